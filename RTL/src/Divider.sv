@@ -1,6 +1,6 @@
 module Divider_Module (
   input  logic [3:0]  ky,
-  input  logic [3:0]  ks,
+  input  logic [4:0]  ks,   // leading one of the 32.16 sum, 0..31
   input  logic [15:0] Mux_Result,
   output logic [15:0] Divider_Output
 );
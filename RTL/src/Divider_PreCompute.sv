@@ -1,21 +1,21 @@
 module Divider_PreCompute_Module (
-  input  logic [31:0] input_data,
-  output logic [3:0]  Leading_One_Pos,
+  input  logic [47:0] input_data,       // 32.16 fixed point
+  output logic [4:0]  Leading_One_Pos,  // 0..31
   output logic [15:0] Mux_Result
 );
-  function automatic logic [3:0] find_leading_one_pos(input logic [31:0] input_val);
-    logic [15:0] integer_part;
+  function automatic logic [4:0] find_leading_one_pos(input logic [47:0] input_val);
+    logic [31:0] integer_part;
     int i;
     begin
-      integer_part = input_val[31:16];
+      integer_part = input_val[47:16];
 
-      if (integer_part == 16'h0000) begin
-        find_leading_one_pos = 4'd0;
+      if (integer_part == 32'h0000_0000) begin
+        find_leading_one_pos = 5'd0;
       end else begin
-        find_leading_one_pos = 4'd0;
-        for (i = 15; i >= 0; i = i - 1) begin
+        find_leading_one_pos = 5'd0;
+        for (i = 31; i >= 0; i = i - 1) begin
           if (integer_part[i]) begin
-            find_leading_one_pos = i[3:0];
+            find_leading_one_pos = i[4:0];
             break;
           end
         end
@@ -23,7 +23,7 @@ module Divider_PreCompute_Module (
     end
   endfunction
 
-  logic [3:0] leading_pos;
+  logic [4:0] leading_pos;
   logic is_over_half;
   int bit_pos;
 
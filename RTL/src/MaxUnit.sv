@@ -1,11 +1,10 @@
-module MaxUnit (
-  input  logic        clk,
-  input  logic        rst_n,
-  input  logic [15:0] A,
-  input  logic [15:0] B,
-  input  logic [15:0] C,
-  input  logic [15:0] D,
-  output logic [15:0] Max_Out
+module MaxUnit #(
+  parameter int LANES = sole_pkg::LANES
+) (
+  input  logic                  clk,
+  input  logic                  rst_n,
+  input  logic [16*LANES-1:0]   In,       // lane i in [16*i +: 16]
+  output logic [15:0]           Max_Out
 );
   // Local function: FP16 maximum (from sole_pkg::fp16_max)
   function automatic logic [15:0] fp16_max(input logic [15:0] a, input logic [15:0] b);
@@ -38,25 +37,38 @@ module MaxUnit (
     end
   endfunction
 
-  logic [15:0] r1, r2;
-  logic [15:0] n1, n2;
+  // log2(LANES) fp16_max levels: the first STAGE1_LEVELS in front of the
+  // registers (A vs B and C vs D for 4 lanes), the rest behind them
+  localparam int LEVELS = $clog2(LANES);
+  localparam int STAGE1_LEVELS = (LEVELS + 1) / 2;
+  localparam int REGS = LANES >> STAGE1_LEVELS;
 
-  always @* begin
-    n1 = fp16_max(A, B);
-    n2 = fp16_max(C, D);
+  logic [15:0] r [0:REGS-1];
+  logic [15:0] n [0:REGS-1];
+
+  always @* begin : stage1_tree
+    logic [15:0] level [0:LANES-1];
+    for (int i = 0; i < LANES; i++) level[i] = In[16*i +: 16];
+    for (int w = LANES; w > REGS; w = w / 2) begin
+      for (int i = 0; i < w / 2; i++) level[i] = fp16_max(level[2*i], level[2*i+1]);
+    end
+    for (int i = 0; i < REGS; i++) n[i] = level[i];
   end
 
   always_ff @(posedge clk or negedge rst_n) begin
     if (!rst_n) begin
-      r1 <= 16'h0000;
-      r2 <= 16'h0000;
+      for (int i = 0; i < REGS; i++) r[i] <= 16'h0000;
     end else begin
-      r1 <= n1;
-      r2 <= n2;
+      for (int i = 0; i < REGS; i++) r[i] <= n[i];
     end
   end
 
-  always @* begin
-    Max_Out = fp16_max(r1, r2);
+  always @* begin : stage2_tree
+    logic [15:0] level [0:REGS-1];
+    for (int i = 0; i < REGS; i++) level[i] = r[i];
+    for (int w = REGS; w > 1; w = w / 2) begin
+      for (int i = 0; i < w / 2; i++) level[i] = fp16_max(level[2*i], level[2*i+1]);
+    end
+    Max_Out = level[0];
   end
 endmodule
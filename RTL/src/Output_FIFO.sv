@@ -1,34 +1,37 @@
-module Output_FIFO (
+module Output_FIFO #(
+  parameter int LANES = sole_pkg::LANES
+) (
   input  logic                        clk,
   input  logic                        rst_n,
-  input  logic [15:0]                 data_in,
+  input  logic [4*LANES-1:0]          data_in,
   input  logic                        write_en,
   input  logic                        read_ready,
   output logic                        read_valid,
   input  logic                        clear,
-  output logic [15:0]                 data_out,
+  output logic [4*LANES-1:0]          data_out,
   output logic                        full,
   output logic                        empty,
   output logic [11:0]                 count
 );
-  // Effective FIFO storage is one 16-bit entry per 4 fp16 input values.
-  // For DATA_LENGTH_MAX=4096 inputs, required entries are 4096/4=1024 => ADDR_BITS=10.
-  localparam int FIFO_ADDR_BITS = 10;
+  // Effective FIFO storage is one 4*LANES-bit entry per LANES fp16 input values.
+  // For DATA_LENGTH_MAX=4096 inputs and 4 lanes, required entries are 4096/4=1024 => ADDR_BITS=10.
+  localparam int DATA_BITS = 4 * LANES;
+  localparam int FIFO_ADDR_BITS = $clog2(sole_pkg::DATA_LENGTH_MAX / LANES);
   localparam int FIFO_DEPTH = (1 << FIFO_ADDR_BITS);
 
   logic [FIFO_ADDR_BITS-1:0] wptr;
   logic [FIFO_ADDR_BITS-1:0] rptr;
   logic [11:0] count_reg;
 
-  logic [15:0] sram_rdata;
+  logic [DATA_BITS-1:0] sram_rdata;
   logic        we_sig;
   logic        re_sig;
 
-  logic [15:0] skid_reg;
+  logic [DATA_BITS-1:0] skid_reg;
   logic        skid_valid;
   logic        sram_output_data_valid;
 
-  SRAM #(.ADDR_BITS(FIFO_ADDR_BITS), .DATA_BITS(16)) u_sram (
+  SRAM #(.ADDR_BITS(FIFO_ADDR_BITS), .DATA_BITS(DATA_BITS)) u_sram (
     .clk(clk), .rst_n(rst_n),
     .we(we_sig), .re(re_sig),
     .waddr(wptr), .raddr(rptr),
@@ -91,15 +94,15 @@ module Output_FIFO (
 
   always_ff @(posedge clk or negedge rst_n) begin
     if (!rst_n) begin
-      skid_reg <= 16'd0;
+      skid_reg <= '0;
       skid_valid <= 1'b0;
       sram_output_data_valid <= 1'b0;
     end else if (clear) begin
-      skid_reg <= 16'd0;
+      skid_reg <= '0;
       skid_valid <= 1'b0;
       sram_output_data_valid <= 1'b0;
     end else begin
-      logic [15:0] skid_reg_next;
+      logic [DATA_BITS-1:0] skid_reg_next;
       logic        skid_valid_next;
       logic        consume_skid;
       logic        new_data_valid;
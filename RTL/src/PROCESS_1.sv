@@ -1,143 +1,111 @@
-module PROCESS_1_Module (
-  input  logic        clk,
-  input  logic        rst_n,
-  input  logic        enable,
-  input  logic [63:0] DataIn_64bits,
-  input  logic [15:0] Global_Max,
-  input  logic [31:0] Sum_Buffer_In,
-  input  logic        data_valid,
-  output logic [15:0] Power_of_Two_Vector,
-  output logic [31:0] Sum_Buffer_Update,
-  output logic [15:0] Local_Max_Output,
-  output logic        stage1_valid,
-  output logic        stage5_valid
+module PROCESS_1_Module #(
+  parameter int LANES = sole_pkg::LANES
+) (
+  input  logic                clk,
+  input  logic                rst_n,
+  input  logic                enable,
+  input  logic [16*LANES-1:0] DataIn_64bits,   // one AXI beat, 64 bits for 4 lanes
+  input  logic [15:0]         Global_Max,
+  input  logic [47:0]         Sum_Buffer_In,      // 32.16 fixed point
+  input  logic                data_valid,
+  output logic [4*LANES-1:0]  Power_of_Two_Vector,
+  output logic [47:0]         Sum_Buffer_Update,
+  output logic [15:0]         Local_Max_Output,
+  output logic                stage1_valid,
+  output logic                stage5_valid
 );
   import utils_pkg::*;
 
   // ---------------- Internal module connections ----------------
-  logic [15:0] datain_unpacked [0:3];
+  // Lanes 0..LANES-1 are the beat, index LANES is the local-max rescale
   logic [15:0] max_out_comb;
-  logic [15:0] reduction_in;
+  logic [4*LANES-1:0] reduction_in;
   logic [31:0] reduction_output;
-  logic [15:0] log2exp_in [0:5-1];
-  logic [3:0]  log2exp_out [0:5-1];
+  logic [15:0] log2exp_in [0:LANES];
+  logic [3:0]  log2exp_out [0:LANES];
 
   // ---------------- Pipeline stage registers ----------------
-  logic [15:0] stage1_datain_reg [0:3];
+  logic [15:0] stage1_datain_reg [0:LANES-1];
   logic        stage1_valid_reg;
 
-  logic [15:0] stage2_datain_reg [0:3];
+  logic [15:0] stage2_datain_reg [0:LANES-1];
   logic [15:0] stage2_max_reg;
   logic        stage2_valid_reg;
 
-  logic [15:0] stage3_diff_reg [0:4];
+  logic [15:0] stage3_diff_reg [0:LANES];
   logic        stage3_valid_reg;
 
-  logic [3:0]  stage4_power_reg [0:4];
+  logic [3:0]  stage4_power_reg [0:LANES];
   logic        stage4_valid_reg;
 
-  logic [15:0] stage5_pow_vec_reg;
+  logic [4*LANES-1:0] stage5_pow_vec_reg;
   logic [3:0]  stage5_shift_reg;
   logic        stage5_valid_reg;
 
   // ---------------- Pipeline next-state signals ----------------
-  logic [15:0] stage1_datain_next [0:3];
+  logic [15:0] stage1_datain_next [0:LANES-1];
   logic        stage1_valid_next;
 
-  logic [15:0] stage2_datain_next [0:3];
+  logic [15:0] stage2_datain_next [0:LANES-1];
   logic [15:0] stage2_max_next;
   logic        stage2_valid_next;
 
-  logic [15:0] stage3_diff_next [0:4];
+  logic [15:0] stage3_diff_next [0:LANES];
   logic        stage3_valid_next;
 
-  logic [3:0]  stage4_power_next [0:4];
+  logic [3:0]  stage4_power_next [0:LANES];
   logic        stage4_valid_next;
 
-  logic [15:0] stage5_pow_vec_next;
+  logic [4*LANES-1:0] stage5_pow_vec_next;
   logic [3:0]  stage5_shift_next;
   logic        stage5_valid_next;
 
-  logic [31:0] shifted_value;
-  logic [31:0] final_result;
+  logic [47:0] shifted_value;
+  logic [47:0] final_result;
 
 `ifdef SYNTHESIS
-  logic [15:0] stage3_diff_dw [0:4];
-  logic [7:0]  stage3_diff_status [0:4];
+  logic [15:0] stage3_diff_dw [0:LANES];
+  logic [7:0]  stage3_diff_status [0:LANES];
 
-  DW_fp_add #(
-    .sig_width       (10),
-    .exp_width       (5),
-    .ieee_compliance (0)
-  ) u_fp_sub_0 (
-    .a      (stage2_datain_reg[0]),
-    .b      ({~stage2_max_reg[15], stage2_max_reg[14:0]}),
-    .rnd    (3'b000),
-    .z      (stage3_diff_dw[0]),
-    .status (stage3_diff_status[0])
-  );
-
-  DW_fp_add #(
-    .sig_width       (10),
-    .exp_width       (5),
-    .ieee_compliance (0)
-  ) u_fp_sub_1 (
-    .a      (stage2_datain_reg[1]),
-    .b      ({~stage2_max_reg[15], stage2_max_reg[14:0]}),
-    .rnd    (3'b000),
-    .z      (stage3_diff_dw[1]),
-    .status (stage3_diff_status[1])
-  );
-
-  DW_fp_add #(
-    .sig_width       (10),
-    .exp_width       (5),
-    .ieee_compliance (0)
-  ) u_fp_sub_2 (
-    .a      (stage2_datain_reg[2]),
-    .b      ({~stage2_max_reg[15], stage2_max_reg[14:0]}),
-    .rnd    (3'b000),
-    .z      (stage3_diff_dw[2]),
-    .status (stage3_diff_status[2])
-  );
-
-  DW_fp_add #(
-    .sig_width       (10),
-    .exp_width       (5),
-    .ieee_compliance (0)
-  ) u_fp_sub_3 (
-    .a      (stage2_datain_reg[3]),
-    .b      ({~stage2_max_reg[15], stage2_max_reg[14:0]}),
-    .rnd    (3'b000),
-    .z      (stage3_diff_dw[3]),
-    .status (stage3_diff_status[3])
-  );
+  genvar si;
+  generate
+    for (si = 0; si < LANES; si++) begin : GEN_FP_SUB
+      DW_fp_add #(
+        .sig_width       (10),
+        .exp_width       (5),
+        .ieee_compliance (0)
+      ) u_fp_sub (
+        .a      (stage2_datain_reg[si]),
+        .b      ({~stage2_max_reg[15], stage2_max_reg[14:0]}),
+        .rnd    (3'b000),
+        .z      (stage3_diff_dw[si]),
+        .status (stage3_diff_status[si])
+      );
+    end
+  endgenerate
 
   DW_fp_add #(
     .sig_width       (10),
     .exp_width       (5),
     .ieee_compliance (0)
-  ) u_fp_sub_4 (
+  ) u_fp_sub_max (
     .a      (stage2_max_reg),
     .b      ({~Global_Max[15], Global_Max[14:0]}),
     .rnd    (3'b000),
-    .z      (stage3_diff_dw[4]),
-    .status (stage3_diff_status[4])
+    .z      (stage3_diff_dw[LANES]),
+    .status (stage3_diff_status[LANES])
   );
 `endif
 
   // ---------------- Submodule instantiations ----------------
-  MaxUnit u_max_unit (
+  MaxUnit #(.LANES(LANES)) u_max_unit (
     .clk(clk),
     .rst_n(rst_n),
-    .A(datain_unpacked[0]),
-    .B(datain_unpacked[1]),
-    .C(datain_unpacked[2]),
-    .D(datain_unpacked[3]),
+    .In(DataIn_64bits),
     .Max_Out(max_out_comb)
   );
 
-  Reduction_Module u_reduction_unit (
+  Reduction_Module #(.LANES(LANES)) u_reduction_unit (
     .clk(clk),
     .rst_n(rst_n),
     .Input_Vector(reduction_in),
@@ -146,7 +114,7 @@ module PROCESS_1_Module (
 
   genvar gi;
   generate
-    for (gi = 0; gi < 5; gi++) begin : GEN_LOG2EXP
+    for (gi = 0; gi <= LANES; gi++) begin : GEN_LOG2EXP
       Log2Exp u_log2exp (
         .fp16_in(log2exp_in[gi]),
         .result_out(log2exp_out[gi])
@@ -156,24 +124,13 @@ module PROCESS_1_Module (
 
   // ---------------- Stage 1 combinational ----------------
   always_comb begin
-    stage1_datain_next[0] = DataIn_64bits[15:0];
-    stage1_datain_next[1] = DataIn_64bits[31:16];
-    stage1_datain_next[2] = DataIn_64bits[47:32];
-    stage1_datain_next[3] = DataIn_64bits[63:48];
+    for (int i = 0; i < LANES; i++) stage1_datain_next[i] = DataIn_64bits[16*i +: 16];
     stage1_valid_next = data_valid;
-
-    datain_unpacked[0] = stage1_datain_next[0];
-    datain_unpacked[1] = stage1_datain_next[1];
-    datain_unpacked[2] = stage1_datain_next[2];
-    datain_unpacked[3] = stage1_datain_next[3];
   end
 
   // ---------------- Stage 2 combinational ----------------
   always_comb begin
-    stage2_datain_next[0] = stage1_datain_reg[0];
-    stage2_datain_next[1] = stage1_datain_reg[1];
-    stage2_datain_next[2] = stage1_datain_reg[2];
-    stage2_datain_next[3] = stage1_datain_reg[3];
+    for (int i = 0; i < LANES; i++) stage2_datain_next[i] = stage1_datain_reg[i];
     stage2_max_next = max_out_comb;
     stage2_valid_next = stage1_valid_reg;
 
@@ -184,46 +141,27 @@ module PROCESS_1_Module (
   // ---------------- Stage 3 combinational ----------------
   always_comb begin
 `ifdef SYNTHESIS
-    stage3_diff_next[0] = stage3_diff_dw[0];
-    stage3_diff_next[1] = stage3_diff_dw[1];
-    stage3_diff_next[2] = stage3_diff_dw[2];
-    stage3_diff_next[3] = stage3_diff_dw[3];
-    stage3_diff_next[4] = stage3_diff_dw[4];
+    for (int i = 0; i <= LANES; i++) stage3_diff_next[i] = stage3_diff_dw[i];
 `else
-    stage3_diff_next[0] = fp16_subtract(stage2_datain_reg[0], stage2_max_reg);
-    stage3_diff_next[1] = fp16_subtract(stage2_datain_reg[1], stage2_max_reg);
-    stage3_diff_next[2] = fp16_subtract(stage2_datain_reg[2], stage2_max_reg);
-    stage3_diff_next[3] = fp16_subtract(stage2_datain_reg[3], stage2_max_reg);
-    stage3_diff_next[4] = fp16_subtract(stage2_max_reg, Global_Max);
+    for (int i = 0; i < LANES; i++) stage3_diff_next[i] = fp16_subtract(stage2_datain_reg[i], stage2_max_reg);
+    stage3_diff_next[LANES] = fp16_subtract(stage2_max_reg, Global_Max);
 `endif
     stage3_valid_next = stage2_valid_reg;
   end
 
   // ---------------- Stage 4 combinational ----------------
   always_comb begin
-    log2exp_in[0] = stage3_diff_reg[0];
-    log2exp_in[1] = stage3_diff_reg[1];
-    log2exp_in[2] = stage3_diff_reg[2];
-    log2exp_in[3] = stage3_diff_reg[3];
-    log2exp_in[4] = stage3_diff_reg[4];
-
-    stage4_power_next[0] = log2exp_out[0];
-    stage4_power_next[1] = log2exp_out[1];
-    stage4_power_next[2] = log2exp_out[2];
-    stage4_power_next[3] = log2exp_out[3];
-    stage4_power_next[4] = log2exp_out[4];
+    for (int i = 0; i <= LANES; i++) begin
+      log2exp_in[i] = stage3_diff_reg[i];
+      stage4_power_next[i] = log2exp_out[i];
+    end
     stage4_valid_next = stage3_valid_reg;
   end
 
   // ---------------- Stage 5 combinational ----------------
   always_comb begin
-    stage5_pow_vec_next = {
-      stage4_power_reg[3],
-      stage4_power_reg[2],
-      stage4_power_reg[1],
-      stage4_power_reg[0]
-    };
-    stage5_shift_next = stage4_power_reg[4];
+    for (int i = 0; i < LANES; i++) stage5_pow_vec_next[4*i +: 4] = stage4_power_reg[i];
+    stage5_shift_next = stage4_power_reg[LANES];
     stage5_valid_next = stage4_valid_reg;
 
     reduction_in = stage5_pow_vec_next;
@@ -232,62 +170,34 @@ module PROCESS_1_Module (
   // ---------------- Sequential pipeline update ----------------
   always_ff @(posedge clk or negedge rst_n) begin
     if (!rst_n) begin
-      stage1_datain_reg[0] <= 16'd0;
-      stage1_datain_reg[1] <= 16'd0;
-      stage1_datain_reg[2] <= 16'd0;
-      stage1_datain_reg[3] <= 16'd0;
+      for (int i = 0; i < LANES; i++) stage1_datain_reg[i] <= 16'd0;
       stage1_valid_reg <= 1'b0;
 
-      stage2_datain_reg[0] <= 16'd0;
-      stage2_datain_reg[1] <= 16'd0;
-      stage2_datain_reg[2] <= 16'd0;
-      stage2_datain_reg[3] <= 16'd0;
+      for (int i = 0; i < LANES; i++) stage2_datain_reg[i] <= 16'd0;
       stage2_max_reg <= 16'd0;
       stage2_valid_reg <= 1'b0;
 
-      stage3_diff_reg[0] <= 16'd0;
-      stage3_diff_reg[1] <= 16'd0;
-      stage3_diff_reg[2] <= 16'd0;
-      stage3_diff_reg[3] <= 16'd0;
-      stage3_diff_reg[4] <= 16'd0;
+      for (int i = 0; i <= LANES; i++) stage3_diff_reg[i] <= 16'd0;
       stage3_valid_reg <= 1'b0;
 
-      stage4_power_reg[0] <= 4'd0;
-      stage4_power_reg[1] <= 4'd0;
-      stage4_power_reg[2] <= 4'd0;
-      stage4_power_reg[3] <= 4'd0;
-      stage4_power_reg[4] <= 4'd0;
+      for (int i = 0; i <= LANES; i++) stage4_power_reg[i] <= 4'd0;
       stage4_valid_reg <= 1'b0;
 
-      stage5_pow_vec_reg <= 16'd0;
+      stage5_pow_vec_reg <= '0;
       stage5_shift_reg <= 4'd0;
       stage5_valid_reg <= 1'b0;
     end else if (enable) begin
-      stage1_datain_reg[0] <= stage1_datain_next[0];
-      stage1_datain_reg[1] <= stage1_datain_next[1];
-      stage1_datain_reg[2] <= stage1_datain_next[2];
-      stage1_datain_reg[3] <= stage1_datain_next[3];
+      for (int i = 0; i < LANES; i++) stage1_datain_reg[i] <= stage1_datain_next[i];
       stage1_valid_reg <= stage1_valid_next;
 
-      stage2_datain_reg[0] <= stage2_datain_next[0];
-      stage2_datain_reg[1] <= stage2_datain_next[1];
-      stage2_datain_reg[2] <= stage2_datain_next[2];
-      stage2_datain_reg[3] <= stage2_datain_next[3];
+      for (int i = 0; i < LANES; i++) stage2_datain_reg[i] <= stage2_datain_next[i];
       stage2_max_reg <= stage2_max_next;
       stage2_valid_reg <= stage2_valid_next;
 
-      stage3_diff_reg[0] <= stage3_diff_next[0];
-      stage3_diff_reg[1] <= stage3_diff_next[1];
-      stage3_diff_reg[2] <= stage3_diff_next[2];
-      stage3_diff_reg[3] <= stage3_diff_next[3];
-      stage3_diff_reg[4] <= stage3_diff_next[4];
+      for (int i = 0; i <= LANES; i++) stage3_diff_reg[i] <= stage3_diff_next[i];
       stage3_valid_reg <= stage3_valid_next;
 
-      stage4_power_reg[0] <= stage4_power_next[0];
-      stage4_power_reg[1] <= stage4_power_next[1];
-      stage4_power_reg[2] <= stage4_power_next[2];
-      stage4_power_reg[3] <= stage4_power_next[3];
-      stage4_power_reg[4] <= stage4_power_next[4];
+      for (int i = 0; i <= LANES; i++) stage4_power_reg[i] <= stage4_power_next[i];
       stage4_valid_reg <= stage4_valid_next;
 
       stage5_pow_vec_reg <= stage5_pow_vec_next;
@@ -300,7 +210,7 @@ module PROCESS_1_Module (
   always_comb begin
     Power_of_Two_Vector = stage5_pow_vec_reg;
     shifted_value = Sum_Buffer_In >> stage5_shift_reg;
-    final_result = shifted_value + reduction_output;
+    final_result = shifted_value + {16'd0, reduction_output};
     Sum_Buffer_Update = final_result;
     stage5_valid = stage5_valid_reg;
   end
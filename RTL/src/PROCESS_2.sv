@@ -3,11 +3,13 @@ module PROCESS_2_Module (
   input  logic        rst_n,
   input  logic        enable,
   input  logic        stall_output,
-  input  logic [31:0] Pre_Compute_In,
-  output logic [3:0]  Leading_One_Pos_Out,
-  output logic [15:0] Mux_Result_Out
+  input  logic [47:0] Pre_Compute_In,   // 32.16 Sum_Buffer
+  input  logic        Pre_Compute_Valid,
+  output logic [4:0]  Leading_One_Pos_Out,
+  output logic [15:0] Mux_Result_Out,
+  output logic        Output_Valid
 );
-  logic [3:0]  lo;
+  logic [4:0]  lo;
   logic [15:0] mr;
 
   Divider_PreCompute_Module u_pre (
@@ -18,14 +20,18 @@ module PROCESS_2_Module (
 
   always_ff @(posedge clk or negedge rst_n) begin
     if (!rst_n) begin
-      Leading_One_Pos_Out <= 4'd0;
+      Leading_One_Pos_Out <= 5'd0;
       Mux_Result_Out <= 16'd0;
+      Output_Valid <= 1'b0;
     end else if (enable && !stall_output) begin
       Leading_One_Pos_Out <= lo;
       Mux_Result_Out <= mr;
+      Output_Valid <= Pre_Compute_Valid;
     end else begin
       Leading_One_Pos_Out <= Leading_One_Pos_Out;
       Mux_Result_Out <= Mux_Result_Out;
+      // SystemC: input not final clears valid, a hold keeps it
+      Output_Valid <= Output_Valid && Pre_Compute_Valid;
     end
   end
 endmodule
@@ -1,17 +1,21 @@
-module PROCESS_3_Module (
-  input  logic        clk,
-  input  logic        rst_n,
-  input  logic        enable,
-  input  logic        stall,
-  input  logic        input_data_valid,
-  input  logic [15:0] Local_Max,
-  input  logic [15:0] Global_Max,
-  input  logic [3:0]  ks_In,
-  input  logic [15:0] Mux_Result_In,
-  input  logic [15:0] Output_Buffer_In,
-  output logic [63:0] Output_Vector,
-  output logic        stage2_valid,
-  output logic        stage4_valid
+module PROCESS_3_Module #(
+  parameter int LANES = sole_pkg::LANES
+) (
+  input  logic                clk,
+  input  logic                rst_n,
+  input  logic                enable,
+  input  logic                flush,   // drop the pipeline contents (row end)
+  input  logic                stall,
+  input  logic                input_data_valid,
+  input  logic [15:0]         Local_Max,
+  input  logic [15:0]         Global_Max,
+  input  logic [4:0]          ks_In,
+  input  logic [15:0]         Mux_Result_In,
+  input  logic [4*LANES-1:0]  Output_Buffer_In,
+  output logic [16*LANES-1:0] Output_Vector,
+  output logic                stage2_valid,
+  output logic                stage3_valid,   // next beat into stage4 (AXI WVALID)
+  output logic                stage4_valid
 );
   import utils_pkg::*;
 
@@ -23,11 +27,11 @@ module PROCESS_3_Module (
   logic        stage2_valid_reg;
 
   logic [15:0] stage3_mux_reg;
-  logic [3:0]  stage3_ks_reg;
-  logic [3:0]  stage3_ky_reg [0:3];
+  logic [4:0]  stage3_ks_reg;
+  logic [3:0]  stage3_ky_reg [0:LANES-1];
   logic        stage3_valid_reg;
 
-  logic [63:0] stage4_out_reg;
+  logic [16*LANES-1:0] stage4_out_reg;
   logic        stage4_valid_reg;
 
   // ---------- Next-state ----------
@@ -38,14 +42,14 @@ module PROCESS_3_Module (
   logic        stage2_valid_next;
 
   logic [15:0] stage3_mux_next;
-  logic [3:0]  stage3_ks_next;
-  logic [3:0]  stage3_ky_next [0:3];
+  logic [4:0]  stage3_ks_next;
+  logic [3:0]  stage3_ky_next [0:LANES-1];
   logic        stage3_valid_next;
 
-  logic [63:0] stage4_out_next;
+  logic [16*LANES-1:0] stage4_out_next;
   logic        stage4_valid_next;
 
-  logic [15:0] divider_out [0:3];
+  logic [15:0] divider_out [0:LANES-1];
   logic [3:0]  log2exp_out;
 
 `ifdef SYNTHESIS
@@ -73,7 +77,7 @@ module PROCESS_3_Module (
 
   genvar di;
   generate
-    for (di = 0; di < 4; di++) begin : GEN_DIV
+    for (di = 0; di < LANES; di++) begin : GEN_DIV
       Divider_Module u_div (
         .ky(stage3_ky_reg[di]),
         .ks(stage3_ks_reg),
@@ -107,16 +111,16 @@ module PROCESS_3_Module (
     stage3_ks_next = ks_In;
     stage3_valid_next = stage2_valid_reg;
 
-    for (i = 0; i < 4; i++) begin
+    for (i = 0; i < LANES; i++) begin
       ky_sum = {1'b0, stage2_power_reg} + {1'b0, Output_Buffer_In[i*4 +: 4]};
       if (ky_sum > 5'd15) stage3_ky_next[i] = 4'd15;
       else stage3_ky_next[i] = ky_sum[3:0];
     end
   end
 
-  // Stage4_Comb: pack 4 divider outputs
+  // Stage4_Comb: pack the divider outputs, lane i in [16*i +: 16]
   always_comb begin
-    stage4_out_next = {divider_out[3], divider_out[2], divider_out[1], divider_out[0]};
+    for (int l = 0; l < LANES; l++) stage4_out_next[16*l +: 16] = divider_out[l];
     stage4_valid_next = stage3_valid_reg;
   end
 
@@ -128,13 +132,16 @@ module PROCESS_3_Module (
       stage2_power_reg <= 4'd0;
       stage2_valid_reg <= 1'b0;
       stage3_mux_reg <= 16'd0;
-      stage3_ks_reg <= 4'd0;
-      stage3_ky_reg[0] <= 4'd0;
-      stage3_ky_reg[1] <= 4'd0;
-      stage3_ky_reg[2] <= 4'd0;
-      stage3_ky_reg[3] <= 4'd0;
+      stage3_ks_reg <= 5'd0;
+      for (int l = 0; l < LANES; l++) stage3_ky_reg[l] <= 4'd0;
+      stage3_valid_reg <= 1'b0;
+      stage4_out_reg <= '0;
+      stage4_valid_reg <= 1'b0;
+    end else if (flush) begin
+      // Tail beats popped after the last output beat of the row
+      stage1_valid_reg <= 1'b0;
+      stage2_valid_reg <= 1'b0;
       stage3_valid_reg <= 1'b0;
-      stage4_out_reg <= 64'd0;
       stage4_valid_reg <= 1'b0;
     end else if (!enable) begin
       // hold
@@ -147,10 +154,7 @@ module PROCESS_3_Module (
       stage2_valid_reg <= stage2_valid_next;
       stage3_mux_reg <= stage3_mux_next;
       stage3_ks_reg <= stage3_ks_next;
-      stage3_ky_reg[0] <= stage3_ky_next[0];
-      stage3_ky_reg[1] <= stage3_ky_next[1];
-      stage3_ky_reg[2] <= stage3_ky_next[2];
-      stage3_ky_reg[3] <= stage3_ky_next[3];
+      for (int l = 0; l < LANES; l++) stage3_ky_reg[l] <= stage3_ky_next[l];
       stage3_valid_reg <= stage3_valid_next;
       stage4_out_reg <= stage4_out_next;
       stage4_valid_reg <= stage4_valid_next;
@@ -161,6 +165,7 @@ module PROCESS_3_Module (
   always_comb begin
     Output_Vector = stage4_out_reg;
     stage2_valid = stage2_valid_reg;
+    stage3_valid = stage3_valid_reg;
     stage4_valid = stage4_valid_reg;
   end
 endmodule
@@ -1,23 +1,30 @@
-module Reduction_Module (
-  input  logic        clk,
-  input  logic        rst_n,
-  input  logic [15:0] Input_Vector,
-  output logic [31:0] Output_Sum
+module Reduction_Module #(
+  parameter int LANES = sole_pkg::LANES
+) (
+  input  logic                 clk,
+  input  logic                 rst_n,
+  input  logic [4*LANES-1:0]   Input_Vector,
+  output logic [31:0]          Output_Sum
 );
-  logic [31:0] e0, e1, e2, e3;
-  logic [31:0] s0, s1;
+  // 2^-x per lane, then a log2(LANES)-level adder tree into one register.
+  // 16 lanes of 2^0 sum to 16.0, so 16.16 fits every lane count.
+  logic [31:0] e [0:LANES-1];
+  logic [31:0] sum;
 
-  always @* begin
-    e0 = 32'd65536 >> Input_Vector[3:0];
-    e1 = 32'd65536 >> Input_Vector[7:4];
-    e2 = 32'd65536 >> Input_Vector[11:8];
-    e3 = 32'd65536 >> Input_Vector[15:12];
-    s0 = e0 + e1;
-    s1 = e2 + e3;
+  always @* begin : adder_tree
+    logic [31:0] level [0:LANES-1];
+    for (int i = 0; i < LANES; i++) begin
+      e[i] = 32'd65536 >> Input_Vector[4*i +: 4];
+      level[i] = e[i];
+    end
+    for (int w = LANES; w > 1; w = w / 2) begin
+      for (int i = 0; i < w / 2; i++) level[i] = level[2*i] + level[2*i+1];
+    end
+    sum = level[0];
   end
 
   always_ff @(posedge clk or negedge rst_n) begin
     if (!rst_n) Output_Sum <= 32'd0;
-    else Output_Sum <= s0 + s1;
+    else Output_Sum <= sum;
   end
 endmodule
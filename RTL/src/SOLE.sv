@@ -1,4 +1,6 @@
-module SOLE (
+module SOLE #(
+  parameter int LANES = sole_pkg::LANES   // FP16 lanes per AXI beat (4 / 8 / 16)
+) (
   input  logic                           clk,
   input  logic                           rst_n,
   input  logic [31:0]                    proc_addr,
@@ -7,27 +9,36 @@ module SOLE (
   output logic [31:0]                    proc_rdata,
   output logic                           interrupt,
   output logic [31:0]                    M_AXI_AWADDR,
+  output logic [7:0]                     M_AXI_AWLEN,
+  output logic [2:0]                     M_AXI_AWSIZE,
+  output logic [1:0]                     M_AXI_AWBURST,
   output logic                           M_AXI_AWVALID,
   input  logic                           M_AXI_AWREADY,
-  output logic [63:0]                    M_AXI_WDATA,
-  output logic [7:0]                     M_AXI_WSTRB,
+  output logic [16*LANES-1:0]            M_AXI_WDATA,
+  output logic [2*LANES-1:0]             M_AXI_WSTRB,
+  output logic                           M_AXI_WLAST,
   output logic                           M_AXI_WVALID,
   input  logic                           M_AXI_WREADY,
   input  logic [1:0]                     M_AXI_BRESP,
   input  logic                           M_AXI_BVALID,
   output logic                           M_AXI_BREADY,
+  output logic [5:0]                     M_AXI_ARID,
   output logic [31:0]                    M_AXI_ARADDR,
+  output logic [7:0]                     M_AXI_ARLEN,
+  output logic [2:0]                     M_AXI_ARSIZE,
+  output logic [1:0]                     M_AXI_ARBURST,
   output logic                           M_AXI_ARVALID,
   input  logic                           M_AXI_ARREADY,
-  input  logic [63:0]                    M_AXI_RDATA,
+  input  logic [5:0]                     M_AXI_RID,
+  input  logic [16*LANES-1:0]            M_AXI_RDATA,
   input  logic [1:0]                     M_AXI_RRESP,
   input  logic                           M_AXI_RVALID,
   output logic                           M_AXI_RREADY
 );
   // Local parameter definitions (from sole_pkg)
   localparam int AXI_ADDR_WIDTH = 32;
-  localparam int AXI_DATA_WIDTH = 64;
-  localparam int AXI_STRB_WIDTH = 8;
+  localparam int AXI_DATA_WIDTH = 16 * LANES;
+  localparam int AXI_STRB_WIDTH = AXI_DATA_WIDTH / 8;
   
   localparam logic [7:0] REG_CONTROL         = 8'h00;
   localparam logic [7:0] REG_STATUS          = 8'h04;
@@ -39,6 +50,11 @@ module SOLE (
   localparam logic [7:0] REG_LENGTH_H        = 8'h1C;
 
   localparam int CTRL_START_BIT = 0;
+  localparam int CTRL_BURST_LEN_LSB = 8;
+  localparam int CTRL_BURST_LEN_MSB = 15;
+  localparam int CTRL_READ_OUTSTANDING_LSB = 16;
+  localparam int CTRL_READ_OUTSTANDING_MSB = 23;
+  localparam int CTRL_REREAD_BIT = 24;
   localparam int CTRL_MODE_BIT = 31;
 
   logic [31:0] reg_control;
@@ -50,38 +66,57 @@ module SOLE (
   logic [31:0] reg_length_l;
   logic [31:0] reg_length_h;
 
-  logic [31:0] softmax_status;
+  logic [31:0] softmax_status /*verilator public_flat_rd*/;  // read by tb/SOLE_cosim_tb.cpp
   logic softmax_start;
   logic [63:0] src_addr_base;
   logic [63:0] dst_addr_base;
   logic [63:0] data_length;
+  logic [7:0]  burst_len;
+  logic [7:0]  read_outstanding;
+  logic        reread;
 
   assign src_addr_base = {reg_src_addr_base_h, reg_src_addr_base_l};
   assign dst_addr_base = {reg_dst_addr_base_h, reg_dst_addr_base_l};
   assign data_length = {reg_length_h, reg_length_l};
+  assign burst_len = reg_control[CTRL_BURST_LEN_MSB:CTRL_BURST_LEN_LSB];
+  assign read_outstanding = reg_control[CTRL_READ_OUTSTANDING_MSB:CTRL_READ_OUTSTANDING_LSB];
+  // Two-pass re-read mode (always on above DATA_LENGTH_MAX)
+  assign reread = reg_control[CTRL_REREAD_BIT];
   assign softmax_start = reg_control[CTRL_START_BIT] && !reg_control[CTRL_MODE_BIT];
 
-  Softmax u_softmax (
+  Softmax #(.LANES(LANES)) u_softmax (
     .clk(clk),
     .rst_n(rst_n),
     .start(softmax_start),
     .src_addr_base(src_addr_base),
     .dst_addr_base(dst_addr_base),
     .data_length(data_length),
+    .burst_len(burst_len),
+    .read_outstanding(read_outstanding),
+    .reread(reread),
     .status_o(softmax_status),
     .M_AXI_AWADDR(M_AXI_AWADDR),
+    .M_AXI_AWLEN(M_AXI_AWLEN),
+    .M_AXI_AWSIZE(M_AXI_AWSIZE),
+    .M_AXI_AWBURST(M_AXI_AWBURST),
     .M_AXI_AWVALID(M_AXI_AWVALID),
     .M_AXI_AWREADY(M_AXI_AWREADY),
     .M_AXI_WDATA(M_AXI_WDATA),
     .M_AXI_WSTRB(M_AXI_WSTRB),
+    .M_AXI_WLAST(M_AXI_WLAST),
     .M_AXI_WVALID(M_AXI_WVALID),
     .M_AXI_WREADY(M_AXI_WREADY),
     .M_AXI_BRESP(M_AXI_BRESP),
     .M_AXI_BVALID(M_AXI_BVALID),
     .M_AXI_BREADY(M_AXI_BREADY),
+    .M_AXI_ARID(M_AXI_ARID),
     .M_AXI_ARADDR(M_AXI_ARADDR),
+    .M_AXI_ARLEN(M_AXI_ARLEN),
+    .M_AXI_ARSIZE(M_AXI_ARSIZE),
+    .M_AXI_ARBURST(M_AXI_ARBURST),
     .M_AXI_ARVALID(M_AXI_ARVALID),
     .M_AXI_ARREADY(M_AXI_ARREADY),
+    .M_AXI_RID(M_AXI_RID),
     .M_AXI_RDATA(M_AXI_RDATA),
     .M_AXI_RRESP(M_AXI_RRESP),
     .M_AXI_RVALID(M_AXI_RVALID),
@@ -142,6 +142,9 @@ module SRAM #(
     end
   end
 
+`ifndef SRAM_BEHAVIORAL
+  // Macro instances for synthesis / VCS; +define+SRAM_BEHAVIORAL (Verilator
+  // build) leaves them out, rdata only ever comes from row_shadow.
   generate
     genvar gi;
     for (gi = 0; gi < NUM_MACROS; gi++) begin : gen_sram_macro
@@ -162,6 +165,7 @@ module SRAM #(
       );
     end
   endgenerate
+`endif
 
   assign rdata = rdata_reg;
 endmodule
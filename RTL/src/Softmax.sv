@@ -1,32 +1,63 @@
-module Softmax (
+module Softmax #(
+  parameter int LANES = sole_pkg::LANES
+) (
   input  logic        clk,
   input  logic        rst_n,
   input  logic        start,
   input  logic [63:0] src_addr_base,
   input  logic [63:0] dst_addr_base,
   input  logic [63:0] data_length,
+  input  logic [7:0]  burst_len,
+  input  logic [7:0]  read_outstanding,
+  input  logic        reread,             // force the two-pass re-read mode (CONTROL[24])
   output logic [31:0] status_o,
   output logic [31:0] M_AXI_AWADDR,
+  output logic [7:0]  M_AXI_AWLEN,
+  output logic [2:0]  M_AXI_AWSIZE,
+  output logic [1:0]  M_AXI_AWBURST,
   output logic        M_AXI_AWVALID,
   input  logic        M_AXI_AWREADY,
-  output logic [63:0] M_AXI_WDATA,
-  output logic [7:0]  M_AXI_WSTRB,
+  output logic [16*LANES-1:0] M_AXI_WDATA,
+  output logic [2*LANES-1:0]  M_AXI_WSTRB,
+  output logic        M_AXI_WLAST,
   output logic        M_AXI_WVALID,
   input  logic        M_AXI_WREADY,
   input  logic [1:0]  M_AXI_BRESP,
   input  logic        M_AXI_BVALID,
   output logic        M_AXI_BREADY,
+  output logic [5:0]  M_AXI_ARID,
   output logic [31:0] M_AXI_ARADDR,
+  output logic [7:0]  M_AXI_ARLEN,
+  output logic [2:0]  M_AXI_ARSIZE,
+  output logic [1:0]  M_AXI_ARBURST,
   output logic        M_AXI_ARVALID,
   input  logic        M_AXI_ARREADY,
-  input  logic [63:0] M_AXI_RDATA,
+  input  logic [5:0]  M_AXI_RID,
+  input  logic [16*LANES-1:0] M_AXI_RDATA,
   input  logic [1:0]  M_AXI_RRESP,
   input  logic        M_AXI_RVALID,
   output logic        M_AXI_RREADY
 );
-  localparam int DATA_LENGTH_MAX = 4096;
+  localparam int DATA_LENGTH_MAX = sole_pkg::DATA_LENGTH_MAX;
+  localparam logic [63:0] DATA_LENGTH_REREAD_MAX = sole_pkg::DATA_LENGTH_REREAD_MAX;
   localparam int AXI_TIMEOUT_THRESHOLD = 100;
   localparam logic [1:0] AXI_RESP_OKAY = 2'b00;
+  localparam int LANE_LOG2 = $clog2(LANES);
+  localparam logic [31:0] BEAT_ELEMS = 32'(LANES);        // fp16 values per beat
+  localparam logic [31:0] BEAT_BYTES = 32'(2 * LANES);    // 8 / 16 / 32 bytes per beat
+  localparam logic [2:0] AXI_SIZE_BEAT = 3'(LANE_LOG2 + 1);
+  localparam logic [1:0] AXI_BURST_INCR = 2'd1;
+  localparam int READ_MAX_OUTSTANDING = 64;        // 2^ARID width
+  localparam int READ_ROB_DEPTH = sole_pkg::READ_ROB_DEPTH;   // reorder buffer beats
+  localparam int ROB_ADDR_BITS = $clog2(READ_ROB_DEPTH);
+  localparam int ROB_BURST_CAP = (READ_ROB_DEPTH < 256) ? READ_ROB_DEPTH : 256;
+  localparam int WRITE_MAX_OUTSTANDING = 16;       // AW bursts awaiting a B
+  localparam int WRITE_BURST_PTR_W = $clog2(WRITE_MAX_OUTSTANDING);
+  // Re-read pass: beats requested ahead of PROCESS3 (fits the reorder buffer and both FIFOs)
+  localparam int MAX_FIFO_DEPTH = 1024;
+  localparam int OUTPUT_FIFO_DEPTH = DATA_LENGTH_MAX / LANES;
+  localparam int REREAD_WINDOW_FIFO = ((MAX_FIFO_DEPTH < OUTPUT_FIFO_DEPTH) ? MAX_FIFO_DEPTH : OUTPUT_FIFO_DEPTH) - 4;
+  localparam int REREAD_WINDOW_BEATS = (READ_ROB_DEPTH < REREAD_WINDOW_FIFO) ? READ_ROB_DEPTH : REREAD_WINDOW_FIFO;
 
   localparam logic [1:0] STATE_IDLE     = 2'd0;
   localparam logic [1:0] STATE_PROCESS1 = 2'd1;
@@ -47,6 +78,8 @@ module Softmax (
 
   // Internal status/state
   logic [1:0] state;
+  logic       reread_mode;   // this job re-reads the input in PROCESS3 (latched at START)
+  logic       read_pass;     // read channel in use: PROCESS1, or PROCESS3 in re-read mode
   logic [3:0] error_code;
   logic       has_error;
   logic       done_pulse;
@@ -60,27 +93,32 @@ module Softmax (
   logic [15:0] global_max_reg;
   logic [15:0] global_max_for_p1_d1_reg;
   logic [15:0] global_max_for_p1_d2_reg;
-  logic [31:0] sum_buffer_reg;
+  logic [47:0] sum_buffer_reg;     // 32.16 fixed point
+  logic [31:0] sum_update_num;     // beats accumulated into sum_buffer_reg in this job
 
   // Process interconnect signals
   logic [15:0] Global_Max_Buffer_In;
-  logic [15:0] Power_of_Two_Vector_Signal;
-  logic [31:0] Sum_Buffer_In;
-  logic [3:0]  Leading_One_Pos_Out_Signal;
+  logic [4*LANES-1:0] Power_of_Two_Vector_Signal;
+  logic [47:0] Sum_Buffer_In;
+  logic [4:0]  Leading_One_Pos_Out_Signal;
   logic [15:0] Mux_Result_Out_Signal;
   logic [15:0] Local_Max_Signal;
-  logic [15:0] Output_Buffer_In_Signal;
-  logic [63:0] Process3_Output_Vector;
+  logic [4*LANES-1:0] Output_Buffer_In_Signal;
+  logic [16*LANES-1:0] Process3_Output_Vector;
 
   // Valid/stall signals
   logic process1_read_data_valid;
+  logic [16*LANES-1:0] process1_read_data;
   logic process1_stage1_valid;
   logic process1_stage5_valid;
   logic process3_read_data_valid;
   logic process3_stage2_valid;
+  logic process3_stage3_valid;
   logic process3_stage4_valid;
   logic process3_stall;
   logic stall_process2_output_Signal;
+  logic process2_input_valid_Signal;
+  logic process2_output_valid_Signal;
 
   // FIFO control/status
   logic        max_fifo_write_en;
@@ -102,15 +140,53 @@ module Softmax (
   // AXI counters (SystemC parity)
   logic [31:0] read_addr_sent_num;
   logic [31:0] read_data_received_num;
+  logic [31:0] read_data_delivered_num;  // beats handed to PROCESS_1 in order
   logic [31:0] write_addr_sent_num;
   logic [31:0] write_data_sent_num;
   logic [31:0] write_response_received_num;
-  logic [31:0] write_buf_addr;
-  logic [63:0] write_buf_data;
-  logic        write_buf_valid;
-  logic        write_buf_aw_sent;
-  logic        aw_active;
-  logic        w_active;
+  logic [31:0] write_burst_end;     // beat index after the current W burst
+  logic        write_aw_handshake;
+  logic        write_w_handshake;
+  logic [31:0] write_addr_sent_next;
+  logic [31:0] write_data_sent_next;
+  logic [8:0]  write_aw_beats;
+  logic [31:0] write_burst_end_next;
+  // Beat count of every accepted AW burst, popped by its B (SystemC write_burst_beats)
+  logic [8:0]  write_burst_beats [WRITE_MAX_OUTSTANDING];
+  logic [WRITE_BURST_PTR_W-1:0] write_burst_head;
+  logic [WRITE_BURST_PTR_W:0]   write_burst_count;
+  logic [WRITE_BURST_PTR_W:0]   write_burst_count_next;
+  logic        write_burst_pop;
+  logic [31:0] total_beats;
+  logic [8:0]  max_burst_beats;
+
+  // Outstanding reads: per-ARID tracker and reorder buffer (SystemC axi_read_address_process)
+  logic [31:0] read_txn_issued;
+  logic [31:0] read_txn_retired;
+  // First beat of each burst, modulo twice the reorder buffer: in-flight beats never span more
+  logic [ROB_ADDR_BITS:0] read_txn_start [READ_MAX_OUTSTANDING];
+  logic [8:0]  read_txn_beats    [READ_MAX_OUTSTANDING];
+  logic [8:0]  read_txn_received [READ_MAX_OUTSTANDING];
+  // Reorder buffer: inferred 1R1W memory, registered read of the next in-order beat
+  logic [16*LANES-1:0] rob_data  [READ_ROB_DEPTH];
+  logic [READ_ROB_DEPTH-1:0] rob_valid;
+  logic        rob_we;
+  logic [ROB_ADDR_BITS-1:0] rob_waddr;
+  logic [ROB_ADDR_BITS-1:0] rob_head_next_idx;
+  logic [16*LANES-1:0] rob_head_data;
+  logic [5:0]  read_head_id;
+  logic        read_head_issued;
+  logic [ROB_ADDR_BITS-1:0] rob_head_idx;
+  logic        rob_head_valid;
+  logic        read_bypass;
+  logic [31:0] read_max_txns;
+  logic [8:0]  read_max_beats;
+  logic [8:0]  read_next_beats;
+  logic        read_can_issue;
+  logic        reread_pass;
+  logic [31:0] reread_max_popped_num;     // re-read beats PROCESS3 took from Max_FIFO
+  logic [31:0] reread_output_popped_num;  // re-read beats PROCESS3 took from Output_FIFO
+  logic [31:0] reread_pending;            // popped from Max_FIFO, not yet from Output_FIFO
 
   logic process1_finish_flag;
   logic process3_finish_flag;
@@ -128,15 +204,14 @@ module Softmax (
   logic [31:0] write_timeout_counter;
   logic any_read_handshake;
   logic any_write_handshake;
-  logic write_outstanding;
+  logic write_response_due;
+  logic read_waiting;
   logic read_transfer_incomplete;
   logic write_transfer_incomplete;
   logic write_timeout_count_enable;
   logic        error_detected_next;
   logic [3:0]  error_code_next;
 
-  logic [31:0] process2_cycle_counter;
-
   // ---------------- Local helper ----------------
   function automatic logic [15:0] fp16_max(input logic [15:0] a, input logic [15:0] b);
     logic a_sign, b_sign;
@@ -158,12 +233,35 @@ module Softmax (
     end
   endfunction
 
+  // Beats of the INCR burst starting at addr: at most max_beats and remaining,
+  // never across a 4 KB boundary (SystemC axi_burst_beats)
+  function automatic logic [8:0] axi_burst_beats(input logic [31:0] addr, input logic [31:0] remaining,
+                                                 input logic [8:0] max_beats);
+    logic [9:0] to_boundary;
+    logic [31:0] beats;
+    begin
+      to_boundary = 10'((32'd4096 - {20'd0, addr[11:0]}) / BEAT_BYTES);
+      beats = {23'd0, max_beats};
+      if (remaining < beats) beats = remaining;
+      if ({22'd0, to_boundary} < beats) beats = {22'd0, to_boundary};
+      if (beats == 32'd0) beats = 32'd1;
+      return beats[8:0];
+    end
+  endfunction
+
+  assign total_beats = 32'(({1'b0, data_length[31:0]} + {1'b0, BEAT_ELEMS} - 33'd1) >> LANE_LOG2);
+  assign max_burst_beats = {1'b0, burst_len} + 9'd1;
+  assign M_AXI_ARSIZE = AXI_SIZE_BEAT;
+  assign M_AXI_ARBURST = AXI_BURST_INCR;
+  assign M_AXI_AWSIZE = AXI_SIZE_BEAT;
+  assign M_AXI_AWBURST = AXI_BURST_INCR;
+
   // ---------------- Submodule instantiation ----------------
-  PROCESS_1_Module u_p1 (
+  PROCESS_1_Module #(.LANES(LANES)) u_p1 (
     .clk(clk),
     .rst_n(rst_n),
     .enable(process_1_enable),
-    .DataIn_64bits(M_AXI_RDATA),
+    .DataIn_64bits(process1_read_data),
     .Global_Max(global_max_for_p1_d1_reg),
     .Sum_Buffer_In(sum_buffer_reg),
     .data_valid(process1_read_data_valid),
@@ -180,14 +278,17 @@ module Softmax (
     .enable(process_2_enable),
     .stall_output(stall_process2_output_Signal),
     .Pre_Compute_In(sum_buffer_reg),
+    .Pre_Compute_Valid(process2_input_valid_Signal),
     .Leading_One_Pos_Out(Leading_One_Pos_Out_Signal),
-    .Mux_Result_Out(Mux_Result_Out_Signal)
+    .Mux_Result_Out(Mux_Result_Out_Signal),
+    .Output_Valid(process2_output_valid_Signal)
   );
 
-  PROCESS_3_Module u_p3 (
+  PROCESS_3_Module #(.LANES(LANES)) u_p3 (
     .clk(clk),
     .rst_n(rst_n),
     .enable(process_3_enable),
+    .flush(process3_finish_flag),
     .stall(process3_stall),
     .input_data_valid(process3_read_data_valid),
     .Local_Max(Local_Max_Signal),
@@ -197,6 +298,7 @@ module Softmax (
     .Output_Buffer_In(Output_Buffer_In_Signal),
     .Output_Vector(Process3_Output_Vector),
     .stage2_valid(process3_stage2_valid),
+    .stage3_valid(process3_stage3_valid),
     .stage4_valid(process3_stage4_valid)
   );
 
@@ -214,7 +316,7 @@ module Softmax (
     .count(max_fifo_count)
   );
 
-  Output_FIFO u_output_fifo (
+  Output_FIFO #(.LANES(LANES)) u_output_fifo (
     .clk(clk),
     .rst_n(rst_n),
     .data_in(Power_of_Two_Vector_Signal),
@@ -230,42 +332,94 @@ module Softmax (
 
   // ---------------- Combinational controls ----------------
   always_comb begin
-    process_1_enable = (state == STATE_PROCESS1) && !has_error;
+    // Re-read: PROCESS_1 recomputes the beats in PROCESS3
+    read_pass = (state == STATE_PROCESS1) || ((state == STATE_PROCESS3) && reread_mode);
+    reread_pass = (state == STATE_PROCESS3) && reread_mode;
+    process_1_enable = read_pass && !has_error;
     process_2_enable = (state == STATE_PROCESS2) && !has_error;
     process_3_enable = (state == STATE_PROCESS3) && !has_error;
 
     // SystemC: stall PROCESS_2 output outside PROCESS2 state
     stall_process2_output_Signal = (state != STATE_PROCESS2);
-
-    // Hold PROCESS_3 while one write beat is buffered but not fully sent.
-    process3_stall = (state == STATE_PROCESS3) && write_buf_valid;
-
-    // SystemC validity update mapping
-    process1_read_data_valid = M_AXI_RVALID && M_AXI_RREADY;
+    // Sum_Buffer is final after PROCESS1 (buffer update only runs in PROCESS1)
+    process2_input_valid_Signal = (state == STATE_PROCESS2) || (state == STATE_PROCESS3);
+
+    // Stage4 holds a beat the W handshake has not taken yet (slave not ready,
+    // or WVALID not yet raised for a beat that follows a bubble)
+    process3_stall = (state == STATE_PROCESS3) && process3_stage4_valid
+                  && !(M_AXI_WVALID && M_AXI_WREADY);
+
+    // SystemC validity update mapping: reorder buffer head, else the next
+    // in-order R beat (also in the cycle its AR is accepted) bypasses it
+    read_head_id = read_txn_retired[5:0];
+    read_head_issued = (read_txn_retired != read_txn_issued);
+    rob_head_idx = read_data_delivered_num[ROB_ADDR_BITS-1:0];
+    read_bypass = M_AXI_RVALID && M_AXI_RREADY && !rob_head_valid
+               && (read_head_issued || (M_AXI_ARVALID && M_AXI_ARREADY))
+               && (M_AXI_RID == read_head_id);
+    process1_read_data_valid = rob_head_valid || read_bypass;
+    process1_read_data = rob_head_valid ? rob_head_data : M_AXI_RDATA;
+
+    // Early beats go to the reorder buffer; the head read address follows delivery
+    rob_we = read_pass && M_AXI_RVALID && M_AXI_RREADY && !read_bypass;
+    rob_waddr = ROB_ADDR_BITS'(read_txn_start[M_AXI_RID] + (ROB_ADDR_BITS + 1)'(read_txn_received[M_AXI_RID]));
+    rob_head_next_idx = rob_head_idx + ROB_ADDR_BITS'(process1_read_data_valid);
+
+    // AR issue limits: read_outstanding bursts (0 = 64) and the reorder buffer size
+    read_max_txns = ((read_outstanding == 8'd0) || (read_outstanding > 8'd64))
+                  ? READ_MAX_OUTSTANDING : {24'd0, read_outstanding};
+    // Bursts fit the reorder buffer (no limit at the default 256 beats)
+    read_max_beats = (max_burst_beats > 9'(ROB_BURST_CAP)) ? 9'(ROB_BURST_CAP) : max_burst_beats;
+    if (reread_pass && (read_max_beats > 9'(REREAD_WINDOW_BEATS))) begin
+      read_max_beats = 9'(REREAD_WINDOW_BEATS);
+    end
+    read_next_beats = axi_burst_beats(src_addr_base[31:0] + (read_addr_sent_num * BEAT_BYTES),
+                                      total_beats - read_addr_sent_num, read_max_beats);
+    // The re-read pass cannot stall PROCESS_1: the beats requested but not yet
+    // popped from Max_FIFO by PROCESS_3 stay within the window, so no FIFO fills
+    read_can_issue = ((read_txn_issued - read_txn_retired) < read_max_txns)
+                  && ((read_addr_sent_num - read_data_delivered_num + {23'd0, read_next_beats})
+                      <= READ_ROB_DEPTH)
+                  && (!reread_pass
+                      || ((read_addr_sent_num - reread_max_popped_num + {23'd0, read_next_beats})
+                          <= REREAD_WINDOW_BEATS));
     process3_read_data_valid = max_fifo_read_en;
 
-    // FIFO controls (SystemC manage_fifo_control)
-    max_fifo_write_en = (state == STATE_PROCESS1) && !has_error && process1_stage1_valid;
-    output_fifo_write_en = (state == STATE_PROCESS1) && !has_error && process1_stage5_valid;
-
-    max_fifo_read_en = (state == STATE_PROCESS3) && !has_error && !process3_stall;
+    // FIFO controls (SystemC manage_fifo_control): written by PROCESS_1 in
+    // PROCESS1, or in PROCESS3 by the re-read pass
+    max_fifo_write_en = (reread_mode ? (state == STATE_PROCESS3) : (state == STATE_PROCESS1))
+                     && !has_error && process1_stage1_valid;
+    output_fifo_write_en = (reread_mode ? (state == STATE_PROCESS3) : (state == STATE_PROCESS1))
+                        && !has_error && process1_stage5_valid;
+
+    // Re-read: pop a local max only once Output_FIFO holds the power vector of
+    // the same beat (stage2 pops it two cycles later without waiting)
+    max_fifo_read_en = (state == STATE_PROCESS3) && !has_error && !process3_stall
+                    && (!reread_mode
+                        || (max_fifo_read_data_valid && ({20'd0, output_fifo_count} > reread_pending)));
     output_fifo_read_en = (state == STATE_PROCESS3) && !has_error && !process3_stall && process3_stage2_valid;
 
-    max_fifo_clear = has_error;
-    output_fifo_clear = has_error;
+    // Both FIFOs and the PROCESS_3 pipeline are flushed when PROCESS3 finishes
+    // the row (SystemC bank_fifo_rst / rst_process3), so no tail beat leaks
+    // into the next START
+    max_fifo_clear = has_error || process3_finish_flag;
+    output_fifo_clear = has_error || process3_finish_flag;
 
     // Transition flags (SystemC state_transition_flag)
+    // Re-read mode leaves the FIFOs empty in PROCESS1: every beat must be in Sum_Buffer
     process1_finish_flag = (state == STATE_PROCESS1)
-                        && ((read_data_received_num * 32'd4) >= data_length)
-                        && (({20'd0, max_fifo_count} * 32'd4) >= data_length)
-                        && (({20'd0, output_fifo_count} * 32'd4) >= data_length);
+                        && ((read_data_delivered_num * BEAT_ELEMS) >= data_length)
+                        && (reread_mode
+                            ? ((sum_update_num * BEAT_ELEMS) >= data_length)
+                            : ((({20'd0, max_fifo_count} * BEAT_ELEMS) >= data_length)
+                               && (({20'd0, output_fifo_count} * BEAT_ELEMS) >= data_length)));
 
     process3_finish_flag = (state == STATE_PROCESS3)
-                        && ((write_addr_sent_num * 32'd4) >= data_length)
-                        && ((write_data_sent_num * 32'd4) >= data_length)
-                        && ((write_response_received_num * 32'd4) >= data_length);
+                        && ((write_addr_sent_num * BEAT_ELEMS) >= data_length)
+                        && ((write_data_sent_num * BEAT_ELEMS) >= data_length)
+                        && ((write_response_received_num * BEAT_ELEMS) >= data_length);
 
-    read_resp_error = (state == STATE_PROCESS1)
+    read_resp_error = read_pass
              && M_AXI_RVALID
              && M_AXI_RREADY
              && (M_AXI_RRESP != AXI_RESP_OKAY);
@@ -277,7 +431,7 @@ module Softmax (
 
     invalid_state_error = (state > STATE_PROCESS3);
     data_length_invalid_error = (state == STATE_IDLE) && start
-                             && ((data_length == 64'd0) || (data_length > DATA_LENGTH_MAX));
+                             && ((data_length == 64'd0) || (data_length > DATA_LENGTH_REREAD_MAX));
 
     max_fifo_overflow_error = max_fifo_full && process1_stage1_valid;
     output_fifo_overflow_error = output_fifo_full && process1_stage5_valid;
@@ -292,25 +446,28 @@ module Softmax (
 
     any_read_handshake = (M_AXI_ARVALID && M_AXI_ARREADY)
                       || (M_AXI_RVALID && M_AXI_RREADY);
-    read_transfer_incomplete = ((read_data_received_num * 32'd4) < data_length);
-    read_timeout_error = (state == STATE_PROCESS1)
+    read_transfer_incomplete = ((read_data_received_num * BEAT_ELEMS) < data_length);
+    // The re-read pass also waits for PROCESS3 (read window): only count with an AR or R pending
+    read_waiting = (state == STATE_PROCESS1) || M_AXI_ARVALID
+                || (read_addr_sent_num > read_data_received_num);
+    read_timeout_error = read_pass
                       && !any_read_handshake
+                      && read_waiting
                       && read_transfer_incomplete
                       && (read_timeout_counter >= (AXI_TIMEOUT_THRESHOLD - 1));
 
     any_write_handshake = (M_AXI_AWVALID && M_AXI_AWREADY)
                        || (M_AXI_WVALID && M_AXI_WREADY)
                        || (M_AXI_BVALID && M_AXI_BREADY);
-    write_outstanding = write_buf_valid
-             || (write_addr_sent_num != write_data_sent_num)
-             || (write_addr_sent_num != write_response_received_num)
-             || (write_data_sent_num != write_response_received_num);
-    write_transfer_incomplete = ((write_addr_sent_num * 32'd4) < data_length)
-                             || ((write_data_sent_num * 32'd4) < data_length)
-                             || ((write_response_received_num * 32'd4) < data_length);
+    write_response_due = M_AXI_BREADY && (write_response_received_num < write_addr_sent_num);
+    write_transfer_incomplete = ((write_addr_sent_num * BEAT_ELEMS) < data_length)
+                             || ((write_data_sent_num * BEAT_ELEMS) < data_length)
+                             || ((write_response_received_num * BEAT_ELEMS) < data_length);
+    // No handshake while AWVALID / WVALID is asserted or a B is due; idle
+    // pipeline bubbles do not count
     write_timeout_count_enable = write_transfer_incomplete
                               && !any_write_handshake
-                  && (M_AXI_AWVALID || M_AXI_WVALID || write_outstanding);
+                              && (M_AXI_AWVALID || M_AXI_WVALID || write_response_due);
     write_timeout_error = (state == STATE_PROCESS3)
                        && write_timeout_count_enable
                        && (write_timeout_counter >= (AXI_TIMEOUT_THRESHOLD - 1));
@@ -350,15 +507,15 @@ module Softmax (
     end
   end
 
-  // ---------------- FSM + process2 timing ----------------
+  // ---------------- FSM + timeout counters ----------------
   always_ff @(posedge clk or negedge rst_n) begin
     if (!rst_n) begin
       read_timeout_counter <= 32'd0;
       write_timeout_counter <= 32'd0;
     end else begin
-      if (state != STATE_PROCESS1) begin
+      if (!read_pass) begin
         read_timeout_counter <= 32'd0;
-      end else if (any_read_handshake) begin
+      end else if (any_read_handshake || !read_waiting) begin
         read_timeout_counter <= 32'd0;
       end else if (read_transfer_incomplete) begin
         read_timeout_counter <= read_timeout_counter + 32'd1;
@@ -379,50 +536,48 @@ module Softmax (
   always_ff @(posedge clk or negedge rst_n) begin
     if (!rst_n) begin
       state <= STATE_IDLE;
+      reread_mode <= 1'b0;
       done_pulse <= 1'b0;
       has_error <= 1'b0;
       error_code <= ERR_NONE;
-      process2_cycle_counter <= 32'd0;
     end else begin
       done_pulse <= 1'b0;
 
       if (has_error) begin
         // Keep error sticky in IDLE, but allow a clean restart with valid start.
         state <= STATE_IDLE;
-        process2_cycle_counter <= 32'd0;
-        if (start && (data_length != 64'd0) && (data_length <= DATA_LENGTH_MAX)) begin
+        if (start && (data_length != 64'd0) && (data_length <= DATA_LENGTH_REREAD_MAX)) begin
           has_error <= 1'b0;
           error_code <= ERR_NONE;
           state <= STATE_PROCESS1;
+          reread_mode <= reread || (data_length > DATA_LENGTH_MAX);
         end
       end else if (error_detected_next) begin
         has_error <= 1'b1;
         error_code <= error_code_next;
         state <= STATE_IDLE;
-        process2_cycle_counter <= 32'd0;
       end else begin
         case (state)
           STATE_IDLE: begin
-            process2_cycle_counter <= 32'd0;
             if (start) begin
               has_error <= 1'b0;
               error_code <= ERR_NONE;
               state <= STATE_PROCESS1;
+              // Rows longer than the FIFOs always take the two-pass re-read mode
+              reread_mode <= reread || (data_length > DATA_LENGTH_MAX);
             end
           end
 
           STATE_PROCESS1: begin
             if (process1_finish_flag) begin
               state <= STATE_PROCESS2;
-              process2_cycle_counter <= 32'd0;
             end
           end
 
           STATE_PROCESS2: begin
-            process2_cycle_counter <= process2_cycle_counter + 32'd1;
-            if (process2_cycle_counter >= 32'd10) begin
+            // PROCESS_2 output registers hold the final ks / mux result
+            if (process2_output_valid_Signal) begin
               state <= STATE_PROCESS3;
-              process2_cycle_counter <= 32'd0;
             end
           end
 
@@ -447,7 +602,8 @@ module Softmax (
       global_max_reg <= 16'd0;
       global_max_for_p1_d1_reg <= 16'd0;
       global_max_for_p1_d2_reg <= 16'd0;
-      sum_buffer_reg <= 32'd0;
+      sum_buffer_reg <= 48'd0;
+      sum_update_num <= 32'd0;
     end else if (state == STATE_PROCESS1) begin
       global_max_for_p1_d1_reg <= global_max_reg;
       global_max_for_p1_d2_reg <= global_max_for_p1_d1_reg;
@@ -456,110 +612,213 @@ module Softmax (
       end
       if (process1_stage5_valid) begin
         sum_buffer_reg <= Sum_Buffer_In;
+        sum_update_num <= sum_update_num + 32'd1;
       end
     end else begin
+      // The PROCESS3 re-read pass does not touch the global max and sum
       global_max_for_p1_d1_reg <= global_max_reg;
       global_max_for_p1_d2_reg <= global_max_for_p1_d1_reg;
+      sum_update_num <= 32'd0;
     end
   end
 
   // ---------------- AXI read process parity ----------------
   always_ff @(posedge clk or negedge rst_n) begin
     if (!rst_n ) begin
+      M_AXI_ARID <= 6'd0;
       M_AXI_ARADDR <= 32'd0;
+      M_AXI_ARLEN <= 8'd0;
       M_AXI_ARVALID <= 1'b0;
       M_AXI_RREADY <= 1'b0;
       read_addr_sent_num <= 32'd0;
       read_data_received_num <= 32'd0;
-    end else if (state != STATE_PROCESS1) begin 
+      read_data_delivered_num <= 32'd0;
+      read_txn_issued <= 32'd0;
+      read_txn_retired <= 32'd0;
+      reread_max_popped_num <= 32'd0;
+      reread_output_popped_num <= 32'd0;
+      rob_valid <= '0;
+      rob_head_valid <= 1'b0;
+    end else if (!read_pass) begin 
+      // Counters restart in PROCESS2, so the re-read pass reads the row from the start
+      M_AXI_ARID <= 6'd0;
       M_AXI_ARADDR <= 32'd0;
+      M_AXI_ARLEN <= 8'd0;
       M_AXI_ARVALID <= 1'b0;
       M_AXI_RREADY <= 1'b0;
       read_addr_sent_num <= 32'd0;
       read_data_received_num <= 32'd0;
+      read_data_delivered_num <= 32'd0;
+      read_txn_issued <= 32'd0;
+      read_txn_retired <= 32'd0;
+      reread_max_popped_num <= 32'd0;
+      reread_output_popped_num <= 32'd0;
+      // An error can leave early beats in the reorder buffer
+      rob_valid <= '0;
+      rob_head_valid <= 1'b0;
     end else begin
-      // Address generation
-      if (!M_AXI_ARVALID && ((read_addr_sent_num * 32'd4) < data_length)) begin
-        M_AXI_ARADDR <= src_addr_base[31:0] + (read_addr_sent_num * 32'd8);
+      // Address generation: one AR per burst of up to burst_len + 1 beats,
+      // ARID = burst number mod 64, while the outstanding limits allow it
+      if (!M_AXI_ARVALID && ((read_addr_sent_num * BEAT_ELEMS) < data_length) && read_can_issue) begin
+        M_AXI_ARID <= read_txn_issued[5:0];
+        M_AXI_ARADDR <= src_addr_base[31:0] + (read_addr_sent_num * BEAT_BYTES);
+        M_AXI_ARLEN <= 8'(read_next_beats - 9'd1);
         M_AXI_ARVALID <= 1'b1;
       end
 
       if (M_AXI_ARVALID && M_AXI_ARREADY) begin
         M_AXI_ARVALID <= 1'b0;
-        read_addr_sent_num <= read_addr_sent_num + 32'd1;
+        read_addr_sent_num <= read_addr_sent_num + {24'd0, M_AXI_ARLEN} + 32'd1;
+        read_txn_issued <= read_txn_issued + 32'd1;
+        read_txn_start[M_AXI_ARID] <= read_addr_sent_num[ROB_ADDR_BITS:0];
+        read_txn_beats[M_AXI_ARID] <= {1'b0, M_AXI_ARLEN} + 9'd1;
+        read_txn_received[M_AXI_ARID] <= 9'd0;
       end
 
-      // Data receive side
-      M_AXI_RREADY <= ((read_data_received_num * 32'd4) < data_length);
+      // Data receive side: beats that cannot bypass wait in the reorder buffer
+      M_AXI_RREADY <= ((read_data_received_num * BEAT_ELEMS) < data_length);
 
       if (M_AXI_RVALID && M_AXI_RREADY) begin
         read_data_received_num <= read_data_received_num + 32'd1;
+        read_txn_received[M_AXI_RID] <= read_txn_received[M_AXI_RID] + 9'd1;
+      end
+      if (rob_we) rob_valid[rob_waddr] <= 1'b1;
+
+      // PROCESS_1 took the next beat; the burst retires after its last beat
+      if (process1_read_data_valid) begin
+        read_data_delivered_num <= read_data_delivered_num + 32'd1;
+        if (rob_head_valid) rob_valid[rob_head_idx] <= 1'b0;
+        if ((ROB_ADDR_BITS + 1)'(read_data_delivered_num + 32'd1)
+            == (read_txn_start[read_head_id] + (ROB_ADDR_BITS + 1)'(read_txn_beats[read_head_id]))) begin
+          read_txn_retired <= read_txn_retired + 32'd1;
+        end
+      end
+
+      // Next in-order beat (SystemC rob_head_valid_sig): the head entry after
+      // this edge, including a beat written to it in this cycle
+      rob_head_valid <= (rob_we && (rob_waddr == rob_head_next_idx)) || rob_valid[rob_head_next_idx];
+
+      // Re-read pass: beats PROCESS_3 took from the FIFOs
+      if (reread_pass && max_fifo_read_en && max_fifo_read_data_valid) begin
+        reread_max_popped_num <= reread_max_popped_num + 32'd1;
       end
+      if (reread_pass && output_fifo_read_en && output_fifo_read_data_valid) begin
+        reread_output_popped_num <= reread_output_popped_num + 32'd1;
+      end
+    end
+  end
+
+  assign reread_pending = reread_max_popped_num - reread_output_popped_num;
+
+  // Reorder buffer storage (no reset, rob_valid qualifies the entries): one
+  // write port and a registered read port at the next head, write-first
+  always_ff @(posedge clk) begin
+    if (rob_we) rob_data[rob_waddr] <= M_AXI_RDATA;
+    rob_head_data <= (rob_we && (rob_waddr == rob_head_next_idx)) ? M_AXI_RDATA : rob_data[rob_head_next_idx];
+  end
+
+`ifndef SYNTHESIS
+  initial begin
+    if ((1 << ROB_ADDR_BITS) != READ_ROB_DEPTH) begin
+      $error("Softmax parameter error: READ_ROB_DEPTH=%0d must be a power of two", READ_ROB_DEPTH);
+      $fatal(1);
     end
   end
+`endif
 
   // ---------------- AXI write request parity ----------------
+  // Registered like SystemC axi_write_request_process: AW runs ahead while a
+  // beat waits in stage4, and WVALID follows the beat that moves into stage4
+  // after a W handshake (the stage3 beat, or a bubble)
   always_comb begin
-    aw_active = (state == STATE_PROCESS3) && write_buf_valid && !write_buf_aw_sent;
-    w_active = (state == STATE_PROCESS3) && write_buf_valid && write_buf_aw_sent;
-
-    if (state == STATE_PROCESS3) begin
-      M_AXI_AWADDR = write_buf_addr;
-      M_AXI_AWVALID = aw_active;
-      M_AXI_WDATA = write_buf_data;
-      M_AXI_WSTRB = 8'hFF;
-      M_AXI_WVALID = w_active;
-      M_AXI_BREADY = 1'b1;
-    end else begin
-      M_AXI_AWADDR = 32'd0;
-      M_AXI_AWVALID = 1'b0;
-      M_AXI_WDATA = 64'd0;
-      M_AXI_WSTRB = 8'h00;
-      M_AXI_WVALID = 1'b0;
-      M_AXI_BREADY = 1'b0;
+    write_aw_handshake = M_AXI_AWVALID && M_AXI_AWREADY;
+    write_w_handshake = M_AXI_WVALID && M_AXI_WREADY;
+    write_addr_sent_next = write_addr_sent_num
+                         + (write_aw_handshake ? ({24'd0, M_AXI_AWLEN} + 32'd1) : 32'd0);
+    write_data_sent_next = write_data_sent_num + {31'd0, write_w_handshake};
+    // A B without an outstanding burst acknowledges nothing
+    write_burst_pop = M_AXI_BVALID && M_AXI_BREADY && (write_burst_count != '0);
+    write_burst_count_next = write_burst_count
+                           + {{WRITE_BURST_PTR_W{1'b0}}, write_aw_handshake}
+                           - {{WRITE_BURST_PTR_W{1'b0}}, write_burst_pop};
+    write_aw_beats = axi_burst_beats(dst_addr_base[31:0] + (write_addr_sent_next * BEAT_BYTES),
+                                     total_beats - write_addr_sent_next, max_burst_beats);
+
+    // Next W beat starts a new burst: find where it ends (drives WLAST)
+    write_burst_end_next = write_burst_end;
+    if ((write_data_sent_next >= write_burst_end) && (write_data_sent_next < total_beats)) begin
+      write_burst_end_next = write_data_sent_next
+                           + {23'd0, axi_burst_beats(dst_addr_base[31:0] + (write_data_sent_next * BEAT_BYTES),
+                                                     total_beats - write_data_sent_next, max_burst_beats)};
+    end
+  end
+
+  assign M_AXI_WDATA = Process3_Output_Vector;
+
+  // Burst beat FIFO entries: no reset, write_burst_count qualifies them
+  always_ff @(posedge clk) begin
+    if ((state == STATE_PROCESS3) && write_aw_handshake) begin
+      write_burst_beats[write_burst_head + write_burst_count[WRITE_BURST_PTR_W-1:0]] <= {1'b0, M_AXI_AWLEN} + 9'd1;
     end
   end
 
   // ---------------- AXI write counter update parity ----------------
   always_ff @(posedge clk or negedge rst_n) begin
     if (!rst_n) begin
+      M_AXI_AWADDR <= 32'd0;
+      M_AXI_AWLEN <= 8'd0;
+      M_AXI_AWVALID <= 1'b0;
+      M_AXI_WSTRB <= '0;
+      M_AXI_WLAST <= 1'b0;
+      M_AXI_WVALID <= 1'b0;
+      M_AXI_BREADY <= 1'b0;
       write_addr_sent_num <= 32'd0;
       write_data_sent_num <= 32'd0;
       write_response_received_num <= 32'd0;
-      write_buf_addr <= 32'd0;
-      write_buf_data <= 64'd0;
-      write_buf_valid <= 1'b0;
-      write_buf_aw_sent <= 1'b0;
+      write_burst_end <= 32'd0;
+      write_burst_head <= '0;
+      write_burst_count <= '0;
     end else if (state != STATE_PROCESS3) begin 
+      M_AXI_AWADDR <= 32'd0;
+      M_AXI_AWLEN <= 8'd0;
+      M_AXI_AWVALID <= 1'b0;
+      M_AXI_WSTRB <= '0;
+      M_AXI_WLAST <= 1'b0;
+      M_AXI_WVALID <= 1'b0;
+      M_AXI_BREADY <= 1'b0;
       write_addr_sent_num <= 32'd0;
       write_data_sent_num <= 32'd0;
       write_response_received_num <= 32'd0;
-      write_buf_addr <= 32'd0;
-      write_buf_data <= 64'd0;
-      write_buf_valid <= 1'b0;
-      write_buf_aw_sent <= 1'b0;
+      write_burst_end <= 32'd0;
+      write_burst_head <= '0;
+      write_burst_count <= '0;
     end else begin
-      if (!write_buf_valid && process3_stage4_valid
-          && ((write_data_sent_num * 32'd4) < data_length)) begin
-        write_buf_addr <= dst_addr_base[31:0] + (write_data_sent_num * 32'd8);
-        write_buf_data <= Process3_Output_Vector;
-        write_buf_valid <= 1'b1;
-        write_buf_aw_sent <= 1'b0;
-      end
-
-      if (aw_active && M_AXI_AWREADY) begin
-        write_addr_sent_num <= write_addr_sent_num + 32'd1;
-        write_buf_aw_sent <= 1'b1;
-      end
-
-      if (w_active && M_AXI_WREADY) begin
-        write_data_sent_num <= write_data_sent_num + 32'd1;
-        write_buf_valid <= 1'b0;
-        write_buf_aw_sent <= 1'b0;
+      // Write address: one AW per burst of up to burst_len + 1 beats, held
+      // while WRITE_MAX_OUTSTANDING bursts wait for their B
+      write_addr_sent_num <= write_addr_sent_next;
+      write_burst_count <= write_burst_count_next;
+      if (((write_addr_sent_next * BEAT_ELEMS) < data_length) && process3_stage4_valid
+          && (write_burst_count_next < WRITE_MAX_OUTSTANDING)) begin
+        M_AXI_AWADDR <= dst_addr_base[31:0] + (write_addr_sent_next * BEAT_BYTES);
+        M_AXI_AWLEN <= 8'(write_aw_beats - 9'd1);
+        M_AXI_AWVALID <= 1'b1;
+      end else begin
+        M_AXI_AWVALID <= 1'b0;
       end
 
-      if (M_AXI_BVALID && M_AXI_BREADY) begin
-        write_response_received_num <= write_response_received_num + 32'd1;
+      // Write data: WDATA is the stage4 register
+      M_AXI_WSTRB <= '1;
+      write_data_sent_num <= write_data_sent_next;
+      write_burst_end <= write_burst_end_next;
+      M_AXI_WLAST <= ((write_data_sent_next + 32'd1) == write_burst_end_next);
+      M_AXI_WVALID <= ((write_data_sent_next * BEAT_ELEMS) < data_length)
+                   && (write_w_handshake ? process3_stage3_valid : process3_stage4_valid);
+
+      // Each B acknowledges the oldest whole burst
+      M_AXI_BREADY <= 1'b1;
+      if (write_burst_pop) begin
+        write_response_received_num <= write_response_received_num + {23'd0, write_burst_beats[write_burst_head]};
+        write_burst_head <= write_burst_head + 1'b1;
       end
 
 `ifndef SYNTHESIS
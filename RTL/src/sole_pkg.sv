@@ -1,11 +1,26 @@
 `ifndef SOLE_PKG_SV
 `define SOLE_PKG_SV
+// FP16 lanes per AXI beat (4, 8 or 16); override with +define+SOLE_LANES=8
+`ifndef SOLE_LANES
+`define SOLE_LANES 4
+`endif
 package sole_pkg;
+  parameter int LANES = `SOLE_LANES;
   parameter int AXI_ADDR_WIDTH = 32;
-  parameter int AXI_DATA_WIDTH = 64;
-  parameter int AXI_STRB_WIDTH = 8;
+  parameter int AXI_DATA_WIDTH = 16 * LANES;
+  parameter int AXI_STRB_WIDTH = AXI_DATA_WIDTH / 8;
   parameter int DATA_LENGTH_MAX = 4096;
   parameter int FIFO_ADDR_BITS = 12;
+  // Sum_Buffer is 32.16 fixed point, so ks (leading one of the integer part) is 0..31
+  parameter int SUM_BITS = 48;
+  parameter int KS_BITS = 5;
+  // Two-pass re-read mode (above DATA_LENGTH_MAX, or CONTROL[24]): bounded by the 32.16 sum
+  parameter logic [63:0] DATA_LENGTH_REREAD_MAX = 64'hFFFF_FFFF;
+  // Read reorder buffer (Softmax.sv): READ_ROB_BURSTS outstanding bursts of
+  // READ_ROB_BURST_BEATS beats (a power of two; SystemC AXI_READ_ROB_DEPTH)
+  parameter int READ_ROB_BURSTS = 16;
+  parameter int READ_ROB_BURST_BEATS = 16;
+  parameter int READ_ROB_DEPTH = READ_ROB_BURSTS * READ_ROB_BURST_BEATS;
 
   localparam logic [1:0] AXI_RESP_OKAY = 2'b00;
   localparam logic [1:0] AXI_RESP_SLVERR = 2'b10;
@@ -20,6 +35,11 @@ package sole_pkg;
   localparam logic [7:0] REG_LENGTH_H        = 8'h1C;
 
   localparam int CTRL_START_BIT = 0;
+  localparam int CTRL_BURST_LEN_LSB = 8;   // max AXI burst length - 1
+  localparam int CTRL_BURST_LEN_MSB = 15;
+  localparam int CTRL_READ_OUTSTANDING_LSB = 16;  // max read bursts in flight (0 = 64)
+  localparam int CTRL_READ_OUTSTANDING_MSB = 23;
+  localparam int CTRL_REREAD_BIT = 24;     // 1 = two-pass re-read mode
   localparam int CTRL_MODE_BIT = 31;
 
   typedef enum logic [1:0] {
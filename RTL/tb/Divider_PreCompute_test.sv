@@ -1,8 +1,8 @@
 `timescale 1ns/1ps
 
 module Divider_PreCompute_test;
-  logic [31:0] input_data;
-  logic [3:0]  Leading_One_Pos;
+  logic [47:0] input_data;
+  logic [4:0]  Leading_One_Pos;
   logic [15:0] Mux_Result;
 
   int test_count;
@@ -14,18 +14,18 @@ module Divider_PreCompute_test;
     .Mux_Result(Mux_Result)
   );
 
-  function automatic [3:0] expected_leading_pos(input logic [31:0] v);
-    logic [15:0] integer_part;
+  function automatic [4:0] expected_leading_pos(input logic [47:0] v);
+    logic [31:0] integer_part;
     int i;
     begin
-      integer_part = v[31:16];
-      if (integer_part == 16'h0000) begin
-        expected_leading_pos = 4'd0;
+      integer_part = v[47:16];
+      if (integer_part == 32'h0000_0000) begin
+        expected_leading_pos = 5'd0;
       end else begin
-        expected_leading_pos = 4'd0;
-        for (i = 15; i >= 0; i = i - 1) begin
+        expected_leading_pos = 5'd0;
+        for (i = 31; i >= 0; i = i - 1) begin
           if (integer_part[i]) begin
-            expected_leading_pos = i[3:0];
+            expected_leading_pos = i[4:0];
             break;
           end
         end
@@ -33,8 +33,8 @@ module Divider_PreCompute_test;
     end
   endfunction
 
-  function automatic [15:0] expected_mux(input logic [31:0] v);
-    logic [3:0] lop;
+  function automatic [15:0] expected_mux(input logic [47:0] v);
+    logic [4:0] lop;
     int bit_pos;
     begin
       lop = expected_leading_pos(v);
@@ -46,8 +46,8 @@ module Divider_PreCompute_test;
 
   task automatic run_one(
     input int id,
-    input logic [31:0] in_v,
-    input logic [3:0] exp_pos,
+    input logic [47:0] in_v,
+    input logic [4:0] exp_pos,
     input logic [15:0] exp_mux
   );
     begin
@@ -56,12 +56,12 @@ module Divider_PreCompute_test;
 
       test_count = test_count + 1;
       if ((Leading_One_Pos !== exp_pos) || (Mux_Result !== exp_mux)) begin
-        $display("[FAIL] case=%0d input=0x%08h exp_pos=%0d got_pos=%0d exp_mux=0x%04h got_mux=0x%04h",
+        $display("[FAIL] case=%0d input=0x%012h exp_pos=%0d got_pos=%0d exp_mux=0x%04h got_mux=0x%04h",
                  id, in_v, exp_pos, Leading_One_Pos, exp_mux, Mux_Result);
         $fatal(1);
       end else begin
         pass_count = pass_count + 1;
-        $display("[PASS] case=%0d input=0x%08h pos=%0d mux=0x%04h", id, in_v, Leading_One_Pos, Mux_Result);
+        $display("[PASS] case=%0d input=0x%012h pos=%0d mux=0x%04h", id, in_v, Leading_One_Pos, Mux_Result);
       end
     end
   endtask
@@ -89,6 +89,9 @@ module Divider_PreCompute_test;
     run_one(17, 32'h0000_0001, 4'd0, 16'h388B);
     run_one(18, 32'h0000_8000, 4'd0, 16'h3A8B);
     run_one(19, 32'h0000_0000, 4'd0, 16'h388B);
+    // Integer part above 16 bits (rows of more than 65535 elements, re-read mode)
+    run_one(20, 48'h0001_0000_0000, 5'd16, 16'h388B);
+    run_one(21, 48'hC000_0000_0000, 5'd31, 16'h3A8B);
 
     $display("[SUMMARY] pass=%0d total=%0d", pass_count, test_count);
     if (pass_count != test_count) begin
@@ -1,9 +1,9 @@
 `timescale 1ns/1ps
 
 module Divider_test;
-  logic [31:0] input_sig;
+  logic [47:0] input_sig;
   logic [3:0]  ky_sig;
-  logic [3:0]  ks_sig;
+  logic [4:0]  ks_sig;
   logic [15:0] mux_sig;
   logic [15:0] out_sig;
 
@@ -23,7 +23,7 @@ module Divider_test;
     .Divider_Output(out_sig)
   );
 
-  function automatic [4:0] expected_new_exp(input [4:0] exp_in, input [3:0] ky, input [3:0] ks);
+  function automatic [4:0] expected_new_exp(input [4:0] exp_in, input [3:0] ky, input [4:0] ks);
     integer v;
     begin
       v = exp_in - (ky + ks);
@@ -33,7 +33,7 @@ module Divider_test;
     end
   endfunction
 
-  function automatic [15:0] expected_divider(input [15:0] mux_in, input [3:0] ky, input [3:0] ks);
+  function automatic [15:0] expected_divider(input [15:0] mux_in, input [3:0] ky, input [4:0] ks);
     reg [4:0] e;
     begin
       e = expected_new_exp(mux_in[14:10], ky, ks);
@@ -41,7 +41,7 @@ module Divider_test;
     end
   endfunction
 
-  task automatic run_one(input int id, input [31:0] in_v, input [3:0] ky_v);
+  task automatic run_one(input int id, input [47:0] in_v, input [3:0] ky_v);
     reg [15:0] exp_out;
     begin
       input_sig = in_v;
@@ -52,12 +52,12 @@ module Divider_test;
 
       test_count = test_count + 1;
       if (out_sig !== exp_out) begin
-        $display("[FAIL] case=%0d input=0x%08h ky=%0d ks=%0d mux=0x%04h exp=0x%04h got=0x%04h",
+        $display("[FAIL] case=%0d input=0x%012h ky=%0d ks=%0d mux=0x%04h exp=0x%04h got=0x%04h",
                  id, input_sig, ky_sig, ks_sig, mux_sig, exp_out, out_sig);
         $fatal(1);
       end else begin
         pass_count = pass_count + 1;
-        $display("[PASS] case=%0d input=0x%08h ky=%0d ks=%0d mux=0x%04h out=0x%04h",
+        $display("[PASS] case=%0d input=0x%012h ky=%0d ks=%0d mux=0x%04h out=0x%04h",
                  id, input_sig, ky_sig, ks_sig, mux_sig, out_sig);
       end
     end
@@ -9,10 +9,10 @@ module MaxUnit_test;
   int test_count;
   int pass_count;
 
-  MaxUnit dut (
+  MaxUnit #(.LANES(4)) dut (
     .clk(clk),
     .rst_n(!rst),
-    .A(A), .B(B), .C(C), .D(D),
+    .In({D, C, B, A}),
     .Max_Out(Max_Out)
   );
 
@@ -22,7 +22,7 @@ module Output_FIFO_test;
   int stress_error_count;
   bit verbose_log;
 
-  Output_FIFO dut (
+  Output_FIFO #(.LANES(4)) dut (
     .clk(clk), .rst_n(!rst),
     .data_in(data_in), .write_en(write_en),
     .read_ready(read_ready), .read_valid(read_valid),
@@ -5,9 +5,11 @@ module PROCESS_2_test;
   logic        rst;
   logic        enable;
   logic        stall_output;
-  logic [31:0] Pre_Compute_In;
-  logic [3:0]  Leading_One_Pos_Out;
+  logic [47:0] Pre_Compute_In;
+  logic        Pre_Compute_Valid;
+  logic [4:0]  Leading_One_Pos_Out;
   logic [15:0] Mux_Result_Out;
+  logic        Output_Valid;
 
   int test_count;
   int pass_count;
@@ -18,22 +20,24 @@ module PROCESS_2_test;
     .enable(enable),
     .stall_output(stall_output),
     .Pre_Compute_In(Pre_Compute_In),
+    .Pre_Compute_Valid(Pre_Compute_Valid),
     .Leading_One_Pos_Out(Leading_One_Pos_Out),
-    .Mux_Result_Out(Mux_Result_Out)
+    .Mux_Result_Out(Mux_Result_Out),
+    .Output_Valid(Output_Valid)
   );
 
-  function automatic [3:0] expected_lo(input [31:0] v);
-    reg [15:0] integer_part;
+  function automatic [4:0] expected_lo(input [47:0] v);
+    reg [31:0] integer_part;
     integer i;
     begin
-      integer_part = v[31:16];
-      if (integer_part == 16'h0000) begin
-        expected_lo = 4'd0;
+      integer_part = v[47:16];
+      if (integer_part == 32'h0000_0000) begin
+        expected_lo = 5'd0;
       end else begin
-        expected_lo = 4'd0;
-        for (i = 15; i >= 0; i = i - 1) begin
+        expected_lo = 5'd0;
+        for (i = 31; i >= 0; i = i - 1) begin
           if (integer_part[i]) begin
-            expected_lo = i[3:0];
+            expected_lo = i[4:0];
             break;
           end
         end
@@ -41,8 +45,8 @@ module PROCESS_2_test;
     end
   endfunction
 
-  function automatic [15:0] expected_mux(input [31:0] v);
-    reg [3:0] lo;
+  function automatic [15:0] expected_mux(input [47:0] v);
+    reg [4:0] lo;
     integer bit_pos;
     begin
       lo = expected_lo(v);
@@ -52,7 +56,7 @@ module PROCESS_2_test;
     end
   endfunction
 
-  task automatic check_now(input int id, input [3:0] exp_lo, input [15:0] exp_mux, input [255:0] msg);
+  task automatic check_now(input int id, input [4:0] exp_lo, input [15:0] exp_mux, input [255:0] msg);
     begin
       test_count = test_count + 1;
       if ((Leading_One_Pos_Out !== exp_lo) || (Mux_Result_Out !== exp_mux)) begin
@@ -66,12 +70,26 @@ module PROCESS_2_test;
     end
   endtask
 
+  task automatic check_valid(input int id, input logic exp_valid, input [255:0] msg);
+    begin
+      test_count = test_count + 1;
+      if (Output_Valid !== exp_valid) begin
+        $display("[FAIL] case=%0d %0s exp_valid=%0b got_valid=%0b", id, msg, exp_valid, Output_Valid);
+        $fatal(1);
+      end else begin
+        pass_count = pass_count + 1;
+        $display("[PASS] case=%0d %0s valid=%0b", id, msg, Output_Valid);
+      end
+    end
+  endtask
+
   initial begin
     clk = 0;
     rst = 0;
     enable = 1;
     stall_output = 0;
     Pre_Compute_In = 0;
+    Pre_Compute_Valid = 0;
     test_count = 0;
     pass_count = 0;
 
@@ -103,6 +121,27 @@ module PROCESS_2_test;
     #1;
     check_now(5, 4'd2, 16'h3A8B, "enable low hold");
 
+    // Valid handshake: Output_Valid follows a sample of a final input
+    rst = 1;
+    #1;
+    check_valid(6, 1'b0, "reset clears valid");
+    rst = 0;
+    enable = 1;
+    stall_output = 0;
+    Pre_Compute_In = 32'h0004_0000;
+    @(posedge clk); #1;
+    check_valid(7, 1'b0, "sample while input not final");
+    Pre_Compute_Valid = 1;
+    @(posedge clk); #1;
+    check_valid(8, 1'b1, "sample of final input");
+    check_now(9, expected_lo(Pre_Compute_In), expected_mux(Pre_Compute_In), "valid result");
+    stall_output = 1;
+    @(posedge clk); #1;
+    check_valid(10, 1'b1, "stall holds valid");
+    Pre_Compute_Valid = 0;
+    @(posedge clk); #1;
+    check_valid(11, 1'b0, "input not final clears valid");
+
     $display("[SUMMARY] pass=%0d total=%0d", pass_count, test_count);
     if (pass_count != test_count) $fatal(1);
     $display("[PROCESS_2 RTL TEST] PASS");
@@ -9,7 +9,7 @@ module Reduction_test;
   int test_count;
   int pass_count;
 
-  Reduction_Module dut (
+  Reduction_Module #(.LANES(4)) dut (
     .clk(clk),
     .rst_n(!rst),
     .Input_Vector(Input_Vector),
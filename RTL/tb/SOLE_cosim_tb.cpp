@@ -0,0 +1,546 @@
+/**
+ * @file SOLE_cosim_tb.cpp
+ * @brief Lock-step co-simulation of SOLE.sv (Verilator) and the SystemC SOLE (make cosim_sim)
+ *
+ * Both models run on the same clock. One Axi_Slave_Cycle answers the SystemC
+ * AXI master and its responses (ARREADY, RID, RDATA, WREADY, BVALID, ...) are driven
+ * into both models, so any difference in the master outputs or the status
+ * register shows up on the cycle it happens. Every cycle, after the inputs have
+ * settled, the harness compares
+ *   - the AXI master outputs (AW*, W*, BREADY, AR*, RREADY)
+ *   - the status register (SystemC SOLE::reg_status, RTL softmax_status)
+ *   - the interrupt output
+ * and stops at the first difference with the differing fields and the last
+ * --history cycles of both sides (pins in the SOLE_test --axi-log format).
+ *
+ * The MMIO program is the one of SOLE_verilator_tb.cpp (reset, address and
+ * length registers, START = 1 then 0, poll REG_STATUS until DONE or error).
+ * SOLE.sv latches a processor write on the clock edge, the SystemC SOLE takes
+ * it while proc_we is high; the SystemC side therefore sees the processor pins
+ * one cycle later, so both engines see a written register in the same cycle.
+ * proc_rdata is not compared for the same reason.
+ *
+ * Usage:
+ *   VSOLE_cosim [--input FILE] [--length N] [--arready-delay N] [--rvalid-delay N]
+ *               [--wready-delay N] [--burst-len N] [--read-outstanding N] [--read-latency N]
+ *               [--read-reorder N] [--timeout-cycles N] [--error-recovery 0|1]
+ *               [--reread 0|1] [--name NAME] [--batch FILE] [--history N]
+ *
+ *   --batch    Batch file of SOLE_verilator_tb (SOLE_test keys, one case per line)
+ *   --history  Cycles shown before the divergence (default 8)
+ *
+ * The exit status is 0 if the models agreed on every cycle of every case (a
+ * timeout or error status both models report is still agreement), 1 on the
+ * first divergence or if a case could not run.
+ */
+
+#include <systemc.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "verilated.h"
+#include "VSOLE.h"
+#include "VSOLE___024root.h"
+
+#include "SOLE.h"
+#include "SOLE_tb_utils.h"
+#include "../../SystemC/test/test_utils.h"
+
+static const sc_time HALF_PERIOD(0.5, SC_NS);
+
+/// Values of one cycle as the comparison sees them
+struct Sample {
+    long long               cycle = 0;
+    Softmax_Cycle::Axi_Pins sc;         ///< SystemC master outputs + slave outputs
+    Softmax_Cycle::Axi_Pins rtl;        ///< RTL master outputs + slave outputs
+    uint32_t                sc_status = 0;
+    uint32_t                rtl_status = 0;
+    bool                    sc_interrupt = false;
+    bool                    rtl_interrupt = false;
+};
+
+struct CosimResult {
+    size_t input_count = 0;
+    long   exec_cycles = -1;         ///< -1 = did not run or timed out
+    uint32_t status = 0;
+    bool   ran = false;              ///< MMIO program went through (agreement up to its end)
+    bool   diverged = false;
+};
+
+/// SystemC SOLE and SOLE.sv on one clock; one call of cycle() is one clock period
+class Cosim {
+public:
+    Cosim(VerilatedContext* ctx, size_t history)
+        : clk("clk"), rst("rst"), proc_addr("proc_addr"), proc_wdata("proc_wdata"), proc_we("proc_we"),
+          proc_rdata("proc_rdata"), interrupt("interrupt"),
+          awaddr("awaddr"), awlen("awlen"), awsize("awsize"), awburst("awburst"), awvalid("awvalid"),
+          awready("awready"),
+          wdata("wdata"), wstrb("wstrb"), wlast("wlast"), wvalid("wvalid"), wready("wready"),
+          bresp("bresp"), bvalid("bvalid"), bready("bready"),
+          arid("arid"), araddr("araddr"), arlen("arlen"), arsize("arsize"), arburst("arburst"), arvalid("arvalid"),
+          arready("arready"),
+          rid("rid"), rdata("rdata"), rresp("rresp"), rvalid("rvalid"), rready("rready"),
+          sole("sole"), rtl(new VSOLE(ctx)), memory(MEM_WORDS), slave(memory), history(history) {
+        sole.clk(clk);
+        sole.rst(rst);
+        sole.proc_addr(proc_addr);
+        sole.proc_wdata(proc_wdata);
+        sole.proc_we(proc_we);
+        sole.proc_rdata(proc_rdata);
+        sole.interrupt(interrupt);
+        sole.M_AXI_AWADDR(awaddr);
+        sole.M_AXI_AWLEN(awlen);
+        sole.M_AXI_AWSIZE(awsize);
+        sole.M_AXI_AWBURST(awburst);
+        sole.M_AXI_AWVALID(awvalid);
+        sole.M_AXI_AWREADY(awready);
+        sole.M_AXI_WDATA(wdata);
+        sole.M_AXI_WSTRB(wstrb);
+        sole.M_AXI_WLAST(wlast);
+        sole.M_AXI_WVALID(wvalid);
+        sole.M_AXI_WREADY(wready);
+        sole.M_AXI_BRESP(bresp);
+        sole.M_AXI_BVALID(bvalid);
+        sole.M_AXI_BREADY(bready);
+        sole.M_AXI_ARID(arid);
+        sole.M_AXI_ARADDR(araddr);
+        sole.M_AXI_ARLEN(arlen);
+        sole.M_AXI_ARSIZE(arsize);
+        sole.M_AXI_ARBURST(arburst);
+        sole.M_AXI_ARVALID(arvalid);
+        sole.M_AXI_ARREADY(arready);
+        sole.M_AXI_RID(rid);
+        sole.M_AXI_RDATA(rdata);
+        sole.M_AXI_RRESP(rresp);
+        sole.M_AXI_RVALID(rvalid);
+        sole.M_AXI_RREADY(rready);
+
+        mmio.addr = REG_STATUS;
+        sc_mmio = mmio;
+        reset = true;
+        rtl->clk = 0;
+        drive_inputs();
+        rtl->eval();
+    }
+
+    ~Cosim() { rtl->final(); }
+
+    CosimResult run(const TestCase& tc);
+
+    long long cycles = 0;
+
+private:
+    /// Processor pins
+    struct Mmio {
+        uint32_t addr = 0;
+        uint32_t wdata = 0;
+        bool     we = false;
+    };
+
+    /**
+     * Compare the settled low phase, then one clock edge on both models and the
+     * inputs of the next cycle; false at the first divergence (dump printed)
+     */
+    bool cycle() {
+        Sample s = sample();
+        past.push_back(s);
+        if (past.size() > history + 1) past.pop_front();
+        if (!compare(s)) {
+            return false;
+        }
+        slave.eval(s.sc, reset);
+        clk.write(true);
+        sc_start(HALF_PERIOD);
+        rtl->clk = 1;
+        rtl->eval();
+        slave.commit(pins);
+        // The SystemC side gets this cycle's processor pins on the next one
+        sc_mmio = mmio;
+        drive_inputs();
+        clk.write(false);
+        sc_start(HALF_PERIOD);
+        rtl->clk = 0;
+        rtl->eval();
+        cycles++;
+        return true;
+    }
+
+    /// Slave responses and reset to both models, processor pins with the SystemC lag
+    void drive_inputs() {
+        rst.write(reset);
+        proc_addr.write(sc_mmio.addr);
+        proc_wdata.write(sc_mmio.wdata);
+        proc_we.write(sc_mmio.we);
+        awready.write(pins.awready);
+        wready.write(pins.wready);
+        bresp.write(pins.bresp);
+        bvalid.write(pins.bvalid);
+        arready.write(pins.arready);
+        rid.write(pins.rid);
+        rdata.write(pins.rdata);
+        rresp.write(pins.rresp);
+        rvalid.write(pins.rvalid);
+
+        rtl->rst_n = !reset;
+        rtl->proc_addr = mmio.addr;
+        rtl->proc_wdata = mmio.wdata;
+        rtl->proc_we = mmio.we;
+        rtl->M_AXI_AWREADY = pins.awready;
+        rtl->M_AXI_WREADY  = pins.wready;
+        rtl->M_AXI_BRESP   = pins.bresp;
+        rtl->M_AXI_BVALID  = pins.bvalid;
+        rtl->M_AXI_ARREADY = pins.arready;
+        rtl->M_AXI_RID     = pins.rid;
+        rtl->M_AXI_RDATA   = pins.rdata;
+        rtl->M_AXI_RRESP   = pins.rresp;
+        rtl->M_AXI_RVALID  = pins.rvalid;
+    }
+
+    Sample sample() const {
+        Sample s;
+        s.cycle = cycles;
+        s.sc = pins;
+        s.sc.awaddr  = awaddr.read().to_uint();
+        s.sc.awlen   = awlen.read().to_uint();
+        s.sc.awvalid = awvalid.read();
+        s.sc.wdata   = wdata.read().to_uint64();
+        s.sc.wstrb   = wstrb.read().to_uint();
+        s.sc.wlast   = wlast.read();
+        s.sc.wvalid  = wvalid.read();
+        s.sc.bready  = bready.read();
+        s.sc.arid    = arid.read().to_uint();
+        s.sc.araddr  = araddr.read().to_uint();
+        s.sc.arlen   = arlen.read().to_uint();
+        s.sc.arvalid = arvalid.read();
+        s.sc.rready  = rready.read();
+        s.sc_status = sole.reg_status.read().to_uint();
+        s.sc_interrupt = interrupt.read();
+
+        s.rtl = pins;
+        s.rtl.awaddr  = rtl->M_AXI_AWADDR;
+        s.rtl.awlen   = rtl->M_AXI_AWLEN;
+        s.rtl.awvalid = rtl->M_AXI_AWVALID;
+        s.rtl.wdata   = rtl->M_AXI_WDATA;
+        s.rtl.wstrb   = rtl->M_AXI_WSTRB;
+        s.rtl.wlast   = rtl->M_AXI_WLAST;
+        s.rtl.wvalid  = rtl->M_AXI_WVALID;
+        s.rtl.bready  = rtl->M_AXI_BREADY;
+        s.rtl.arid    = rtl->M_AXI_ARID;
+        s.rtl.araddr  = rtl->M_AXI_ARADDR;
+        s.rtl.arlen   = rtl->M_AXI_ARLEN;
+        s.rtl.arvalid = rtl->M_AXI_ARVALID;
+        s.rtl.rready  = rtl->M_AXI_RREADY;
+        s.rtl_status = rtl->rootp->SOLE__DOT__softmax_status;
+        s.rtl_interrupt = rtl->interrupt;
+        return s;
+    }
+
+    /// True if both sides agree; otherwise print the differing fields and the history
+    bool compare(const Sample& s) const {
+        struct Field { const char* name; uint64_t sc, rtl; };
+        // Address and data only count while their VALID is high; the models are
+        // free to differ in between
+        auto when = [](bool valid, uint64_t value) -> uint64_t { return valid ? value : 0; };
+        const Field fields[] = {
+            {"M_AXI_AWVALID", s.sc.awvalid, s.rtl.awvalid},
+            {"M_AXI_AWADDR",  when(s.sc.awvalid, s.sc.awaddr), when(s.rtl.awvalid, s.rtl.awaddr)},
+            {"M_AXI_AWLEN",   when(s.sc.awvalid, s.sc.awlen), when(s.rtl.awvalid, s.rtl.awlen)},
+            {"M_AXI_WVALID",  s.sc.wvalid, s.rtl.wvalid},
+            {"M_AXI_WDATA",   when(s.sc.wvalid, s.sc.wdata), when(s.rtl.wvalid, s.rtl.wdata)},
+            {"M_AXI_WSTRB",   when(s.sc.wvalid, s.sc.wstrb), when(s.rtl.wvalid, s.rtl.wstrb)},
+            {"M_AXI_WLAST",   when(s.sc.wvalid, s.sc.wlast), when(s.rtl.wvalid, s.rtl.wlast)},
+            {"M_AXI_BREADY",  s.sc.bready, s.rtl.bready},
+            {"M_AXI_ARVALID", s.sc.arvalid, s.rtl.arvalid},
+            {"M_AXI_ARID",    when(s.sc.arvalid, s.sc.arid), when(s.rtl.arvalid, s.rtl.arid)},
+            {"M_AXI_ARADDR",  when(s.sc.arvalid, s.sc.araddr), when(s.rtl.arvalid, s.rtl.araddr)},
+            {"M_AXI_ARLEN",   when(s.sc.arvalid, s.sc.arlen), when(s.rtl.arvalid, s.rtl.arlen)},
+            {"M_AXI_RREADY",  s.sc.rready, s.rtl.rready},
+            {"status",        s.sc_status, s.rtl_status},
+            {"interrupt",     s.sc_interrupt, s.rtl_interrupt},
+        };
+        bool same = true;
+        for (const Field& f : fields) {
+            if (f.sc != f.rtl) same = false;
+        }
+        if (same) {
+            return true;
+        }
+        std::printf("[DIVERGE] %s: cycle %lld (%lld after START)\n", case_name.c_str(), s.cycle,
+                    start_cycle >= 0 ? s.cycle - start_cycle : -1);
+        std::printf("  %-14s %-18s %s\n", "field", "SystemC", "RTL");
+        for (const Field& f : fields) {
+            if (f.sc != f.rtl) {
+                std::printf("  %-14s 0x%-16llx 0x%llx\n", f.name, (unsigned long long)f.sc, (unsigned long long)f.rtl);
+            }
+        }
+        std::printf("  last %zu cycles (status / interrupt, then the --axi-log pin line):\n", past.size());
+        for (const Sample& p : past) {
+            std::printf("  SC  st=%08x irq=%d ", p.sc_status, p.sc_interrupt);
+            print_pins(stdout, p.cycle, p.sc);
+            std::printf("  RTL st=%08x irq=%d ", p.rtl_status, p.rtl_interrupt);
+            print_pins(stdout, p.cycle, p.rtl);
+        }
+        return false;
+    }
+
+    /// Two-cycle write as in SOLE_verilator_tb; false on divergence
+    bool mmio_write(uint32_t addr, uint32_t data) {
+        mmio.addr = addr;
+        mmio.wdata = data;
+        mmio.we = true;
+        settle_rtl();
+        if (!cycle()) return false;
+        mmio.we = false;
+        mmio.addr = REG_STATUS;
+        settle_rtl();
+        return cycle();
+    }
+
+    /// The RTL processor pins changed within the low phase (the SystemC ones only
+    /// change at the clock edge)
+    void settle_rtl() {
+        rtl->proc_addr = mmio.addr;
+        rtl->proc_wdata = mmio.wdata;
+        rtl->proc_we = mmio.we;
+        rtl->eval();
+    }
+
+    /// Poll REG_STATUS (RTL side) until a bit of 'mask' is set; 'timeout' on no
+    /// answer within max_cycles, false on divergence
+    bool wait_status(long max_cycles, uint32_t mask, uint32_t& status, bool& timeout) {
+        timeout = false;
+        for (long i = 0; ; i++) {
+            status = rtl->proc_rdata;
+            if (status & mask) {
+                return true;
+            }
+            if (i == max_cycles) {
+                timeout = true;
+                return true;
+            }
+            if (!cycle()) return false;
+        }
+    }
+
+    // SystemC side
+    sc_signal<bool>                           clk;
+    sc_signal<bool>                           rst;
+    sc_signal<sc_dt::sc_uint<32>>             proc_addr;
+    sc_signal<sc_dt::sc_uint<32>>             proc_wdata;
+    sc_signal<bool>                           proc_we;
+    sc_signal<sc_dt::sc_uint<32>>             proc_rdata;
+    sc_signal<bool>                           interrupt;
+    sc_signal<sc_dt::sc_uint<AXI_ADDR_WIDTH>> awaddr;
+    sc_signal<sc_dt::sc_uint<8>>              awlen;
+    sc_signal<sc_dt::sc_uint<3>>              awsize;
+    sc_signal<sc_dt::sc_uint<2>>              awburst;
+    sc_signal<bool>                           awvalid;
+    sc_signal<bool>                           awready;
+    sc_signal<sc_dt::sc_uint<AXI_DATA_WIDTH>> wdata;
+    sc_signal<sc_dt::sc_uint<AXI_STRB_WIDTH>> wstrb;
+    sc_signal<bool>                           wlast;
+    sc_signal<bool>                           wvalid;
+    sc_signal<bool>                           wready;
+    sc_signal<sc_dt::sc_uint<2>>              bresp;
+    sc_signal<bool>                           bvalid;
+    sc_signal<bool>                           bready;
+    sc_signal<sc_dt::sc_uint<AXI_ID_WIDTH>>   arid;
+    sc_signal<sc_dt::sc_uint<AXI_ADDR_WIDTH>> araddr;
+    sc_signal<sc_dt::sc_uint<8>>              arlen;
+    sc_signal<sc_dt::sc_uint<3>>              arsize;
+    sc_signal<sc_dt::sc_uint<2>>              arburst;
+    sc_signal<bool>                           arvalid;
+    sc_signal<bool>                           arready;
+    sc_signal<sc_dt::sc_uint<AXI_ID_WIDTH>>   rid;
+    sc_signal<sc_dt::sc_uint<AXI_DATA_WIDTH>> rdata;
+    sc_signal<sc_dt::sc_uint<2>>              rresp;
+    sc_signal<bool>                           rvalid;
+    sc_signal<bool>                           rready;
+    SOLE                                      sole;
+
+    // RTL side
+    std::unique_ptr<VSOLE> rtl;
+
+    Word_Memory             memory;
+    Axi_Slave_Cycle         slave;
+    Softmax_Cycle::Axi_Pins pins;       ///< Slave outputs driven into both models
+    bool                    reset = true;
+    Mmio                    mmio;       ///< RTL processor pins
+    Mmio                    sc_mmio;    ///< SystemC processor pins (one cycle behind)
+    size_t                  history;
+    std::deque<Sample>      past;
+    std::string             case_name;
+    long long               start_cycle = -1;
+};
+
+CosimResult Cosim::run(const TestCase& tc) {
+    CosimResult result;
+    std::vector<float> values;
+    std::string error;
+    if (!read_input(tc, values, error)) {
+        std::fprintf(stderr, "[ERROR] %s: %s\n", tc.name.c_str(), error.c_str());
+        return result;
+    }
+    const size_t num_data = values.size();
+    const size_t num_words = (num_data + 3) / 4;
+    result.input_count = num_data;
+    case_name = tc.name;
+    start_cycle = -1;
+    past.clear();
+
+    // Reset; memory contents and wait states are replaced while in reset
+    reset = true;
+    drive_inputs();
+    const size_t output_word = case_output_word(num_words);
+    memory.words.assign(case_memory_words(num_words), 0);
+    std::vector<uint16_t> fp16_input(num_words * 4, 0);
+    for (size_t i = 0; i < num_data; i++) {
+        fp16_input[i] = float_to_fp16(values[i]);
+    }
+    std::memcpy(&memory.words[INPUT_START_WORD], fp16_input.data(), fp16_input.size() * sizeof(uint16_t));
+    slave.set_wait_states(tc.arready_delay, tc.rvalid_delay, tc.wready_delay);
+    slave.set_read_model(tc.read_latency, tc.read_reorder);
+    for (int i = 0; i <= RESET_CYCLES; i++) {
+        if (i == RESET_CYCLES) {
+            reset = false;
+            drive_inputs();
+            sc_start(SC_ZERO_TIME);
+            rtl->eval();
+        }
+        if (!cycle()) {
+            result.diverged = true;
+            return result;
+        }
+    }
+
+    uint32_t status = 0;
+    bool timeout = false;
+    if (tc.error_recovery) {
+        // Zero-length START: both models must raise the error bit, the valid START recovers
+        if (!mmio_write(REG_LENGTH_L, 0) || !mmio_write(REG_LENGTH_H, 0) || !mmio_write(REG_CONTROL, 0x1) ||
+            !wait_status(64, STATUS_ERROR, status, timeout) || !mmio_write(REG_CONTROL, 0x0)) {
+            result.diverged = true;
+            return result;
+        }
+        if (timeout) {
+            std::fprintf(stderr, "[ERROR] %s: injected zero-length error was not reported (status=0x%08x)\n",
+                         tc.name.c_str(), status);
+            return result;
+        }
+    }
+
+    if (!mmio_write(REG_SRC_ADDR_BASE_L, INPUT_START_WORD * 8) || !mmio_write(REG_SRC_ADDR_BASE_H, 0) ||
+        !mmio_write(REG_DST_ADDR_BASE_L, (uint32_t)(output_word * 8)) || !mmio_write(REG_DST_ADDR_BASE_H, 0) ||
+        !mmio_write(REG_LENGTH_L, (uint32_t)num_data) || !mmio_write(REG_LENGTH_H, 0)) {
+        result.diverged = true;
+        return result;
+    }
+    start_cycle = cycles;
+    const uint32_t control = ((uint32_t)tc.read_outstanding << CTRL_READ_OUTSTANDING_LSB) |
+                             ((uint32_t)tc.burst_len << CTRL_BURST_LEN_LSB) |
+                             ((uint32_t)tc.reread << CTRL_REREAD_BIT);
+    if (!mmio_write(REG_CONTROL, control | 0x1) || !mmio_write(REG_CONTROL, control) ||
+        !wait_status(tc.timeout_cycles, STATUS_DONE | STATUS_ERROR, status, timeout)) {
+        result.diverged = true;
+        return result;
+    }
+    result.ran = true;
+    result.status = status;
+    if (!timeout) result.exec_cycles = (long)(cycles - start_cycle) + 1;
+    // Keep comparing while the last responses drain (and the SystemC side sees START = 0)
+    for (int i = 0; i < 4; i++) {
+        if (!cycle()) {
+            result.diverged = true;
+            return result;
+        }
+    }
+    return result;
+}
+
+static void usage(const char* prog) {
+    std::fprintf(stderr,
+                 "Usage: %s [--input FILE] [--length N] [--arready-delay N] [--rvalid-delay N]\n"
+                 "          [--wready-delay N] [--burst-len N] [--read-outstanding N] [--read-latency N]\n"
+                 "          [--read-reorder N] [--timeout-cycles N] [--error-recovery 0|1]\n"
+                 "          [--reread 0|1] [--name NAME] [--batch FILE] [--history N]\n",
+                 prog);
+}
+
+int sc_main(int argc, char* argv[]) {
+    TestCase base;
+    base.name = "case";
+    std::string batch_file;
+    long history = 8;
+    std::string error;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-h" || arg == "--help") {
+            usage(argv[0]);
+            return 2;
+        }
+        if (arg.compare(0, 2, "--") != 0) {
+            std::fprintf(stderr, "[ERROR] Unexpected argument '%s'\n", arg.c_str());
+            return 1;
+        }
+        std::string key = arg.substr(2);
+        std::string value;
+        size_t eq = key.find('=');
+        if (eq != std::string::npos) {
+            value = key.substr(eq + 1);
+            key = key.substr(0, eq);
+        } else if (i + 1 < argc) {
+            value = argv[++i];
+        } else {
+            std::fprintf(stderr, "[ERROR] Option --%s needs a value\n", key.c_str());
+            return 1;
+        }
+        if (key == "batch") {
+            batch_file = value;
+        } else if (key == "history") {
+            if (!parse_int(value, history)) {
+                std::fprintf(stderr, "[ERROR] history must be a non-negative integer, got '%s'\n", value.c_str());
+                return 1;
+            }
+        } else if (!apply_case_option(base, key, value, error)) {
+            std::fprintf(stderr, "[ERROR] %s\n", error.c_str());
+            return 1;
+        }
+    }
+
+    std::vector<TestCase> cases;
+    if (batch_file.empty()) {
+        cases.push_back(base);
+    } else if (!load_batch(batch_file, base, cases, error)) {
+        std::fprintf(stderr, "[ERROR] %s\n", error.c_str());
+        return 1;
+    }
+
+    std::unique_ptr<VerilatedContext> ctx(new VerilatedContext);
+    ctx->commandArgs(argc, argv);
+    Cosim cosim(ctx.get(), (size_t)history);
+    int rc = 0;
+    size_t matched = 0;
+    auto wall_start = std::chrono::steady_clock::now();
+    for (const TestCase& tc : cases) {
+        CosimResult r = cosim.run(tc);
+        if (r.diverged || !r.ran) {
+            rc = 1;
+            if (r.diverged) break;
+            continue;
+        }
+        matched++;
+        std::printf("[CASE] %s elements=%zu cycles=%ld status=0x%08x MATCH\n",
+                    tc.name.c_str(), r.input_count, r.exec_cycles, r.status);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+    std::printf("cases=%zu matched=%zu total_cycles=%lld wall_s=%.3f cycles_per_s=%.0f\n",
+                cases.size(), matched, cosim.cycles, seconds, seconds > 0 ? cosim.cycles / seconds : 0.0);
+    return rc;
+}
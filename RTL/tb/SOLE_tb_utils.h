@@ -0,0 +1,259 @@
+#ifndef SOLE_TB_UTILS_H
+#define SOLE_TB_UTILS_H
+
+/**
+ * @file SOLE_tb_utils.h
+ * @brief Case handling shared by the C++ testbenches of SOLE.sv
+ *
+ * Memory model, SOLE_test style case options and batch files, input loading
+ * and the AXI pin log line, used by SOLE_verilator_tb.cpp and SOLE_cosim_tb.cpp.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "SOLE_MMIO.hpp"
+#include "Softmax_Cycle.h"
+
+static const int INPUT_START_WORD = 100;
+static const int OUTPUT_START_WORD = 500;
+static const size_t MEM_WORDS = 2048;
+static const int RESET_CYCLES = 10;
+
+/// Output area of a case: behind the input when the two would overlap (long re-read rows)
+static size_t case_output_word(size_t num_words) {
+    return std::max((size_t)OUTPUT_START_WORD, INPUT_START_WORD + num_words);
+}
+
+/// Memory words of a case: at least MEM_WORDS, more for inputs that do not fit
+static size_t case_memory_words(size_t num_words) {
+    return std::max(MEM_WORDS, case_output_word(num_words) + num_words);
+}
+
+// SOLE MMIO map (src/SOLE.sv), same offsets as the SystemC model
+using namespace sole::mmio;
+static const uint32_t STATUS_DONE  = 1u << STAT_DONE_BIT;
+static const uint32_t STATUS_ERROR = 1u << STAT_ERROR_BIT;
+
+/// Flat 64-bit word memory; out-of-range accesses answer SLVERR
+class Word_Memory : public Softmax_Cycle_Memory {
+public:
+    explicit Word_Memory(size_t words) : words(words, 0) {}
+
+    uint8_t read(uint32_t addr, uint64_t& data) override {
+        size_t idx = addr >> 3;
+        if (idx >= words.size()) {
+            data = 0;
+            return 2;
+        }
+        data = words[idx];
+        return 0;
+    }
+
+    uint8_t write(uint32_t addr, uint64_t data, uint8_t strb) override {
+        size_t idx = addr >> 3;
+        if (idx >= words.size()) {
+            return 2;
+        }
+        uint64_t mask = 0;
+        for (int b = 0; b < 8; b++) {
+            if ((strb >> b) & 1) mask |= 0xFFull << (b * 8);
+        }
+        words[idx] = (words[idx] & ~mask) | (data & mask);
+        return 0;
+    }
+
+    std::vector<uint64_t> words;
+};
+
+struct TestCase {
+    std::string name;
+    std::string input = "../data/SOLE_test_Data_rtl.txt";
+    long        length = 0;          ///< 0 = every value of the input file
+    int         arready_delay = 0;
+    int         rvalid_delay = 0;
+    int         wready_delay = 0;
+    int         burst_len = 0;           ///< REG_CONTROL[15:8]: max beats per AXI burst - 1
+    int         read_outstanding = 0;    ///< REG_CONTROL[23:16]: max read bursts in flight (0 = 64)
+    int         read_latency = 0;        ///< Slave: pipelined read latency in cycles
+    int         read_reorder = 0;        ///< Slave: read reorder window - 1 (0 = in order)
+    long        timeout_cycles = 10000;
+    bool        error_recovery = false;
+    bool        reread = false;          ///< REG_CONTROL[24]: force the two-pass re-read mode
+};
+
+struct CaseResult {
+    size_t input_count = 0;
+    long   exec_cycles = -1;         ///< -1 = did not run or timed out
+    double cosine = 0.0;
+    bool   cosine_valid = false;
+    bool   timeout = false;
+    bool   passed = false;
+};
+
+static std::string trim(const std::string& s) {
+    size_t b = s.find_first_not_of(" \t\r\n");
+    size_t e = s.find_last_not_of(" \t\r\n");
+    return b == std::string::npos ? "" : s.substr(b, e - b + 1);
+}
+
+static bool parse_int(const std::string& value, long& out) {
+    char* end = nullptr;
+    long v = std::strtol(value.c_str(), &end, 0);
+    if (value.empty() || *end != '\0' || v < 0) {
+        return false;
+    }
+    out = v;
+    return true;
+}
+
+/// Apply one case key ('-' or '_' separated); false with 'error' set on failure
+static bool apply_case_option(TestCase& tc, std::string key, const std::string& value, std::string& error) {
+    for (char& c : key) {
+        if (c == '-') c = '_';
+    }
+    long v = 0;
+    if (key == "name") {
+        tc.name = value;
+        return true;
+    }
+    if (key == "input") {
+        tc.input = value;
+        return true;
+    }
+    if (key != "length" && key != "arready_delay" && key != "rvalid_delay" && key != "wready_delay" &&
+        key != "burst_len" && key != "read_outstanding" && key != "read_latency" && key != "read_reorder" &&
+        key != "timeout_cycles" && key != "error_recovery" && key != "reread") {
+        error = "unknown option '" + key + "'";
+        return false;
+    }
+    if (!parse_int(value, v)) {
+        error = key + " must be a non-negative integer, got '" + value + "'";
+        return false;
+    }
+    if (key == "length")              tc.length = v;
+    else if (key == "arready_delay")  tc.arready_delay = (int)v;
+    else if (key == "rvalid_delay")   tc.rvalid_delay = (int)v;
+    else if (key == "wready_delay")   tc.wready_delay = (int)v;
+    else if (key == "burst_len") {
+        if (v > 0xFF) {
+            error = "burst_len must be at most 255, got '" + value + "'";
+            return false;
+        }
+        tc.burst_len = (int)v;
+    }
+    else if (key == "read_outstanding") {
+        if (v > 0xFF) {
+            error = "read_outstanding must be at most 255, got '" + value + "'";
+            return false;
+        }
+        tc.read_outstanding = (int)v;
+    }
+    else if (key == "read_latency")   tc.read_latency = (int)v;
+    else if (key == "read_reorder")   tc.read_reorder = (int)v;
+    else if (key == "timeout_cycles") tc.timeout_cycles = v;
+    else if (key == "reread")         tc.reread = (v != 0);
+    else                              tc.error_recovery = (v != 0);
+    return true;
+}
+
+/// Batch lines: whitespace separated key=value, values may be double-quoted
+static bool load_batch(const std::string& path, const TestCase& base, std::vector<TestCase>& cases, std::string& error) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        error = "failed to open batch file " + path;
+        return false;
+    }
+    std::string line;
+    int line_no = 0;
+    while (std::getline(file, line)) {
+        line_no++;
+        line = trim(line.substr(0, line.find('#')));
+        if (line.empty()) continue;
+        TestCase tc = base;
+        tc.name = "case" + std::to_string(line_no);
+        size_t pos = 0;
+        while (pos < line.size()) {
+            while (pos < line.size() && std::isspace((unsigned char)line[pos])) pos++;
+            if (pos >= line.size()) break;
+            size_t eq = line.find('=', pos);
+            if (eq == std::string::npos) {
+                error = path + ":" + std::to_string(line_no) + ": expected key=value";
+                return false;
+            }
+            std::string key = line.substr(pos, eq - pos);
+            std::string value;
+            pos = eq + 1;
+            if (pos < line.size() && line[pos] == '"') {
+                size_t close = line.find('"', pos + 1);
+                if (close == std::string::npos) {
+                    error = path + ":" + std::to_string(line_no) + ": unterminated quote";
+                    return false;
+                }
+                value = line.substr(pos + 1, close - pos - 1);
+                pos = close + 1;
+            } else {
+                size_t end = pos;
+                while (end < line.size() && !std::isspace((unsigned char)line[end])) end++;
+                value = line.substr(pos, end - pos);
+                pos = end;
+            }
+            if (!apply_case_option(tc, key, value, error)) {
+                error = path + ":" + std::to_string(line_no) + ": " + error;
+                return false;
+            }
+        }
+        cases.push_back(tc);
+    }
+    if (cases.empty()) {
+        error = "batch file " + path + " has no cases";
+        return false;
+    }
+    return true;
+}
+
+/// One value per line, lines without a number are skipped (as SOLE_test does)
+static bool read_input(const TestCase& tc, std::vector<float>& values, std::string& error) {
+    std::ifstream file(tc.input);
+    if (!file.is_open()) {
+        error = "failed to open " + tc.input;
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        std::stringstream ss(line);
+        float v;
+        if (ss >> v) values.push_back(v);
+    }
+    if (tc.length > 0) {
+        if ((size_t)tc.length > values.size()) {
+            error = tc.input + " has " + std::to_string(values.size()) + " values, length=" +
+                    std::to_string(tc.length) + " requested";
+            return false;
+        }
+        values.resize(tc.length);
+    }
+    if (values.empty()) {
+        error = "no input data found in " + tc.input;
+        return false;
+    }
+    return true;
+}
+/// One line of the SOLE_test --axi-log format
+static void print_pins(std::FILE* f, long long cycle, const Softmax_Cycle::Axi_Pins& p) {
+    std::fprintf(f, "%lld AW %d%d %x %x W %d%d %llx %x %d B %d%d %x AR %d%d %x %x %x R %d%d %llx %x %x\n",
+                 cycle, p.awvalid, p.awready, p.awaddr, p.awlen,
+                 p.wvalid, p.wready, (unsigned long long)p.wdata, p.wstrb, p.wlast,
+                 p.bvalid, p.bready, p.bresp,
+                 p.arvalid, p.arready, p.araddr, p.arlen, p.arid,
+                 p.rvalid, p.rready, (unsigned long long)p.rdata, p.rresp, p.rid);
+}
+
+#endif // SOLE_TB_UTILS_H
@@ -16,6 +16,16 @@
 `define AXI_WRITE_WREADY_DELAY 10
 `endif
 
+// REG_CONTROL[15:8]: max AXI burst length - 1 (0 = single-beat transfers)
+`ifndef AXI_BURST_LEN
+`define AXI_BURST_LEN 0
+`endif
+
+// REG_CONTROL[23:16]: max read bursts in flight (0 = 64); the slave answers in order
+`ifndef AXI_READ_OUTSTANDING
+`define AXI_READ_OUTSTANDING 0
+`endif
+
 `ifndef error_recovery_test
 `define error_recovery_test 0
 `endif
@@ -27,18 +37,23 @@ module AxiSlaveMemory #(
   input  logic        rst_n,
   input  logic        force_zero_delay,
   input  logic [31:0] S_AXI_AWADDR,
+  input  logic [7:0]  S_AXI_AWLEN,
   input  logic        S_AXI_AWVALID,
   output logic        S_AXI_AWREADY,
   input  logic [63:0] S_AXI_WDATA,
   input  logic [7:0]  S_AXI_WSTRB,
+  input  logic        S_AXI_WLAST,
   input  logic        S_AXI_WVALID,
   output logic        S_AXI_WREADY,
   output logic [1:0]  S_AXI_BRESP,
   output logic        S_AXI_BVALID,
   input  logic        S_AXI_BREADY,
+  input  logic [5:0]  S_AXI_ARID,
   input  logic [31:0] S_AXI_ARADDR,
+  input  logic [7:0]  S_AXI_ARLEN,
   input  logic        S_AXI_ARVALID,
   output logic        S_AXI_ARREADY,
+  output logic [5:0]  S_AXI_RID,
   output logic [63:0] S_AXI_RDATA,
   output logic [1:0]  S_AXI_RRESP,
   output logic        S_AXI_RVALID,
@@ -54,6 +69,8 @@ module AxiSlaveMemory #(
 
   logic [31:0] write_addr_queue[$];
   logic [31:0] read_addr_queue[$];
+  logic [7:0]  read_len_queue[$];
+  logic [5:0]  read_id_queue[$];
   logic [31:0] write_addr_buf;
   logic [31:0] last_write_addr;
   logic [31:0] addr_buf;
@@ -64,6 +81,13 @@ module AxiSlaveMemory #(
   integer      arready_delay_cnt;
   integer      rvalid_delay_cnt;
   logic        has_addr;
+  // INCR bursts (8-byte beats): a W burst ends at WLAST and gets one B;
+  // a read burst returns ARLEN + 1 words from consecutive addresses
+  logic        wr_in_burst;
+  logic        wr_burst_err;
+  logic [31:0] rd_addr;
+  logic [7:0]  rd_beats_left;
+  logic [5:0]  rd_id;             // RID = ARID of the burst being returned
 
   always @(posedge clk) begin
     if (do_write) begin
@@ -80,6 +104,7 @@ module AxiSlaveMemory #(
       S_AXI_ARREADY <= 1'b0;
       S_AXI_RVALID <= 1'b0;
       S_AXI_RRESP <= AXI_RESP_OKAY;
+      S_AXI_RID <= 6'd0;
       S_AXI_RDATA <= 64'd0;
 
       awaddr_q <= 32'd0;
@@ -90,6 +115,9 @@ module AxiSlaveMemory #(
 
       write_addr_queue = {};
       read_addr_queue = {};
+      read_len_queue = {};
+      read_id_queue = {};
+      rd_id = 6'd0;
       write_addr_buf = 32'd0;
       last_write_addr = 32'd0;
       addr_buf = 32'd0;
@@ -100,6 +128,10 @@ module AxiSlaveMemory #(
       arready_delay_cnt = -1;
       rvalid_delay_cnt = -1;
       has_addr = 1'b0;
+      wr_in_burst = 1'b0;
+      wr_burst_err = 1'b0;
+      rd_addr = 32'd0;
+      rd_beats_left = 8'd0;
     end else begin
       integer rd_ar_delay;
       integer rd_r_delay;
@@ -129,24 +161,33 @@ module AxiSlaveMemory #(
 
         if (S_AXI_WVALID && S_AXI_WREADY) begin
           logic [31:0] wr_addr;
-          if (S_AXI_AWVALID && S_AXI_AWREADY) begin
+          if (wr_in_burst) begin
+            wr_addr = last_write_addr + 32'd8;
+          end else if (S_AXI_AWVALID && S_AXI_AWREADY) begin
             wr_addr = S_AXI_AWADDR;
           end else if (awaddr_valid) begin
             wr_addr = awaddr_q;
           end else begin
             wr_addr = 32'd0;
           end
+          last_write_addr = wr_addr;
 
           if ((wr_addr >> 3) < TEST_DATA_SIZE) begin
             do_write <= 1'b1;
             write_addr_q <= wr_addr;
             write_data_q <= S_AXI_WDATA;
-            S_AXI_BRESP <= AXI_RESP_OKAY;
           end else begin
-            S_AXI_BRESP <= AXI_RESP_SLVERR;
+            wr_burst_err = 1'b1;
           end
           awaddr_valid <= 1'b0;
-          S_AXI_BVALID <= 1'b1;
+          if (S_AXI_WLAST) begin
+            S_AXI_BRESP <= wr_burst_err ? AXI_RESP_SLVERR : AXI_RESP_OKAY;
+            S_AXI_BVALID <= 1'b1;
+            wr_burst_err = 1'b0;
+          end else if (S_AXI_BVALID && S_AXI_BREADY) begin
+            S_AXI_BVALID <= 1'b0;
+          end
+          wr_in_burst = !S_AXI_WLAST;
         end else if (S_AXI_BVALID && S_AXI_BREADY) begin
           S_AXI_BVALID <= 1'b0;
         end
@@ -160,9 +201,26 @@ module AxiSlaveMemory #(
             S_AXI_RRESP <= AXI_RESP_SLVERR;
           end
           S_AXI_RVALID <= 1'b1;
+          S_AXI_RID <= S_AXI_ARID;
+          rd_addr = S_AXI_ARADDR;
+          rd_beats_left = S_AXI_ARLEN;
         end else if (S_AXI_RVALID && S_AXI_RREADY) begin
-          S_AXI_RVALID <= 1'b0;
+          if (rd_beats_left != 8'd0) begin
+            rd_addr = rd_addr + 32'd8;
+            rd_beats_left = rd_beats_left - 8'd1;
+            if ((rd_addr >> 3) < TEST_DATA_SIZE) begin
+              S_AXI_RDATA <= memory[rd_addr >> 3];
+              S_AXI_RRESP <= AXI_RESP_OKAY;
+            end else begin
+              S_AXI_RDATA <= 64'd0;
+              S_AXI_RRESP <= AXI_RESP_SLVERR;
+            end
+          end else begin
+            S_AXI_RVALID <= 1'b0;
+          end
         end
+        // No new AR until the remaining beats of the current burst are out
+        S_AXI_ARREADY <= (rd_beats_left == 8'd0);
       end else begin
         logic awready_now;
         logic wready_now;
@@ -194,6 +252,10 @@ module AxiSlaveMemory #(
             end
           end
         end
+        // Inside a write burst WREADY stays high until WLAST
+        if (wr_in_burst) begin
+          wready_now = 1'b1;
+        end
         S_AXI_WREADY <= wready_now;
 
         // ARREADY delay: once ARVALID is observed, wait N cycles, then allow one AR handshake.
@@ -229,7 +291,9 @@ module AxiSlaveMemory #(
         if (w_handshake) begin
           logic [31:0] wr_addr;
 
-          if (write_addr_queue.size() != 0) begin
+          if (wr_in_burst) begin
+            wr_addr = last_write_addr + 32'd8;
+          end else if (write_addr_queue.size() != 0) begin
             wr_addr = write_addr_queue[0];
             write_addr_queue.pop_front();
           end else if (has_last_write_addr) begin
@@ -245,19 +309,27 @@ module AxiSlaveMemory #(
           word_idx = wr_addr >> 3;
           if ((word_idx >= 0) && (word_idx < TEST_DATA_SIZE)) begin
             memory[word_idx] <= S_AXI_WDATA;
-            S_AXI_BRESP <= AXI_RESP_OKAY;
           end else begin
-            S_AXI_BRESP <= AXI_RESP_SLVERR;
+            wr_burst_err = 1'b1;
           end
-          S_AXI_BVALID <= 1'b1;
-          wready_wait_pending = 1'b0;
-          wready_delay_cnt = -1;
+          if (S_AXI_WLAST) begin
+            S_AXI_BRESP <= wr_burst_err ? AXI_RESP_SLVERR : AXI_RESP_OKAY;
+            S_AXI_BVALID <= 1'b1;
+            wr_burst_err = 1'b0;
+            wready_wait_pending = 1'b0;
+            wready_delay_cnt = -1;
+          end else if (S_AXI_BVALID && S_AXI_BREADY) begin
+            S_AXI_BVALID <= 1'b0;
+          end
+          wr_in_burst = !S_AXI_WLAST;
         end else if (S_AXI_BVALID && S_AXI_BREADY) begin
           S_AXI_BVALID <= 1'b0;
         end
 
         if (ar_handshake) begin
           read_addr_queue.push_back(S_AXI_ARADDR);
+          read_len_queue.push_back(S_AXI_ARLEN);
+          read_id_queue.push_back(S_AXI_ARID);
           arready_wait_pending = 1'b0;
           arready_delay_cnt = -1;
         end
@@ -265,7 +337,11 @@ module AxiSlaveMemory #(
         if (!has_addr && (read_addr_queue.size() != 0)) begin
           if (rd_r_delay <= 0) begin
             addr_buf = read_addr_queue[0];
+            rd_beats_left = read_len_queue[0];
+            rd_id = read_id_queue[0];
             read_addr_queue.pop_front();
+            read_len_queue.pop_front();
+            read_id_queue.pop_front();
             has_addr = 1'b1;
             rvalid_delay_cnt = -1;
           end else begin
@@ -275,7 +351,11 @@ module AxiSlaveMemory #(
               rvalid_delay_cnt = rvalid_delay_cnt - 1;
             end else begin
               addr_buf = read_addr_queue[0];
+              rd_beats_left = read_len_queue[0];
+              rd_id = read_id_queue[0];
               read_addr_queue.pop_front();
+              read_len_queue.pop_front();
+              read_id_queue.pop_front();
               has_addr = 1'b1;
               rvalid_delay_cnt = -1;
             end
@@ -293,9 +373,15 @@ module AxiSlaveMemory #(
             S_AXI_RRESP <= AXI_RESP_SLVERR;
           end
           S_AXI_RVALID <= 1'b1;
+          S_AXI_RID <= rd_id;
           if (S_AXI_RREADY) begin
-            has_addr = 1'b0;
-            rvalid_delay_cnt = -1;
+            if (rd_beats_left != 8'd0) begin
+              addr_buf = addr_buf + 32'd8;
+              rd_beats_left = rd_beats_left - 8'd1;
+            end else begin
+              has_addr = 1'b0;
+              rvalid_delay_cnt = -1;
+            end
           end
         end else begin
           S_AXI_RVALID <= 1'b0;
@@ -319,18 +405,27 @@ module SOLE_test;
   logic interrupt;
 
   logic [31:0] M_AXI_AWADDR;
+  logic [7:0] M_AXI_AWLEN;
+  logic [2:0] M_AXI_AWSIZE;
+  logic [1:0] M_AXI_AWBURST;
   logic M_AXI_AWVALID;
   logic M_AXI_AWREADY;
   logic [63:0] M_AXI_WDATA;
   logic [7:0] M_AXI_WSTRB;
+  logic M_AXI_WLAST;
   logic M_AXI_WVALID;
   logic M_AXI_WREADY;
   logic [1:0] M_AXI_BRESP;
   logic M_AXI_BVALID;
   logic M_AXI_BREADY;
+  logic [5:0] M_AXI_ARID;
   logic [31:0] M_AXI_ARADDR;
+  logic [7:0] M_AXI_ARLEN;
+  logic [2:0] M_AXI_ARSIZE;
+  logic [1:0] M_AXI_ARBURST;
   logic M_AXI_ARVALID;
   logic M_AXI_ARREADY;
+  logic [5:0] M_AXI_RID;
   logic [63:0] M_AXI_RDATA;
   logic [1:0] M_AXI_RRESP;
   logic M_AXI_RVALID;
@@ -387,20 +482,24 @@ module SOLE_test;
   SOLE dut (
     .clk(clk), .rst_n(!rst),
     .proc_addr(proc_addr), .proc_wdata(proc_wdata), .proc_we(proc_we), .proc_rdata(proc_rdata), .interrupt(interrupt),
-    .M_AXI_AWADDR(M_AXI_AWADDR), .M_AXI_AWVALID(M_AXI_AWVALID), .M_AXI_AWREADY(M_AXI_AWREADY),
-    .M_AXI_WDATA(M_AXI_WDATA), .M_AXI_WSTRB(M_AXI_WSTRB), .M_AXI_WVALID(M_AXI_WVALID), .M_AXI_WREADY(M_AXI_WREADY),
+    .M_AXI_AWADDR(M_AXI_AWADDR), .M_AXI_AWLEN(M_AXI_AWLEN), .M_AXI_AWSIZE(M_AXI_AWSIZE), .M_AXI_AWBURST(M_AXI_AWBURST),
+    .M_AXI_AWVALID(M_AXI_AWVALID), .M_AXI_AWREADY(M_AXI_AWREADY),
+    .M_AXI_WDATA(M_AXI_WDATA), .M_AXI_WSTRB(M_AXI_WSTRB), .M_AXI_WLAST(M_AXI_WLAST), .M_AXI_WVALID(M_AXI_WVALID),
+    .M_AXI_WREADY(M_AXI_WREADY),
     .M_AXI_BRESP(M_AXI_BRESP), .M_AXI_BVALID(M_AXI_BVALID), .M_AXI_BREADY(M_AXI_BREADY),
-    .M_AXI_ARADDR(M_AXI_ARADDR), .M_AXI_ARVALID(M_AXI_ARVALID), .M_AXI_ARREADY(M_AXI_ARREADY),
-    .M_AXI_RDATA(M_AXI_RDATA), .M_AXI_RRESP(M_AXI_RRESP), .M_AXI_RVALID(M_AXI_RVALID), .M_AXI_RREADY(M_AXI_RREADY)
+    .M_AXI_ARID(M_AXI_ARID), .M_AXI_ARADDR(M_AXI_ARADDR), .M_AXI_ARLEN(M_AXI_ARLEN), .M_AXI_ARSIZE(M_AXI_ARSIZE),
+    .M_AXI_ARBURST(M_AXI_ARBURST), .M_AXI_ARVALID(M_AXI_ARVALID), .M_AXI_ARREADY(M_AXI_ARREADY),
+    .M_AXI_RID(M_AXI_RID), .M_AXI_RDATA(M_AXI_RDATA), .M_AXI_RRESP(M_AXI_RRESP), .M_AXI_RVALID(M_AXI_RVALID), .M_AXI_RREADY(M_AXI_RREADY)
   );
 
   AxiSlaveMemory mem (
     .clk(clk), .rst_n(!rst), .force_zero_delay(recovery_force_zero_delay),
-    .S_AXI_AWADDR(M_AXI_AWADDR), .S_AXI_AWVALID(M_AXI_AWVALID), .S_AXI_AWREADY(M_AXI_AWREADY),
-    .S_AXI_WDATA(M_AXI_WDATA), .S_AXI_WSTRB(M_AXI_WSTRB), .S_AXI_WVALID(M_AXI_WVALID), .S_AXI_WREADY(M_AXI_WREADY),
+    .S_AXI_AWADDR(M_AXI_AWADDR), .S_AXI_AWLEN(M_AXI_AWLEN), .S_AXI_AWVALID(M_AXI_AWVALID), .S_AXI_AWREADY(M_AXI_AWREADY),
+    .S_AXI_WDATA(M_AXI_WDATA), .S_AXI_WSTRB(M_AXI_WSTRB), .S_AXI_WLAST(M_AXI_WLAST), .S_AXI_WVALID(M_AXI_WVALID),
+    .S_AXI_WREADY(M_AXI_WREADY),
     .S_AXI_BRESP(M_AXI_BRESP), .S_AXI_BVALID(M_AXI_BVALID), .S_AXI_BREADY(M_AXI_BREADY),
-    .S_AXI_ARADDR(M_AXI_ARADDR), .S_AXI_ARVALID(M_AXI_ARVALID), .S_AXI_ARREADY(M_AXI_ARREADY),
-    .S_AXI_RDATA(M_AXI_RDATA), .S_AXI_RRESP(M_AXI_RRESP), .S_AXI_RVALID(M_AXI_RVALID), .S_AXI_RREADY(M_AXI_RREADY)
+    .S_AXI_ARID(M_AXI_ARID), .S_AXI_ARADDR(M_AXI_ARADDR), .S_AXI_ARLEN(M_AXI_ARLEN), .S_AXI_ARVALID(M_AXI_ARVALID),
+    .S_AXI_ARREADY(M_AXI_ARREADY), .S_AXI_RID(M_AXI_RID), .S_AXI_RDATA(M_AXI_RDATA), .S_AXI_RRESP(M_AXI_RRESP), .S_AXI_RVALID(M_AXI_RVALID), .S_AXI_RREADY(M_AXI_RREADY)
   );
 
   task mmio_write(input logic [31:0] addr, input logic [31:0] data);
@@ -579,7 +678,7 @@ module SOLE_test;
     end else begin
       // Rearm interrupt latch on every software START write so recovery runs
       // do not inherit a previously latched interrupt.
-      if (proc_we && (proc_addr == REG_CONTROL) && (proc_wdata == 32'h0000_0001)) begin
+      if (proc_we && (proc_addr == REG_CONTROL) && proc_wdata[CTRL_START_BIT]) begin
         interrupt_seen <= 1'b0;
       end else if (interrupt && !interrupt_prev) begin
         interrupt_seen <= 1'b1;
@@ -667,8 +766,9 @@ module SOLE_test;
     run_datetime = get_local_datetime();
     $fdisplay(test_log_fh, "%s", run_datetime);
     $fdisplay(test_log_fh, "===== SOLE TEST LOG =====");
-    $fdisplay(test_log_fh, "[STRESS CONFIG] AXI_READ_ARREADY_DELAY=%0d AXI_READ_RVALID_DELAY=%0d AXI_WRITE_WREADY_DELAY=%0d error_recovery_test=%0d",
-          `AXI_READ_ARREADY_DELAY, `AXI_READ_RVALID_DELAY, `AXI_WRITE_WREADY_DELAY, `error_recovery_test);
+    $fdisplay(test_log_fh, "[STRESS CONFIG] AXI_READ_ARREADY_DELAY=%0d AXI_READ_RVALID_DELAY=%0d AXI_WRITE_WREADY_DELAY=%0d AXI_BURST_LEN=%0d AXI_READ_OUTSTANDING=%0d error_recovery_test=%0d",
+          `AXI_READ_ARREADY_DELAY, `AXI_READ_RVALID_DELAY, `AXI_WRITE_WREADY_DELAY, `AXI_BURST_LEN,
+          `AXI_READ_OUTSTANDING, `error_recovery_test);
     $fdisplay(monitor_log_fh, "[CONTINUOUS MONITOR STARTED]");
 
     data_file_path = "../data/SOLE_test_Data_rtl.txt";
@@ -825,14 +925,19 @@ module SOLE_test;
     mmio_write(REG_LENGTH_H, 0);
     $fdisplay(test_log_fh, "%0d ns,REG_LENGTH_H,0x0,length high", sim_time_ns());
     start_time_ns = sim_time_ns();
-    mmio_write(REG_CONTROL, 32'h0000_0001);
-    $fdisplay(test_log_fh, "%0d ns,REG_CONTROL,0x1,mode=softmax start=1", sim_time_ns());
+    mmio_write(REG_CONTROL, (32'(`AXI_READ_OUTSTANDING) << CTRL_READ_OUTSTANDING_LSB) |
+                            (32'(`AXI_BURST_LEN) << CTRL_BURST_LEN_LSB) | 32'h0000_0001);
+    $fdisplay(test_log_fh, "%0d ns,REG_CONTROL,0x%0h,mode=softmax start=1 burst_len=%0d read_outstanding=%0d",
+              sim_time_ns(), (32'(`AXI_READ_OUTSTANDING) << CTRL_READ_OUTSTANDING_LSB) |
+                             (32'(`AXI_BURST_LEN) << CTRL_BURST_LEN_LSB) | 32'h0000_0001,
+              `AXI_BURST_LEN, `AXI_READ_OUTSTANDING);
     if (`error_recovery_test && (monitor_log_fh != 0)) begin
       $fdisplay(monitor_log_fh,
                 "[RECOVERY] restart_start_written @%0d ns",
                 sim_time_ns());
     end
-    mmio_write(REG_CONTROL, 32'h0000_0000);
+    mmio_write(REG_CONTROL, (32'(`AXI_READ_OUTSTANDING) << CTRL_READ_OUTSTANDING_LSB) |
+                            (32'(`AXI_BURST_LEN) << CTRL_BURST_LEN_LSB));
 
   `ifndef POST_SIM
     dump_sole_mmio(test_log_fh);
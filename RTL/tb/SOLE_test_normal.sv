@@ -19,9 +19,11 @@ module AxiSlaveMemory #(
   output logic [1:0]  S_AXI_BRESP,
   output logic        S_AXI_BVALID,
   input  logic        S_AXI_BREADY,
+  input  logic [5:0]  S_AXI_ARID,
   input  logic [31:0] S_AXI_ARADDR,
   input  logic        S_AXI_ARVALID,
   output logic        S_AXI_ARREADY,
+  output logic [5:0]  S_AXI_RID,
   output logic [63:0] S_AXI_RDATA,
   output logic [1:0]  S_AXI_RRESP,
   output logic        S_AXI_RVALID,
@@ -51,6 +53,7 @@ module AxiSlaveMemory #(
       S_AXI_ARREADY <= 1'b0;
       S_AXI_RVALID <= 1'b0;
       S_AXI_RRESP <= AXI_RESP_OKAY;
+      S_AXI_RID <= 6'd0;
       S_AXI_RDATA <= 64'd0;
       awaddr_q <= 32'd0;
       awaddr_valid <= 1'b0;
@@ -101,6 +104,7 @@ module AxiSlaveMemory #(
           S_AXI_RRESP <= AXI_RESP_SLVERR;
         end
         S_AXI_RVALID <= 1'b1;
+        S_AXI_RID <= S_AXI_ARID;
       end else if (S_AXI_RVALID && S_AXI_RREADY) begin
         S_AXI_RVALID <= 1'b0;
       end
@@ -122,18 +126,27 @@ module SOLE_test;
   logic interrupt;
 
   logic [31:0] M_AXI_AWADDR;
+  logic [7:0] M_AXI_AWLEN;
+  logic [2:0] M_AXI_AWSIZE;
+  logic [1:0] M_AXI_AWBURST;
   logic M_AXI_AWVALID;
   logic M_AXI_AWREADY;
   logic [63:0] M_AXI_WDATA;
   logic [7:0] M_AXI_WSTRB;
+  logic M_AXI_WLAST;
   logic M_AXI_WVALID;
   logic M_AXI_WREADY;
   logic [1:0] M_AXI_BRESP;
   logic M_AXI_BVALID;
   logic M_AXI_BREADY;
+  logic [5:0] M_AXI_ARID;
   logic [31:0] M_AXI_ARADDR;
+  logic [7:0] M_AXI_ARLEN;
+  logic [2:0] M_AXI_ARSIZE;
+  logic [1:0] M_AXI_ARBURST;
   logic M_AXI_ARVALID;
   logic M_AXI_ARREADY;
+  logic [5:0] M_AXI_RID;
   logic [63:0] M_AXI_RDATA;
   logic [1:0] M_AXI_RRESP;
   logic M_AXI_RVALID;
@@ -187,11 +200,14 @@ module SOLE_test;
   SOLE dut (
     .clk(clk), .rst_n(!rst),
     .proc_addr(proc_addr), .proc_wdata(proc_wdata), .proc_we(proc_we), .proc_rdata(proc_rdata), .interrupt(interrupt),
-    .M_AXI_AWADDR(M_AXI_AWADDR), .M_AXI_AWVALID(M_AXI_AWVALID), .M_AXI_AWREADY(M_AXI_AWREADY),
-    .M_AXI_WDATA(M_AXI_WDATA), .M_AXI_WSTRB(M_AXI_WSTRB), .M_AXI_WVALID(M_AXI_WVALID), .M_AXI_WREADY(M_AXI_WREADY),
+    .M_AXI_AWADDR(M_AXI_AWADDR), .M_AXI_AWLEN(M_AXI_AWLEN), .M_AXI_AWSIZE(M_AXI_AWSIZE), .M_AXI_AWBURST(M_AXI_AWBURST),
+    .M_AXI_AWVALID(M_AXI_AWVALID), .M_AXI_AWREADY(M_AXI_AWREADY),
+    .M_AXI_WDATA(M_AXI_WDATA), .M_AXI_WSTRB(M_AXI_WSTRB), .M_AXI_WLAST(M_AXI_WLAST), .M_AXI_WVALID(M_AXI_WVALID),
+    .M_AXI_WREADY(M_AXI_WREADY),
     .M_AXI_BRESP(M_AXI_BRESP), .M_AXI_BVALID(M_AXI_BVALID), .M_AXI_BREADY(M_AXI_BREADY),
-    .M_AXI_ARADDR(M_AXI_ARADDR), .M_AXI_ARVALID(M_AXI_ARVALID), .M_AXI_ARREADY(M_AXI_ARREADY),
-    .M_AXI_RDATA(M_AXI_RDATA), .M_AXI_RRESP(M_AXI_RRESP), .M_AXI_RVALID(M_AXI_RVALID), .M_AXI_RREADY(M_AXI_RREADY)
+    .M_AXI_ARID(M_AXI_ARID), .M_AXI_ARADDR(M_AXI_ARADDR), .M_AXI_ARLEN(M_AXI_ARLEN), .M_AXI_ARSIZE(M_AXI_ARSIZE),
+    .M_AXI_ARBURST(M_AXI_ARBURST), .M_AXI_ARVALID(M_AXI_ARVALID), .M_AXI_ARREADY(M_AXI_ARREADY),
+    .M_AXI_RID(M_AXI_RID), .M_AXI_RDATA(M_AXI_RDATA), .M_AXI_RRESP(M_AXI_RRESP), .M_AXI_RVALID(M_AXI_RVALID), .M_AXI_RREADY(M_AXI_RREADY)
   );
 
   AxiSlaveMemory mem (
@@ -199,8 +215,8 @@ module SOLE_test;
     .S_AXI_AWADDR(M_AXI_AWADDR), .S_AXI_AWVALID(M_AXI_AWVALID), .S_AXI_AWREADY(M_AXI_AWREADY),
     .S_AXI_WDATA(M_AXI_WDATA), .S_AXI_WSTRB(M_AXI_WSTRB), .S_AXI_WVALID(M_AXI_WVALID), .S_AXI_WREADY(M_AXI_WREADY),
     .S_AXI_BRESP(M_AXI_BRESP), .S_AXI_BVALID(M_AXI_BVALID), .S_AXI_BREADY(M_AXI_BREADY),
-    .S_AXI_ARADDR(M_AXI_ARADDR), .S_AXI_ARVALID(M_AXI_ARVALID), .S_AXI_ARREADY(M_AXI_ARREADY),
-    .S_AXI_RDATA(M_AXI_RDATA), .S_AXI_RRESP(M_AXI_RRESP), .S_AXI_RVALID(M_AXI_RVALID), .S_AXI_RREADY(M_AXI_RREADY)
+    .S_AXI_ARID(M_AXI_ARID), .S_AXI_ARADDR(M_AXI_ARADDR), .S_AXI_ARVALID(M_AXI_ARVALID), .S_AXI_ARREADY(M_AXI_ARREADY),
+    .S_AXI_RID(M_AXI_RID), .S_AXI_RDATA(M_AXI_RDATA), .S_AXI_RRESP(M_AXI_RRESP), .S_AXI_RVALID(M_AXI_RVALID), .S_AXI_RREADY(M_AXI_RREADY)
   );
 
   task mmio_write(input logic [31:0] addr, input logic [31:0] data);
@@ -533,6 +549,7 @@ module SOLE_test;
     mmio_write(REG_LENGTH_H, 0);
     $fdisplay(test_log_fh, "%0d ns,REG_LENGTH_H,0x0,length high", sim_time_ns());
     start_time_ns = sim_time_ns();
+    // BURST_LEN = 0: this slave model only handles single-beat transfers
     mmio_write(REG_CONTROL, 32'h0000_0001);
     $fdisplay(test_log_fh, "%0d ns,REG_CONTROL,0x1,mode=softmax start=1", sim_time_ns());
     mmio_write(REG_CONTROL, 32'h0000_0000);
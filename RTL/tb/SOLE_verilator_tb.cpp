@@ -0,0 +1,373 @@
+/**
+ * @file SOLE_verilator_tb.cpp
+ * @brief C++ testbench for the Verilator build of SOLE.sv (make verilator_sim)
+ *
+ * Drives the SOLE MMIO port the way tb/SOLE_test.sv does (reset, address and
+ * length registers, START = 1 then 0, poll REG_STATUS until DONE or error)
+ * and answers the AXI4-Lite master port with Axi_Slave_Cycle, the C++ copy of
+ * the AxiSlaveMemory in SystemC/test/SOLE_test.cpp (ARREADY / RVALID / WREADY
+ * wait states, address queues, WREADY pulse model). Memory layout matches
+ * SOLE_test: input from word 100, output from word 500, 2048 words (rows
+ * longer than 1600 elements put the output behind the input and grow the memory).
+ *
+ * Usage:
+ *   VSOLE_tb [--input FILE] [--length N] [--arready-delay N] [--rvalid-delay N]
+ *            [--wready-delay N] [--burst-len N] [--read-outstanding N] [--read-latency N]
+ *            [--read-reorder N] [--timeout-cycles N] [--error-recovery 0|1]
+ *            [--reread 0|1]
+ *            [--name NAME] [--batch FILE] [--csv FILE] [--output FILE] [--axi-log FILE]
+ *
+ *   --batch    One case per line, key=value pairs with the SOLE_test keys (name,
+ *              input, length, arready_delay, rvalid_delay, wready_delay,
+ *              burst_len, read_outstanding, read_latency, read_reorder,
+ *              timeout_cycles, error_recovery); unspecified keys come from
+ *              the command line. '-' and '_' are interchangeable in keys.
+ *   --csv      Per-case summary with the SOLE_test --csv columns, so
+ *              SystemC/tools/sole_sweep can drive this binary with -b
+ *   --output   Every output element: name,index,input,hw_fp16,hw_output,sw_output
+ *   --axi-log  Per-cycle AXI pin log in the SOLE_test --axi-log format
+ *
+ * Execution time is counted in clock cycles from the START write to the posedge
+ * that samples DONE or an error in REG_STATUS, as SOLE_test does; the clock
+ * is 1 ns, so execution_time_ns in the CSV is the same number. The reference is
+ * SOLE_softmax() from Csim/Softmax.h and a case passes with cosine > 0.99.
+ * The exit status is 0 if every case completed (as SOLE_test: a failed
+ * cosine check only shows up as FAIL), 1 if a case timed out or could not run.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "verilated.h"
+#include "VSOLE.h"
+
+#include "SOLE_tb_utils.h"
+#include "../../SystemC/test/test_utils.h"
+#include "../../Csim/Softmax.h"
+
+/// SOLE.sv plus the memory side; one call of cycle() is one clock period
+class Harness {
+public:
+    Harness(VerilatedContext* ctx, std::FILE* axi_log)
+        : top(new VSOLE(ctx)), memory(MEM_WORDS), slave(memory), axi_log(axi_log) {
+        top->clk = 0;
+        top->rst_n = 0;
+        top->proc_addr = REG_STATUS;
+        top->proc_wdata = 0;
+        top->proc_we = 0;
+        drive_slave();
+        top->eval();
+    }
+
+    ~Harness() { top->final(); }
+
+    CaseResult run(const TestCase& tc, std::FILE* output);
+
+    long long cycles = 0;
+
+private:
+    /// Settle, let the slave see the pre-edge master outputs, then the posedge
+    void cycle() {
+        top->clk = 0;
+        top->eval();
+        sample_master();
+        if (axi_log) log_pins();
+        slave.eval(pins, top->rst_n == 0);
+        top->clk = 1;
+        top->eval();
+        slave.commit(pins);
+        drive_slave();
+        cycles++;
+    }
+
+    void sample_master() {
+        pins.awaddr  = top->M_AXI_AWADDR;
+        pins.awlen   = top->M_AXI_AWLEN;
+        pins.awvalid = top->M_AXI_AWVALID;
+        pins.wdata   = top->M_AXI_WDATA;
+        pins.wstrb   = top->M_AXI_WSTRB;
+        pins.wlast   = top->M_AXI_WLAST;
+        pins.wvalid  = top->M_AXI_WVALID;
+        pins.bready  = top->M_AXI_BREADY;
+        pins.arid    = top->M_AXI_ARID;
+        pins.araddr  = top->M_AXI_ARADDR;
+        pins.arlen   = top->M_AXI_ARLEN;
+        pins.arvalid = top->M_AXI_ARVALID;
+        pins.rready  = top->M_AXI_RREADY;
+    }
+
+    void drive_slave() {
+        top->M_AXI_AWREADY = pins.awready;
+        top->M_AXI_WREADY  = pins.wready;
+        top->M_AXI_BRESP   = pins.bresp;
+        top->M_AXI_BVALID  = pins.bvalid;
+        top->M_AXI_ARREADY = pins.arready;
+        top->M_AXI_RID     = pins.rid;
+        top->M_AXI_RDATA   = pins.rdata;
+        top->M_AXI_RRESP   = pins.rresp;
+        top->M_AXI_RVALID  = pins.rvalid;
+    }
+
+    void log_pins() {
+        const Softmax_Cycle::Axi_Pins& p = pins;
+        if (p.awvalid || p.wvalid || p.bvalid || p.arvalid || p.rvalid) {
+            print_pins(axi_log, cycles, p);
+        }
+    }
+
+    /// Same two-cycle sequence as the mmio_write task of tb/SOLE_test.sv
+    void mmio_write(uint32_t addr, uint32_t data) {
+        top->proc_addr = addr;
+        top->proc_wdata = data;
+        top->proc_we = 1;
+        cycle();
+        top->proc_we = 0;
+        top->proc_addr = REG_STATUS;
+        cycle();
+    }
+
+    /// Poll REG_STATUS every cycle until a bit of 'mask' is set; false on timeout.
+    /// mmio_write() leaves proc_addr on REG_STATUS, so the current value counts.
+    bool wait_status(long max_cycles, uint32_t mask, uint32_t& status) {
+        top->proc_addr = REG_STATUS;
+        top->eval();
+        for (long i = 0; ; i++) {
+            status = top->proc_rdata;
+            if (status & mask) {
+                return true;
+            }
+            if (i == max_cycles) {
+                return false;
+            }
+            cycle();
+        }
+    }
+
+    std::unique_ptr<VSOLE> top;
+    Word_Memory memory;
+    Axi_Slave_Cycle slave;
+    Softmax_Cycle::Axi_Pins pins;
+    std::FILE* axi_log;
+};
+
+CaseResult Harness::run(const TestCase& tc, std::FILE* output) {
+    CaseResult result;
+    std::vector<float> values;
+    std::string error;
+    if (!read_input(tc, values, error)) {
+        std::fprintf(stderr, "[ERROR] %s: %s\n", tc.name.c_str(), error.c_str());
+        return result;
+    }
+    const size_t num_data = values.size();
+    const size_t num_words = (num_data + 3) / 4;
+    result.input_count = num_data;
+
+    // Reset; memory contents and wait states are replaced while in reset
+    top->rst_n = 0;
+    const size_t output_word = case_output_word(num_words);
+    memory.words.assign(case_memory_words(num_words), 0);
+    std::vector<uint16_t> fp16_input(num_words * 4, 0);
+    std::vector<float> hw_input(num_data);
+    for (size_t i = 0; i < num_data; i++) {
+        fp16_input[i] = float_to_fp16(values[i]);
+        hw_input[i] = fp16_to_float(fp16_input[i]);
+    }
+    std::memcpy(&memory.words[INPUT_START_WORD], fp16_input.data(), fp16_input.size() * sizeof(uint16_t));
+    slave.set_wait_states(tc.arready_delay, tc.rvalid_delay, tc.wready_delay);
+    slave.set_read_model(tc.read_latency, tc.read_reorder);
+    for (int i = 0; i < RESET_CYCLES; i++) cycle();
+    top->rst_n = 1;
+    cycle();
+
+    uint32_t status = 0;
+    if (tc.error_recovery) {
+        // A zero-length START must raise the error bit (it also pulses DONE, there
+        // is nothing to write); the valid START below recovers
+        mmio_write(REG_LENGTH_L, 0);
+        mmio_write(REG_LENGTH_H, 0);
+        mmio_write(REG_CONTROL, 0x1);
+        bool reported = wait_status(64, STATUS_ERROR, status);
+        mmio_write(REG_CONTROL, 0x0);
+        if (!reported) {
+            std::fprintf(stderr, "[ERROR] %s: injected zero-length error was not reported (status=0x%08x)\n",
+                         tc.name.c_str(), status);
+            return result;
+        }
+    }
+
+    mmio_write(REG_SRC_ADDR_BASE_L, INPUT_START_WORD * 8);
+    mmio_write(REG_SRC_ADDR_BASE_H, 0);
+    mmio_write(REG_DST_ADDR_BASE_L, (uint32_t)(output_word * 8));
+    mmio_write(REG_DST_ADDR_BASE_H, 0);
+    mmio_write(REG_LENGTH_L, (uint32_t)num_data);
+    mmio_write(REG_LENGTH_H, 0);
+    long long start_cycle = cycles;
+    const uint32_t control = ((uint32_t)tc.read_outstanding << CTRL_READ_OUTSTANDING_LSB) |
+                             ((uint32_t)tc.burst_len << CTRL_BURST_LEN_LSB) |
+                             ((uint32_t)tc.reread << CTRL_REREAD_BIT);
+    mmio_write(REG_CONTROL, control | 0x1);
+    mmio_write(REG_CONTROL, control);
+
+    if (!wait_status(tc.timeout_cycles, STATUS_DONE | STATUS_ERROR, status)) {
+        result.timeout = true;
+        std::fprintf(stderr, "[ERROR] %s: timeout after %ld cycles, status=0x%08x\n",
+                     tc.name.c_str(), tc.timeout_cycles, (uint32_t)top->proc_rdata);
+        return result;
+    }
+    // SOLE_test samples REG_STATUS on the next posedge; count that edge too so
+    // the numbers match its execution_time_ns
+    result.exec_cycles = (long)(cycles - start_cycle) + 1;
+    if (status & STATUS_ERROR) {
+        std::fprintf(stderr, "[ERROR] %s: error status 0x%08x after %ld cycles\n",
+                     tc.name.c_str(), status, result.exec_cycles);
+        return result;
+    }
+    // Let the last B response drain before the next case resets the engine
+    for (int i = 0; i < 2; i++) cycle();
+
+    std::vector<float> sw_output(num_data);
+    SOLE_softmax(sw_output.data(), hw_input.data(), (int)num_data);
+    const uint16_t* fp16_output = reinterpret_cast<const uint16_t*>(&memory.words[output_word]);
+    double dot = 0.0, norm_hw = 0.0, norm_sw = 0.0;
+    for (size_t i = 0; i < num_data; i++) {
+        float hw = fp16_to_float(fp16_output[i]);
+        dot += (double)hw * (double)sw_output[i];
+        norm_hw += (double)hw * (double)hw;
+        norm_sw += (double)sw_output[i] * (double)sw_output[i];
+        if (output) {
+            std::fprintf(output, "%s,%zu,%.6f,0x%04x,%.9f,%.9f\n", tc.name.c_str(), i, values[i],
+                         fp16_output[i], hw, sw_output[i]);
+        }
+    }
+    if (norm_hw > 0.0 && norm_sw > 0.0) result.cosine = dot / (std::sqrt(norm_hw) * std::sqrt(norm_sw));
+    result.cosine_valid = true;
+    result.passed = result.cosine > 0.99;
+    return result;
+}
+
+static void usage(const char* prog) {
+    std::fprintf(stderr,
+                 "Usage: %s [--input FILE] [--length N] [--arready-delay N] [--rvalid-delay N]\n"
+                 "          [--wready-delay N] [--burst-len N] [--read-outstanding N] [--read-latency N]\n"
+                 "          [--read-reorder N] [--timeout-cycles N] [--error-recovery 0|1]\n"
+                 "          [--reread 0|1]\n"
+                 "          [--name NAME] [--batch FILE] [--csv FILE] [--output FILE] [--axi-log FILE]\n",
+                 prog);
+}
+
+int main(int argc, char* argv[]) {
+    TestCase base;
+    base.name = "case";
+    std::string batch_file, csv_file, output_file, axi_log_file;
+    std::string error;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-h" || arg == "--help") {
+            usage(argv[0]);
+            return 2;
+        }
+        if (arg.compare(0, 2, "--") != 0) {
+            std::fprintf(stderr, "[ERROR] Unexpected argument '%s'\n", arg.c_str());
+            return 1;
+        }
+        std::string key = arg.substr(2);
+        std::string value;
+        size_t eq = key.find('=');
+        if (eq != std::string::npos) {
+            value = key.substr(eq + 1);
+            key = key.substr(0, eq);
+        } else if (i + 1 < argc) {
+            value = argv[++i];
+        } else {
+            std::fprintf(stderr, "[ERROR] Option --%s needs a value\n", key.c_str());
+            return 1;
+        }
+        if (key == "batch") {
+            batch_file = value;
+        } else if (key == "csv") {
+            csv_file = value;
+        } else if (key == "output") {
+            output_file = value;
+        } else if (key == "axi-log" || key == "axi_log") {
+            axi_log_file = value;
+        } else if (!apply_case_option(base, key, value, error)) {
+            std::fprintf(stderr, "[ERROR] %s\n", error.c_str());
+            return 1;
+        }
+    }
+
+    std::vector<TestCase> cases;
+    if (batch_file.empty()) {
+        cases.push_back(base);
+    } else if (!load_batch(batch_file, base, cases, error)) {
+        std::fprintf(stderr, "[ERROR] %s\n", error.c_str());
+        return 1;
+    }
+
+    std::FILE* axi_log = nullptr;
+    std::FILE* output = nullptr;
+    if (!axi_log_file.empty() && !(axi_log = std::fopen(axi_log_file.c_str(), "w"))) {
+        std::fprintf(stderr, "[ERROR] Failed to create AXI pin log %s\n", axi_log_file.c_str());
+        return 1;
+    }
+    if (!output_file.empty()) {
+        if (!(output = std::fopen(output_file.c_str(), "w"))) {
+            std::fprintf(stderr, "[ERROR] Failed to create %s\n", output_file.c_str());
+            return 1;
+        }
+        std::fprintf(output, "name,index,input,hw_fp16,hw_output,sw_output\n");
+    }
+
+    std::unique_ptr<VerilatedContext> ctx(new VerilatedContext);
+    ctx->commandArgs(argc, argv);
+    std::vector<CaseResult> results;
+    auto wall_start = std::chrono::steady_clock::now();
+    {
+        Harness harness(ctx.get(), axi_log);
+        for (const TestCase& tc : cases) {
+            CaseResult r = harness.run(tc, output);
+            std::printf("[CASE] %s elements=%zu cycles=%ld cycles_per_element=%.2f cosine=%.9f %s\n",
+                        tc.name.c_str(), r.input_count, r.exec_cycles,
+                        (r.exec_cycles >= 0 && r.input_count) ? (double)r.exec_cycles / r.input_count : 0.0,
+                        r.cosine, r.passed ? "PASS" : "FAIL");
+            results.push_back(r);
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+        std::printf("cases=%zu total_cycles=%lld wall_s=%.3f cycles_per_s=%.0f cases_per_hour=%.0f\n",
+                    cases.size(), harness.cycles, seconds, seconds > 0 ? harness.cycles / seconds : 0.0,
+                    seconds > 0 ? cases.size() * 3600.0 / seconds : 0.0);
+    }
+    if (axi_log) std::fclose(axi_log);
+    if (output) std::fclose(output);
+
+    int rc = 0;
+    std::FILE* csv = nullptr;
+    if (!csv_file.empty() && !(csv = std::fopen(csv_file.c_str(), "w"))) {
+        std::fprintf(stderr, "[ERROR] Failed to create %s\n", csv_file.c_str());
+        rc = 1;
+    }
+    if (csv) {
+        std::fprintf(csv, "name,input_count,arready_delay,rvalid_delay,wready_delay,burst_len,"
+                          "read_outstanding,read_latency,read_reorder,execution_time_ns,cosine_similarity,timeout_detected,passed\n");
+    }
+    for (size_t i = 0; i < cases.size(); i++) {
+        const TestCase& tc = cases[i];
+        const CaseResult& r = results[i];
+        if (r.exec_cycles < 0) rc = 1;
+        if (!csv) continue;
+        std::string exec = r.exec_cycles >= 0 ? std::to_string(r.exec_cycles) : "NA";
+        char cosine[32] = "NA";
+        if (r.cosine_valid) std::snprintf(cosine, sizeof(cosine), "%.9f", r.cosine);
+        std::fprintf(csv, "%s,%zu,%d,%d,%d,%d,%d,%d,%d,%s,%s,%s,%s\n", tc.name.c_str(), r.input_count,
+                     tc.arready_delay, tc.rvalid_delay, tc.wready_delay, tc.burst_len, tc.read_outstanding,
+                     tc.read_latency, tc.read_reorder, exec.c_str(), cosine,
+                     r.timeout ? "yes" : "no", r.passed ? "yes" : "no");
+    }
+    if (csv) std::fclose(csv);
+    return rc;
+}
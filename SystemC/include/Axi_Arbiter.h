@@ -0,0 +1,205 @@
+#ifndef AXI_ARBITER_H
+#define AXI_ARBITER_H
+
+#include <systemc.h>
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <vector>
+#include "Softmax.h"
+
+/**
+ * @class Axi_Arbiter
+ * @brief N AXI4 masters (SOLE engines, other SoC masters) onto one AXI4 master port
+ *
+ * **Read Channels:**
+ * One AR grant, registered: it stays on a master while its ARVALID waits for
+ * ARREADY and moves (see Arbitration) after a handshake or when the granted
+ * master is idle or at its outstanding limit. Every accepted burst gets a free ARID
+ * of the shared AXI_ID_WIDTH space (the master's own ARID is kept in the ID
+ * table), so bursts of different masters never share an ID and the slave may
+ * reorder them. R beats are routed back by RID with the master's ARID
+ * restored, and M_AXI_RREADY is the RREADY of the master that owns the beat
+ * on the bus, so a stalled master holds only its own beats. A beat counts on
+ * RVALID && RREADY at the edge; the ID is freed after the last beat of the
+ * burst.
+ *
+ * **Write Channels:**
+ * AW is granted like AR, with its own grant. Accepted AWs queue their master in order, and W
+ * beats are taken only from the master at the head of that queue until
+ * WLAST, so W follows AW order as AXI requires. B responses come back in the
+ * same order (queued at WLAST); BREADY comes from the master at the head of
+ * that queue and its entry is retired on BVALID && BREADY.
+ *
+ * **Arbitration (set_arbitration()):**
+ * - ROUND_ROBIN (default): the next requesting master after the granted one.
+ * - FIXED_PRIORITY: the requesting master with the highest weight (the lower
+ *   port on a tie); a low-priority master only gets the bus while no
+ *   higher one requests.
+ * - WEIGHTED: round-robin, but a master keeps the grant for up to weight
+ *   consecutive bursts while it keeps requesting.
+ * A grant never moves off a VALID that is waiting for READY, whatever the policy.
+ * The policy only matters while masters wait at the arbiter, i.e. when the
+ * slave pushes back or the issue limit (set_issue_limit()) is reached; a
+ * slave that accepts every address at once orders the bursts itself.
+ *
+ * **Outstanding Limit:**
+ * A master with outstanding_limit read bursts (or write bursts without B) in
+ * flight is skipped until one completes. The default is the ID space divided
+ * among the masters. The issue limit caps the bursts in flight of all
+ * masters together (the slave's queue depth; default 0 = none).
+ */
+SC_MODULE(Axi_Arbiter) {
+    // ===== System Ports =====
+    sc_in<bool>                 clk;
+    sc_in<bool>                 rst;
+
+    // ===== AXI4 Slave Ports (one per master) =====
+    sc_core::sc_vector<sc_in<sc_dt::sc_uint<AXI_ADDR_WIDTH>>>    S_AXI_AWADDR;
+    sc_core::sc_vector<sc_in<sc_dt::sc_uint<8>>>                 S_AXI_AWLEN;
+    sc_core::sc_vector<sc_in<sc_dt::sc_uint<3>>>                 S_AXI_AWSIZE;
+    sc_core::sc_vector<sc_in<sc_dt::sc_uint<2>>>                 S_AXI_AWBURST;
+    sc_core::sc_vector<sc_in<bool>>                              S_AXI_AWVALID;
+    sc_core::sc_vector<sc_out<bool>>                             S_AXI_AWREADY;
+    sc_core::sc_vector<sc_in<axi_data_t>>                        S_AXI_WDATA;
+    sc_core::sc_vector<sc_in<sc_dt::sc_uint<AXI_STRB_WIDTH>>>    S_AXI_WSTRB;
+    sc_core::sc_vector<sc_in<bool>>                              S_AXI_WLAST;
+    sc_core::sc_vector<sc_in<bool>>                              S_AXI_WVALID;
+    sc_core::sc_vector<sc_out<bool>>                             S_AXI_WREADY;
+    sc_core::sc_vector<sc_out<sc_dt::sc_uint<2>>>                S_AXI_BRESP;
+    sc_core::sc_vector<sc_out<bool>>                             S_AXI_BVALID;
+    sc_core::sc_vector<sc_in<bool>>                              S_AXI_BREADY;
+    sc_core::sc_vector<sc_in<sc_dt::sc_uint<AXI_ID_WIDTH>>>      S_AXI_ARID;
+    sc_core::sc_vector<sc_in<sc_dt::sc_uint<AXI_ADDR_WIDTH>>>    S_AXI_ARADDR;
+    sc_core::sc_vector<sc_in<sc_dt::sc_uint<8>>>                 S_AXI_ARLEN;
+    sc_core::sc_vector<sc_in<sc_dt::sc_uint<3>>>                 S_AXI_ARSIZE;
+    sc_core::sc_vector<sc_in<sc_dt::sc_uint<2>>>                 S_AXI_ARBURST;
+    sc_core::sc_vector<sc_in<bool>>                              S_AXI_ARVALID;
+    sc_core::sc_vector<sc_out<bool>>                             S_AXI_ARREADY;
+    sc_core::sc_vector<sc_out<sc_dt::sc_uint<AXI_ID_WIDTH>>>     S_AXI_RID;
+    sc_core::sc_vector<sc_out<axi_data_t>>                       S_AXI_RDATA;
+    sc_core::sc_vector<sc_out<sc_dt::sc_uint<2>>>                S_AXI_RRESP;
+    sc_core::sc_vector<sc_out<bool>>                             S_AXI_RVALID;
+    sc_core::sc_vector<sc_in<bool>>                              S_AXI_RREADY;
+
+    // ===== AXI4 Master Port (to the interconnect / memory) =====
+    sc_out<sc_dt::sc_uint<AXI_ADDR_WIDTH>>  M_AXI_AWADDR;
+    sc_out<sc_dt::sc_uint<8>>               M_AXI_AWLEN;
+    sc_out<sc_dt::sc_uint<3>>               M_AXI_AWSIZE;
+    sc_out<sc_dt::sc_uint<2>>               M_AXI_AWBURST;
+    sc_out<bool>                            M_AXI_AWVALID;
+    sc_in<bool>                             M_AXI_AWREADY;
+    sc_out<axi_data_t>                      M_AXI_WDATA;
+    sc_out<sc_dt::sc_uint<AXI_STRB_WIDTH>>  M_AXI_WSTRB;
+    sc_out<bool>                            M_AXI_WLAST;
+    sc_out<bool>                            M_AXI_WVALID;
+    sc_in<bool>                             M_AXI_WREADY;
+    sc_in<sc_dt::sc_uint<2>>                M_AXI_BRESP;
+    sc_in<bool>                             M_AXI_BVALID;
+    sc_out<bool>                            M_AXI_BREADY;
+    sc_out<sc_dt::sc_uint<AXI_ID_WIDTH>>    M_AXI_ARID;
+    sc_out<sc_dt::sc_uint<AXI_ADDR_WIDTH>>  M_AXI_ARADDR;
+    sc_out<sc_dt::sc_uint<8>>               M_AXI_ARLEN;
+    sc_out<sc_dt::sc_uint<3>>               M_AXI_ARSIZE;
+    sc_out<sc_dt::sc_uint<2>>               M_AXI_ARBURST;
+    sc_out<bool>                            M_AXI_ARVALID;
+    sc_in<bool>                             M_AXI_ARREADY;
+    sc_in<sc_dt::sc_uint<AXI_ID_WIDTH>>     M_AXI_RID;
+    sc_in<axi_data_t>                       M_AXI_RDATA;
+    sc_in<sc_dt::sc_uint<2>>                M_AXI_RRESP;
+    sc_in<bool>                             M_AXI_RVALID;
+    sc_out<bool>                            M_AXI_RREADY;
+
+    enum class Arbitration_Policy { ROUND_ROBIN, FIXED_PRIORITY, WEIGHTED };
+
+    /// Per-master traffic counters (since reset)
+    struct Port_Stats {
+        uint64_t ar_bursts = 0;     ///< Accepted AR
+        uint64_t r_beats = 0;       ///< R handshakes
+        uint64_t aw_bursts = 0;     ///< Accepted AW
+        uint64_t w_beats = 0;       ///< W handshakes
+        uint64_t ar_wait_cycles = 0; ///< Cycles with ARVALID high and no handshake
+        uint64_t aw_wait_cycles = 0; ///< Cycles with AWVALID high and no handshake
+        uint64_t read_bursts_done = 0;      ///< Bursts whose last R beat arrived
+        uint64_t read_latency_total = 0;    ///< Sum of AR handshake to last R beat, cycles
+        uint64_t read_latency_max = 0;
+        uint64_t write_bursts_done = 0;     ///< Bursts whose B arrived
+        uint64_t write_latency_total = 0;   ///< Sum of AW handshake to B, cycles
+        uint64_t write_latency_max = 0;
+    };
+
+    const unsigned              masters;
+    const unsigned              outstanding_limit;  ///< Bursts in flight per master and direction
+    std::vector<Port_Stats>     stats;
+    uint64_t                    cycles = 0;         ///< Clock edges since reset (bandwidth = beats / cycles)
+
+    /// Arbitration policy and per-master weights (default 1); set before the simulation starts
+    void set_arbitration(Arbitration_Policy policy, const std::vector<unsigned>& weights = {});
+    /// Read / write bursts in flight for all masters together (0 = no limit); set before the simulation starts
+    void set_issue_limit(unsigned read_bursts, unsigned write_bursts);
+    Arbitration_Policy arbitration() const { return policy; }
+
+    // ===== Methods =====
+
+    /**
+     * @brief Arbiter State (clocked)
+     * Records the handshakes seen on the ports, updates the ID table, the AW
+     * order and B order queues and the outstanding counts, and moves the AR /
+     * AW grants
+     */
+    void arbiter_process();
+
+    /**
+     * @brief Channel Routing (combinational)
+     * Drives the master port from the granted masters and routes READY,
+     * R and B back to the slave ports
+     */
+    void route_process();
+
+    SC_HAS_PROCESS(Axi_Arbiter);
+    Axi_Arbiter(sc_core::sc_module_name name, unsigned masters, unsigned outstanding_limit = 0);
+
+private:
+    static constexpr unsigned ID_COUNT = 1u << AXI_ID_WIDTH;
+
+    /// One entry per ARID of the master port
+    struct Read_Slot {
+        bool     valid = false;
+        unsigned master = 0;
+        unsigned id = 0;            ///< The master's own ARID
+        unsigned beats_left = 0;
+        uint64_t issue_cycle = 0;   ///< Cycle of the AR handshake
+    };
+
+    /// Accepted AW, in W / B order
+    struct Write_Burst {
+        unsigned master;
+        uint64_t issue_cycle;       ///< Cycle of the AW handshake
+    };
+
+    Read_Slot                   read_slots[ID_COUNT];
+    std::vector<unsigned>       reads_in_flight;    ///< Read bursts per master
+    std::vector<unsigned>       writes_in_flight;   ///< Write bursts without B per master
+    std::vector<bool>           ar_allowed;         ///< Below the limit and an ID is free
+    std::vector<bool>           aw_allowed;         ///< Below the limit
+    std::deque<Write_Burst>     aw_order;           ///< Accepted AWs whose W is not done
+    std::deque<Write_Burst>     b_order;            ///< Finished W bursts awaiting B
+    Arbitration_Policy          policy = Arbitration_Policy::ROUND_ROBIN;
+    std::vector<unsigned>       weights;
+    unsigned                    read_issue_limit = 0;
+    unsigned                    write_issue_limit = 0;
+    unsigned                    ar_grant = 0;
+    unsigned                    aw_grant = 0;
+    unsigned                    ar_turn = 0;        ///< WEIGHTED: bursts of the granted master this turn
+    unsigned                    aw_turn = 0;
+    unsigned                    free_id = 0;        ///< ARID of the next AR (ID_COUNT = none)
+    sc_signal<uint64_t>         state_epoch;        ///< Bumped by arbiter_process to re-run route_process
+
+    void update_allowed(bool keep_free_id);
+    unsigned next_grant(unsigned current, bool skip_current, const sc_core::sc_vector<sc_in<bool>>& valid,
+                        const std::vector<bool>& allowed) const;
+    unsigned move_grant(unsigned current, bool handshake, unsigned& turn,
+                        const sc_core::sc_vector<sc_in<bool>>& valid, const std::vector<bool>& allowed) const;
+};
+
+#endif // AXI_ARBITER_H
@@ -0,0 +1,145 @@
+#ifndef DATA_TYPES_HPP
+#define DATA_TYPES_HPP
+
+#include <systemc.h>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <type_traits>
+
+/**
+ * @file DataTypes.hpp
+ * @brief Datapath integer type selection for the SOLE SystemC model
+ *
+ * All datapath aliases (sc_uint4, sc_uint16, ...) resolve through sole_uint<W>.
+ * In the default build sole_uint<W> is sc_dt::sc_uint<W>. When SOLE_NATIVE_TYPES
+ * is defined (CMake target Softmax_lib_native) it is sole::native::uint_t<W>, a
+ * masked native integer with the subset of the sc_uint API the datapath uses.
+ *
+ * The AXI master ports and the processor MMIO ports always stay sc_dt::sc_uint,
+ * so both builds plug into the same testbench and produce the same AXI traffic.
+ */
+namespace sole::native {
+
+    /**
+     * @class uint_t
+     * @brief W-bit unsigned value stored in the smallest native integer
+     *
+     * Every write is masked to W bits and every read widens to uint64_t, which
+     * matches the sc_uint value semantics (arithmetic is done in 64 bits and
+     * truncated on assignment).
+     */
+    template<int W>
+    class uint_t {
+        static_assert(W >= 1 && W <= 64, "uint_t width must be 1..64");
+
+    public:
+        using storage_t = std::conditional_t<(W <= 8), uint8_t,
+                          std::conditional_t<(W <= 16), uint16_t,
+                          std::conditional_t<(W <= 32), uint32_t, uint64_t>>>;
+
+        static constexpr uint64_t MASK = (W == 64) ? ~uint64_t(0) : ((uint64_t(1) << W) - 1);
+
+        constexpr uint_t() : m_val(0) {}
+
+        template<class T, class = std::enable_if_t<std::is_convertible<T, uint64_t>::value>>
+        constexpr uint_t(const T& v) : m_val(static_cast<storage_t>(static_cast<uint64_t>(v) & MASK)) {}
+
+        constexpr operator uint64_t() const { return m_val; }
+
+        constexpr unsigned int to_uint() const { return static_cast<unsigned int>(m_val); }
+        constexpr uint64_t to_uint64() const { return m_val; }
+        constexpr int to_int() const { return static_cast<int>(m_val); }
+        constexpr int64_t to_int64() const { return static_cast<int64_t>(m_val); }
+        constexpr int length() const { return W; }
+
+        /// Bits [high:low], right-aligned
+        constexpr uint_t<64> range(int high, int low) const {
+            return (uint64_t(m_val) >> low) & ((high - low + 1 >= 64) ? ~uint64_t(0)
+                                                                       : ((uint64_t(1) << (high - low + 1)) - 1));
+        }
+        constexpr bool operator[](int bit) const { return (uint64_t(m_val) >> bit) & 1; }
+
+        uint_t& operator+=(uint64_t v)  { return *this = uint64_t(m_val) + v; }
+        uint_t& operator-=(uint64_t v)  { return *this = uint64_t(m_val) - v; }
+        uint_t& operator&=(uint64_t v)  { return *this = uint64_t(m_val) & v; }
+        uint_t& operator|=(uint64_t v)  { return *this = uint64_t(m_val) | v; }
+        uint_t& operator^=(uint64_t v)  { return *this = uint64_t(m_val) ^ v; }
+        uint_t& operator<<=(int v)      { return *this = uint64_t(m_val) << v; }
+        uint_t& operator>>=(int v)      { return *this = uint64_t(m_val) >> v; }
+        uint_t& operator++()            { return *this = uint64_t(m_val) + 1; }
+        uint_t& operator--()            { return *this = uint64_t(m_val) - 1; }
+        uint_t operator++(int)          { uint_t old = *this; ++*this; return old; }
+        uint_t operator--(int)          { uint_t old = *this; --*this; return old; }
+
+    private:
+        storage_t m_val;
+    };
+
+} // namespace sole::native
+
+#ifdef SOLE_NATIVE_TYPES
+template<int W> using sole_uint = sole::native::uint_t<W>;
+#else
+template<int W> using sole_uint = sc_dt::sc_uint<W>;
+#endif
+
+/**
+ * Datapath lanes: FP16 elements per AXI beat. The AXI data width is
+ * 16 * SOLE_LANES (64 / 128 / 256 bits); like SOLE_NATIVE_TYPES it is set per
+ * library in CMake (Softmax_lib_l8 / Softmax_lib_l16), the default is 4.
+ *
+ * Accuracy limit: every beat shares one local max, and an element's exponent
+ * is log2exp(x - local) + log2exp(local - global), one truncation more than
+ * log2exp(x - global) for every lane but the local max. With 8 / 16 lanes
+ * long rows of uniform input fall below the 0.99 cosine PASS threshold of
+ * SOLE_test (about 0.98 / 0.976 at n = 4096); SOLE_lanes{8,16}_accuracy pins
+ * the measured values.
+ */
+#ifndef SOLE_LANES
+#define SOLE_LANES 4
+#endif
+static_assert(SOLE_LANES == 4 || SOLE_LANES == 8 || SOLE_LANES == 16, "SOLE_LANES must be 4, 8 or 16");
+
+constexpr int SOLE_LANE_LOG2  = (SOLE_LANES == 4) ? 2 : (SOLE_LANES == 8) ? 3 : 4;  ///< MaxUnit / Reduction tree levels
+constexpr int SOLE_BEAT_WIDTH = 16 * SOLE_LANES;                                  ///< Bits per AXI beat
+
+/// One AXI beat, lane i in bits [16i+15:16i]; an sc_dt type in both builds (it reaches the AXI ports)
+using sole_beat_t = std::conditional_t<(SOLE_BEAT_WIDTH <= 64), sc_dt::sc_uint<SOLE_BEAT_WIDTH>,
+                                       sc_dt::sc_biguint<SOLE_BEAT_WIDTH>>;
+
+/// Packed 4-bit Log2Exp exponents of one beat (Power_of_Two_Vector, Output_FIFO entry)
+using sole_power_vector_t = sole_uint<4 * SOLE_LANES>;
+
+/**
+ * Sum_Buffer: 32.16 fixed-point running sum of the 2^-k exponent terms. Every
+ * term is at most 1.0, so a row of up to 2^32 - 1 elements cannot overflow it.
+ */
+constexpr int SOLE_SUM_BITS = 48;
+using sole_sum_t = sole_uint<SOLE_SUM_BITS>;
+
+/// ks: leading-one position of the Sum_Buffer integer part (0..31)
+using sole_ks_t = sole_uint<5>;
+
+/// FP16 lane 'lane' of a beat
+inline uint16_t sole_beat_lane(const sole_beat_t& beat, int lane) {
+    return (uint16_t)beat.range(16 * lane + 15, 16 * lane).to_uint();
+}
+
+/// Replace FP16 lane 'lane' of a beat
+inline void sole_beat_set_lane(sole_beat_t& beat, int lane, uint16_t value) {
+    beat.range(16 * lane + 15, 16 * lane) = (uint64_t)value;
+}
+
+/// Beat as hex digits, most significant lane first (16 digits for 4 lanes)
+inline std::string sole_beat_hex(const sole_beat_t& beat) {
+    std::string hex;
+    char lane_hex[5];
+    for (int lane = SOLE_LANES - 1; lane >= 0; --lane) {
+        std::snprintf(lane_hex, sizeof(lane_hex), "%04x", sole_beat_lane(beat, lane));
+        hex += lane_hex;
+    }
+    return hex;
+}
+
+#endif // DATA_TYPES_HPP
@@ -0,0 +1,157 @@
+#ifndef DESCRIPTOR_RING_H
+#define DESCRIPTOR_RING_H
+
+#include <systemc.h>
+#include <iostream>
+#include <cstdint>
+#include "Softmax.h"
+#include "SOLE_MMIO.hpp"
+#include "DataTypes.hpp"
+
+using sc_uint32 = sole_uint<32>;
+using sc_uint64 = sole_uint<64>;
+
+/// Beats of one descriptor (32 bytes: 4 / 2 / 1 beats on 64 / 128 / 256-bit buses)
+constexpr unsigned RING_DESC_BEATS = (sole::mmio::RING_DESC_BYTES + AXI_BEAT_BYTES - 1) / AXI_BEAT_BYTES;
+/// 64-bit descriptor words per beat
+constexpr unsigned RING_BEAT_WORDS = AXI_BEAT_BYTES / 8;
+
+/**
+ * @class Descriptor_Ring
+ * @brief Memory-resident job queue in front of the Softmax engine
+ *
+ * The processor fills descriptors (src, dst, length, flags; see SOLE_MMIO.hpp)
+ * in a ring at REG_RING_BASE, then writes REG_RING_TAIL. While ring mode is
+ * enabled and HEAD != TAIL the ring runs one job per descriptor, back to back:
+ *
+ * 1. FETCH: one INCR burst of RING_DESC_BEATS beats at base + HEAD * 32 (ARID 0)
+ * 2. START: drives the job onto the Softmax start / address / length inputs
+ *    (one row, packed) and holds start until the engine leaves IDLE
+ * 3. RUN: counts cycles until the DONE pulse or ERROR in the engine status
+ * 4. WRITEBACK: a single-beat write of the beat holding word 3, the
+ *    completion record, with WSTRB set for word 3 only, then HEAD advances
+ *    modulo REG_RING_SIZE
+ *
+ * The ring drives the AXI master only in FETCH and WRITEBACK (bus_owner),
+ * when the engine is idle, so SOLE switches the master ports without
+ * arbitration. A descriptor that fails to fetch (RRESP != OKAY) is not run;
+ * its completion record reports ERR_AXI_READ_ERROR.
+ */
+SC_MODULE(Descriptor_Ring) {
+    // ===== System Ports =====
+    sc_in<bool>                 clk;
+    sc_in<bool>                 rst;
+
+    // ===== Configuration (SOLE MMIO) =====
+    sc_in<bool>                 enable;         ///< REG_CONTROL[25] (CTRL_RING_BIT)
+    sc_in<sc_uint64>            ring_base;      ///< {REG_RING_BASE_H, REG_RING_BASE_L}
+    sc_in<sc_uint32>            ring_size;      ///< REG_RING_SIZE (descriptors)
+    sc_in<sc_uint32>            ring_tail;      ///< REG_RING_TAIL (producer index)
+    sc_out<sc_uint32>           ring_head;      ///< REG_RING_HEAD (consumer index)
+
+    // ===== Job Interface (to the Softmax inputs through SOLE) =====
+    sc_out<bool>                job_start;      ///< START of the current descriptor
+    sc_out<sc_uint64>           job_src;        ///< Descriptor word 0
+    sc_out<sc_uint64>           job_dst;        ///< Descriptor word 1
+    sc_out<sc_uint64>           job_length;     ///< Descriptor word 2 [31:0]
+    sc_out<sc_uint32>           job_flags;      ///< Descriptor word 2 [63:32] (REG_CONTROL layout)
+    sc_in<sc_uint32>            engine_status;  ///< Softmax status (REG_STATUS layout)
+    sc_out<bool>                busy;           ///< A descriptor is being fetched, run or written back
+    sc_out<bool>                job_complete;   ///< One-cycle pulse when HEAD advances past a completed descriptor
+
+    // ===== AXI4 Master (valid while bus_owner) =====
+    sc_out<bool>                            bus_owner;  ///< Ring drives the master ports (FETCH / WRITEBACK)
+    sc_out<sc_dt::sc_uint<AXI_ADDR_WIDTH>>  M_AXI_AWADDR;
+    sc_out<sc_dt::sc_uint<8>>               M_AXI_AWLEN;
+    sc_out<bool>                            M_AXI_AWVALID;
+    sc_in<bool>                             M_AXI_AWREADY;
+    sc_out<axi_data_t>                      M_AXI_WDATA;
+    sc_out<sc_dt::sc_uint<AXI_STRB_WIDTH>>  M_AXI_WSTRB;
+    sc_out<bool>                            M_AXI_WLAST;
+    sc_out<bool>                            M_AXI_WVALID;
+    sc_in<bool>                             M_AXI_WREADY;
+    sc_in<sc_dt::sc_uint<2>>                M_AXI_BRESP;
+    sc_in<bool>                             M_AXI_BVALID;
+    sc_out<bool>                            M_AXI_BREADY;
+    sc_out<sc_dt::sc_uint<AXI_ID_WIDTH>>    M_AXI_ARID;
+    sc_out<sc_dt::sc_uint<AXI_ADDR_WIDTH>>  M_AXI_ARADDR;
+    sc_out<sc_dt::sc_uint<8>>               M_AXI_ARLEN;
+    sc_out<bool>                            M_AXI_ARVALID;
+    sc_in<bool>                             M_AXI_ARREADY;
+    sc_in<axi_data_t>                       M_AXI_RDATA;
+    sc_in<sc_dt::sc_uint<2>>                M_AXI_RRESP;
+    sc_in<bool>                             M_AXI_RVALID;
+    sc_out<bool>                            M_AXI_RREADY;
+
+    /// Ring controller states
+    enum Ring_State : uint8_t {
+        RING_IDLE      = 0,   ///< Waiting for HEAD != TAIL
+        RING_FETCH     = 1,   ///< Reading the descriptor at HEAD
+        RING_START     = 2,   ///< START held until the engine leaves IDLE
+        RING_RUN       = 3,   ///< Waiting for DONE / ERROR
+        RING_WRITEBACK = 4    ///< Writing the completion record
+    };
+
+    /** Controller registers (held across clock edges by ring_process) */
+    Ring_State              ring_state = RING_IDLE;
+    uint32_t                head = 0;                       ///< Consumer index
+    uint64_t                desc_addr = 0;                  ///< Byte address of the current descriptor
+    uint64_t                desc[sole::mmio::RING_DESC_BYTES / 8] = {};  ///< Fetched descriptor words
+    unsigned                beats_received = 0;             ///< FETCH: R beats taken
+    bool                    fetch_error = false;            ///< FETCH: a beat had RRESP != OKAY
+    uint32_t                completion_status = 0;          ///< Completion record [31:0]
+    uint32_t                job_cycles = 0;                 ///< Cycles since the job's START
+    bool                    aw_done = false;                ///< WRITEBACK: AW accepted
+    bool                    w_done = false;                 ///< WRITEBACK: W accepted
+    uint32_t                restored_head = 0;              ///< Set by restore_head()
+    bool                    head_restore_pending = false;   ///< restored_head not yet applied
+
+    /**
+     * @brief Load HEAD without running descriptors (checkpoint restore)
+     * Applied by ring_process at the first clock edge with the ring enabled
+     * (a disabled ring holds HEAD at 0).
+     */
+    void restore_head(uint32_t value) {
+        restored_head = value;
+        head_restore_pending = true;
+    }
+
+    /// Clock edges that may be skipped while no signal changes (0 until a restored HEAD is applied)
+    uint64_t idle_cycle_limit() const { return head_restore_pending ? 0 : UINT64_MAX; }
+
+    /// Account for 'cycles' skipped edges: a started or running job keeps counting
+    void skip_cycles(uint64_t cycles) {
+        if (ring_state == RING_START || ring_state == RING_RUN) {
+            job_cycles += (uint32_t)cycles;
+        }
+    }
+
+    /**
+     * @brief Ring Controller (clocked)
+     * FETCH -> START -> RUN -> WRITEBACK per descriptor, see the class comment.
+     */
+    void ring_process();
+
+    SC_HAS_PROCESS(Descriptor_Ring);
+    Descriptor_Ring(sc_core::sc_module_name name) : sc_core::sc_module(name),
+        clk("clk"), rst("rst"), enable("enable"), ring_base("ring_base"), ring_size("ring_size"),
+        ring_tail("ring_tail"), ring_head("ring_head"),
+        job_start("job_start"), job_src("job_src"), job_dst("job_dst"), job_length("job_length"),
+        job_flags("job_flags"), engine_status("engine_status"), busy("busy"), job_complete("job_complete"),
+        bus_owner("bus_owner"),
+        M_AXI_AWADDR("M_AXI_AWADDR"), M_AXI_AWLEN("M_AXI_AWLEN"), M_AXI_AWVALID("M_AXI_AWVALID"),
+        M_AXI_AWREADY("M_AXI_AWREADY"),
+        M_AXI_WDATA("M_AXI_WDATA"), M_AXI_WSTRB("M_AXI_WSTRB"), M_AXI_WLAST("M_AXI_WLAST"),
+        M_AXI_WVALID("M_AXI_WVALID"), M_AXI_WREADY("M_AXI_WREADY"),
+        M_AXI_BRESP("M_AXI_BRESP"), M_AXI_BVALID("M_AXI_BVALID"), M_AXI_BREADY("M_AXI_BREADY"),
+        M_AXI_ARID("M_AXI_ARID"), M_AXI_ARADDR("M_AXI_ARADDR"), M_AXI_ARLEN("M_AXI_ARLEN"),
+        M_AXI_ARVALID("M_AXI_ARVALID"), M_AXI_ARREADY("M_AXI_ARREADY"),
+        M_AXI_RDATA("M_AXI_RDATA"), M_AXI_RRESP("M_AXI_RRESP"), M_AXI_RVALID("M_AXI_RVALID"),
+        M_AXI_RREADY("M_AXI_RREADY")
+    {
+        SC_METHOD(ring_process);
+        sensitive << clk.pos();
+    }
+};
+
+#endif // DESCRIPTOR_RING_H
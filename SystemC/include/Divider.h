@@ -4,11 +4,24 @@
 #include <systemc.h>
 #include <iostream>
 #include <cstdint>
+#include "DataTypes.hpp"
 
-using sc_uint4 = sc_dt::sc_uint<4>;
-using sc_uint5 = sc_dt::sc_uint<5>;
-using sc_uint16 = sc_dt::sc_uint<16>;
-using sc_uint1 = sc_dt::sc_uint<1>;
+using sc_uint4 = sole_uint<4>;
+using sc_uint5 = sole_uint<5>;
+using sc_uint16 = sole_uint<16>;
+using sc_uint1 = sole_uint<1>;
+
+/**
+ * @brief Divider datapath (combinational), used by Divider_Module
+ * 
+ * Subtracts (ky + ks) from the FP16 exponent of mux_result, saturating to 0..31.
+ * 
+ * @param ky_val 4-bit right shift
+ * @param ks_val 5-bit right shift (leading one position of the sum)
+ * @param mux_result FP16 threshold value from Divider_PreCompute
+ * @return sc_uint16 FP16 result
+ */
+sc_uint16 divider_fp16(sc_uint4 ky_val, sole_ks_t ks_val, sc_uint16 mux_result);
 
 /**
  * @brief SystemC Module for Divider
@@ -23,14 +36,14 @@ using sc_uint1 = sc_dt::sc_uint<1>;
  * 
  * Ports:
  *   - ky: 4-bit input (right shift bits)
- *   - ks: 4-bit input (left shift bits)
+ *   - ks: 5-bit input (left shift bits)
  *   - Mux_Result: 16-bit input (FP16 format)
  *   - Divider_Output: 16-bit output (FP16 format with modified exponent)
  */
 SC_MODULE(Divider_Module) {
     // Ports
     sc_in<sc_uint4>  ky;                   ///< 4-bit input ky (right shift bits)
-    sc_in<sc_uint4>  ks;                   ///< 4-bit input ks (left shift bits)
+    sc_in<sole_ks_t> ks;                   ///< 5-bit input ks (left shift bits)
     sc_in<sc_uint16> Mux_Result;           ///< 16-bit input (FP16 format)
     sc_out<sc_uint16> Divider_Output;      ///< 16-bit output (FP16 format)
 
@@ -4,23 +4,31 @@
 #include <systemc.h>
 #include <iostream>
 #include <cstdint>
+#include "DataTypes.hpp"
 
-using sc_uint4 = sc_dt::sc_uint<4>;
-using sc_uint32 = sc_dt::sc_uint<32>;
-using sc_uint16 = sc_dt::sc_uint<16>;
-using sc_uint1 = sc_dt::sc_uint<1>;
+using sc_uint4 = sole_uint<4>;
+using sc_uint32 = sole_uint<32>;
+using sc_uint16 = sole_uint<16>;
+using sc_uint1 = sole_uint<1>;
 
 /**
- * @brief Find the position of the leading (most significant) one bit in a 32-bit value
+ * @brief Find the position of the leading one bit in the integer part of the sum
  * 
- * Scans from MSB to LSB to find the position of the first '1' bit.
- * Position 31 is the MSB (2^31), position 0 is the LSB.
- * Returns 0 if input is 0.
+ * Scans the integer part (bits 47-16) from MSB to LSB. Integer bit 31 (2^31)
+ * gives 31, integer bit 0 gives 0. Returns 0 if the integer part is 0.
  * 
- * @param input 32-bit unsigned integer
- * @return sc_uint4 4-bit position of leading one (0-31, stored in 4 bits)
+ * @param input 48-bit accumulated sum (32.16 fixed point)
+ * @return sole_ks_t 5-bit position of leading one (0-31)
  */
-sc_uint4 find_leading_one_pos(sc_uint32 input);
+sole_ks_t find_leading_one_pos(sole_sum_t input);
+
+/**
+ * @brief Select the FP16 threshold (0x3A8B or 0x388B) from the bit below the leading one
+ * 
+ * @param input 48-bit accumulated sum (32.16 fixed point)
+ * @return sc_uint16 fp16 threshold value
+ */
+sc_uint16 divider_threshold(sole_sum_t input);
 
 /**
  * @brief SystemC Module for Divider PreComputation
@@ -31,16 +39,16 @@ sc_uint4 find_leading_one_pos(sc_uint32 input);
  * 3. Uses this bit to select between two threshold values (fp16)
  * 
  * Ports:
- *   - input: 32-bit unsigned integer input
- *   - Leading_One_Pos: 4-bit output (position of leading one, 0-15)
+ *   - input: 48-bit accumulated sum (32.16 fixed point)
+ *   - Leading_One_Pos: 5-bit output (position of leading one, 0-31)
  *   - Threshold_Result: 16-bit output (fp16 format)
  *       - If bit at (Leading_One_Pos - 1) = 1: outputs fp16(0.818)
  *       - If bit at (Leading_One_Pos - 1) = 0: outputs fp16(0.568)
  */
 SC_MODULE(Divider_PreCompute_Module) {
     // Ports
-    sc_in<sc_uint32>  input;                ///< 32-bit input
-    sc_out<sc_uint4>  Leading_One_Pos;      ///< 4-bit output: position of leading one
+    sc_in<sole_sum_t> input;                ///< 48-bit input (32.16 fixed point)
+    sc_out<sole_ks_t> Leading_One_Pos;      ///< 5-bit output: position of leading one
     sc_out<sc_uint16> Mux_Result;     ///< 16-bit output: fp16 threshold value
 
     // Constructor
@@ -2,9 +2,17 @@
 #define LOG2EXP_H
 
 #include <systemc.h>
+#include "DataTypes.hpp"
 
-using sc_uint4 = sc_dt::sc_uint<4>;
-using sc_uint16 = sc_dt::sc_uint<16>;
+using sc_uint4 = sole_uint<4>;
+using sc_uint16 = sole_uint<16>;
+
+/**
+ * @brief Log2Exp datapath (combinational), used by the Log2Exp module
+ * @param fp16_in_val FP16 difference (x - max), expected <= 0
+ * @return sc_uint4 4-bit power-of-two exponent
+ */
+sc_uint4 log2exp_fp16(sc_uint16 fp16_in_val);
 
 SC_MODULE(Log2Exp) {
     // Ports
@@ -3,8 +3,14 @@
 
 #include <systemc.h>
 #include <iostream>
+#include "DataTypes.hpp"
 
-using sc_uint16 = sc_dt::sc_uint<16>;
+using sc_uint16 = sole_uint<16>;
+
+/// Comparator levels in front of the pipeline register; the other levels follow it
+constexpr int MAXUNIT_STAGE1_LEVELS = (SOLE_LANE_LOG2 + 1) / 2;
+/// Pipeline registers between the two stages (one per stage 1 comparator tree)
+constexpr int MAXUNIT_REGS = SOLE_LANES >> MAXUNIT_STAGE1_LEVELS;
 
 /**
  * @brief Binary maximum operation for FP16 (half-precision floating point)
@@ -13,35 +19,37 @@ using sc_uint16 = sc_dt::sc_uint<16>;
  * the maximum value according to FP16 comparison rules:
  * - Positive numbers are always greater than negative numbers
 /**
- * @brief 4-Input FP16 Maximum Finder with 2-Stage Pipeline
+ * @brief SOLE_LANES-Input FP16 Maximum Finder with 2-Stage Pipeline
  * 
- * This SystemC module implements a pipelined maximum finder for 4 FP16 inputs:
- * - Stage 1: Parallel comparison of (A vs B) and (C vs D)
- * - Register: Pipeline registers store intermediate results
- * - Stage 2: Final comparison of stage 1 results
+ * This SystemC module implements a pipelined maximum finder for SOLE_LANES
+ * FP16 inputs as a binary comparator tree of SOLE_LANE_LOG2 levels:
+ * - Stage 1: the first MAXUNIT_STAGE1_LEVELS levels, e.g. (In[0] vs In[1])
+ *   and (In[2] vs In[3]) for 4 lanes
+ * - Register: MAXUNIT_REGS pipeline registers store intermediate results
+ * - Stage 2: the remaining levels down to the final comparison
  * 
- * Latency: 2 clock cycles
+ * Latency: 2 clock cycles for every lane count
  * 
  * Ports:
  *   - clk: Clock input (positive edge triggered)
  *   - rst: Reset input (active high)
- *   - A, B, C, D: 4x 16-bit FP16 input ports
+ *   - In: SOLE_LANES x 16-bit FP16 input ports
  *   - Max_Out: 16-bit FP16 output port
  */
 SC_MODULE(MaxUnit) {
     // Ports
-    sc_in<bool>      clk, rst;        ///< Clock and reset signals
-    sc_in<sc_uint16> A, B, C, D;      ///< 4x FP16 input ports
-    sc_out<sc_uint16> Max_Out;        ///< FP16 maximum output
+    sc_in<bool>      clk, rst;                  ///< Clock and reset signals
+    sc_in<sc_uint16> In[SOLE_LANES];            ///< SOLE_LANES x FP16 input ports
+    sc_out<sc_uint16> Max_Out;                  ///< FP16 maximum output
 
     // Internal signals
-    sc_signal<sc_uint16> R1_reg, R2_reg;    ///< Pipeline register values
-    sc_signal<sc_uint16> R1_next, R2_next;  ///< Next pipeline register values
+    sc_signal<sc_uint16> R_reg[MAXUNIT_REGS];   ///< Pipeline register values
+    sc_signal<sc_uint16> R_next[MAXUNIT_REGS];  ///< Next pipeline register values
 
     // Methods
     void stage1_comb_logic();         ///< Stage 1: Parallel comparisons
     void stage1_register_update();    ///< Register update on clock edge
-    void stage2_comb_logic();         ///< Stage 2: Final comparison
+    void stage2_comb_logic();         ///< Stage 2: Final comparisons
     //void Print_Stage_Regs();         ///< Debug: Print pipeline registers
 
     /**
@@ -49,13 +57,17 @@ SC_MODULE(MaxUnit) {
      */
     SC_CTOR(MaxUnit) {
         SC_METHOD(stage1_comb_logic);
-        sensitive << A << B << C << D; 
+        for (int i = 0; i < SOLE_LANES; i++) {
+            sensitive << In[i];
+        }
 
         SC_METHOD(stage1_register_update);
         sensitive << clk.pos();
 
         SC_METHOD(stage2_comb_logic);
-        sensitive << R1_reg << R2_reg;
+        for (int i = 0; i < MAXUNIT_REGS; i++) {
+            sensitive << R_reg[i];
+        }
 
         //SC_METHOD(Print_Stage_Regs);
         //sensitive << clk.pos();
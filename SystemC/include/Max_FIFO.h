@@ -5,8 +5,10 @@
 #include <iostream>
 #include <cstdint>
 #include "SRAM.h"
+#include "Trace.hpp"
+#include "DataTypes.hpp"
 
-using sc_uint16 = sc_dt::sc_uint<16>;
+using sc_uint16 = sole_uint<16>;
 
 #ifndef DATA_LENGTH_MAX
 #define DATA_LENGTH_MAX 4096
@@ -17,7 +19,7 @@ constexpr unsigned max_fifo_ceil_log2(unsigned n, unsigned bits = 0, unsigned va
 }
 
 constexpr unsigned MAX_FIFO_ADDR_BITS = max_fifo_ceil_log2(DATA_LENGTH_MAX);
-using max_fifo_addr_t = sc_dt::sc_uint<MAX_FIFO_ADDR_BITS>;
+using max_fifo_addr_t = sole_uint<MAX_FIFO_ADDR_BITS>;
 
 /**
  * @brief SystemC Module for Max_FIFO
@@ -113,8 +115,11 @@ SC_MODULE(Max_FIFO) {
 
         //SC_METHOD(Print_Push_Count);
         //sensitive << clk.pos();
-        SC_METHOD(Print_FIFO_SRAM);
-        sensitive << clk.pos();
+        // SRAM state trace: only registered when compiled in (see Trace.hpp)
+        if (SOLE_TRACE_ON(CAT_FIFO, LVL_VERBOSE)) {
+            SC_METHOD(Print_FIFO_SRAM);
+            sensitive << clk.pos();
+        }
     }
 
     // Methods
@@ -126,7 +131,7 @@ SC_MODULE(Max_FIFO) {
     void gate_signals();                 ///< Gate write/read enables against full/empty
     void read_data_valid_flag();        ///< Output-valid flag for direct SRAM return or skid data
     //void Print_Push_Count();            ///< Debug: Print push count and data
-    void Print_FIFO_SRAM();             ///< Debug: Print SRAM state
+    void Print_FIFO_SRAM();             ///< Debug: Trace SRAM state
 };
 
 #endif // MAX_FIFO_H
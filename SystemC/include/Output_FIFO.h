@@ -5,8 +5,9 @@
 #include <iostream>
 #include <cstdint>
 #include "SRAM.h"
+#include "DataTypes.hpp"
 
-using sc_uint16 = sc_dt::sc_uint<16>;
+using sc_uint16 = sole_uint<16>;
 
 #ifndef DATA_LENGTH_MAX
 #define DATA_LENGTH_MAX 4096
@@ -17,21 +18,26 @@ constexpr unsigned output_fifo_ceil_log2(unsigned n, unsigned bits = 0, unsigned
 }
 
 constexpr unsigned OUTPUT_FIFO_ADDR_BITS = output_fifo_ceil_log2(DATA_LENGTH_MAX);
-using output_fifo_addr_t = sc_dt::sc_uint<OUTPUT_FIFO_ADDR_BITS>;
+using output_fifo_addr_t = sole_uint<OUTPUT_FIFO_ADDR_BITS>;
+
+/// One entry: the packed 4-bit exponents of one AXI beat (16 bits for 4 lanes)
+constexpr int OUTPUT_FIFO_DATA_BITS = 4 * SOLE_LANES;
+using output_fifo_data_t = sole_power_vector_t;
 
 /**
  * @brief SystemC Module for Output_FIFO
  * 
- * FIFO built using dual-port SRAM for uint16 values.
+ * FIFO built using dual-port SRAM for OUTPUT_FIFO_DATA_BITS-bit power vectors
+ * (uint16 values for 4 lanes).
  * 
  * Ports:
  *   - clk: Clock input
  *   - rst: Reset signal (1=reset entire SRAM and pointers, 0=normal)
- *   - data_in: 16-bit uint16 input
+ *   - data_in: OUTPUT_FIFO_DATA_BITS-bit input
  *   - write_en: Write enable signal
  *   - read_ready: Read ready signal
  *   - clear: Clear signal (resets read_addr to equal write_addr)
- *   - data_out: 16-bit uint16 output (1-cycle latency from SRAM)
+ *   - data_out: OUTPUT_FIFO_DATA_BITS-bit output (1-cycle latency from SRAM)
  *   - full: Full flag output
  *   - empty: Empty flag output
  *   - count: Number of elements currently in FIFO
@@ -40,25 +46,25 @@ SC_MODULE(Output_FIFO) {
     // Ports
     sc_in<bool>       clk;              ///< Clock input
     sc_in<bool>       rst;              ///< Reset signal
-    sc_in<sc_uint16>  data_in;          ///< 16-bit uint16 input
+    sc_in<output_fifo_data_t>  data_in; ///< Packed power vector input
     sc_in<bool>       write_en;         ///< Write enable
     sc_in<bool>       read_ready;       ///< Read ready signal
     sc_out<bool>      read_valid;       ///< Read data valid signal
     sc_in<bool>       clear;            ///< Clear signal (read_addr = write_addr)
-    sc_out<sc_uint16> data_out;         ///< 16-bit uint16 output
+    sc_out<output_fifo_data_t> data_out; ///< Packed power vector output
     sc_out<bool>      full;             ///< Full flag
     sc_out<bool>      empty;            ///< Empty flag
     sc_out<output_fifo_addr_t> count;            ///< Number of elements currently in FIFO
 
-    // SRAM instance (OUTPUT_FIFO_ADDR_BITS address, 16-bit data)
-    SRAM<OUTPUT_FIFO_ADDR_BITS, 16> *sram;
+    // SRAM instance (OUTPUT_FIFO_ADDR_BITS address, OUTPUT_FIFO_DATA_BITS data)
+    SRAM<OUTPUT_FIFO_ADDR_BITS, OUTPUT_FIFO_DATA_BITS> *sram;
 
     // FIFO pointers
     sc_signal<output_fifo_addr_t> write_addr_sig; ///< Write pointer
     sc_signal<output_fifo_addr_t> read_addr_sig;  ///< Read pointer
-    sc_signal<sc_uint16> sram_rdata_sig; ///< SRAM read data
+    sc_signal<output_fifo_data_t> sram_rdata_sig; ///< SRAM read data
     // Skid buffer after SRAM output (captures returned read data on stall)
-    sc_signal<sc_uint16> skid_reg_sig;
+    sc_signal<output_fifo_data_t> skid_reg_sig;
     sc_signal<bool> skid_valid_sig;
     // Delayed read issue flag: true when SRAM return data is valid this cycle.
     sc_signal<bool> sram_output_data_valid;
@@ -70,7 +76,7 @@ SC_MODULE(Output_FIFO) {
     SC_HAS_PROCESS(Output_FIFO);
     Output_FIFO(sc_core::sc_module_name name) : sc_core::sc_module(name) {
         // Create SRAM instance
-        sram = new SRAM<OUTPUT_FIFO_ADDR_BITS, 16>("Output_FIFO_SRAM");
+        sram = new SRAM<OUTPUT_FIFO_ADDR_BITS, OUTPUT_FIFO_DATA_BITS>("Output_FIFO_SRAM");
         
         // Connect SRAM ports
         sram->clk(clk);
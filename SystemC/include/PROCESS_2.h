@@ -4,11 +4,12 @@
 #include <systemc.h>
 #include <iostream>
 #include "Divider_PreCompute.h"
+#include "DataTypes.hpp"
 
-using sc_uint4 = sc_dt::sc_uint<4>;
-using sc_uint16 = sc_dt::sc_uint<16>;
-using sc_uint32 = sc_dt::sc_uint<32>;
-using sc_uint64 = sc_dt::sc_uint<64>;
+using sc_uint4 = sole_uint<4>;
+using sc_uint16 = sole_uint<16>;
+using sc_uint32 = sole_uint<32>;
+using sc_uint64 = sole_uint<64>;
 
 /**
  * @struct Output_Data
@@ -18,7 +19,7 @@ using sc_uint64 = sc_dt::sc_uint<64>;
  * and held based on the stall_output control signal.
  */
 struct Output_Data {
-    sc_uint4  Leading_One_Reg;      ///< 4-bit leading one position register
+    sole_ks_t Leading_One_Reg;      ///< 5-bit leading one position register
     sc_uint16 Mux_Result_Reg;       ///< 16-bit FP16 threshold value register
 };
 
@@ -32,11 +33,11 @@ struct Output_Data {
  * PROCESS_2 performs fixed-point number analysis for normalized division
  * operations in CNN processing pipelines:
  * 
- * 1. **Input Stage**: Receives 32-bit fixed-point number (16-bit integer + 16-bit decimal)
+ * 1. **Input Stage**: Receives 48-bit fixed-point number (32-bit integer + 16-bit decimal)
  *    and routes to embedded Divider_PreCompute_Module
  * 
  * 2. **Processing**: Divider_PreCompute_Module analyzes the number:
- *    - Detects position of leading (most significant) one bit (0-15)
+ *    - Detects position of leading (most significant) one bit (0-31)
  *    - Checks bit at position (Leading_One - 1) for threshold selection
  *    - Outputs: fp16(0.818)=0x3A8B if bit=1, fp16(0.568)=0x388B if bit=0
  * 
@@ -45,7 +46,14 @@ struct Output_Data {
  *    - stall_output=1: Output registers hold previous values (pipeline hold)
  *    - rst=1: All registers cleared to 0
  * 
- * **Latency**: 1 clock cycle (combinational processing + register sampling)
+ * 4. **Handshake**: Pre_Compute_Valid / Output_Valid
+ *    - Pre_Compute_Valid=1: Pre_Compute_In is final (Sum_Buffer no longer accumulates)
+ *    - Output_Valid=1: the output registers hold the result of that final input;
+ *      cleared by rst and while Pre_Compute_Valid=0
+ * 
+ * **Latency**: 1 clock cycle (combinational processing + register sampling);
+ * Output_Valid rises in the first cycle with enable=1, stall_output=0 and
+ * Pre_Compute_Valid=1, so the controller can leave PROCESS2 on the next edge.
  * **Use Case**: CNN preprocessing for feature normalization
  */
 SC_MODULE(PROCESS_2_Module) {
@@ -54,11 +62,13 @@ SC_MODULE(PROCESS_2_Module) {
     sc_in<bool>              rst;                  ///< Reset signal (forces output registers to 0)
     sc_in<bool>              enable;               ///< Enable signal (1=active, 0=stall)
     sc_in<bool>              stall_output;         ///< Stall control (1=hold, 0=update)
-    sc_in<sc_uint32>         Pre_Compute_In;       ///< 32-bit fixed-point input (16-bit integer|16-bit decimal)
+    sc_in<sole_sum_t>        Pre_Compute_In;       ///< 48-bit fixed-point input (32-bit integer|16-bit decimal)
+    sc_in<bool>              Pre_Compute_Valid;    ///< Pre_Compute_In is final (1=valid)
     
     // ===== Output Ports =====
-    sc_out<sc_uint4>         Leading_One_Pos_Out;   ///< 4-bit leading one position (0-15)
+    sc_out<sole_ks_t>        Leading_One_Pos_Out;   ///< 5-bit leading one position (0-31)
     sc_out<sc_uint16>        Mux_Result_Out;        ///< 16-bit FP16 threshold (0x3A8B or 0x388B)
+    sc_out<bool>             Output_Valid;          ///< Output registers hold the result of the valid input
 
     // ===== Internal Signals & Registers =====
     
@@ -66,20 +76,23 @@ SC_MODULE(PROCESS_2_Module) {
     Divider_PreCompute_Module   *Divider_Pre_units;  
 
     /** Input signal routing from port to embedded unit */
-    sc_signal<sc_uint32>     Pre_Compute_In_Signal;
+    sc_signal<sole_sum_t>    Pre_Compute_In_Signal;
     
     /** Leading one position output from embedded unit (combinational) */
-    sc_signal<sc_uint4>      Leading_One_Pos_Out_Signal; 
+    sc_signal<sole_ks_t>     Leading_One_Pos_Out_Signal; 
     
     /** Threshold value output from embedded unit (combinational) */
     sc_signal<sc_uint16>     Mux_Result_Out_Signal;
 
     /** Output stall register: holds leading one position when stalled */
-    sc_signal<sc_uint4>      Output_Reg_Lo_Pos;
+    sc_signal<sole_ks_t>     Output_Reg_Lo_Pos;
     
     /** Output stall register: holds mux result when stalled */
     sc_signal<sc_uint16>     Output_Reg_Mux_Result;
 
+    /** Output valid register: set when the output registers sample a valid input */
+    sc_signal<bool>          Output_Reg_Valid;
+
     // ===== Process Methods =====
     
     /** @brief Input combinational logic - routes input to Divider unit */
@@ -107,10 +120,11 @@ SC_MODULE(PROCESS_2_Module) {
         sensitive << Pre_Compute_In;
 
         SC_METHOD(Output_Comb);
-        sensitive << Output_Reg_Lo_Pos << Output_Reg_Mux_Result;
+        sensitive << Output_Reg_Lo_Pos << Output_Reg_Mux_Result << Output_Reg_Valid;
         
         SC_METHOD(Output_Stall);
-        sensitive << stall_output << rst << Mux_Result_Out_Signal << Leading_One_Pos_Out_Signal;
+        sensitive << stall_output << rst << enable << Pre_Compute_Valid
+                  << Mux_Result_Out_Signal << Leading_One_Pos_Out_Signal;
 
         //SC_METHOD(Print_Stage_Regs);
         //sensitive << clk.pos();
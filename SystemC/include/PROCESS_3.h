@@ -7,11 +7,13 @@
 #include <iomanip>
 #include "Log2Exp.h"
 #include "Divider.h"
+#include "Trace.hpp"
+#include "DataTypes.hpp"
 
-using sc_uint4 = sc_dt::sc_uint<4>;
-using sc_uint16 = sc_dt::sc_uint<16>;
-using sc_uint32 = sc_dt::sc_uint<32>;
-using sc_uint64 = sc_dt::sc_uint<64>;
+using sc_uint4 = sole_uint<4>;
+using sc_uint16 = sole_uint<16>;
+using sc_uint32 = sole_uint<32>;
+using sc_uint64 = sole_uint<64>;
 
 /**
  * @brief FP16 Subtraction Function
@@ -64,26 +66,28 @@ struct Stage2_Data {
  * @brief Pipeline Stage 3: Division Parameters
  * 
  * Holds the multiplexer result (threshold), scale factor (ks),
- * and pre-computed coefficients (ky[0..3]) for division operations.
+ * and pre-computed coefficients (ky[0..SOLE_LANES-1]) for division operations.
  * 
- * These values control the behavior of the 4 Divider modules.
+ * These values control the behavior of the SOLE_LANES Divider modules.
  */
 struct Stage3_Data {
     sc_uint16 Mux_Result;  ///< 16-bit threshold value (fp16)
-    sc_uint4  ks;          ///< 4-bit scale factor
-    sc_uint4  ky[4];       ///< 4 x 4-bit pre-computed coefficients
+    sole_ks_t ks;          ///< 5-bit scale factor
+    sc_uint4  ky[SOLE_LANES];  ///< SOLE_LANES x 4-bit pre-computed coefficients
     bool data_valid;       ///< Validity flag: inherited from Stage2
 };
 
 struct Stage4_Data {
-    sc_uint64 Output; 
+    sole_beat_t Output;    ///< Packed Divider outputs (one AXI beat)
     bool data_valid;       ///< Validity flag: inherited from Stage3
 };
 
 } // namespace process3_pipeline
 
 // ===== Operator overloads for SystemC compatibility =====
-namespace sc_core {
+// In the structs' namespace, where sc_signal<T> finds them by argument-dependent
+// lookup (a write of an equal value then raises no value_changed_event)
+namespace process3_pipeline {
     // operator== for Stage1_Data
     inline bool operator==(const process3_pipeline::Stage1_Data& lhs, const process3_pipeline::Stage1_Data& rhs) {
         return (lhs.data_valid == rhs.data_valid) && (lhs.Sub_Result.to_uint() == rhs.Sub_Result.to_uint());
@@ -112,7 +116,7 @@ namespace sc_core {
         if (lhs.data_valid != rhs.data_valid) return false;
         if (lhs.Mux_Result.to_uint() != rhs.Mux_Result.to_uint()) return false;
         if (lhs.ks.to_uint() != rhs.ks.to_uint()) return false;
-        for (int i = 0; i < 4; i++) {
+        for (int i = 0; i < SOLE_LANES; i++) {
             if (lhs.ky[i].to_uint() != rhs.ky[i].to_uint()) return false;
         }
         return true;
@@ -122,9 +126,9 @@ namespace sc_core {
     inline std::ostream& operator<<(std::ostream& os, const process3_pipeline::Stage3_Data& data) {
         os << "Stage3_Data[valid=" << data.data_valid << ", mux=" << std::hex << data.Mux_Result.to_uint() 
            << ", ks=" << (int)data.ks.to_uint() << ", ky=(";
-        for (int i = 0; i < 4; i++) {
+        for (int i = 0; i < SOLE_LANES; i++) {
             os << (int)data.ky[i].to_uint();
-            if (i < 3) os << ",";
+            if (i < SOLE_LANES - 1) os << ",";
         }
         os << std::dec << ")]";
         return os;
@@ -132,13 +136,12 @@ namespace sc_core {
     
     // operator== for Stage4_Data
     inline bool operator==(const process3_pipeline::Stage4_Data& lhs, const process3_pipeline::Stage4_Data& rhs) {
-        return (lhs.data_valid == rhs.data_valid) && (lhs.Output.to_uint64() == rhs.Output.to_uint64());
+        return (lhs.data_valid == rhs.data_valid) && (lhs.Output == rhs.Output);
     }
 
     // operator<< for Stage4_Data
     inline std::ostream& operator<<(std::ostream& os, const process3_pipeline::Stage4_Data& data) {
-        os << "Stage4_Data[valid=" << data.data_valid << ", output=0x" << std::hex << std::setfill('0') << std::setw(16)
-           << data.Output.to_uint64() << std::dec << "]";
+        os << "Stage4_Data[valid=" << data.data_valid << ", output=0x" << sole_beat_hex(data.Output) << "]";
         return os;
     }
 }
@@ -169,16 +172,16 @@ namespace sc_core {
  * 
  * **Stage 3 (Register):**
  *   - Combines Stage2_Reg.Power with ky[i] coefficients
- *   - Computes ky[i] + Power for each of 4 channels
+ *   - Computes ky[i] + Power for each of SOLE_LANES channels
  *   - Stores Mux_Result, ks, and computed ky values
  * 
  * **Stage 4 (Combinational):**
- *   - 4x Divider modules process Stage3_Reg data
+ *   - SOLE_LANES Divider modules process Stage3_Reg data
  *   - Each divider outputs normalized 16-bit FP16 values
  * 
  * **Final Output:**
- *   - Packs 4 x 16-bit FP16 results into 64-bit Output_Vector
- *   - Format: [Output[3]|Output[2]|Output[1]|Output[0]] (16-bit each)
+ *   - Packs SOLE_LANES x 16-bit FP16 results into one AXI beat (Output_Vector)
+ *   - Format: [...|Output[1]|Output[0]] (16-bit each, 64 bits for 4 lanes)
  * 
  * **Latency**: 5 clock cycles end-to-end
  * 
@@ -204,22 +207,23 @@ SC_MODULE(PROCESS_3_Module) {
     sc_in<bool>              input_data_valid;     ///< Data validity flag (from AXI write handshake)
     sc_in<sc_uint16>         Local_Max;            ///< 16-bit FP16 local maximum value  
     sc_in<sc_uint16>         Global_Max;           ///< 16-bit FP16 global maximum value
-    sc_in<sc_uint4>          ks_In;                ///< 4-bit scale factor from Divider_PreCompute
+    sc_in<sole_ks_t>         ks_In;                ///< 5-bit scale factor from Divider_PreCompute
     sc_in<sc_uint16>         Mux_Result_In;        ///< 16-bit threshold from Divider_PreCompute
-    sc_in<sc_uint16>         Output_Buffer_In;     ///< 16-bit pre-computed coefficient buffer
+    sc_in<sole_power_vector_t> Output_Buffer_In;   ///< Packed pre-computed coefficients (4 bits per lane)
     
     // ===== Output Ports =====
-    sc_out<sc_uint64>        Output_Vector;         ///< 64-bit packed output (4 x 16-bit FP16 results)
+    sc_out<sole_beat_t>      Output_Vector;        ///< One AXI beat (SOLE_LANES x 16-bit FP16 results)
     sc_out<bool>             stage2_valid;         ///< Stage 3 data valid flag (for Output FIFO Read enable control)
+    sc_out<bool>             stage3_valid;         ///< Stage 3 data valid flag (next beat into Stage 4, for AXI WVALID)
     sc_out<bool>             stage4_valid;         ///< Stage 4 data valid flag (aligned with Output_Vector)
     
     // ===== Internal Signals & Modules =====
     
-    /** 4 instances of Divider module for parallel division computations */
-    Divider_Module           *divider_unit[4];      ///< Array of Divider module pointers
+    /** SOLE_LANES instances of Divider module for parallel division computations */
+    Divider_Module           *divider_unit[SOLE_LANES];  ///< Array of Divider module pointers
     
     /** Output signals from each Divider module */
-    sc_signal<sc_uint16>     Divider_Output[4];     ///< 4 x 16-bit normalized results
+    sc_signal<sc_uint16>     Divider_Output[SOLE_LANES];  ///< 16-bit normalized results
     
     /** Log2Exp unit for exponential approximation transformation */
     Log2Exp                  *log2exp_units;       ///< Pointer to Log2Exp module instance
@@ -230,8 +234,8 @@ SC_MODULE(PROCESS_3_Module) {
     // ===== Helper Signals for Module Interconnection =====
     // These signals bridge between struct members and module ports
     sc_signal<sc_uint16>     stage1_sub_result_sig;     ///< Extracted Sub_Result from Stage1_Reg for Log2Exp input
-    sc_signal<sc_uint4>      stage3_ky_sig[4];          ///< Extracted ky[i] values from Stage3_Reg for Divider inputs
-    sc_signal<sc_uint4>      stage3_ks_sig;             ///< Extracted ks from Stage3_Reg for Divider input
+    sc_signal<sc_uint4>      stage3_ky_sig[SOLE_LANES]; ///< Extracted ky[i] values from Stage3_Reg for Divider inputs
+    sc_signal<sole_ks_t>     stage3_ks_sig;             ///< Extracted ks from Stage3_Reg for Divider input
     sc_signal<sc_uint16>     stage3_mux_result_sig;     ///< Extracted Mux_Result from Stage3_Reg for Divider input
     
     // ===== Pipeline Stage 1 Signals =====
@@ -312,14 +316,14 @@ SC_MODULE(PROCESS_3_Module) {
     /**
      * @brief Output Combinational Logic
      * 
-     * Packs outputs from the 4 Divider modules into a 64-bit vector:
+     * Packs outputs from the SOLE_LANES Divider modules into one AXI beat:
      *   Output_Vector[15:0]   = Divider_Output[0]
      *   Output_Vector[31:16]  = Divider_Output[1]
-     *   Output_Vector[47:32]  = Divider_Output[2]
-     *   Output_Vector[63:48]  = Divider_Output[3]
+     *   ...
+     *   Output_Vector[16i+15:16i] = Divider_Output[i]
      * 
      * This is the final combinational output stage.
-     * Triggered by: Divider_Output[0..3] changes
+     * Triggered by: Divider_Output[0..SOLE_LANES-1] changes
      * Latency: 0 ns (combinational)
      */
     void Stage4_Comb();
@@ -358,8 +362,8 @@ SC_MODULE(PROCESS_3_Module) {
         log2exp_units->fp16_in(stage1_sub_result_sig);
         log2exp_units->result_out(log2exp_out);
         
-        // Instantiate 4 Divider modules
-        for (int i = 0; i < 4; i++) {
+        // Instantiate SOLE_LANES Divider modules
+        for (int i = 0; i < SOLE_LANES; i++) {
             std::stringstream ss;
             ss << "divider_" << i;
             divider_unit[i] = new Divider_Module(ss.str().c_str());
@@ -383,7 +387,7 @@ SC_MODULE(PROCESS_3_Module) {
         sensitive << clk.pos();
         
         SC_METHOD(Stage4_Comb);
-        for (int i = 0; i < 4; i++) {
+        for (int i = 0; i < SOLE_LANES; i++) {
             sensitive << Divider_Output[i];
         }
         sensitive << Stage3_Reg;
@@ -397,8 +401,11 @@ SC_MODULE(PROCESS_3_Module) {
         SC_METHOD(Extract_Stage3_Data);
         sensitive << Stage3_Reg;
 
-        SC_METHOD(Print_Stage_Regs);
-        sensitive << clk.pos();
+        // Pipeline register trace: only registered when compiled in (see Trace.hpp)
+        if (SOLE_TRACE_ON(CAT_PIPELINE, LVL_VERBOSE)) {
+            SC_METHOD(Print_Stage_Regs);
+            sensitive << clk.pos();
+        }
     }
 };
 
@@ -0,0 +1,252 @@
+#ifndef PROFILE_HPP
+#define PROFILE_HPP
+
+/**
+ * @file Profile.hpp
+ * @brief Opt-in per-process activation profiler for the SOLE SystemC model
+ *
+ * Every SC_METHOD body (and the per-wakeup part of the testbench threads)
+ * starts with SOLE_PROFILE_PROCESS(). With profiling enabled this counts
+ * the activations of each process instance and accumulates the wall time spent
+ * in them; the report groups the numbers per process and per module instance.
+ *
+ * **Build-time configuration:**
+ * - SOLE_PROFILE : 0 = off (default, the macros compile to nothing), 1 = on
+ *
+ * **Run-time configuration:**
+ * - SOLE_PROFILE_JSON (environment) : JSON export path (default "sole_profile.json")
+ *
+ * **Usage:**
+ * @code
+ *   void SOLE::demux_logic() {
+ *       SOLE_PROFILE_PROCESS();
+ *       ...
+ *   }
+ *
+ *   sc_start();
+ *   SOLE_PROFILE_REPORT();   // sorted table on stdout + JSON export
+ * @endcode
+ * Process and module are identified by __func__ and this->name(), so the
+ * macro must be used inside a member function of an sc_module.
+ */
+
+#ifndef SOLE_PROFILE
+#define SOLE_PROFILE 0
+#endif
+
+#if SOLE_PROFILE
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sole::profile {
+
+    /**
+     * @struct Entry
+     * @brief Counters of one process instance
+     */
+    struct Entry {
+        std::string module;         ///< Hierarchical module name (sc_object::name())
+        std::string process;        ///< Member function name
+        uint64_t    activations = 0;
+        uint64_t    total_ns = 0;   ///< Wall time spent inside the process
+    };
+
+    /**
+     * @class Registry
+     * @brief Process-wide table of Entries (one per module instance and process)
+     */
+    class Registry {
+    public:
+        static Registry& instance() {
+            static Registry registry;
+            return registry;
+        }
+
+        Entry* find_or_add(const char* module, const char* process) {
+            auto key = std::make_pair(std::string(module), std::string(process));
+            auto it = index_.find(key);
+            if (it != index_.end()) {
+                return it->second;
+            }
+            entries_.emplace_back(new Entry{key.first, key.second});
+            index_[key] = entries_.back().get();
+            return entries_.back().get();
+        }
+
+        /// Sorted tables (by total wall time) on 'os'
+        void report(std::ostream& os) const {
+            std::vector<const Entry*> procs = sorted_processes();
+            std::vector<Entry> modules = per_module();
+            uint64_t total_ns = 0, total_act = 0;
+            for (const Entry* e : procs) {
+                total_ns += e->total_ns;
+                total_act += e->activations;
+            }
+
+            os << "\n[PROFILE] " << procs.size() << " processes, " << total_act << " activations, "
+               << std::fixed << std::setprecision(3) << total_ns / 1e6 << " ms inside processes\n";
+            os << " Rank | Activations | Total (ms) | ns/act |      % | Process\n";
+            int rank = 1;
+            for (const Entry* e : procs) {
+                print_row(os, rank++, *e, total_ns, e->module + "." + e->process);
+            }
+            os << "\n[PROFILE] Per module\n";
+            os << " Rank | Activations | Total (ms) | ns/act |      % | Module\n";
+            rank = 1;
+            for (const Entry& m : modules) {
+                print_row(os, rank++, m, total_ns, m.module);
+            }
+        }
+
+        /// JSON export of both tables; false if the file cannot be written
+        bool write_json(const char* path) const {
+            std::ofstream out(path);
+            if (!out.is_open()) {
+                return false;
+            }
+            out << "{\n  \"processes\": [";
+            const char* sep = "\n";
+            for (const Entry* e : sorted_processes()) {
+                out << sep << "    {\"module\": \"" << e->module << "\", \"process\": \"" << e->process
+                    << "\", \"activations\": " << e->activations << ", \"total_ns\": " << e->total_ns << "}";
+                sep = ",\n";
+            }
+            out << "\n  ],\n  \"modules\": [";
+            sep = "\n";
+            for (const Entry& m : per_module()) {
+                out << sep << "    {\"module\": \"" << m.module << "\", \"activations\": " << m.activations
+                    << ", \"total_ns\": " << m.total_ns << "}";
+                sep = ",\n";
+            }
+            out << "\n  ]\n}\n";
+            return true;
+        }
+
+    private:
+        Registry() = default;
+
+        std::vector<const Entry*> sorted_processes() const {
+            std::vector<const Entry*> procs;
+            for (const auto& e : entries_) {
+                procs.push_back(e.get());
+            }
+            std::stable_sort(procs.begin(), procs.end(),
+                             [](const Entry* a, const Entry* b) { return a->total_ns > b->total_ns; });
+            return procs;
+        }
+
+        std::vector<Entry> per_module() const {
+            std::map<std::string, Entry> modules;
+            for (const auto& e : entries_) {
+                Entry& m = modules[e->module];
+                m.module = e->module;
+                m.activations += e->activations;
+                m.total_ns += e->total_ns;
+            }
+            std::vector<Entry> sorted;
+            for (auto& kv : modules) {
+                sorted.push_back(kv.second);
+            }
+            std::stable_sort(sorted.begin(), sorted.end(),
+                             [](const Entry& a, const Entry& b) { return a.total_ns > b.total_ns; });
+            return sorted;
+        }
+
+        static void print_row(std::ostream& os, int rank, const Entry& e, uint64_t total_ns, const std::string& label) {
+            double ns_per_act = e.activations ? (double)e.total_ns / (double)e.activations : 0.0;
+            double percent = total_ns ? 100.0 * (double)e.total_ns / (double)total_ns : 0.0;
+            os << std::setw(5) << rank << " | " << std::setw(11) << e.activations << " | "
+               << std::setw(10) << std::fixed << std::setprecision(3) << e.total_ns / 1e6 << " | "
+               << std::setw(6) << std::setprecision(1) << ns_per_act << " | "
+               << std::setw(5) << std::setprecision(1) << percent << "% | " << label << "\n";
+        }
+
+        std::vector<std::unique_ptr<Entry>> entries_;
+        std::map<std::pair<std::string, std::string>, Entry*> index_;
+    };
+
+    /**
+     * @class Site
+     * @brief One SOLE_PROFILE_PROCESS() call site; caches the Entry of the last caller
+     *
+     * A process body is shared by every instance of its module, so the Entry is
+     * looked up per owner; the one-element cache makes the common case a compare.
+     */
+    class Site {
+    public:
+        explicit Site(const char* process) : process_(process) {}
+
+        template <class Owner>
+        Entry* entry(const Owner* owner) {
+            if (owner != last_owner_) {
+                last_owner_ = owner;
+                last_entry_ = Registry::instance().find_or_add(owner->name(), process_);
+            }
+            return last_entry_;
+        }
+
+    private:
+        const char* process_;
+        const void* last_owner_ = nullptr;
+        Entry*      last_entry_ = nullptr;
+    };
+
+    /**
+     * @class Scope
+     * @brief Counts one activation and its wall time (RAII)
+     */
+    class Scope {
+    public:
+        explicit Scope(Entry* entry) : entry_(entry), start_(std::chrono::steady_clock::now()) {}
+        ~Scope() {
+            auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_);
+            entry_->activations++;
+            entry_->total_ns += (uint64_t)ns.count();
+        }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Entry* entry_;
+        std::chrono::steady_clock::time_point start_;
+    };
+
+    /// Report on stdout and JSON export (SOLE_PROFILE_JSON, default "sole_profile.json")
+    inline void report() {
+        Registry& registry = Registry::instance();
+        registry.report(std::cout);
+        const char* path = std::getenv("SOLE_PROFILE_JSON");
+        if (!registry.write_json(path ? path : "sole_profile.json")) {
+            std::cerr << "[PROFILE] Failed to write " << (path ? path : "sole_profile.json") << std::endl;
+        }
+    }
+
+} // namespace sole::profile
+
+/// Profile the rest of the enclosing scope as one activation of the current process
+#define SOLE_PROFILE_PROCESS()                                                        \
+    static ::sole::profile::Site sole_profile_site_(__func__);                        \
+    ::sole::profile::Scope sole_profile_scope_(sole_profile_site_.entry(this))
+
+/// Print the sorted report and write the JSON export
+#define SOLE_PROFILE_REPORT() ::sole::profile::report()
+
+#else
+
+#define SOLE_PROFILE_PROCESS() do { } while (0)
+#define SOLE_PROFILE_REPORT() do { } while (0)
+
+#endif // SOLE_PROFILE
+
+#endif // PROFILE_HPP
@@ -4,12 +4,18 @@
 #include <systemc.h>
 #include <iostream>
 #include <vector>
+#include "DataTypes.hpp"
 
 using sc_int4 = sc_dt::sc_int<4>;
 using sc_int16 = sc_dt::sc_int<16>;
-using sc_uint4 = sc_dt::sc_uint<4>;
-using sc_uint16 = sc_dt::sc_uint<16>;
-using sc_uint32 = sc_dt::sc_uint<32>;
+using sc_uint4 = sole_uint<4>;
+using sc_uint16 = sole_uint<16>;
+using sc_uint32 = sole_uint<32>;
+
+/// Adder levels in front of the pipeline register; the other levels follow it
+constexpr int REDUCTION_STAGE1_LEVELS = (SOLE_LANE_LOG2 + 1) / 2;
+/// Pipeline registers between the two adder stages
+constexpr int REDUCTION_REGS = SOLE_LANES >> REDUCTION_STAGE1_LEVELS;
 
 /**
  * @brief Exponential-Sum Reduction Module (指數加總歸約模組)
@@ -17,38 +23,37 @@ using sc_uint32 = sc_dt::sc_uint<32>;
  * Computes the sum of exponential values: Output = Σ(2^(-x_i))
  * 
  * Architecture:
- * - 4 parallel Power-of-Two units compute 2^(-x_i) for each 4-bit input
- * - Binary adder tree with pipeline register for timing optimization
- * - Stage 1: Two 32-bit adders (parallel addition of input pairs)
+ * - SOLE_LANES parallel Power-of-Two units compute 2^(-x_i) for each 4-bit input
+ * - Binary adder tree of SOLE_LANE_LOG2 levels with a pipeline register
+ * - Stage 1: REDUCTION_STAGE1_LEVELS levels of 32-bit adders (two adders for 4 lanes)
  * - Pipeline Register: For timing optimization
- * - Stage 2: One 32-bit adder (final reduction)
+ * - Stage 2: The remaining levels (one adder for 4 lanes)
  * 
  * Data Format:
- * - Input: 4×4 bits (signed int4 values)
+ * - Input: SOLE_LANES×4 bits (signed int4 values)
  * - Output: 32 bits (16.16 fixed-point)
  *   - Bits [31:16]: Integer part
  *   - Bits [15:0]: Fractional part
  *   - Resolution: 2^(-16)
+ *   - 16 lanes of 2^0 sum to 16.0, so 32 bits hold every lane count
  * 
  * Ports:
  *   - clk: Clock input
  *   - rst: Reset signal
- *   - Input_Vector: 4×4 bits input vector (4 signed integers)
+ *   - Input_Vector: SOLE_LANES×4 bits input vector
  *   - Output_Sum: 32 bits output (16.16 fixed-point format)
  */
 SC_MODULE(Reduction_Module) {
     // Ports
     sc_in<bool>                      clk;             ///< Clock input
     sc_in<bool>                      rst;             ///< Reset signal
-    sc_in<sc_uint16>        Input_Vector;    ///< 4×4 bits packed input
+    sc_in<sole_power_vector_t>       Input_Vector;    ///< SOLE_LANES×4 bits packed input
     sc_out<sc_uint32>                Output_Sum;      ///< 32-bit output (16.16 fixed-point)
 
     // Internal signals for pipeline stages
-    sc_signal<sc_uint32> exp_out[4];                  ///< Outputs of 4 exponential units
-    sc_signal<sc_uint32> stage1_add0;                 ///< First adder output (exp[0] + exp[1])
-    sc_signal<sc_uint32> stage1_add1;                 ///< Second adder output (exp[2] + exp[3])
-    sc_signal<sc_uint32> pipe_add0_reg;               ///< Pipeline register for stage1_add0
-    sc_signal<sc_uint32> pipe_add1_reg;               ///< Pipeline register for stage1_add1
+    sc_signal<sc_uint32> exp_out[SOLE_LANES];         ///< Outputs of the exponential units
+    sc_signal<sc_uint32> stage1_add[REDUCTION_REGS];  ///< Stage 1 adder tree outputs
+    sc_signal<sc_uint32> pipe_add_reg[REDUCTION_REGS];///< Pipeline registers for stage1_add
     sc_signal<sc_uint32> final_sum;                   ///< Final sum output
 
     // Constructor
@@ -59,13 +64,17 @@ SC_MODULE(Reduction_Module) {
         sensitive << Input_Vector;
         
         SC_METHOD(stage1_additions);
-        sensitive << exp_out[0] << exp_out[1] << exp_out[2] << exp_out[3];
+        for (int i = 0; i < SOLE_LANES; i++) {
+            sensitive << exp_out[i];
+        }
         
         SC_METHOD(pipeline_register_update);
         sensitive << clk.pos();
         
         SC_METHOD(stage2_addition);
-        sensitive << pipe_add0_reg << pipe_add1_reg;
+        for (int i = 0; i < REDUCTION_REGS; i++) {
+            sensitive << pipe_add_reg[i];
+        }
         
         SC_METHOD(update_output);
         sensitive << final_sum;
@@ -7,15 +7,17 @@
 #include "axi4-lite.hpp"
 #include "SOLE_MMIO.hpp"
 #include "Softmax.h"
+#include "Descriptor_Ring.h"
+#include "DataTypes.hpp"
 
 using namespace hybridacc::axi4lite;
 using namespace sole::mmio;
 
-using sc_uint2 = sc_dt::sc_uint<2>;
-using sc_uint4 = sc_dt::sc_uint<4>;
-using sc_uint8 = sc_dt::sc_uint<8>;
-using sc_uint32 = sc_dt::sc_uint<32>;
-using sc_uint64 = sc_dt::sc_uint<64>;
+using sc_uint2 = sole_uint<2>;
+using sc_uint4 = sole_uint<4>;
+using sc_uint8 = sole_uint<8>;
+using sc_uint32 = sole_uint<32>;
+using sc_uint64 = sole_uint<64>;
 
 /**
  * @class SOLE (Softmax/Normalization Non-Linear Engine)
@@ -23,11 +25,14 @@ using sc_uint64 = sc_dt::sc_uint<64>;
  * 
  * **Functional Overview:**
  * - Simple Processor interface (4-signal MMIO access): Addr, Wdata, We, Rdata
- *   - Processor writes configuration: Control, Addr_Base, Length registers (write-only)
+ *   - Processor writes configuration: Control, Addr_Base, Length, Row_Count / Row_Stride registers (write-only)
  *   - Processor reads status (read-only)
+ *   - Or, in ring mode, posts jobs as descriptors in memory (Ring_Base / Ring_Size / Ring_Tail, Ring_Head read-only)
+ *   - Counts completions (Completed_Jobs) and can coalesce interrupts (Irq_Count_Threshold / Irq_Timeout_Cycles)
  * - Compute engines (Softmax/Norm) actively read config regs and write status
- * - AXI4-Lite Master interface for autonomous memory access from compute engines
+ * - AXI4 Master interface (INCR bursts up to 256 beats) for autonomous memory access from compute engines
  * - Demux logic to route operations to SoftMax or Norm engines
+ * - Descriptor ring: fetches queued jobs and writes their completion records over the same AXI master
  * - SoftMax engine implementation (Norm engine placeholder)
  */
 SC_MODULE(SOLE) {
@@ -40,32 +45,41 @@ SC_MODULE(SOLE) {
     sc_in<sc_dt::sc_uint<32>>   proc_wdata;     ///< Processor write data
     sc_in<bool>                 proc_we;        ///< Processor write enable (1=write, 0=read)
     sc_out<sc_dt::sc_uint<32>>  proc_rdata;     ///< Processor read data
-    sc_out<bool>                interrupt;      ///< Interrupt to CPU when DONE or ERROR bit is set
+    sc_out<bool>                interrupt;      ///< Interrupt to CPU on DONE / ERROR, or coalesced (REG_IRQ_COUNT_THRESHOLD)
     
-    // ===== AXI4-Lite Master Ports (Write Address Channel) ======
+    // ===== AXI4 Master Ports (Write Address Channel) ======
     sc_out<sc_dt::sc_uint<AXI_ADDR_WIDTH>>  M_AXI_AWADDR;   ///< Master write address
+    sc_out<sc_dt::sc_uint<8>>               M_AXI_AWLEN;    ///< Master write burst length - 1
+    sc_out<sc_dt::sc_uint<3>>               M_AXI_AWSIZE;   ///< Master write beat size
+    sc_out<sc_dt::sc_uint<2>>               M_AXI_AWBURST;  ///< Master write burst type
     sc_out<bool>                            M_AXI_AWVALID;  ///< Master write address valid
     sc_in<bool>                             M_AXI_AWREADY;  ///< Master write address ready
     
-    // ===== AXI4-Lite Master Ports (Write Data Channel) =====
-    sc_out<sc_dt::sc_uint<AXI_DATA_WIDTH>> M_AXI_WDATA;     ///< Master write data (64-bit)
-    sc_out<sc_dt::sc_uint<AXI_STRB_WIDTH>> M_AXI_WSTRB;     ///< Master write strobes (8-bit)
+    // ===== AXI4 Master Ports (Write Data Channel) =====
+    sc_out<axi_data_t>                     M_AXI_WDATA;     ///< Master write data (AXI_DATA_WIDTH)
+    sc_out<sc_dt::sc_uint<AXI_STRB_WIDTH>> M_AXI_WSTRB;     ///< Master write strobes (AXI_STRB_WIDTH)
+    sc_out<bool>                           M_AXI_WLAST;     ///< Master last write beat of the burst
     sc_out<bool>                           M_AXI_WVALID;    ///< Master write data valid
     sc_in<bool>                            M_AXI_WREADY;    ///< Master write data ready
     
-    // ===== AXI4-Lite Master Ports (Write Response Channel) =====
-    sc_in<sc_uint2>                        M_AXI_BRESP;     ///< Master write response
+    // ===== AXI4 Master Ports (Write Response Channel) =====
+    sc_in<sc_dt::sc_uint<2>>                 M_AXI_BRESP;     ///< Master write response
     sc_in<bool>                            M_AXI_BVALID;    ///< Master write response valid
     sc_out<bool>                           M_AXI_BREADY;    ///< Master write response ready
     
-    // ===== AXI4-Lite Master Ports (Read Address Channel) =====
+    // ===== AXI4 Master Ports (Read Address Channel) =====
+    sc_out<sc_dt::sc_uint<AXI_ID_WIDTH>>    M_AXI_ARID;     ///< Master read transaction ID
     sc_out<sc_dt::sc_uint<AXI_ADDR_WIDTH>>  M_AXI_ARADDR;   ///< Master read address
+    sc_out<sc_dt::sc_uint<8>>               M_AXI_ARLEN;    ///< Master read burst length - 1
+    sc_out<sc_dt::sc_uint<3>>               M_AXI_ARSIZE;   ///< Master read beat size
+    sc_out<sc_dt::sc_uint<2>>               M_AXI_ARBURST;  ///< Master read burst type
     sc_out<bool>                            M_AXI_ARVALID;  ///< Master read address valid
     sc_in<bool>                             M_AXI_ARREADY;  ///< Master read address ready
     
-    // ===== AXI4-Lite Master Ports (Read Data Channel) =====
-    sc_in<sc_dt::sc_uint<AXI_DATA_WIDTH>>  M_AXI_RDATA;     ///< Master read data (64-bit)
-    sc_in<sc_uint2>                        M_AXI_RRESP;     ///< Master read response
+    // ===== AXI4 Master Ports (Read Data Channel) =====
+    sc_in<sc_dt::sc_uint<AXI_ID_WIDTH>>    M_AXI_RID;       ///< Master read data ID
+    sc_in<axi_data_t>                      M_AXI_RDATA;     ///< Master read data (AXI_DATA_WIDTH)
+    sc_in<sc_dt::sc_uint<2>>                 M_AXI_RRESP;     ///< Master read response
     sc_in<bool>                            M_AXI_RVALID;    ///< Master read data valid
     sc_out<bool>                           M_AXI_RREADY;    ///< Master read data ready
 
@@ -80,6 +94,17 @@ SC_MODULE(SOLE) {
     sc_signal<sc_uint32>        reg_dst_addr_base_h;   ///< Destination address base high 32-bit (0x14)
     sc_signal<sc_uint32>        reg_length_l;          ///< Data length low 32-bit (0x18)
     sc_signal<sc_uint32>        reg_length_h;          ///< Data length high 32-bit (0x1C)
+    sc_signal<sc_uint32>        reg_row_count;         ///< Rows per START (0x24, 0 = 1)
+    sc_signal<sc_uint32>        reg_src_row_stride;    ///< Source row stride in bytes (0x28, 0 = packed)
+    sc_signal<sc_uint32>        reg_dst_row_stride;    ///< Destination row stride in bytes (0x2C, 0 = packed)
+    sc_signal<sc_uint32>        reg_ring_base_l;       ///< Descriptor ring address low 32-bit (0x30)
+    sc_signal<sc_uint32>        reg_ring_base_h;       ///< Descriptor ring address high 32-bit (0x34)
+    sc_signal<sc_uint32>        reg_ring_size;         ///< Descriptors in the ring (0x38)
+    sc_signal<sc_uint32>        reg_ring_tail;         ///< Ring producer index, the doorbell (0x3C)
+    sc_signal<sc_uint32>        reg_completed_jobs;    ///< Jobs completed since reset (0x44, read)
+    sc_signal<sc_uint32>        reg_completed_ack;     ///< Completions acknowledged by the processor (0x44, write)
+    sc_signal<sc_uint32>        reg_irq_count_threshold; ///< Coalesced interrupt count threshold (0x48, 0 = off)
+    sc_signal<sc_uint32>        reg_irq_timeout_cycles;  ///< Coalesced interrupt timeout in cycles (0x4C, 0 = none)
     
     // Status signals
     sc_signal<bool>             softmax_done;      ///< SoftMax engine done signal
@@ -94,35 +119,96 @@ SC_MODULE(SOLE) {
     sc_signal<sc_uint64>        src_addr_base;     ///< 64-bit source address from registers
     sc_signal<sc_uint64>        dst_addr_base;     ///< 64-bit destination address from registers
     sc_signal<sc_uint64>        data_length;       ///< 64-bit data length from registers
+    sc_signal<sc_uint8>         burst_len;         ///< Max AXI burst length - 1 (REG_CONTROL[15:8])
+    sc_signal<sc_uint8>         read_outstanding;  ///< Max AR bursts in flight (REG_CONTROL[23:16])
+    sc_signal<bool>             reread;            ///< Force the two-pass re-read mode (REG_CONTROL[24])
+    sc_signal<sc_uint32>        row_count;         ///< Rows per START from REG_ROW_COUNT
+    sc_signal<sc_uint32>        src_row_stride;    ///< Source row stride from REG_SRC_ROW_STRIDE
+    sc_signal<sc_uint32>        dst_row_stride;    ///< Destination row stride from REG_DST_ROW_STRIDE
+
+    // Descriptor ring (REG_CONTROL[25] = ring mode)
+    sc_signal<bool>             ring_enable;       ///< Ring mode from REG_CONTROL[25]
+    sc_signal<sc_uint64>        ring_base;         ///< 64-bit descriptor ring address from registers
+    sc_signal<sc_uint32>        ring_size;         ///< Ring size from REG_RING_SIZE
+    sc_signal<sc_uint32>        ring_tail;         ///< Producer index from REG_RING_TAIL
+    sc_signal<sc_uint32>        ring_head;         ///< Consumer index (REG_RING_HEAD)
+    sc_signal<bool>             ring_busy;         ///< Ring is fetching, running or completing a descriptor
+    sc_signal<bool>             ring_job_complete; ///< HEAD advanced past a completed descriptor (pulse)
+    sc_signal<bool>             ring_job_start;    ///< START of the current descriptor
+    sc_signal<sc_uint64>        ring_job_src;      ///< Source address of the current descriptor
+    sc_signal<sc_uint64>        ring_job_dst;      ///< Destination address of the current descriptor
+    sc_signal<sc_uint64>        ring_job_length;   ///< Length of the current descriptor
+    sc_signal<sc_uint32>        ring_job_flags;    ///< Flags of the current descriptor (REG_CONTROL layout)
     
+    // Interrupt coalescing
+    sc_signal<bool>             irq_coalesced;     ///< Coalesced interrupt level (threshold or timeout reached)
+    bool                        last_error = false;  ///< REG_STATUS ERROR at the previous clock edge
+    uint32_t                    irq_wait_cycles = 0; ///< Cycles with unacknowledged completions
+
     // Softmax control signals
     sc_signal<bool>             softmax_enable;    ///< Enable signal for Softmax
     
-    // AXI4-Lite Master signals from Softmax (internal routing)
+    // AXI4 Master signals from Softmax (internal routing)
     sc_signal<sc_dt::sc_uint<AXI_ADDR_WIDTH>> softmax_awaddr;    ///< Softmax write address
+    sc_signal<sc_dt::sc_uint<8>>              softmax_awlen;     ///< Softmax write burst length - 1
+    sc_signal<sc_dt::sc_uint<3>>              softmax_awsize;    ///< Softmax write beat size
+    sc_signal<sc_dt::sc_uint<2>>              softmax_awburst;   ///< Softmax write burst type
     sc_signal<bool>                           softmax_awvalid;   ///< Softmax write address valid
     sc_signal<bool>                           softmax_awready;   ///< Softmax write address ready
     
-    sc_signal<sc_dt::sc_uint<AXI_DATA_WIDTH>> softmax_wdata;     ///< Softmax write data
+    sc_signal<axi_data_t>                     softmax_wdata;     ///< Softmax write data
     sc_signal<sc_dt::sc_uint<AXI_STRB_WIDTH>> softmax_wstrb;     ///< Softmax write strobes
+    sc_signal<bool>                           softmax_wlast;     ///< Softmax last write beat
     sc_signal<bool>                           softmax_wvalid;    ///< Softmax write data valid
     sc_signal<bool>                           softmax_wready;    ///< Softmax write data ready
     
-    sc_signal<sc_uint2>                       softmax_bresp;     ///< Softmax write response
+    sc_signal<sc_dt::sc_uint<2>>              softmax_bresp;     ///< Softmax write response
     sc_signal<bool>                           softmax_bvalid;    ///< Softmax write response valid
     sc_signal<bool>                           softmax_bready;    ///< Softmax write response ready
     
+    sc_signal<sc_dt::sc_uint<AXI_ID_WIDTH>>   softmax_arid;      ///< Softmax read transaction ID
     sc_signal<sc_dt::sc_uint<AXI_ADDR_WIDTH>> softmax_araddr;    ///< Softmax read address
+    sc_signal<sc_dt::sc_uint<8>>              softmax_arlen;     ///< Softmax read burst length - 1
+    sc_signal<sc_dt::sc_uint<3>>              softmax_arsize;    ///< Softmax read beat size
+    sc_signal<sc_dt::sc_uint<2>>              softmax_arburst;   ///< Softmax read burst type
     sc_signal<bool>                           softmax_arvalid;   ///< Softmax read address valid
     sc_signal<bool>                           softmax_arready;   ///< Softmax read address ready
     
-    sc_signal<sc_dt::sc_uint<AXI_DATA_WIDTH>> softmax_rdata;     ///< Softmax read data
-    sc_signal<sc_uint2>                       softmax_rresp;     ///< Softmax read response
+    sc_signal<sc_dt::sc_uint<AXI_ID_WIDTH>>   softmax_rid;       ///< Softmax read data ID
+    sc_signal<axi_data_t>                     softmax_rdata;     ///< Softmax read data
+    sc_signal<sc_dt::sc_uint<2>>              softmax_rresp;     ///< Softmax read response
     sc_signal<bool>                           softmax_rvalid;    ///< Softmax read data valid
     sc_signal<bool>                           softmax_rready;    ///< Softmax read data ready
     
+    // AXI4 Master signals from the descriptor ring (valid while ring_bus_owner)
+    sc_signal<bool>                           ring_bus_owner;    ///< Ring drives the master ports
+    sc_signal<sc_dt::sc_uint<AXI_ADDR_WIDTH>> ring_awaddr;
+    sc_signal<sc_dt::sc_uint<8>>              ring_awlen;
+    sc_signal<bool>                           ring_awvalid;
+    sc_signal<bool>                           ring_awready;
+    sc_signal<axi_data_t>                     ring_wdata;
+    sc_signal<sc_dt::sc_uint<AXI_STRB_WIDTH>> ring_wstrb;
+    sc_signal<bool>                           ring_wlast;
+    sc_signal<bool>                           ring_wvalid;
+    sc_signal<bool>                           ring_wready;
+    sc_signal<sc_dt::sc_uint<2>>              ring_bresp;
+    sc_signal<bool>                           ring_bvalid;
+    sc_signal<bool>                           ring_bready;
+    sc_signal<sc_dt::sc_uint<AXI_ID_WIDTH>>   ring_arid;
+    sc_signal<sc_dt::sc_uint<AXI_ADDR_WIDTH>> ring_araddr;
+    sc_signal<sc_dt::sc_uint<8>>              ring_arlen;
+    sc_signal<bool>                           ring_arvalid;
+    sc_signal<bool>                           ring_arready;
+    sc_signal<axi_data_t>                     ring_rdata;
+    sc_signal<sc_dt::sc_uint<2>>              ring_rresp;
+    sc_signal<bool>                           ring_rvalid;
+    sc_signal<bool>                           ring_rready;
+
     // Softmax engine instance
     Softmax                     *softmax_unit;
+
+    // Descriptor ring instance
+    Descriptor_Ring             *ring_unit;
     
     // Norm engine instance (placeholder - not instantiated yet)
     // Norm_Module              *norm_unit;
@@ -150,13 +236,23 @@ SC_MODULE(SOLE) {
      * @brief Demux Logic
      * Routes control signals to SoftMax or Norm engine based on Mode bit
      * Softmax/Norm engines read config registers and write status register
+     * (in ring mode Softmax takes its job from the descriptor ring instead)
      * Multiplexes AXI4-Lite Master signals from compute engines to MMIO outputs
      */
     void demux_logic();
 
+    /**
+     * @brief Completion Counter (clocked)
+     * Counts completed jobs into REG_COMPLETED_JOBS and raises irq_coalesced
+     * when the unacknowledged ones reach REG_IRQ_COUNT_THRESHOLD or have
+     * waited REG_IRQ_TIMEOUT_CYCLES
+     */
+    void completion_counter_process();
+
     /**
      * @brief Interrupt Output Update
-     * interrupt = 1 when REG_STATUS has DONE bit or ERROR bit asserted
+     * REG_IRQ_COUNT_THRESHOLD = 0: interrupt = 1 when REG_STATUS has DONE bit or ERROR bit asserted
+     * Otherwise: interrupt = irq_coalesced
      */
     void interrupt_update_process();
 
@@ -165,17 +261,77 @@ SC_MODULE(SOLE) {
      */
     //void print_reg_status();
 
+    // ===== Checkpoint Support =====
+
+    /// MMIO register file (everything a checkpoint restores; REG_STATUS comes from the engine)
+    struct Register_File {
+        uint32_t control = 0;
+        uint32_t src_addr_base_l = 0;
+        uint32_t src_addr_base_h = 0;
+        uint32_t dst_addr_base_l = 0;
+        uint32_t dst_addr_base_h = 0;
+        uint32_t length_l = 0;
+        uint32_t length_h = 0;
+        uint32_t row_count = 0;
+        uint32_t src_row_stride = 0;
+        uint32_t dst_row_stride = 0;
+        uint32_t ring_base_l = 0;
+        uint32_t ring_base_h = 0;
+        uint32_t ring_size = 0;
+        uint32_t ring_tail = 0;
+        uint32_t ring_head = 0;             ///< Descriptor ring consumer index (read-only over MMIO)
+        uint32_t irq_count_threshold = 0;
+        uint32_t irq_timeout_cycles = 0;
+        uint32_t completed_jobs = 0;        ///< REG_COMPLETED_JOBS counter (read side of 0x44)
+        uint32_t completed_ack = 0;         ///< Acknowledged count (write side of 0x44)
+        uint32_t irq_wait_cycles = 0;       ///< Coalescing timeout progress (not MMIO-visible)
+        uint32_t last_error = 0;            ///< REG_STATUS ERROR at the last edge, 0 / 1 (not MMIO-visible)
+    };
+
+    /// Current register file contents
+    Register_File save_registers() const;
+
+    /// AXI port shared with other masters (Softmax::set_bus_share()); before the simulation starts
+    void set_bus_share(unsigned bursts) { softmax_unit->set_bus_share(bursts); }
+
+    /**
+     * @brief Clock edges that may be skipped while no signal changes (stopped clock)
+     * The smallest limit of the engine and the ring; the coalescing timeout
+     * must still expire at its own edge, and a pending restore is applied first.
+     */
+    uint64_t idle_cycle_limit() const;
+
+    /// Account for 'cycles' skipped edges (at most idle_cycle_limit())
+    void skip_cycles(uint64_t cycles);
+
+    /**
+     * @brief Load the register file without processor write cycles
+     * Applied by mmio_access_process on its next activation (at the latest the
+     * next clock edge), so the registers keep a single writer process; the
+     * completion count and coalescing state load at the next edge. In ring
+     * mode HEAD is loaded into the descriptor ring once it sees the ring enabled.
+     */
+    void restore_registers(const Register_File& regs);
+
+    Register_File               pending_registers;  ///< Set by restore_registers()
+    bool                        restore_pending;    ///< pending_registers not yet applied (mmio_access_process)
+    bool                        counter_restore_pending = false;  ///< Completion count not yet applied (completion_counter_process)
+
     
     // ===== Constructor =====
     SC_HAS_PROCESS(SOLE);
     SOLE(sc_core::sc_module_name name) : sc_core::sc_module(name), 
         clk("clk"), rst("rst"), proc_addr("proc_addr"), proc_wdata("proc_wdata"), proc_we("proc_we"), proc_rdata("proc_rdata"),
         interrupt("interrupt"),
-        M_AXI_AWADDR("M_AXI_AWADDR"), M_AXI_AWVALID("M_AXI_AWVALID"), M_AXI_AWREADY("M_AXI_AWREADY"),
-        M_AXI_WDATA("M_AXI_WDATA"), M_AXI_WSTRB("M_AXI_WSTRB"), M_AXI_WVALID("M_AXI_WVALID"), M_AXI_WREADY("M_AXI_WREADY"),
+        M_AXI_AWADDR("M_AXI_AWADDR"), M_AXI_AWLEN("M_AXI_AWLEN"), M_AXI_AWSIZE("M_AXI_AWSIZE"), M_AXI_AWBURST("M_AXI_AWBURST"),
+        M_AXI_AWVALID("M_AXI_AWVALID"), M_AXI_AWREADY("M_AXI_AWREADY"),
+        M_AXI_WDATA("M_AXI_WDATA"), M_AXI_WSTRB("M_AXI_WSTRB"), M_AXI_WLAST("M_AXI_WLAST"), M_AXI_WVALID("M_AXI_WVALID"),
+        M_AXI_WREADY("M_AXI_WREADY"),
         M_AXI_BRESP("M_AXI_BRESP"), M_AXI_BVALID("M_AXI_BVALID"), M_AXI_BREADY("M_AXI_BREADY"),
-        M_AXI_ARADDR("M_AXI_ARADDR"), M_AXI_ARVALID("M_AXI_ARVALID"), M_AXI_ARREADY("M_AXI_ARREADY"),
-        M_AXI_RDATA("M_AXI_RDATA"), M_AXI_RRESP("M_AXI_RRESP"), M_AXI_RVALID("M_AXI_RVALID"), M_AXI_RREADY("M_AXI_RREADY")
+        M_AXI_ARID("M_AXI_ARID"), M_AXI_ARADDR("M_AXI_ARADDR"), M_AXI_ARLEN("M_AXI_ARLEN"), M_AXI_ARSIZE("M_AXI_ARSIZE"), M_AXI_ARBURST("M_AXI_ARBURST"),
+        M_AXI_ARVALID("M_AXI_ARVALID"), M_AXI_ARREADY("M_AXI_ARREADY"),
+        M_AXI_RID("M_AXI_RID"), M_AXI_RDATA("M_AXI_RDATA"), M_AXI_RRESP("M_AXI_RRESP"), M_AXI_RVALID("M_AXI_RVALID"), M_AXI_RREADY("M_AXI_RREADY"),
+        restore_pending(false)
     {
  
         std::cout << "Constructing SOLE module..." << std::endl;
@@ -192,57 +348,124 @@ SC_MODULE(SOLE) {
         softmax_unit->src_addr_base(src_addr_base);
         softmax_unit->dst_addr_base(dst_addr_base);
         softmax_unit->data_length(data_length);
+        softmax_unit->burst_len(burst_len);
+        softmax_unit->read_outstanding(read_outstanding);
+        softmax_unit->reread(reread);
+        softmax_unit->row_count(row_count);
+        softmax_unit->src_row_stride(src_row_stride);
+        softmax_unit->dst_row_stride(dst_row_stride);
         
         // Connect status feedback to SOLE regfile
         softmax_unit->status_o(softmax_status);
         
-        // Connect Softmax AXI4-Lite Master interface (Write Address Channel)
+        // Connect Softmax AXI4 Master interface (Write Address Channel)
         softmax_unit->M_AXI_AWADDR(softmax_awaddr);
+        softmax_unit->M_AXI_AWLEN(softmax_awlen);
+        softmax_unit->M_AXI_AWSIZE(softmax_awsize);
+        softmax_unit->M_AXI_AWBURST(softmax_awburst);
         softmax_unit->M_AXI_AWVALID(softmax_awvalid);
         softmax_unit->M_AXI_AWREADY(softmax_awready);
         
-        // Connect Softmax AXI4-Lite Master interface (Write Data Channel)
+        // Connect Softmax AXI4 Master interface (Write Data Channel)
         softmax_unit->M_AXI_WDATA(softmax_wdata);
         softmax_unit->M_AXI_WSTRB(softmax_wstrb);
+        softmax_unit->M_AXI_WLAST(softmax_wlast);
         softmax_unit->M_AXI_WVALID(softmax_wvalid);
         softmax_unit->M_AXI_WREADY(softmax_wready);
         
-        // Connect Softmax AXI4-Lite Master interface (Write Response Channel)
+        // Connect Softmax AXI4 Master interface (Write Response Channel)
         softmax_unit->M_AXI_BRESP(softmax_bresp);
         softmax_unit->M_AXI_BVALID(softmax_bvalid);
         softmax_unit->M_AXI_BREADY(softmax_bready);
         
-        // Connect Softmax AXI4-Lite Master interface (Read Address Channel)
+        // Connect Softmax AXI4 Master interface (Read Address Channel)
+        softmax_unit->M_AXI_ARID(softmax_arid);
         softmax_unit->M_AXI_ARADDR(softmax_araddr);
+        softmax_unit->M_AXI_ARLEN(softmax_arlen);
+        softmax_unit->M_AXI_ARSIZE(softmax_arsize);
+        softmax_unit->M_AXI_ARBURST(softmax_arburst);
         softmax_unit->M_AXI_ARVALID(softmax_arvalid);
         softmax_unit->M_AXI_ARREADY(softmax_arready);
         
-        // Connect Softmax AXI4-Lite Master interface (Read Data Channel)
+        // Connect Softmax AXI4 Master interface (Read Data Channel)
+        softmax_unit->M_AXI_RID(softmax_rid);
         softmax_unit->M_AXI_RDATA(softmax_rdata);
         softmax_unit->M_AXI_RRESP(softmax_rresp);
         softmax_unit->M_AXI_RVALID(softmax_rvalid);
         softmax_unit->M_AXI_RREADY(softmax_rready);
+
+        // ===== Instantiate Descriptor Ring =====
+        ring_unit = new Descriptor_Ring("ring_unit");
+        ring_unit->clk(clk);
+        ring_unit->rst(rst);
+        ring_unit->enable(ring_enable);
+        ring_unit->ring_base(ring_base);
+        ring_unit->ring_size(ring_size);
+        ring_unit->ring_tail(ring_tail);
+        ring_unit->ring_head(ring_head);
+        ring_unit->job_start(ring_job_start);
+        ring_unit->job_src(ring_job_src);
+        ring_unit->job_dst(ring_job_dst);
+        ring_unit->job_length(ring_job_length);
+        ring_unit->job_flags(ring_job_flags);
+        ring_unit->engine_status(softmax_status);
+        ring_unit->busy(ring_busy);
+        ring_unit->job_complete(ring_job_complete);
+        ring_unit->bus_owner(ring_bus_owner);
+        ring_unit->M_AXI_AWADDR(ring_awaddr);
+        ring_unit->M_AXI_AWLEN(ring_awlen);
+        ring_unit->M_AXI_AWVALID(ring_awvalid);
+        ring_unit->M_AXI_AWREADY(ring_awready);
+        ring_unit->M_AXI_WDATA(ring_wdata);
+        ring_unit->M_AXI_WSTRB(ring_wstrb);
+        ring_unit->M_AXI_WLAST(ring_wlast);
+        ring_unit->M_AXI_WVALID(ring_wvalid);
+        ring_unit->M_AXI_WREADY(ring_wready);
+        ring_unit->M_AXI_BRESP(ring_bresp);
+        ring_unit->M_AXI_BVALID(ring_bvalid);
+        ring_unit->M_AXI_BREADY(ring_bready);
+        ring_unit->M_AXI_ARID(ring_arid);
+        ring_unit->M_AXI_ARADDR(ring_araddr);
+        ring_unit->M_AXI_ARLEN(ring_arlen);
+        ring_unit->M_AXI_ARVALID(ring_arvalid);
+        ring_unit->M_AXI_ARREADY(ring_arready);
+        ring_unit->M_AXI_RDATA(ring_rdata);
+        ring_unit->M_AXI_RRESP(ring_rresp);
+        ring_unit->M_AXI_RVALID(ring_rvalid);
+        ring_unit->M_AXI_RREADY(ring_rready);
         
         // ===== Register SC_METHOD processes =====
         
         // Processor MMIO Access Process (combinational for reads, sequential for writes)
         SC_METHOD(mmio_access_process);
-        sensitive << clk.pos() << proc_we << proc_addr << proc_wdata
-                  << softmax_busy << softmax_done << norm_busy << norm_done << softmax_status;
+        sensitive << clk.pos() << rst << proc_we << proc_addr << proc_wdata
+                  << softmax_busy << softmax_done << norm_busy << norm_done << softmax_status << ring_head
+                  << reg_completed_jobs;
         
         // Demux Logic (combinational)
         SC_METHOD(demux_logic);
         sensitive << reg_control << reg_src_addr_base_l << reg_src_addr_base_h 
                   << reg_dst_addr_base_l << reg_dst_addr_base_h
                   << reg_length_l << reg_length_h << softmax_done << norm_done
-                  << softmax_awaddr << softmax_awvalid << M_AXI_AWREADY
-                  << softmax_wdata << softmax_wstrb << softmax_wvalid << M_AXI_WREADY
+                  << reg_row_count << reg_src_row_stride << reg_dst_row_stride
+                  << reg_ring_base_l << reg_ring_base_h << reg_ring_size << reg_ring_tail
+                  << ring_job_start << ring_job_src << ring_job_dst << ring_job_length << ring_job_flags
+                  << ring_bus_owner << ring_awaddr << ring_awlen << ring_awvalid << ring_wdata << ring_wstrb
+                  << ring_wlast << ring_wvalid << ring_bready << ring_arid << ring_araddr << ring_arlen
+                  << ring_arvalid << ring_rready
+                  << softmax_awaddr << softmax_awlen << softmax_awsize << softmax_awburst
+                  << softmax_awvalid << M_AXI_AWREADY
+                  << softmax_wdata << softmax_wstrb << softmax_wlast << softmax_wvalid << M_AXI_WREADY
                   << M_AXI_BRESP << M_AXI_BVALID << softmax_bready
-                  << softmax_araddr << softmax_arvalid << M_AXI_ARREADY
-                  << M_AXI_RDATA << M_AXI_RRESP << M_AXI_RVALID << softmax_rready;
+                  << softmax_arid << softmax_araddr << softmax_arlen << softmax_arsize << softmax_arburst
+                  << softmax_arvalid << M_AXI_ARREADY
+                  << M_AXI_RID << M_AXI_RDATA << M_AXI_RRESP << M_AXI_RVALID << softmax_rready;
+
+        SC_METHOD(completion_counter_process);
+        sensitive << clk.pos();
 
         SC_METHOD(interrupt_update_process);
-        sensitive << rst << reg_status;
+        sensitive << rst << reg_status << reg_irq_count_threshold << irq_coalesced;
 
         //SC_METHOD(print_reg_status);
         //sensitive << reg_status;
@@ -0,0 +1,144 @@
+#ifndef SOLE_AT_H
+#define SOLE_AT_H
+
+#include <systemc.h>
+#include <tlm.h>
+#include <tlm_utils/simple_initiator_socket.h>
+#include <tlm_utils/peq_with_cb_and_phase.h>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+#include "SOLE_TLM.h"
+
+/**
+ * @class SOLE_AT
+ * @brief TLM-2.0 approximately-timed model of SOLE (SoftMax mode)
+ *
+ * **Functional Overview:**
+ * - MMIO target, interrupt and numerics from SOLE_TLM
+ * - mem_socket: non-blocking TLM initiator (base protocol, four phases).
+ *   Every request carries burst_beats 64-bit beats; a read response delivers
+ *   one beat per cycle, so END_RESP is sent burst_beats cycles after BEGIN_RESP
+ * - Flow control: one BEGIN_REQ per cycle, the next one only after END_REQ,
+ *   at most max_outstanding_reads / max_outstanding_writes requests in flight
+ *   (a request is in flight from BEGIN_REQ until its END_RESP)
+ *
+ * **Timing (clk_period per cycle):**
+ * Same phase structure as the pin-level Softmax. PROCESS1 issues its first read
+ * READ_ISSUE_CYCLES after entering the state, consumes beats in address order
+ * one per cycle and ends P1_DRAIN_CYCLES after the last beat. Output beat i of
+ * PROCESS3 is ready P3_FILL_CYCLES + i cycles after entering the state and the
+ * state ends P3_DRAIN_CYCLES after the last write response. Against a memory with
+ * the timing of the SOLE_test AxiSlaveMemory this reproduces the pin-level
+ * execution time exactly; with other interconnect latencies it predicts it.
+ */
+class SOLE_AT : public SOLE_TLM {
+public:
+    // ===== TLM Socket =====
+    tlm_utils::simple_initiator_socket<SOLE_AT, 64>  mem_socket;   ///< Memory master (64-bit beats)
+
+    // ===== Calibrated pipeline lengths (cycles) =====
+    static constexpr unsigned READ_ISSUE_CYCLES    = 1;    ///< PROCESS1 -> first read request
+    static constexpr unsigned P1_DRAIN_CYCLES      = 7;    ///< Last input beat -> PROCESS2
+    static constexpr unsigned P3_FILL_CYCLES       = 5;    ///< PROCESS3 -> first output beat ready
+    static constexpr unsigned P3_DRAIN_CYCLES      = 2;    ///< Last write response -> DONE
+
+    /// Interconnect-facing parameters
+    struct Config {
+        unsigned max_outstanding_reads;
+        unsigned max_outstanding_writes;
+        unsigned read_burst_beats;              ///< 64-bit beats per read request
+        unsigned write_burst_beats;             ///< 64-bit beats per write request
+
+        Config() : max_outstanding_reads(4), max_outstanding_writes(4),
+                   read_burst_beats(1), write_burst_beats(1) {}
+    };
+
+    /// Counters of the last row (run_softmax)
+    struct Stats {
+        uint64_t         read_requests  = 0;
+        uint64_t         write_requests = 0;
+        unsigned         peak_outstanding_reads  = 0;
+        unsigned         peak_outstanding_writes = 0;
+        sc_core::sc_time process1_time;
+        sc_core::sc_time process3_time;
+    };
+
+    SOLE_AT(sc_core::sc_module_name name, const Config& config = Config(),
+            sc_core::sc_time clk_period = sc_core::sc_time(1, sc_core::SC_NS))
+        : SOLE_TLM(name, clk_period),
+        mem_socket("mem_socket"),
+        config(config),
+        peq("peq", this, &SOLE_AT::peq_callback),
+        request_pending(nullptr),
+        requests_completed(0),
+        response_error(false)
+    {
+        if (this->config.max_outstanding_reads == 0 || this->config.max_outstanding_writes == 0 ||
+            this->config.read_burst_beats == 0 || this->config.write_burst_beats == 0) {
+            SC_REPORT_ERROR("SOLE_AT", "outstanding limits and burst lengths must be non-zero");
+        }
+        mem_socket.register_nb_transport_bw(this, &SOLE_AT::nb_transport_bw);
+    }
+
+    const Config& get_config() const { return config; }
+    const Stats& stats() const { return run_stats; }
+
+protected:
+    void run_softmax(uint64_t src_addr, uint64_t dst_addr, uint64_t length) override;
+    bool ring_access(tlm::tlm_command cmd, uint64_t addr, uint64_t* data, size_t words) override;
+
+private:
+    /// Payload pool (tlm_mm_interface): payloads return here on their last release()
+    class Payload_Pool : public tlm::tlm_mm_interface {
+    public:
+        tlm::tlm_generic_payload* allocate();
+        void free(tlm::tlm_generic_payload* trans) override { free_list.push_back(trans); }
+    private:
+        std::vector<std::unique_ptr<tlm::tlm_generic_payload>> payloads;
+        std::vector<tlm::tlm_generic_payload*> free_list;
+    };
+
+    /// Bookkeeping of one request in flight
+    struct Request {
+        size_t first_beat;
+        size_t beats;
+        bool   completed_by_target;   ///< TLM_COMPLETED returned: no END_RESP to send
+    };
+
+    Config config;
+    Stats  run_stats;
+    tlm_utils::peq_with_cb_and_phase<SOLE_AT> peq;
+    Payload_Pool pool;
+
+    // ===== Transfer state (one transfer at a time) =====
+    std::vector<uint64_t>         beat_buffer;     ///< Input beats (PROCESS1) / output beats (PROCESS3)
+    std::vector<sc_core::sc_time> beat_time;       ///< Read: arrival time of each beat
+    std::map<tlm::tlm_generic_payload*, Request> in_flight;
+    tlm::tlm_generic_payload* request_pending;     ///< Request without END_REQ yet (nullptr: channel free)
+    size_t            requests_completed;
+    bool              response_error;
+    sc_core::sc_time  last_response;               ///< Time of the last BEGIN_RESP
+    sc_core::sc_event transfer_event;              ///< Notified on every protocol step
+
+    /**
+     * @brief Move 'beats' beats between beat_buffer and memory at 'addr'
+     *
+     * Read requests may start at 'first_issue'. For writes, beat i is ready at
+     * first_issue + i cycles; a request is issued once its first beat is ready
+     * and holds the write data channel for one cycle per beat.
+     * Returns when every request has seen its END_RESP.
+     * @return true if no request got an error response
+     */
+    bool transfer(tlm::tlm_command cmd, uint64_t addr, size_t beats, const sc_core::sc_time& first_issue);
+    void issue_request(tlm::tlm_command cmd, uint64_t addr, size_t first_beat, size_t beats);
+
+    tlm::tlm_sync_enum nb_transport_bw(tlm::tlm_generic_payload& trans, tlm::tlm_phase& phase, sc_core::sc_time& delay);
+    void peq_callback(tlm::tlm_generic_payload& trans, const tlm::tlm_phase& phase);
+
+    /// Hold 'state' until 'end'; a non-zero error_code is flagged during the last cycle
+    void finish_phase(softmax::status::State_t state, const sc_core::sc_time& end, uint8_t error_code);
+};
+
+#endif // SOLE_AT_H
@@ -0,0 +1,66 @@
+#ifndef SOLE_LT_H
+#define SOLE_LT_H
+
+#include <systemc.h>
+#include <tlm.h>
+#include <tlm_utils/simple_initiator_socket.h>
+#include <cstdint>
+#include <vector>
+#include "SOLE_TLM.h"
+
+/**
+ * @class SOLE_LT
+ * @brief TLM-2.0 loosely-timed functional model of SOLE (SoftMax mode)
+ *
+ * **Functional Overview:**
+ * - MMIO target, interrupt and numerics from SOLE_TLM
+ * - mem_socket: TLM initiator for the source/destination buffers. Each phase is
+ *   one bulk b_transport (or a memcpy when the target grants DMI)
+ *
+ * **Timing (clk_period per cycle):**
+ * The status register walks IDLE -> PROCESS1 -> PROCESS2 -> PROCESS3 -> IDLE
+ * with the same phase lengths as the pin-level Softmax on a zero-wait memory
+ * (test/SOLE_Execution_Time_TEST/softmax_exec_time_results.csv, 20 + 2 * beats ns):
+ * START_LATENCY_CYCLES after the CONTROL write, PROCESS1 for beats + P1_PIPELINE_CYCLES,
+ * PROCESS2 for P2_CYCLES, PROCESS3 for beats + P3_PIPELINE_CYCLES, then DONE for one cycle.
+ * Descriptor fetches and completion records are one access each.
+ * Delay annotated by the memory target (or DMI latency) is added to the phase
+ * in which the access happens.
+ */
+class SOLE_LT : public SOLE_TLM {
+public:
+    // ===== TLM Socket =====
+    tlm_utils::simple_initiator_socket<SOLE_LT, 64>  mem_socket;   ///< Memory master (64-bit beats)
+
+    // ===== Calibrated phase lengths (cycles) =====
+    static constexpr unsigned P1_PIPELINE_CYCLES   = 8;    ///< PROCESS1 = beats + 8
+    static constexpr unsigned P3_PIPELINE_CYCLES   = 8;    ///< PROCESS3 = beats + 8
+
+    SOLE_LT(sc_core::sc_module_name name, sc_core::sc_time clk_period = sc_core::sc_time(1, sc_core::SC_NS))
+        : SOLE_TLM(name, clk_period),
+        mem_socket("mem_socket"),
+        dmi_valid(false)
+    {
+        mem_socket.register_invalidate_direct_mem_ptr(this, &SOLE_LT::invalidate_direct_mem_ptr);
+    }
+
+protected:
+    void run_softmax(uint64_t src_addr, uint64_t dst_addr, uint64_t length) override;
+    bool ring_access(tlm::tlm_command cmd, uint64_t addr, uint64_t* data, size_t words) override;
+
+private:
+    std::vector<uint64_t> beat_buffer;  ///< Input beats (PROCESS1) / output beats (PROCESS3)
+
+    // ===== DMI =====
+    tlm::tlm_dmi dmi_data;
+    bool         dmi_valid;
+
+    /**
+     * @brief Bulk memory access through DMI or b_transport
+     * @return true on success; delay is increased by the annotated latency
+     */
+    bool mem_access(tlm::tlm_command cmd, uint64_t addr, uint64_t* data, size_t beats, sc_core::sc_time& delay);
+    void invalidate_direct_mem_ptr(sc_dt::uint64 start_range, sc_dt::uint64 end_range);
+};
+
+#endif // SOLE_LT_H
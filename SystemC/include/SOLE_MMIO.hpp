@@ -18,12 +18,16 @@ namespace mmio {
 // Address filtering uses 8-bit LSB (Addr[7:0]) for register offset
 // 
 // **Processor (Host) Access Permissions:**
-// - Control, Src_Addr_Base, Dst_Addr_Base, Length: Write-only for Processor
-// - Status: Read-only for Processor
+// - Control, Src_Addr_Base, Dst_Addr_Base, Length, Row_Count, Row_Strides: Write-only for Processor
+// - Ring_Base, Ring_Size, Ring_Tail: Write-only for Processor
+// - Status, Ring_Head: Read-only for Processor
+// - Irq_Count_Threshold, Irq_Timeout_Cycles: Write-only for Processor
+// - Completed_Jobs: Read-only counter; a Processor write acknowledges completions
 //
 // **Compute Engine (Softmax/Norm) Access Permissions:**
-// - Control, Src_Addr_Base, Dst_Addr_Base, Length: Read-only for Engine
+// - Control, Src_Addr_Base, Dst_Addr_Base, Length, Row_Count, Row_Strides: Read-only for Engine
 // - Status: Write-only for Engine
+// - Ring_Base, Ring_Size, Ring_Tail: Read-only for the descriptor ring; Ring_Head: Write-only
 
 /**
  * @brief Control Register Offset
@@ -97,6 +101,116 @@ constexpr uint32_t REG_LENGTH_H       = 0x1C;
  */
 constexpr uint32_t REG_RESERVED       = 0x20;
 
+/**
+ * @brief Row Count Offset
+ * Access: Write-only from Processor, Read-only from Compute Engine
+ * Width: 32 bits
+ * Description: Number of rows of Length elements processed by one START.
+ *   The engine runs the rows back to back and raises DONE (and the
+ *   interrupt) once, after the last row. 0 and 1 both mean a single row.
+ */
+constexpr uint32_t REG_ROW_COUNT      = 0x24;
+
+/**
+ * @brief Source Row Stride Offset
+ * Access: Write-only from Processor, Read-only from Compute Engine
+ * Width: 32 bits
+ * Description: Byte distance between the first elements of two consecutive
+ *   input rows (a multiple of the AXI beat size). 0 = rows packed back to back
+ *   (ceil(Length / lanes) beats).
+ */
+constexpr uint32_t REG_SRC_ROW_STRIDE = 0x28;
+
+/**
+ * @brief Destination Row Stride Offset
+ * Access: Write-only from Processor, Read-only from Compute Engine
+ * Width: 32 bits
+ * Description: Byte distance between two consecutive output rows, same
+ *   encoding as REG_SRC_ROW_STRIDE
+ */
+constexpr uint32_t REG_DST_ROW_STRIDE = 0x2C;
+
+/**
+ * @brief Descriptor Ring Base Low Offset
+ * Access: Write-only from Processor, Read-only from the descriptor ring
+ * Width: 32 bits
+ * Description: Lower 32-bits of the 64-bit byte address of descriptor 0
+ *   (RING_DESC_BYTES aligned). Program while CTRL_RING_BIT is 0.
+ */
+constexpr uint32_t REG_RING_BASE_L    = 0x30;
+
+/**
+ * @brief Descriptor Ring Base High Offset
+ * Access: Write-only from Processor, Read-only from the descriptor ring
+ * Width: 32 bits
+ * Description: Upper 32-bits of the 64-bit descriptor ring address
+ */
+constexpr uint32_t REG_RING_BASE_H    = 0x34;
+
+/**
+ * @brief Descriptor Ring Size Offset
+ * Access: Write-only from Processor, Read-only from the descriptor ring
+ * Width: 32 bits
+ * Description: Number of descriptors in the ring. HEAD == TAIL means empty,
+ *   so at most RING_SIZE - 1 jobs are queued at a time.
+ */
+constexpr uint32_t REG_RING_SIZE      = 0x38;
+
+/**
+ * @brief Descriptor Ring Tail Offset
+ * Access: Write-only from Processor, Read-only from the descriptor ring
+ * Width: 32 bits
+ * Description: Producer index (0 .. RING_SIZE - 1): one past the last
+ *   descriptor the processor has posted. Writing it is the doorbell; the
+ *   engine runs descriptors from HEAD until HEAD reaches TAIL.
+ */
+constexpr uint32_t REG_RING_TAIL      = 0x3C;
+
+/**
+ * @brief Descriptor Ring Head Offset
+ * Access: Read-only from Processor, Write-only from the descriptor ring
+ * Width: 32 bits
+ * Description: Consumer index: the next descriptor the engine runs. It
+ *   advances after the completion record of a descriptor is written back,
+ *   so HEAD == TAIL means every posted job has completed. Reset to 0 while
+ *   CTRL_RING_BIT is 0.
+ */
+constexpr uint32_t REG_RING_HEAD      = 0x40;
+
+/**
+ * @brief Completed Jobs Offset
+ * Access: Read: completion counter; Write: acknowledge (Processor)
+ * Width: 32 bits
+ * Description: Number of jobs completed since reset, wrapping at 2^32. A job
+ *   completes at the DONE pulse or when ERROR rises in register mode, and when
+ *   its completion record has been written back in ring mode. Unlike the DONE
+ *   pulse it cannot be missed by polling. Writing the value last read
+ *   acknowledges every completion up to it: the completions not yet
+ *   acknowledged (read value - written value) drive the coalesced interrupt.
+ */
+constexpr uint32_t REG_COMPLETED_JOBS = 0x44;
+
+/**
+ * @brief Interrupt Count Threshold Offset
+ * Access: Write-only from Processor
+ * Width: 32 bits
+ * Description: 0 = interrupt on every DONE / ERROR of REG_STATUS (default).
+ *   N > 0 = coalesced interrupt: raised once N completions are not
+ *   acknowledged (or on REG_IRQ_TIMEOUT_CYCLES), held until the processor
+ *   acknowledges them through REG_COMPLETED_JOBS.
+ */
+constexpr uint32_t REG_IRQ_COUNT_THRESHOLD = 0x48;
+
+/**
+ * @brief Interrupt Timeout Offset
+ * Access: Write-only from Processor
+ * Width: 32 bits
+ * Description: Coalesced interrupt only: also raise it when completions have
+ *   been waiting for acknowledgement this many cycles, even below the count
+ *   threshold. 0 = no timeout.
+ */
+constexpr uint32_t REG_IRQ_TIMEOUT_CYCLES = 0x4C;
+
 // ===== Control Register Bit Fields =====
 // Format: Register offset + bit position
 
@@ -108,6 +222,59 @@ constexpr uint32_t REG_RESERVED       = 0x20;
  */
 constexpr uint32_t CTRL_START_BIT  = 0;
 
+/**
+ * @brief BURST_LEN Field Lower Bit Position
+ * Bit Position: [8]
+ * Description: Lower bit of the 8-bit maximum AXI burst length field.
+ *   The field holds max beats per burst - 1 (AXI AxLEN encoding):
+ *   0 = single-beat transfers (default), 255 = up to 256-beat INCR bursts.
+ *   Bursts are also split at the end of the data and at 4 KB boundaries.
+ */
+constexpr uint32_t CTRL_BURST_LEN_LSB = 8;
+
+/**
+ * @brief BURST_LEN Field Upper Bit Position
+ * Bit Position: [15]
+ * Description: Upper bit of the 8-bit maximum AXI burst length field
+ */
+constexpr uint32_t CTRL_BURST_LEN_MSB = 15;
+
+/**
+ * @brief READ_OUTSTANDING Field Lower Bit Position
+ * Bit Position: [16]
+ * Description: Lower bit of the 8-bit outstanding read limit field.
+ *   The field holds the max number of AR bursts in flight (each with its own
+ *   ARID); 0 or values above 64 mean 64, the number of read IDs (default).
+ */
+constexpr uint32_t CTRL_READ_OUTSTANDING_LSB = 16;
+
+/**
+ * @brief READ_OUTSTANDING Field Upper Bit Position
+ * Bit Position: [23]
+ * Description: Upper bit of the 8-bit outstanding read limit field
+ */
+constexpr uint32_t CTRL_READ_OUTSTANDING_MSB = 23;
+
+/**
+ * @brief REREAD Bit Position
+ * Bit Position: [24]
+ * Description: 1 = two-pass re-read mode: PROCESS3 reads the input again and
+ *   recomputes the local max / exponents instead of popping the FIFOs.
+ *   Lengths above DATA_LENGTH_MAX (the FIFO capacity) always use it; this bit
+ *   forces it for shorter rows. Keep it set when writing 0 to clear START.
+ */
+constexpr uint32_t CTRL_REREAD_BIT = 24;
+
+/**
+ * @brief RING Enable Bit Position
+ * Bit Position: [25]
+ * Description: 1 = descriptor ring mode: jobs come from the descriptors
+ *   between REG_RING_HEAD and REG_RING_TAIL instead of START and the
+ *   Src/Dst/Length/Row registers (START is ignored). 0 = register mode;
+ *   clearing the bit resets REG_RING_HEAD once the current descriptor is done.
+ */
+constexpr uint32_t CTRL_RING_BIT   = 25;
+
 /**
  * @brief MODE Selection Bit Position
  * Bit Position: [31]
@@ -124,7 +291,7 @@ constexpr uint32_t CTRL_MODE_BIT   = 31;
 // [7:4]      error_code (4-bit error code)
 // [3]        error (1-bit error flag)
 // [2:1]      state (2-bit state: 0=IDLE, 1=PROCESS1, 2=PROCESS2, 3=PROCESS3)
-// [0]        done (1-bit done flag, pulses HIGH for one clock when PROCESS3 completes)
+// [0]        done (1-bit done flag, pulses HIGH for one clock when PROCESS3 completes the last row)
 
 /**
  * @brief DONE Flag Bit Position
@@ -175,6 +342,44 @@ constexpr uint32_t STAT_ERROR_CODE_LSB = 4;
 constexpr uint32_t STAT_ERROR_CODE_MSB = 7;
 
 
+// ===== Descriptor Format =====
+// One descriptor is RING_DESC_BYTES in memory, four little-endian 64-bit words:
+// word 0     source byte address
+// word 1     destination byte address
+// word 2     [31:0] length (FP16 elements), [63:32] flags in the REG_CONTROL
+//            layout: BURST_LEN [15:8], READ_OUTSTANDING [23:16], REREAD [24]
+// word 3     completion record, written by the engine (the processor posts 0):
+//            [7:0] REG_STATUS layout (DONE, ERROR, error_code; state = IDLE),
+//            [31] COMPLETE, [63:32] cycles from the job's START to DONE / ERROR
+
+/**
+ * @brief Descriptor Size
+ * Description: Bytes per descriptor (ring entries are this far apart)
+ */
+constexpr uint32_t RING_DESC_BYTES = 32;
+
+/**
+ * @brief Descriptor Completion Word
+ * Description: Index of the 64-bit completion record within a descriptor
+ */
+constexpr uint32_t RING_DESC_COMPLETION_WORD = 3;
+
+/**
+ * @brief COMPLETE Flag Bit Position (completion record)
+ * Bit Position: [31]
+ * Description: Set by the engine when it writes the completion record back,
+ *   with DONE (success) or ERROR and error_code in bits [7:0]
+ */
+constexpr uint32_t RING_CPL_COMPLETE_BIT = 31;
+
+/**
+ * @brief Cycle Count Field Lower Bit Position (completion record)
+ * Bit Position: [32]
+ * Description: Lower bit of the 32-bit job cycle count
+ */
+constexpr uint32_t RING_CPL_CYCLES_LSB = 32;
+
+
 // ===== Address Offset Mask =====
 // Used to extract register offset from full addresses
 
@@ -186,6 +391,13 @@ constexpr uint32_t STAT_ERROR_CODE_MSB = 7;
  */
 constexpr uint32_t ADDR_OFFSET_MASK = 0xFF;
 
+/**
+ * @brief Engine Window Shift (SOLE_Multi)
+ * Description: SOLE_Multi selects the engine from the address bits above
+ *   the register offset; engine e's registers are at e << ENGINE_WINDOW_SHIFT
+ */
+constexpr uint32_t ENGINE_WINDOW_SHIFT = 8;
+
 } // namespace mmio
 } // namespace sole
 
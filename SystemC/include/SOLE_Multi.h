@@ -0,0 +1,121 @@
+#ifndef SOLE_MULTI_H
+#define SOLE_MULTI_H
+
+#include <systemc.h>
+#include <iostream>
+#include <cstdint>
+#include "SOLE.h"
+#include "Axi_Arbiter.h"
+
+/**
+ * @class SOLE_Multi
+ * @brief N SOLE engines behind one MMIO window and one AXI4 master port
+ *
+ * **MMIO:**
+ * Engine e's complete register file (REG_CONTROL .. REG_IRQ_TIMEOUT_CYCLES,
+ * including its own descriptor ring) is at e << ENGINE_WINDOW_SHIFT; the
+ * register offset is Addr[7:0] as for a single SOLE. Writes reach only the
+ * addressed engine, reads return its register, and addresses past the last
+ * engine read as 0. interrupt is the OR of the engine interrupts.
+ *
+ * **AXI:**
+ * The engines' AXI4 masters share M_AXI through an Axi_Arbiter (round-robin
+ * AR / AW grants, remapped ARIDs, outstanding_limit bursts per engine). The
+ * memory accepts at most 2 * engine_count bursts per direction (issue limit),
+ * so an engine waits behind at most 2 * engine_count - 1 other bursts, which
+ * its AXI timeout allows for (SOLE::set_bus_share()).
+ */
+SC_MODULE(SOLE_Multi) {
+    // ===== System Ports =====
+    sc_in<bool>                 clk;
+    sc_in<bool>                 rst;
+
+    // ===== Processor MMIO Interface =====
+    sc_in<sc_dt::sc_uint<32>>   proc_addr;      ///< Addr[15:8] = engine, Addr[7:0] = reg offset
+    sc_in<sc_dt::sc_uint<32>>   proc_wdata;
+    sc_in<bool>                 proc_we;
+    sc_out<sc_dt::sc_uint<32>>  proc_rdata;
+    sc_out<bool>                interrupt;      ///< Any engine interrupt
+
+    // ===== AXI4 Master Ports =====
+    sc_out<sc_dt::sc_uint<AXI_ADDR_WIDTH>>  M_AXI_AWADDR;
+    sc_out<sc_dt::sc_uint<8>>               M_AXI_AWLEN;
+    sc_out<sc_dt::sc_uint<3>>               M_AXI_AWSIZE;
+    sc_out<sc_dt::sc_uint<2>>               M_AXI_AWBURST;
+    sc_out<bool>                            M_AXI_AWVALID;
+    sc_in<bool>                             M_AXI_AWREADY;
+    sc_out<axi_data_t>                      M_AXI_WDATA;
+    sc_out<sc_dt::sc_uint<AXI_STRB_WIDTH>>  M_AXI_WSTRB;
+    sc_out<bool>                            M_AXI_WLAST;
+    sc_out<bool>                            M_AXI_WVALID;
+    sc_in<bool>                             M_AXI_WREADY;
+    sc_in<sc_dt::sc_uint<2>>                M_AXI_BRESP;
+    sc_in<bool>                             M_AXI_BVALID;
+    sc_out<bool>                            M_AXI_BREADY;
+    sc_out<sc_dt::sc_uint<AXI_ID_WIDTH>>    M_AXI_ARID;
+    sc_out<sc_dt::sc_uint<AXI_ADDR_WIDTH>>  M_AXI_ARADDR;
+    sc_out<sc_dt::sc_uint<8>>               M_AXI_ARLEN;
+    sc_out<sc_dt::sc_uint<3>>               M_AXI_ARSIZE;
+    sc_out<sc_dt::sc_uint<2>>               M_AXI_ARBURST;
+    sc_out<bool>                            M_AXI_ARVALID;
+    sc_in<bool>                             M_AXI_ARREADY;
+    sc_in<sc_dt::sc_uint<AXI_ID_WIDTH>>     M_AXI_RID;
+    sc_in<axi_data_t>                       M_AXI_RDATA;
+    sc_in<sc_dt::sc_uint<2>>                M_AXI_RRESP;
+    sc_in<bool>                             M_AXI_RVALID;
+    sc_out<bool>                            M_AXI_RREADY;
+
+    const unsigned              engine_count;
+
+    // ===== Engines and Arbiter =====
+    sc_core::sc_vector<SOLE>             engines;
+    Axi_Arbiter                 *arbiter;
+
+    // Per-engine MMIO
+    sc_core::sc_vector<sc_signal<bool>>                  engine_we;
+    sc_core::sc_vector<sc_signal<sc_dt::sc_uint<32>>>    engine_rdata;
+    sc_core::sc_vector<sc_signal<bool>>                  engine_interrupt;
+
+    // Per-engine AXI4 master signals (engine <-> arbiter)
+    sc_core::sc_vector<sc_signal<sc_dt::sc_uint<AXI_ADDR_WIDTH>>>    awaddr;
+    sc_core::sc_vector<sc_signal<sc_dt::sc_uint<8>>>                 awlen;
+    sc_core::sc_vector<sc_signal<sc_dt::sc_uint<3>>>                 awsize;
+    sc_core::sc_vector<sc_signal<sc_dt::sc_uint<2>>>                 awburst;
+    sc_core::sc_vector<sc_signal<bool>>                              awvalid;
+    sc_core::sc_vector<sc_signal<bool>>                              awready;
+    sc_core::sc_vector<sc_signal<axi_data_t>>                        wdata;
+    sc_core::sc_vector<sc_signal<sc_dt::sc_uint<AXI_STRB_WIDTH>>>    wstrb;
+    sc_core::sc_vector<sc_signal<bool>>                              wlast;
+    sc_core::sc_vector<sc_signal<bool>>                              wvalid;
+    sc_core::sc_vector<sc_signal<bool>>                              wready;
+    sc_core::sc_vector<sc_signal<sc_dt::sc_uint<2>>>                 bresp;
+    sc_core::sc_vector<sc_signal<bool>>                              bvalid;
+    sc_core::sc_vector<sc_signal<bool>>                              bready;
+    sc_core::sc_vector<sc_signal<sc_dt::sc_uint<AXI_ID_WIDTH>>>      arid;
+    sc_core::sc_vector<sc_signal<sc_dt::sc_uint<AXI_ADDR_WIDTH>>>    araddr;
+    sc_core::sc_vector<sc_signal<sc_dt::sc_uint<8>>>                 arlen;
+    sc_core::sc_vector<sc_signal<sc_dt::sc_uint<3>>>                 arsize;
+    sc_core::sc_vector<sc_signal<sc_dt::sc_uint<2>>>                 arburst;
+    sc_core::sc_vector<sc_signal<bool>>                              arvalid;
+    sc_core::sc_vector<sc_signal<bool>>                              arready;
+    sc_core::sc_vector<sc_signal<sc_dt::sc_uint<AXI_ID_WIDTH>>>      rid;
+    sc_core::sc_vector<sc_signal<axi_data_t>>                        rdata;
+    sc_core::sc_vector<sc_signal<sc_dt::sc_uint<2>>>                 rresp;
+    sc_core::sc_vector<sc_signal<bool>>                              rvalid;
+    sc_core::sc_vector<sc_signal<bool>>                              rready;
+
+    // ===== Methods =====
+
+    /**
+     * @brief MMIO Decode (combinational)
+     * Engine select from Addr[15:8]: write enable to that engine, read data
+     * from it, and the OR of the engine interrupts
+     */
+    void mmio_decode_process();
+
+    SC_HAS_PROCESS(SOLE_Multi);
+    SOLE_Multi(sc_core::sc_module_name name, unsigned engines, unsigned outstanding_limit = 0);
+    ~SOLE_Multi();
+};
+
+#endif // SOLE_MULTI_H
@@ -0,0 +1,185 @@
+#ifndef SOLE_TLM_H
+#define SOLE_TLM_H
+
+#include <systemc.h>
+#include <tlm.h>
+#include <tlm_utils/simple_target_socket.h>
+#include <cstdint>
+#include "SOLE_MMIO.hpp"
+#include "Status.hpp"
+#include "Softmax.h"
+#include "Softmax_Datapath.h"
+
+using namespace sole::mmio;
+
+/**
+ * @class SOLE_TLM
+ * @brief Common part of the SOLE transaction-level models (SOLE_LT, SOLE_AT)
+ *
+ * **Functional Overview:**
+ * - mmio_socket: TLM target for the MMIO register file in SOLE_MMIO.hpp
+ *   (32-bit accesses, offset = address & ADDR_OFFSET_MASK, same read-back as SOLE)
+ * - interrupt: DONE || ERROR of the status register, or the coalesced interrupt
+ *   of REG_IRQ_COUNT_THRESHOLD / REG_IRQ_TIMEOUT_CYCLES, as in SOLE
+ * - REG_COMPLETED_JOBS: completion counter and acknowledge, as in SOLE
+ * - Row batching: REG_ROW_COUNT rows at REG_SRC/DST_ROW_STRIDE (0 = packed),
+ *   one run_softmax() per row, DONE once after the last row
+ * - Descriptor ring: CTRL_RING_BIT with REG_RING_BASE / SIZE / TAIL / HEAD and
+ *   the 32-byte descriptors of SOLE_MMIO.hpp, one row per descriptor
+ * - engine_thread(): START / MODE / Length handling of the IDLE state and the
+ *   ring; each row calls run_softmax(), implemented by the LT and AT models
+ * - datapath: Softmax_Datapath, bit-exact with the pin-level model
+ *
+ * Phase lengths shared by both models (cycles of clk_period):
+ * START_LATENCY_CYCLES from the CONTROL write to PROCESS1, P2_CYCLES for PROCESS2.
+ * Rows of a batch run back to back; the pin-level ping-pong overlap of one row's
+ * PROCESS3 with the next row's PROCESS1 is not modelled, so a batch of R rows
+ * takes (R - 1) * (b + 8) cycles longer than on the pin-level model (b = beats per row).
+ * A descriptor takes at least RING_FETCH_CYCLES to fetch, RING_START_CYCLES from
+ * the fetch to PROCESS1 and RING_WRITEBACK_CYCLES from DONE to the HEAD update
+ * (the zero-wait pin-level Descriptor_Ring); the first one starts
+ * START_LATENCY_CYCLES after the REG_RING_TAIL write.
+ */
+class SOLE_TLM : public sc_core::sc_module {
+public:
+    // ===== TLM Socket =====
+    tlm_utils::simple_target_socket<SOLE_TLM> mmio_socket;  ///< Processor MMIO target
+
+    // ===== Interrupt =====
+    sc_out<bool>                interrupt;      ///< Interrupt to CPU on DONE / ERROR, or coalesced (REG_IRQ_COUNT_THRESHOLD)
+
+    static constexpr unsigned START_LATENCY_CYCLES = 3;    ///< CONTROL write -> PROCESS1
+    static constexpr unsigned P2_CYCLES            = 1;    ///< PROCESS2 (until PROCESS_2 Output_Valid)
+    static constexpr unsigned RING_FETCH_CYCLES    = 5;    ///< Descriptor AR + 4 R beats
+    static constexpr unsigned RING_START_CYCLES    = 1;    ///< Descriptor fetched -> PROCESS1
+    static constexpr unsigned RING_WRITEBACK_CYCLES = 3;   ///< DONE -> completion record written, HEAD + 1
+
+    SC_HAS_PROCESS(SOLE_TLM);
+    SOLE_TLM(sc_core::sc_module_name name, sc_core::sc_time clk_period)
+        : sc_core::sc_module(name),
+        mmio_socket("mmio_socket"), interrupt("interrupt"),
+        clk_period(clk_period),
+        reg_control(0), reg_status(0), reg_src_addr_base_l(0), reg_src_addr_base_h(0),
+        reg_dst_addr_base_l(0), reg_dst_addr_base_h(0), reg_length_l(0), reg_length_h(0),
+        reg_row_count(0), reg_src_row_stride(0), reg_dst_row_stride(0),
+        reg_ring_base_l(0), reg_ring_base_h(0), reg_ring_size(0), reg_ring_tail(0), ring_head(0),
+        reg_completed_jobs(0), reg_completed_ack(0), reg_irq_count_threshold(0), reg_irq_timeout_cycles(0),
+        ring_job(false), ring_job_status(0), last_error(false), completions_in_flight(0)
+    {
+        mmio_socket.register_b_transport(this, &SOLE_TLM::mmio_b_transport);
+        mmio_socket.register_transport_dbg(this, &SOLE_TLM::mmio_transport_dbg);
+
+        SC_THREAD(engine_thread);
+
+        SC_METHOD(completion_method);
+        sensitive << completion_event;
+        dont_initialize();
+
+        SC_METHOD(interrupt_method);
+        sensitive << irq_written << irq_timeout;
+        dont_initialize();
+    }
+
+    /// Current value of the status register (for testbench monitoring)
+    uint32_t status() const { return reg_status; }
+
+protected:
+    sc_core::sc_time clk_period;
+    Softmax_Datapath datapath;
+
+    uint64_t src_addr_base() const { return ((uint64_t)reg_src_addr_base_h << 32) | reg_src_addr_base_l; }
+    uint64_t dst_addr_base() const { return ((uint64_t)reg_dst_addr_base_h << 32) | reg_dst_addr_base_l; }
+
+    /**
+     * @brief One SoftMax row of 'length' elements from src_addr to dst_addr
+     * Must walk the status through PROCESS1/2/3 and return at the end of
+     * PROCESS3; the caller raises DONE after the last row.
+     */
+    virtual void run_softmax(uint64_t src_addr, uint64_t dst_addr, uint64_t length) = 0;
+
+    /**
+     * @brief Descriptor fetch or completion record write of 'words' 64-bit words
+     * Returns when the access has completed (annotated delay or protocol time included).
+     * @return true if the memory answered without an error response
+     */
+    virtual bool ring_access(tlm::tlm_command cmd, uint64_t addr, uint64_t* data, size_t words) = 0;
+
+    /// Update reg_status and the interrupt output
+    void set_status(softmax::status::State_t state, bool done, uint8_t error_code);
+
+    /**
+     * @brief Hold 'state' for 'cycles' cycles plus 'extra'
+     * A non-zero error_code is flagged in the status register during the last cycle.
+     */
+    void run_phase(softmax::status::State_t state, unsigned cycles, const sc_core::sc_time& extra, uint8_t error_code);
+
+    /// DONE for one cycle, then IDLE
+    void done_pulse();
+
+private:
+    // ===== MMIO Registers =====
+    uint32_t reg_control;
+    uint32_t reg_status;
+    uint32_t reg_src_addr_base_l;
+    uint32_t reg_src_addr_base_h;
+    uint32_t reg_dst_addr_base_l;
+    uint32_t reg_dst_addr_base_h;
+    uint32_t reg_length_l;
+    uint32_t reg_length_h;
+    uint32_t reg_row_count;             ///< Rows per START (0 and 1 = one row)
+    uint32_t reg_src_row_stride;        ///< Source row stride in bytes (0 = packed)
+    uint32_t reg_dst_row_stride;        ///< Destination row stride in bytes (0 = packed)
+    uint32_t reg_ring_base_l;           ///< Descriptor ring base address
+    uint32_t reg_ring_base_h;
+    uint32_t reg_ring_size;             ///< Descriptors in the ring (0 = ring idle)
+    uint32_t reg_ring_tail;             ///< Producer index (doorbell)
+    uint32_t ring_head;                 ///< Consumer index (REG_RING_HEAD)
+    uint32_t reg_completed_jobs;        ///< Jobs completed (0x44, read)
+    uint32_t reg_completed_ack;         ///< Last acknowledged count (0x44, write)
+    uint32_t reg_irq_count_threshold;   ///< Coalesced interrupt count threshold (0 = off)
+    uint32_t reg_irq_timeout_cycles;    ///< Coalesced interrupt timeout in cycles (0 = none)
+    sc_core::sc_event mmio_written;     ///< Notified on every MMIO write
+
+    // ===== Descriptor Ring Job =====
+    bool     ring_job;                  ///< A descriptor is running: DONE / ERROR count at its write-back
+    uint32_t ring_job_status;           ///< First DONE / ERROR status bits of the descriptor ([7:0])
+
+    // ===== Completion Counter / Interrupt Coalescing =====
+    bool              last_error;             ///< ERROR bit of the previous set_status (rising edge = completion)
+    unsigned          completions_in_flight;  ///< Completions to count at completion_event
+    sc_core::sc_time  pending_since;          ///< When the unacknowledged count last left 0
+    sc_core::sc_event completion_event;       ///< One cycle after DONE / ERROR rising (SOLE counts on the next edge)
+    sc_core::sc_event irq_written;            ///< Acknowledge or coalescing register written
+    sc_core::sc_event irq_timeout;            ///< REG_IRQ_TIMEOUT_CYCLES reached
+
+    /// MMIO register read/write (4-byte accesses)
+    void mmio_b_transport(tlm::tlm_generic_payload& trans, sc_core::sc_time& delay);
+    unsigned int mmio_transport_dbg(tlm::tlm_generic_payload& trans);
+    bool mmio_access(tlm::tlm_generic_payload& trans);
+
+    /// START/length handling of the IDLE state and the descriptor ring
+    void engine_thread();
+
+    /// REG_ROW_COUNT rows of 'length' elements, then DONE
+    void run_rows(uint64_t length);
+
+    /// Fetch, run and complete the descriptor at ring_head
+    void run_descriptor();
+
+    /// Count one completion on the next cycle (SOLE::completion_counter_process)
+    void count_completion();
+
+    /// Wait until 'end' (no-op if it has passed)
+    void wait_until(const sc_core::sc_time& end);
+
+    /// Count the completions of completion_event into REG_COMPLETED_JOBS
+    void completion_method();
+
+    /// Re-evaluate the interrupt after an acknowledge, a register write or the timeout
+    void interrupt_method();
+
+    /// Drive interrupt: DONE || ERROR, or the coalesced level
+    void update_interrupt();
+};
+
+#endif // SOLE_TLM_H
@@ -3,6 +3,8 @@
 
 #include <systemc.h>
 #include <vector>
+#include "DataTypes.hpp"
+#include "Profile.hpp"
 
 template<int ADDR_BITS, int DATA_BITS>
 class SRAM : public sc_module {
@@ -15,10 +17,10 @@ public:
     sc_in<bool> rst;
     sc_in<bool> we;                                    // Write enable
     sc_in<bool> re;                                    // Read enable
-    sc_in<sc_dt::sc_uint<ADDR_BITS>> waddr;           // Write address
-    sc_in<sc_dt::sc_uint<ADDR_BITS>> raddr;           // Read address
-    sc_in<sc_dt::sc_uint<DATA_BITS>> wdata;           // Write data
-    sc_out<sc_dt::sc_uint<DATA_BITS>> rdata;          // Read data
+    sc_in<sole_uint<ADDR_BITS>> waddr;           // Write address
+    sc_in<sole_uint<ADDR_BITS>> raddr;           // Read address
+    sc_in<sole_uint<DATA_BITS>> wdata;           // Write data
+    sc_out<sole_uint<DATA_BITS>> rdata;          // Read data
     
     // Constructor
     SC_HAS_PROCESS(SRAM);
@@ -37,20 +39,21 @@ public:
     ~SRAM() {}
 
     // Debug accessor: peek at memory contents (safe read)
-    sc_dt::sc_uint<DATA_BITS> debug_peek(int idx) const {
+    sole_uint<DATA_BITS> debug_peek(int idx) const {
         if (idx >= 0 && idx < BYTE_SIZE) return mem[idx];
         return 0;
     }
     
 private:
     // Memory storage
-    std::vector<sc_dt::sc_uint<DATA_BITS>> mem;
+    std::vector<sole_uint<DATA_BITS>> mem;
     
     // Output register for 1-cycle pipeline
-    sc_dt::sc_uint<DATA_BITS> rdata_reg;
+    sole_uint<DATA_BITS> rdata_reg;
     
     // FSM process
     void memory_process() {
+        SOLE_PROFILE_PROCESS();
         if (rst.read()) {
             reset_memory();
             rdata.write(0);
@@ -5,10 +5,14 @@
 #define DATA_LENGTH_MAX 4096  // Max number of FP16 inputs per Softmax run
 #endif
 
+#ifndef AXI_TIMEOUT_THRESHOLD
 #define AXI_TIMEOUT_THRESHOLD 100  // Number of cycles to wait before declaring a timeout
+#endif
 
 #include <systemc.h>
 #include <iostream>
+#include <algorithm>
+#include <cstdint>
 #include "PROCESS_1.h"
 #include "PROCESS_2.h"
 #include "PROCESS_3.h"
@@ -16,21 +20,75 @@
 #include "Output_FIFO.h"
 #include "axi4-lite.hpp"
 #include "Status.hpp"
-
-using sc_uint2 = sc_dt::sc_uint<2>;
-using sc_uint4 = sc_dt::sc_uint<4>;
-using sc_uint16 = sc_dt::sc_uint<16>;
-using sc_uint32 = sc_dt::sc_uint<32>;
-using sc_uint64 = sc_dt::sc_uint<64>;
-using sc_uint3 = sc_dt::sc_uint<3>;
-using sc_uint8 = sc_dt::sc_uint<8>;
+#include "Trace.hpp"
+#include "Profile.hpp"
+#include "DataTypes.hpp"
+
+using sc_uint2 = sole_uint<2>;
+using sc_uint4 = sole_uint<4>;
+using sc_uint16 = sole_uint<16>;
+using sc_uint32 = sole_uint<32>;
+using sc_uint64 = sole_uint<64>;
+using sc_uint3 = sole_uint<3>;
+using sc_uint8 = sole_uint<8>;
 
 // Use AXI4-Lite parameters from axi4-lite.hpp
 using namespace hybridacc::axi4lite;
 using namespace softmax::status;
 constexpr unsigned AXI_ADDR_WIDTH = AXI4L_DEFAULT_ADDR_WIDTH;   // 32
-constexpr unsigned AXI_DATA_WIDTH = AXI4L_DEFAULT_DATA_WIDTH;   // 64
-constexpr unsigned AXI_STRB_WIDTH = AXI4L_DEFAULT_STRB_WIDTH;   // 8
+constexpr unsigned AXI_DATA_WIDTH = SOLE_BEAT_WIDTH;            // 64 / 128 / 256: one FP16 per lane
+constexpr unsigned AXI_STRB_WIDTH = AXI_DATA_WIDTH / 8;         // 8 / 16 / 32
+constexpr unsigned AXI_BEAT_BYTES = AXI_DATA_WIDTH / 8;         // Address step of one beat
+
+using axi_data_t = sole_beat_t;                                 // RDATA / WDATA (sc_uint<64> for 4 lanes)
+
+// AXI4 INCR bursts (AxSIZE = AXI_BEAT_BYTES); AxLEN = beats - 1
+constexpr unsigned AXI_BURST_MAX_BEATS = 256;       // AxLEN is 8 bits
+constexpr uint64_t AXI_BURST_BOUNDARY  = 4096;      // A burst must not cross a 4 KB boundary
+constexpr unsigned AXI_SIZE_BEAT       = SOLE_LANE_LOG2 + 1;  // AxSIZE: 2^3 / 2^4 / 2^5 bytes per beat
+constexpr unsigned AXI_BURST_INCR      = 1;         // AxBURST: INCR
+
+// AXI read IDs: every outstanding AR has its own ARID, so the slave may return
+// the bursts in any order; the reorder buffer hands the beats to PROCESS_1 in order
+constexpr unsigned AXI_ID_WIDTH             = 6;
+constexpr uint32_t AXI_READ_MAX_OUTSTANDING = 1u << AXI_ID_WIDTH;  // 64 read transactions in flight
+// Reorder buffer sized for AXI_READ_ROB_BURSTS outstanding bursts of AXI_READ_ROB_BURST_BEATS
+// beats (a power of two, RTL sole_pkg::READ_ROB_DEPTH); bursts are capped at its depth
+constexpr uint32_t AXI_READ_ROB_BURSTS      = 16;
+constexpr uint32_t AXI_READ_ROB_BURST_BEATS = 16;
+constexpr uint32_t AXI_READ_ROB_DEPTH       = AXI_READ_ROB_BURSTS * AXI_READ_ROB_BURST_BEATS;
+static_assert((AXI_READ_ROB_DEPTH & (AXI_READ_ROB_DEPTH - 1)) == 0, "reorder buffer depth must be a power of two");
+// AXI writes: the beats of every accepted AW burst wait in a FIFO until its B pops
+// them; AW is held while the FIFO is full
+constexpr uint32_t AXI_WRITE_MAX_OUTSTANDING = 16;
+
+// Two-pass re-read mode (lengths above DATA_LENGTH_MAX, or REG_CONTROL[24]): PROCESS1
+// only accumulates the global max and sum, and PROCESS3 reads the input a second time,
+// recomputing the local max and exponents of each beat in PROCESS_1. The FIFOs then
+// only hold the beats between that second read pass and PROCESS3, so the length is
+// bounded by the 32.16 Sum_Buffer instead of the FIFO depth.
+constexpr uint64_t DATA_LENGTH_REREAD_MAX = 0xFFFFFFFFull;
+// Beats the second read pass may request ahead of PROCESS3 (fits both FIFOs and the reorder buffer)
+constexpr uint32_t AXI_REREAD_WINDOW_BEATS = std::min({AXI_READ_ROB_DEPTH, (1u << MAX_FIFO_ADDR_BITS) - 4,
+                                                       (1u << OUTPUT_FIFO_ADDR_BITS) - 4});
+
+// Ping-pong FIFO banks: in a batched job PROCESS1 fills one bank with row N+1 while
+// PROCESS3 drains the other one with row N (FIFO mode only; re-read rows use bank 0)
+constexpr unsigned SOFTMAX_FIFO_BANKS = 2;
+
+/**
+ * @brief Beats of the burst starting at byte address 'addr'
+ * At most 'max_beats', at most 'remaining' and never past the next 4 KB boundary.
+ * The engine splits a transfer into bursts with this function on every channel,
+ * so AW, W (WLAST) and B agree on where each burst ends.
+ */
+inline uint32_t axi_burst_beats(uint64_t addr, uint64_t remaining, uint32_t max_beats) {
+    uint64_t to_boundary = (AXI_BURST_BOUNDARY - (addr & (AXI_BURST_BOUNDARY - 1))) / AXI_BEAT_BYTES;
+    uint64_t beats = max_beats;
+    if (remaining < beats) beats = remaining;
+    if (to_boundary < beats) beats = to_boundary;
+    return beats > 0 ? (uint32_t)beats : 1;
+}
 
 SC_MODULE(Softmax) {
     // ===== System Ports =====
@@ -46,34 +104,49 @@ SC_MODULE(Softmax) {
     sc_in<sc_uint64>         src_addr_base;        ///< Source base address (read from memory)
     sc_in<sc_uint64>         dst_addr_base;        ///< Destination base address (write to memory)
     sc_in<sc_uint64>         data_length;          ///< Number of FP16 elements to process
+    sc_in<sc_uint8>          burst_len;            ///< Max AXI burst length - 1 (REG_CONTROL[15:8], 0 = single beat)
+    sc_in<sc_uint8>          read_outstanding;     ///< Max AR transactions in flight (REG_CONTROL[23:16], 0 = AXI_READ_MAX_OUTSTANDING)
+    sc_in<bool>              reread;               ///< Force the two-pass re-read mode (REG_CONTROL[24])
+    sc_in<sc_uint32>         row_count;            ///< Rows per START (REG_ROW_COUNT, 0 = 1)
+    sc_in<sc_uint32>         src_row_stride;       ///< Source row stride in bytes (REG_SRC_ROW_STRIDE, 0 = packed)
+    sc_in<sc_uint32>         dst_row_stride;       ///< Destination row stride in bytes (REG_DST_ROW_STRIDE, 0 = packed)
     
     // ===== Status Output to SOLE MMIO =====
     sc_out<sc_uint32>        status_o;               ///< Status register (state, error, error_code) 
     
-    // ===== AXI4-Lite Master Ports (Write Address Channel) =====
+    // ===== AXI4 Master Ports (Write Address Channel) =====
     sc_out<sc_dt::sc_uint<AXI_ADDR_WIDTH>>  M_AXI_AWADDR;   ///< Write address
+    sc_out<sc_dt::sc_uint<8>>               M_AXI_AWLEN;    ///< Write burst length - 1
+    sc_out<sc_dt::sc_uint<3>>               M_AXI_AWSIZE;   ///< Write beat size (AXI_SIZE_BEAT)
+    sc_out<sc_dt::sc_uint<2>>               M_AXI_AWBURST;  ///< Write burst type (AXI_BURST_INCR)
     sc_out<bool>                            M_AXI_AWVALID;  ///< Write address valid
     sc_in<bool>                             M_AXI_AWREADY;  ///< Write address ready
     
-    // ===== AXI4-Lite Master Ports (Write Data Channel) =====
-    sc_out<sc_dt::sc_uint<AXI_DATA_WIDTH>> M_AXI_WDATA;     ///< Write data (64-bit)
-    sc_out<sc_dt::sc_uint<AXI_STRB_WIDTH>> M_AXI_WSTRB;     ///< Write strobes (8-bit, byte enables)
+    // ===== AXI4 Master Ports (Write Data Channel) =====
+    sc_out<axi_data_t>                      M_AXI_WDATA;     ///< Write data (AXI_DATA_WIDTH, 64-bit for 4 lanes)
+    sc_out<sc_dt::sc_uint<AXI_STRB_WIDTH>> M_AXI_WSTRB;     ///< Write strobes (byte enables, 8-bit for 4 lanes)
+    sc_out<bool>                           M_AXI_WLAST;     ///< Last beat of the write burst
     sc_out<bool>                           M_AXI_WVALID;    ///< Write data valid
     sc_in<bool>                            M_AXI_WREADY;    ///< Write data ready
     
-    // ===== AXI4-Lite Master Ports (Write Response Channel) =====
-    sc_in<sc_uint2>                        M_AXI_BRESP;     ///< Write response (2-bit)
+    // ===== AXI4 Master Ports (Write Response Channel) =====
+    sc_in<sc_dt::sc_uint<2>>                 M_AXI_BRESP;     ///< Write response (2-bit)
     sc_in<bool>                            M_AXI_BVALID;    ///< Write response valid
     sc_out<bool>                           M_AXI_BREADY;    ///< Write response ready
     
-    // ===== AXI4-Lite Master Ports (Read Address Channel) =====
+    // ===== AXI4 Master Ports (Read Address Channel) =====
+    sc_out<sc_dt::sc_uint<AXI_ID_WIDTH>>    M_AXI_ARID;     ///< Read transaction ID
     sc_out<sc_dt::sc_uint<AXI_ADDR_WIDTH>>  M_AXI_ARADDR;   ///< Read address
+    sc_out<sc_dt::sc_uint<8>>               M_AXI_ARLEN;    ///< Read burst length - 1
+    sc_out<sc_dt::sc_uint<3>>               M_AXI_ARSIZE;   ///< Read beat size (AXI_SIZE_BEAT)
+    sc_out<sc_dt::sc_uint<2>>               M_AXI_ARBURST;  ///< Read burst type (AXI_BURST_INCR)
     sc_out<bool>                            M_AXI_ARVALID;  ///< Read address valid
     sc_in<bool>                             M_AXI_ARREADY;  ///< Read address ready
     
-    // ===== AXI4-Lite Master Ports (Read Data Channel) =====
-    sc_in<sc_dt::sc_uint<AXI_DATA_WIDTH>>  M_AXI_RDATA;     ///< Read data (64-bit)
-    sc_in<sc_uint2>                        M_AXI_RRESP;     ///< Read response (2-bit)
+    // ===== AXI4 Master Ports (Read Data Channel) =====
+    sc_in<sc_dt::sc_uint<AXI_ID_WIDTH>>    M_AXI_RID;       ///< Read data ID (ARID of the burst)
+    sc_in<axi_data_t>                       M_AXI_RDATA;     ///< Read data (AXI_DATA_WIDTH, 64-bit for 4 lanes)
+    sc_in<sc_dt::sc_uint<2>>                 M_AXI_RRESP;     ///< Read response (2-bit)
     sc_in<bool>                            M_AXI_RVALID;    ///< Read data valid
     sc_out<bool>                           M_AXI_RREADY;    ///< Read data ready        
 
@@ -81,11 +154,30 @@ SC_MODULE(Softmax) {
     PROCESS_1_Module   *Process_1_unit; 
     PROCESS_2_Module   *Process_2_unit; 
     PROCESS_3_Module   *Process_3_unit; 
-    Max_FIFO           *Max_FIFO_unit;
-    Output_FIFO        *Output_FIFO_unit; 
+    Max_FIFO           *Max_FIFO_unit[SOFTMAX_FIFO_BANKS];
+    Output_FIFO        *Output_FIFO_unit[SOFTMAX_FIFO_BANKS];
 
     /** State Machine - Controls which process is active */
-    sc_signal<sc_uint2>     state;                      ///< '0':idle   '1':Process1 running  '2':Process2 running  '3':Process3 running
+    sc_signal<sc_uint2>     state;                      ///< PROCESS1/2 front end: '0':idle '1':Process1 '2':Process2 '3':row waits for PROCESS3
+    sc_signal<bool>         reread_mode;                ///< This job re-reads the input in PROCESS3 (latched at START)
+
+    /** Batched rows: the state machine runs row_count rows per START */
+    sc_signal<sc_uint32>    row_index_sig;              ///< Row in the front end (0 at START)
+    sc_signal<sc_uint64>    row_src_addr;               ///< Source address of the front end row
+    sc_signal<sc_uint64>    row_dst_addr;               ///< Destination address of the front end row
+    sc_signal<bool>         fifo_bank;                  ///< FIFO bank PROCESS1 writes
+    sc_signal<bool>         row_start_flag;             ///< The front end starts a row on this edge (START or next row)
+    sc_signal<bool>         row_next_flag;              ///< PROCESS3 finished a row and another row follows
+    sc_signal<bool>         handoff_flag;               ///< The row PROCESS2 finished moves to PROCESS3 on this edge
+
+    /** PROCESS3 back end: drains one bank while the front end reads the next row */
+    sc_signal<bool>         p3_active;                  ///< PROCESS3 is writing row p3_row_sig
+    sc_signal<bool>         p3_bank;                    ///< FIFO bank PROCESS3 reads
+    sc_signal<sc_uint32>    p3_row_sig;                 ///< Row in PROCESS3
+    sc_signal<sc_uint64>    p3_dst_addr;                ///< Destination address of that row
+    sc_signal<sc_uint16>    p3_global_max;              ///< Global max of that row (latched at hand-off)
+    sc_signal<sole_ks_t>    p3_ks;                      ///< PROCESS2 leading one position of that row (latched at hand-off)
+    sc_signal<sc_uint16>    p3_mux_result;              ///< PROCESS2 mux result of that row (latched at hand-off)
     
     /** Enable signals for each process module */
     sc_signal<bool>         process_1_enable;           ///< Enable PROCESS_1 (read from memory + compute)
@@ -94,6 +186,7 @@ SC_MODULE(Softmax) {
 
     /** Finish flags for each process */
     sc_signal<bool>         process1_finish_flag;       ///< Flag to indicate PROCESS_1 has finished processing all data (used for state transition)
+    sc_signal<bool>         process2_finish_flag;       ///< Flag to indicate PROCESS_2 has finished (used for state transition)
     sc_signal<bool>         process3_finish_flag;       ///< Flag to indicate PROCESS_3 has finished processing all data (used for state transition)
 
     /** Data counter and address generation */
@@ -107,10 +200,11 @@ SC_MODULE(Softmax) {
     sc_signal<sc_uint16>    Global_Max_Buffer_Out;      ///< Read output (combinational, all states)
     sc_signal<sc_uint16>    Global_Max_Buffer_In;       ///< Update input (write-only, state=1)
 
-    sc_signal<sc_uint32>    Sum_Buffer_Out;             ///< Read output (combinational, all states)
-    sc_signal<sc_uint32>    Sum_Buffer_In;              ///< Update input (write-only, state=1)
+    sc_signal<sole_sum_t>   Sum_Buffer_Out;             ///< Read output (combinational, all states)
+    sc_signal<sole_sum_t>   Sum_Buffer_In;              ///< Update input (write-only, state=1)
+    sc_signal<sc_uint32>    sum_update_count_sig;       ///< Beats accumulated into Sum_Buffer in this job
     
-    /** FIFO Control Signals */
+    /** FIFO Control Signals (write side and counts: bank fifo_bank, read side: bank p3_bank) */
     sc_signal<bool>         max_fifo_write_en;          ///< Max FIFO write enable
     sc_signal<bool>         max_fifo_read_en;           ///< Max FIFO read enable (1 when state=3)
     sc_signal<bool>         max_fifo_read_data_valid;   ///< Max FIFO read data valid
@@ -127,31 +221,58 @@ SC_MODULE(Softmax) {
     sc_signal<bool>         output_fifo_empty;          ///< Output FIFO empty flag
     sc_signal<output_fifo_addr_t>    output_fifo_count;          ///< Number of elements currently in Output_FIFO
 
+    /** Per-bank FIFO ports (routed by fifo_bank_select) */
+    sc_signal<bool>         bank_fifo_rst[SOFTMAX_FIFO_BANKS];
+    sc_signal<bool>         bank_max_fifo_write_en[SOFTMAX_FIFO_BANKS];
+    sc_signal<bool>         bank_max_fifo_read_en[SOFTMAX_FIFO_BANKS];
+    sc_signal<bool>         bank_max_fifo_read_data_valid[SOFTMAX_FIFO_BANKS];
+    sc_signal<bool>         bank_max_fifo_full[SOFTMAX_FIFO_BANKS];
+    sc_signal<bool>         bank_max_fifo_empty[SOFTMAX_FIFO_BANKS];
+    sc_signal<max_fifo_addr_t> bank_max_fifo_count[SOFTMAX_FIFO_BANKS];
+    sc_signal<sc_uint16>    bank_local_max[SOFTMAX_FIFO_BANKS];
+    sc_signal<bool>         bank_output_fifo_write_en[SOFTMAX_FIFO_BANKS];
+    sc_signal<bool>         bank_output_fifo_read_en[SOFTMAX_FIFO_BANKS];
+    sc_signal<bool>         bank_output_fifo_read_data_valid[SOFTMAX_FIFO_BANKS];
+    sc_signal<bool>         bank_output_fifo_full[SOFTMAX_FIFO_BANKS];
+    sc_signal<bool>         bank_output_fifo_empty[SOFTMAX_FIFO_BANKS];
+    sc_signal<output_fifo_addr_t> bank_output_fifo_count[SOFTMAX_FIFO_BANKS];
+    sc_signal<sole_power_vector_t> bank_output_buffer[SOFTMAX_FIFO_BANKS];
+
     /** Data signal routing between Modules  */
     sc_signal<sc_uint16>    Global_Max_In_Signal;
-    sc_signal<sc_uint16>    Power_of_Two_Vector_Signal;
-    sc_signal<sc_uint4>     Leading_One_Pos_Out_Signal;
+    sc_signal<sole_power_vector_t> Power_of_Two_Vector_Signal;
+    sc_signal<sole_ks_t>    Leading_One_Pos_Out_Signal;
     sc_signal<sc_uint16>    Mux_Result_Out_Signal;
 
     sc_signal<sc_uint16>    Local_Max_Signal;
     sc_signal<sc_uint16>    Global_Max_Signal;
-    sc_signal<sc_uint16>    Output_Buffer_In_Signal;
+    sc_signal<sole_power_vector_t> Output_Buffer_In_Signal;
 
     /**Control signal */
     sc_signal<bool>         stall_process2_output_Signal;
+    sc_signal<bool>         process2_input_valid_Signal;    ///< Sum_Buffer is final (front end past PROCESS1)
+    sc_signal<bool>         process2_output_valid_Signal;   ///< PROCESS_2 output registers hold this row's ks / mux result
     
     /** PROCESS1 Data Validity Flags (from pipeline stages) */
-    sc_signal<bool>         process1_read_data_valid;       ///< Read data valid from AXI (input to PROCESS1)
+    sc_signal<bool>         process1_read_data_valid;       ///< Next in-order beat valid (input to PROCESS1)
+    sc_signal<axi_data_t>   process1_read_data;   ///< Next in-order beat: reorder buffer head or RDATA (input to PROCESS1)
     sc_signal<bool>         process1_stage1_valid;              ///< Stage1 data valid flag (output from PROCESS1)
     sc_signal<bool>         process1_stage5_valid;              ///< Stage5 data valid flag (output from PROCESS1)
 
     sc_signal<sc_uint32>    read_addr_sent_num_sig;         ///< Number of read addresses sent (for error checking)
     sc_signal<sc_uint32>    read_data_received_count_sig;   ///< Number of read data responses received from AXI
+    sc_signal<sc_uint32>    read_data_delivered_count_sig;  ///< Number of beats handed to PROCESS1 in order
+    sc_signal<sc_dt::sc_uint<AXI_ID_WIDTH>> read_head_id_sig;   ///< ARID of the burst holding the next in-order beat
+    sc_signal<bool>         read_head_issued_sig;           ///< That burst has been requested
+    sc_signal<bool>         rob_head_valid_sig;             ///< The next in-order beat is already in the reorder buffer
+    sc_signal<axi_data_t>   rob_head_data_sig;    ///< Reorder buffer word of the next in-order beat
+    sc_signal<sc_uint32>    reread_pending_sig;             ///< Re-read: beats popped from Max_FIFO but not yet from Output_FIFO
     
     /** PROCESS3 Data Validity Flag and Write Control */
     sc_signal<bool>         process3_read_data_valid;       ///< Read data valid from Max FIFO
     sc_signal<bool>         process3_stage1_valid;          ///< Stage1 data valid flag (output from PROCESS3)
     sc_signal<bool>         process3_stage2_valid;              ///< Stage3 data valid flag (output from PROCESS3, for AXI write control)
+    sc_signal<bool>         process3_stage3_valid;              ///< Stage3 data valid flag (beat entering stage4 on the next advance)
     sc_signal<bool>         process3_stage4_valid;              ///< Stage4 data valid flag (aligned with M_AXI_WDATA)
     sc_signal<bool>         process3_stall;          ///< Stall signal for PROCESS_3 (when write handshake fails)
     
@@ -165,16 +286,56 @@ SC_MODULE(Softmax) {
     sc_signal<bool>         done_pulse_prev;                ///< Previous cycle's done_pulse value (for edge detection)
     
     sc_signal<bool>         rst_modules;                      ///< Reset signal for internal modules (active when rst=1 or has_error=1)
+    sc_signal<bool>         rst_process3;                     ///< PROCESS_3 reset (rst_modules, or PROCESS3 moves to the next row)
+
+    /** Per-instance process state (registers held across clock edges by the SC_METHODs) */
+    sc_uint16               global_max_reg = 0;             ///< Buffer_Update: running FP16 global max
+    sole_sum_t              sum_buffer_reg = 0;             ///< Buffer_Update: running exponent sum (32.16)
+    sc_uint32               sum_update_num = 0;             ///< Buffer_Update: beats accumulated into Sum_Buffer in this job
+    sc_uint32               read_addr_sent_num = 0;         ///< axi_read_address_process: beats requested by AR handshakes in this job
+    sc_uint32               read_data_received_num = 0;     ///< axi_read_address_process: R handshakes in this job
+    sc_uint32               read_data_delivered_num = 0;    ///< axi_read_address_process: beats handed to PROCESS1 in this job
+    sc_uint32               read_txn_issued = 0;            ///< axi_read_address_process: AR handshakes in this job (next ARID = issued % 64)
+    sc_uint32               read_txn_retired = 0;           ///< axi_read_address_process: bursts fully handed to PROCESS1
+    /// Read tracker entry of one ARID: first beat index, beats and beats received so far
+    struct Read_Txn {
+        uint32_t start;
+        uint32_t beats;
+        uint32_t received;
+    };
+    Read_Txn                read_txn[AXI_READ_MAX_OUTSTANDING] = {};   ///< axi_read_address_process: read tracker, indexed by ARID
+    axi_data_t              rob_data[AXI_READ_ROB_DEPTH];         ///< axi_read_address_process: reorder buffer, indexed by beat % depth
+    bool                    rob_valid[AXI_READ_ROB_DEPTH] = {};        ///< axi_read_address_process: reorder buffer entry holds an early beat
+    sc_uint32               reread_max_popped_num = 0;      ///< axi_read_address_process: re-read beats PROCESS3 took from Max_FIFO
+    sc_uint32               reread_output_popped_num = 0;   ///< axi_read_address_process: re-read beats PROCESS3 took from Output_FIFO
+    sc_uint32               write_addr_sent_num = 0;        ///< axi_write_request_process: beats requested by AW handshakes in this job
+    sc_uint32               write_data_sent_num = 0;        ///< axi_write_request_process: W handshakes in this job
+    sc_uint32               write_response_received_num = 0;///< axi_write_request_process: beats acknowledged by B handshakes in this job
+    sc_uint32               write_burst_end = 0;            ///< axi_write_request_process: beat index after the current W burst
+    uint16_t                write_burst_beats[AXI_WRITE_MAX_OUTSTANDING] = {}; ///< axi_write_request_process: beats of the AW bursts awaiting a B (FIFO)
+    unsigned                write_burst_head = 0;           ///< axi_write_request_process: oldest write_burst_beats entry
+    unsigned                write_burst_count = 0;          ///< axi_write_request_process: AW bursts awaiting a B
+    sc_uint32               read_timeout_counter = 0;       ///< error_detection_process: cycles without read progress
+    sc_uint32               write_timeout_counter = 0;      ///< error_detection_process: cycles without write progress
+    bool                    read_timeout_counting = false;  ///< error_detection_process: read_timeout_counter advanced at the last edge
+    bool                    write_timeout_counting = false; ///< error_detection_process: write_timeout_counter advanced at the last edge
+    unsigned                bus_bursts_ahead = 0;           ///< Other masters' bursts that may run between two handshakes (set_bus_share())
 
     // ===== Constructor =====
     SC_HAS_PROCESS(Softmax);
     Softmax(sc_core::sc_module_name name) : sc_core::sc_module(name) ,        clk("clk"), rst("rst"), start("start"),
-        src_addr_base("src_addr_base"), dst_addr_base("dst_addr_base"), data_length("data_length"), status_o("status_o"),
-        M_AXI_AWADDR("M_AXI_AWADDR"), M_AXI_AWVALID("M_AXI_AWVALID"), M_AXI_AWREADY("M_AXI_AWREADY"),
-        M_AXI_WDATA("M_AXI_WDATA"), M_AXI_WSTRB("M_AXI_WSTRB"), M_AXI_WVALID("M_AXI_WVALID"), M_AXI_WREADY("M_AXI_WREADY"),
+        src_addr_base("src_addr_base"), dst_addr_base("dst_addr_base"), data_length("data_length"), burst_len("burst_len"),
+        read_outstanding("read_outstanding"), reread("reread"),
+        row_count("row_count"), src_row_stride("src_row_stride"), dst_row_stride("dst_row_stride"),
+        status_o("status_o"),
+        M_AXI_AWADDR("M_AXI_AWADDR"), M_AXI_AWLEN("M_AXI_AWLEN"), M_AXI_AWSIZE("M_AXI_AWSIZE"), M_AXI_AWBURST("M_AXI_AWBURST"),
+        M_AXI_AWVALID("M_AXI_AWVALID"), M_AXI_AWREADY("M_AXI_AWREADY"),
+        M_AXI_WDATA("M_AXI_WDATA"), M_AXI_WSTRB("M_AXI_WSTRB"), M_AXI_WLAST("M_AXI_WLAST"), M_AXI_WVALID("M_AXI_WVALID"),
+        M_AXI_WREADY("M_AXI_WREADY"),
         M_AXI_BRESP("M_AXI_BRESP"), M_AXI_BVALID("M_AXI_BVALID"), M_AXI_BREADY("M_AXI_BREADY"),
-        M_AXI_ARADDR("M_AXI_ARADDR"), M_AXI_ARVALID("M_AXI_ARVALID"), M_AXI_ARREADY("M_AXI_ARREADY"),
-        M_AXI_RDATA("M_AXI_RDATA"), M_AXI_RRESP("M_AXI_RRESP"), M_AXI_RVALID("M_AXI_RVALID"), M_AXI_RREADY("M_AXI_RREADY")
+        M_AXI_ARID("M_AXI_ARID"), M_AXI_ARADDR("M_AXI_ARADDR"), M_AXI_ARLEN("M_AXI_ARLEN"), M_AXI_ARSIZE("M_AXI_ARSIZE"), M_AXI_ARBURST("M_AXI_ARBURST"),
+        M_AXI_ARVALID("M_AXI_ARVALID"), M_AXI_ARREADY("M_AXI_ARREADY"),
+        M_AXI_RID("M_AXI_RID"), M_AXI_RDATA("M_AXI_RDATA"), M_AXI_RRESP("M_AXI_RRESP"), M_AXI_RVALID("M_AXI_RVALID"), M_AXI_RREADY("M_AXI_RREADY")
     
     {
         std::cout << "Constructing Softmax Module: " << name << std::endl;
@@ -183,7 +344,7 @@ SC_MODULE(Softmax) {
         Process_1_unit = new PROCESS_1_Module("Process_1_unit");
         Process_1_unit->clk(clk);
         Process_1_unit->rst(rst_modules);  // Use combined reset signal for modules
-        Process_1_unit->DataIn_64bits(M_AXI_RDATA);
+        Process_1_unit->DataIn_64bits(process1_read_data);             // In-order beat from the reorder buffer / RDATA
         Process_1_unit->enable(process_1_enable);
         Process_1_unit->data_valid(process1_read_data_valid);           // Connect data validity from AXI
         Process_1_unit->Global_Max(Global_Max_Buffer_Out);              // FIXED: Read from output, not input
@@ -201,52 +362,57 @@ SC_MODULE(Softmax) {
         Process_2_unit->enable(process_2_enable);                       // Add enable signal
         Process_2_unit->stall_output(stall_process2_output_Signal);
         Process_2_unit->Pre_Compute_In(Sum_Buffer_Out);
+        Process_2_unit->Pre_Compute_Valid(process2_input_valid_Signal);
         Process_2_unit->Leading_One_Pos_Out(Leading_One_Pos_Out_Signal);
         Process_2_unit->Mux_Result_Out(Mux_Result_Out_Signal);
+        Process_2_unit->Output_Valid(process2_output_valid_Signal);
 
         // ===== Construct PROCESS_3_Module=====
         Process_3_unit = new PROCESS_3_Module("Process_3_unit");
         Process_3_unit->clk(clk);
-        Process_3_unit->rst(rst_modules);
+        Process_3_unit->rst(rst_process3);
         Process_3_unit->enable(process_3_enable);
         Process_3_unit->stall(process3_stall);
         Process_3_unit->input_data_valid(process3_read_data_valid);      // Input: include max_fifo valid and stall->run recovery pulse
         Process_3_unit->Local_Max(Local_Max_Signal);
-        Process_3_unit->Global_Max(Global_Max_Buffer_Out);
-        Process_3_unit->ks_In(Leading_One_Pos_Out_Signal);
-        Process_3_unit->Mux_Result_In(Mux_Result_Out_Signal);
+        Process_3_unit->Global_Max(p3_global_max);                     // Row in PROCESS3, latched at hand-off
+        Process_3_unit->ks_In(p3_ks);
+        Process_3_unit->Mux_Result_In(p3_mux_result);
         Process_3_unit->Output_Buffer_In(Output_Buffer_In_Signal);
         Process_3_unit->Output_Vector(M_AXI_WDATA);
         Process_3_unit->stage2_valid(process3_stage2_valid);             // Output: stage2 valid flag for output FIFO read control
+        Process_3_unit->stage3_valid(process3_stage3_valid);                 // Output: stage3 valid flag (beat moving into stage4)
         Process_3_unit->stage4_valid(process3_stage4_valid);                 // Output: stage4 valid flag aligned with M_AXI_WDATA
 
-        // ===== Construct Max_FIFO=====
-        Max_FIFO_unit = new Max_FIFO("Max_FIFO_unit");
-        Max_FIFO_unit->clk(clk);
-        Max_FIFO_unit->rst(rst_modules);
-        Max_FIFO_unit->data_in(Global_Max_Buffer_In);                   // FIXED: Connect to Max_FIFO for accumulation
-        Max_FIFO_unit->write_en(max_fifo_write_en);                     // Write to FIFO when stage1 data is valid (new max value available)
-        Max_FIFO_unit->read_ready(max_fifo_read_en);
-        Max_FIFO_unit->read_valid(max_fifo_read_data_valid);
-        Max_FIFO_unit->clear(max_fifo_clear);
-        Max_FIFO_unit->data_out(Local_Max_Signal);
-        Max_FIFO_unit->full(max_fifo_full);
-        Max_FIFO_unit->empty(max_fifo_empty);
-        Max_FIFO_unit->count(max_fifo_count);
-
-        // ===== Construct Output_FIFO=====
-        Output_FIFO_unit = new Output_FIFO("Output_FIFO_unit");
-        Output_FIFO_unit->clk(clk);
-        Output_FIFO_unit->rst(rst_modules);
-        Output_FIFO_unit->data_in(Power_of_Two_Vector_Signal);
-        Output_FIFO_unit->write_en(output_fifo_write_en);
-        Output_FIFO_unit->read_ready(output_fifo_read_en);
-        Output_FIFO_unit->read_valid(output_fifo_read_data_valid);
-        Output_FIFO_unit->clear(output_fifo_clear);
-        Output_FIFO_unit->data_out(Output_Buffer_In_Signal);
-        Output_FIFO_unit->full(output_fifo_full);
-        Output_FIFO_unit->empty(output_fifo_empty);
-        Output_FIFO_unit->count(output_fifo_count);
+        for (unsigned b = 0; b < SOFTMAX_FIFO_BANKS; b++) {
+            // ===== Construct Max_FIFO (one per bank) =====
+            Max_FIFO_unit[b] = new Max_FIFO(("Max_FIFO_unit_" + std::to_string(b)).c_str());
+            Max_FIFO_unit[b]->clk(clk);
+            Max_FIFO_unit[b]->rst(bank_fifo_rst[b]);
+            Max_FIFO_unit[b]->data_in(Global_Max_Buffer_In);                // FIXED: Connect to Max_FIFO for accumulation
+            Max_FIFO_unit[b]->write_en(bank_max_fifo_write_en[b]);          // Write to FIFO when stage1 data is valid (new max value available)
+            Max_FIFO_unit[b]->read_ready(bank_max_fifo_read_en[b]);
+            Max_FIFO_unit[b]->read_valid(bank_max_fifo_read_data_valid[b]);
+            Max_FIFO_unit[b]->clear(max_fifo_clear);
+            Max_FIFO_unit[b]->data_out(bank_local_max[b]);
+            Max_FIFO_unit[b]->full(bank_max_fifo_full[b]);
+            Max_FIFO_unit[b]->empty(bank_max_fifo_empty[b]);
+            Max_FIFO_unit[b]->count(bank_max_fifo_count[b]);
+
+            // ===== Construct Output_FIFO (one per bank) =====
+            Output_FIFO_unit[b] = new Output_FIFO(("Output_FIFO_unit_" + std::to_string(b)).c_str());
+            Output_FIFO_unit[b]->clk(clk);
+            Output_FIFO_unit[b]->rst(bank_fifo_rst[b]);
+            Output_FIFO_unit[b]->data_in(Power_of_Two_Vector_Signal);
+            Output_FIFO_unit[b]->write_en(bank_output_fifo_write_en[b]);
+            Output_FIFO_unit[b]->read_ready(bank_output_fifo_read_en[b]);
+            Output_FIFO_unit[b]->read_valid(bank_output_fifo_read_data_valid[b]);
+            Output_FIFO_unit[b]->clear(output_fifo_clear);
+            Output_FIFO_unit[b]->data_out(bank_output_buffer[b]);
+            Output_FIFO_unit[b]->full(bank_output_fifo_full[b]);
+            Output_FIFO_unit[b]->empty(bank_output_fifo_empty[b]);
+            Output_FIFO_unit[b]->count(bank_output_fifo_count[b]);
+        }
 
         // Buffer update 
         SC_METHOD(Buffer_Update);
@@ -262,7 +428,7 @@ SC_MODULE(Softmax) {
             
         // ===== Status Update Process (combinational) =====
         SC_METHOD(status_update_process);
-        sensitive << state << error_code_sig << has_error << done_pulse;
+        sensitive << state << p3_active << error_code_sig << has_error << done_pulse;
         
         // ===== PROCESS_2 Output Stall Control (combinational) =====
         SC_METHOD(manage_process2_stall);
@@ -270,8 +436,20 @@ SC_MODULE(Softmax) {
         
         // ===== manage_fifo_control (thread - clocked) =====
         SC_METHOD(manage_fifo_control);
-        sensitive << rst << has_error << state << process1_stage1_valid << process1_stage5_valid
-                  << process3_stall << process3_stage2_valid;
+        sensitive << rst << has_error << state << p3_active << reread_mode << process1_stage1_valid << process1_stage5_valid
+                  << process3_stall << process3_stage2_valid << max_fifo_read_data_valid << output_fifo_count
+                  << reread_pending_sig;
+
+        // ===== Ping-pong FIFO bank routing (combinational) =====
+        SC_METHOD(fifo_bank_select);
+        sensitive << fifo_bank << p3_bank << max_fifo_write_en << max_fifo_read_en
+                  << output_fifo_write_en << output_fifo_read_en;
+        for (unsigned b = 0; b < SOFTMAX_FIFO_BANKS; b++) {
+            sensitive << bank_max_fifo_read_data_valid[b] << bank_max_fifo_full[b] << bank_max_fifo_empty[b]
+                      << bank_max_fifo_count[b] << bank_local_max[b]
+                      << bank_output_fifo_read_data_valid[b] << bank_output_fifo_full[b]
+                      << bank_output_fifo_empty[b] << bank_output_fifo_count[b] << bank_output_buffer[b];
+        }
 
         // ===== State machine process (thread - clocked) =====
         SC_METHOD(execute_state_transition);
@@ -279,10 +457,14 @@ SC_MODULE(Softmax) {
 
         // ===== Connect process1 data valid(combinational) =====
         SC_METHOD(validity_signal_update);
-        sensitive << M_AXI_RVALID << M_AXI_RREADY << max_fifo_read_en;
-
-        SC_METHOD(dubug_print);
-        sensitive << clk.pos();  // Delay the process3_read_data_valid signal by one cycle
+        sensitive << M_AXI_ARVALID << M_AXI_ARREADY << M_AXI_RVALID << M_AXI_RREADY << M_AXI_RID << M_AXI_RDATA << max_fifo_read_en
+                  << read_head_id_sig << read_head_issued_sig << rob_head_valid_sig << rob_head_data_sig;
+
+        // Per-cycle FIFO control trace: only registered when compiled in (see Trace.hpp)
+        if (SOLE_TRACE_ON(CAT_FIFO, LVL_VERBOSE)) {
+            SC_METHOD(dubug_print);
+            sensitive << clk.pos();
+        }
         
         // ===== Done Pulse Handler =====
         // Automatically resets done_pulse after one clock cycle
@@ -293,15 +475,16 @@ SC_MODULE(Softmax) {
         sensitive << clk.pos();
 
         SC_METHOD(state_transition_flag);
-        sensitive << data_length << max_fifo_count << output_fifo_count << read_data_received_count_sig
+        sensitive << data_length << max_fifo_count << output_fifo_count << read_data_delivered_count_sig
                   << write_addr_sent_num_sig << write_data_sent_num_sig << write_response_received_num_sig
-                  << state;
+                  << state << reread_mode << sum_update_count_sig << row_index_sig << row_count
+                  << process2_output_valid_Signal << p3_active << p3_row_sig << start;
 
         SC_METHOD(update_rst_modules);
-        sensitive << rst << has_error;
+        sensitive << rst << has_error << process3_finish_flag << p3_bank;
 
         SC_METHOD(stall_process3_control);
-        sensitive << rst << state << process3_stage4_valid << M_AXI_WREADY;
+        sensitive << rst << p3_active << process3_stage4_valid << M_AXI_WVALID << M_AXI_WREADY;
 
     }
     
@@ -316,9 +499,17 @@ SC_MODULE(Softmax) {
      */
     void manage_fifo_control();
     
+    /**
+     * @brief Ping-pong FIFO bank routing
+     * Write enables and counts go to bank fifo_bank (PROCESS1), read enables and
+     * read data to bank p3_bank (PROCESS3)
+     */
+    void fifo_bank_select();
+
     /**
      * @brief State Transition & Process Control
-     * Executes state machine transitions (IDLE → PROCESS1 → PROCESS2 → PROCESS3 → IDLE)
+     * Executes the front end (IDLE → PROCESS1 → PROCESS2 → hand-off) and the
+     * PROCESS3 back end; in a batched job the next row's PROCESS1 overlaps PROCESS3
      * Manages enable signals (process_1_enable, process_2_enable, process_3_enable)
      * Delegates data counter management to data_counter_update()
      * Detects errors (data_length=0, invalid state)
@@ -336,6 +527,7 @@ SC_MODULE(Softmax) {
      * Controls stall_process2_output_Signal based on current state:
      * - When state == STATE_PROCESS2: stall_process2_output_Signal = 0 (allow output)
      * - Otherwise: stall_process2_output_Signal = 1 (stall output)
+     * process2_input_valid_Signal = 1 in states 2 and 3, where Sum_Buffer holds the final row sum.
      */
     void manage_process2_stall();
     
@@ -347,8 +539,9 @@ SC_MODULE(Softmax) {
     
     /**
      * @brief AXI Read Address Generation Process
-     * Generates AXI read address requests during PROCESS1 state
-     * Connects current_src_addr to M_AXI_ARADDR
+     * Generates AXI read address requests during PROCESS1 state (and again in
+     * PROCESS3 in re-read mode), tracks the outstanding bursts by ARID and keeps
+     * the reorder buffer for PROCESS1
      */
     void axi_read_address_process();
     
@@ -358,6 +551,11 @@ SC_MODULE(Softmax) {
      */
     void axi_write_request_process();
 
+    /**
+     * @brief PROCESS1 / PROCESS3 input valid (combinational)
+     * PROCESS1 gets the next in-order read beat: the reorder buffer head if it
+     * is there, else the R beat on the bus when it is that beat (bypass)
+     */
     void validity_signal_update();
 
     void dubug_print();
@@ -370,13 +568,44 @@ SC_MODULE(Softmax) {
     void done_pulse_handler();
 
     void error_detection_process();
+
+    /**
+     * @brief Bursts of other masters that can be served between two of this engine's handshakes
+     * On a shared port (Axi_Arbiter with an issue limit) the engine may wait
+     * behind that many bursts of at most BURST_LEN + 1 beats, so the read /
+     * write timeout becomes AXI_TIMEOUT_THRESHOLD + bursts * (BURST_LEN + 1)
+     * cycles. Default 0 (a port of its own). Set before the simulation starts.
+     */
+    void set_bus_share(unsigned bursts) { bus_bursts_ahead = bursts; }
+
+    /**
+     * @brief Clock edges that may be skipped while no signal changes (stopped clock)
+     * Only the AXI timeout counters move on such edges; the limit keeps them
+     * below the timeout so the error is still raised at its own edge.
+     */
+    uint64_t idle_cycle_limit() const;
+
+    /**
+     * @brief Account for 'cycles' skipped edges (at most idle_cycle_limit())
+     * Call between two edges after an edge that changed no signal.
+     */
+    void skip_cycles(uint64_t cycles);
     
     void state_transition_flag();
 
     void stall_process3_control();
 
     void update_rst_modules() {
-        rst_modules.write(rst.read() || has_error.read());
+        SOLE_PROFILE_PROCESS();
+        bool rst_all = rst.read() || has_error.read();
+        rst_modules.write(rst_all);
+        // PROCESS_3 and its bank are flushed when PROCESS3 finishes a row: the PROCESS_3 pipeline
+        // still holds the tail beats popped after the last output beat of the row, which would
+        // otherwise go out first on the next row of a batch or the next START without reset
+        rst_process3.write(rst_all || process3_finish_flag.read());
+        for (unsigned b = 0; b < SOFTMAX_FIFO_BANKS; b++) {
+            bank_fifo_rst[b].write(rst_all || (process3_finish_flag.read() && p3_bank.read() == (b != 0)));
+        }
     };
 };
 #endif // Softmax_H
\ No newline at end of file
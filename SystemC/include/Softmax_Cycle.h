@@ -0,0 +1,331 @@
+#ifndef SOFTMAX_CYCLE_H
+#define SOFTMAX_CYCLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+/**
+ * @file Softmax_Cycle.h
+ * @brief Cycle-accurate C++ model of the Softmax engine (no SystemC kernel)
+ *
+ * Softmax_Cycle is a register-level translation of the Softmax SC_MODULE and its
+ * sub-modules (PROCESS_1/2/3, MaxUnit, Reduction, Max_FIFO / Output_FIFO with
+ * their SRAM and skid buffer). One clock edge is two calls:
+ * - eval():   settle the combinational logic of the current cycle (all
+ *             SC_METHODs on signals, using the inputs as set now), then compute
+ *             the next value of every clocked register (all SC_METHODs on clk.pos())
+ * - commit(): latch the registers and drive the AXI master pins
+ *
+ * The AXI4 master pins live in Softmax_Cycle::Axi_Pins (AxSIZE / AxBURST are
+ * the constant AXI_SIZE_BEAT / AXI_BURST_INCR and are left out). Axi_Slave_Cycle is
+ * the same two-phase translation of the SOLE_test AxiSlaveMemory (wait states,
+ * address queues, WREADY pulse model); the words behind it come from a
+ * Softmax_Cycle_Memory, so any memory model can be plugged in. One cycle is
+ *
+ *     dut.eval(); slave.eval(dut.axi, dut.rst); slave.commit(dut.axi); dut.commit();
+ *
+ * (see Softmax_Cycle::step()). Datapath functions (fp16_max, log2exp_fp16,
+ * divider_fp16, ...) are the ones the SystemC modules use, so AXI traffic,
+ * including every pin value while a VALID is high, matches Softmax edge for edge.
+ */
+
+/**
+ * @class Softmax_Cycle_Memory
+ * @brief Word storage behind Axi_Slave_Cycle
+ *
+ * Addresses are AXI byte addresses of 64-bit words. The return value is the
+ * AXI response (0 = OKAY, 2 = SLVERR, ...) put on RRESP / BRESP.
+ */
+class Softmax_Cycle_Memory {
+public:
+    virtual ~Softmax_Cycle_Memory() {}
+    virtual uint8_t read(uint32_t addr, uint64_t& data) = 0;
+    virtual uint8_t write(uint32_t addr, uint64_t data, uint8_t strb) = 0;
+};
+
+class Softmax_Cycle {
+public:
+    /// AXI_READ_MAX_OUTSTANDING / AXI_READ_ROB_DEPTH of Softmax.h (this header needs no SystemC)
+    static constexpr uint32_t READ_MAX_OUTSTANDING = 64;
+    static constexpr uint32_t READ_ROB_DEPTH = 256;
+    /// AXI_WRITE_MAX_OUTSTANDING of Softmax.h
+    static constexpr uint32_t WRITE_MAX_OUTSTANDING = 16;
+
+    /// AXI4 pins between the engine (master) and the memory side (slave)
+    struct Axi_Pins {
+        // Master outputs
+        uint32_t awaddr  = 0;
+        uint8_t  awlen   = 0;
+        bool     awvalid = false;
+        uint64_t wdata   = 0;
+        uint8_t  wstrb   = 0;
+        bool     wlast   = false;
+        bool     wvalid  = false;
+        bool     bready  = false;
+        uint8_t  arid    = 0;
+        uint32_t araddr  = 0;
+        uint8_t  arlen   = 0;
+        bool     arvalid = false;
+        bool     rready  = false;
+        // Slave outputs
+        bool     awready = false;
+        bool     wready  = false;
+        uint8_t  bresp   = 0;
+        bool     bvalid  = false;
+        bool     arready = false;
+        uint8_t  rid     = 0;
+        uint64_t rdata   = 0;
+        uint8_t  rresp   = 0;
+        bool     rvalid  = false;
+    };
+
+    // ===== Inputs (SOLE MMIO side), sampled by eval() =====
+    bool     rst = false;
+    bool     start = false;
+    uint64_t src_addr_base = 0;
+    uint64_t dst_addr_base = 0;
+    uint64_t data_length = 0;
+    uint8_t  burst_len = 0;             ///< Max AXI burst length - 1
+    uint8_t  read_outstanding = 0;      ///< Max outstanding read bursts (0 = READ_MAX_OUTSTANDING)
+
+    Axi_Pins axi;
+
+    Softmax_Cycle();
+
+    /// Settle the current cycle and compute the next register values
+    void eval();
+
+    /// Latch the registers (the clock edge)
+    void commit();
+
+    /// One clock edge with 'slave' on the AXI pins
+    template<class Slave>
+    void step(Slave& slave) {
+        eval();
+        slave.eval(axi, rst);
+        slave.commit(axi);
+        commit();
+    }
+
+    /// Status register (status_o): done, state, error flag, error code
+    uint32_t status() const;
+    uint8_t  state() const { return cur.state; }
+    bool     done() const { return cur.done_pulse; }
+    bool     error() const { return cur.has_error; }
+    uint8_t  error_code() const { return cur.error_code; }
+
+private:
+    // ===== Pipeline stage registers (see PROCESS_1.h / PROCESS_3.h) =====
+    struct P1_Stage1 { uint16_t DataIn[4]; bool data_valid; };
+    struct P1_Stage2 { uint16_t DataIn[4]; uint16_t Max_Out; bool data_valid; };
+    struct P1_Stage3 { uint16_t diff[5]; bool data_valid; };
+    struct P1_Stage4 { uint8_t power[5]; bool data_valid; };
+    struct P1_Stage5 { uint16_t Power_of_Two_Vector; uint8_t Right_Shift_Num; bool data_valid; };
+    struct P3_Stage1 { uint16_t Sub_Result; bool data_valid; };
+    struct P3_Stage2 { uint8_t Power; bool data_valid; };
+    struct P3_Stage3 { uint16_t Mux_Result; uint8_t ks; uint8_t ky[4]; bool data_valid; };
+    struct P3_Stage4 { uint64_t Output; bool data_valid; };
+
+    /// Max_FIFO / Output_FIFO registers (the SRAM arrays are max_fifo_mem / out_fifo_mem)
+    struct Fifo {
+        uint32_t write_addr;
+        uint32_t read_addr;
+        uint32_t count;
+        uint16_t skid_reg;
+        bool     skid_valid;
+        bool     sram_output_data_valid;
+        uint16_t sram_rdata;            ///< SRAM rdata port
+        uint16_t sram_rdata_reg;        ///< SRAM internal read register (not reset)
+    };
+
+    /// Every clocked register of Softmax and its sub-modules
+    struct Regs {
+        // Softmax
+        uint8_t  state;
+        bool     process_1_enable, process_2_enable, process_3_enable;
+        uint16_t Global_Max_Buffer_Out;
+        uint32_t Sum_Buffer_Out;
+        uint16_t global_max_reg;
+        uint32_t sum_buffer_reg;
+        uint32_t read_addr_sent_num, read_data_received_num, read_data_delivered_num;
+        uint32_t read_addr_sent_num_sig, read_data_received_count_sig, read_data_delivered_count_sig;
+        uint32_t read_txn_issued, read_txn_retired;
+        uint8_t  read_head_id;
+        bool     read_head_issued, rob_head_valid;
+        uint64_t rob_head_data;
+        uint32_t write_addr_sent_num, write_data_sent_num, write_response_received_num;
+        uint32_t write_addr_sent_num_sig, write_data_sent_num_sig, write_response_received_num_sig;
+        uint32_t write_burst_end;
+        uint8_t  write_burst_head, write_burst_count;
+        uint8_t  arid;
+        uint32_t araddr;
+        uint8_t  arlen;
+        bool     arvalid, rready;
+        uint32_t awaddr;
+        uint8_t  awlen;
+        bool     awvalid;
+        uint8_t  wstrb;
+        bool     wlast, wvalid, bready;
+        bool     done_pulse, done_pulse_prev;
+        bool     has_error;
+        uint8_t  error_code;
+        uint32_t read_timeout_counter, write_timeout_counter;
+        // PROCESS_1 + MaxUnit + Reduction
+        P1_Stage1 p1_s1;
+        P1_Stage2 p1_s2;
+        P1_Stage3 p1_s3;
+        P1_Stage4 p1_s4;
+        P1_Stage5 p1_s5;
+        uint16_t  max_R1, max_R2;
+        uint32_t  pipe_add0, pipe_add1;
+        // PROCESS_2 output latch (updated while settling, see settle())
+        uint8_t   p2_lo_pos;
+        uint16_t  p2_mux_result;
+        bool      p2_output_valid;
+        // PROCESS_3
+        P3_Stage1 p3_s1;
+        P3_Stage2 p3_s2;
+        P3_Stage3 p3_s3;
+        P3_Stage4 p3_s4;
+        // FIFOs
+        Fifo      max_fifo, out_fifo;
+    };
+
+    /// Combinational signals of the current cycle
+    struct Wires {
+        bool     rst_modules;
+        bool     p1_read_data_valid;
+        uint64_t p1_read_data;              ///< Reorder buffer head or bypassed RDATA
+        uint16_t Max_Out;                   ///< MaxUnit output = Local_Max_Output = Global_Max_Buffer_In
+        uint32_t Sum_Buffer_Update;
+        bool     p1_finish, p3_finish;
+        bool     p3_stall;
+        bool     max_fifo_write_en, max_fifo_read_en;
+        bool     out_fifo_write_en, out_fifo_read_en;
+        bool     fifo_clear;
+        bool     max_we, max_re, out_we, out_re;
+        bool     max_full, out_full;
+        bool     max_read_valid, out_read_valid;
+        uint16_t max_data_out, out_data_out;
+    };
+
+    void settle();
+    void settle_fifo(const Fifo& f, uint32_t mask, bool write_en, bool read_ready, bool& we, bool& re,
+                     bool& full, bool& read_valid, uint16_t& data_out) const;
+    void eval_fifo(const Fifo& f, Fifo& n, uint32_t mask, std::vector<uint16_t>& mem, bool& mem_clear,
+                   bool we, bool re, bool read_ready, bool read_valid, uint16_t data_in);
+    void commit_pins();
+
+    /// Outstanding read bursts by ARID (start beat, beats, beats received)
+    struct Read_Txn {
+        uint32_t start;
+        uint32_t beats;
+        uint32_t received;
+    };
+
+    Regs  cur;
+    Regs  nxt;
+    Wires w;
+    // Read tracker and reorder buffer: only read and written by eval(), updated in place
+    Read_Txn read_txn[READ_MAX_OUTSTANDING] = {};
+    uint64_t rob_data[READ_ROB_DEPTH] = {};
+    bool     rob_valid[READ_ROB_DEPTH] = {};
+    // Beats of the AW bursts awaiting a B (FIFO from write_burst_head), updated in place
+    uint16_t write_burst_beats[WRITE_MAX_OUTSTANDING] = {};
+    std::vector<uint16_t> max_fifo_mem;
+    std::vector<uint16_t> out_fifo_mem;
+    bool  max_fifo_mem_clear = true;
+    bool  out_fifo_mem_clear = true;
+};
+
+/**
+ * @class Axi_Slave_Cycle
+ * @brief Two-phase copy of the SOLE_test AxiSlaveMemory
+ *
+ * AWREADY stays high, WREADY pulses once every wready_delay + 1 cycles after the
+ * first WVALID and stays high through a burst until WLAST, every W burst gets a
+ * B response from the cycle after WLAST, ARREADY comes arready_delay cycles after
+ * ARVALID and each queued read burst starts its response rvalid_delay cycles
+ * after the last beat of the previous one was accepted. R beats and B responses
+ * stay on the bus until VALID && READY. set_read_model() adds
+ * the read latency and out-of-order responses (RID = ARID) of AxiSlaveMemory.
+ */
+class Axi_Slave_Cycle {
+public:
+    explicit Axi_Slave_Cycle(Softmax_Cycle_Memory& memory) : mem(memory) {}
+
+    /// New wait states; takes effect with the next transaction (apply during reset)
+    void set_wait_states(int arready, int rvalid, int wready) {
+        arready_delay = arready;
+        rvalid_delay = rvalid;
+        wready_delay = wready;
+    }
+
+    /// Pipelined read latency and reorder window - 1 (see AxiSlaveMemory); apply during reset
+    void set_read_model(int latency, int reorder) {
+        read_latency = latency;
+        read_reorder = reorder;
+    }
+
+    /// Next slave outputs from the pins of the current cycle
+    void eval(const Softmax_Cycle::Axi_Pins& pins, bool rst);
+
+    /// Drive the slave outputs
+    void commit(Softmax_Cycle::Axi_Pins& pins) const;
+
+private:
+    Softmax_Cycle_Memory& mem;
+    int arready_delay = 0;
+    int rvalid_delay = 0;
+    int wready_delay = 0;
+    int read_latency = 0;
+    int read_reorder = 0;
+
+    // Next outputs
+    bool     awready = false;
+    bool     wready = false;
+    uint8_t  bresp = 0;
+    bool     bvalid = false;
+    bool     arready = false;
+    uint8_t  rid = 0;
+    uint64_t rdata = 0;
+    uint8_t  rresp = 0;
+    bool     rvalid = false;
+
+    /// Accepted AW / AR: start address and AxLEN (reads: ARID and the first cycle it may start)
+    struct Burst {
+        uint32_t addr;
+        uint8_t  len;
+        uint8_t  id;
+        uint64_t ready;
+        unsigned passed;                ///< Times a younger burst was answered first
+    };
+
+    size_t next_read_burst() const;
+
+    // Write channel state
+    std::deque<Burst> write_addr_queue;
+    uint32_t last_write_addr = 0;
+    bool     has_last_write_addr = false;
+    bool     write_in_burst = false;
+    uint8_t  write_burst_resp = 0;
+    std::deque<uint8_t> write_resp_queue;   ///< BRESP of finished bursts; front is on the bus
+    bool     wready_pulse_enable = false;
+    int      wready_pulse_cnt = -1;
+
+    // Read channel state
+    bool     has_addr = false;
+    uint32_t read_addr = 0;             ///< Address of the beat in progress
+    unsigned read_beats_left = 0;       ///< Beats of the current burst after read_addr
+    uint8_t  read_id = 0;               ///< RID of the current burst
+    uint64_t read_cycle = 0;            ///< Cycles since reset (read latency reference)
+    uint64_t addr_data = 0;             ///< Word of the response in progress
+    uint8_t  addr_resp = 0;
+    int      arready_delay_cnt = -1;
+    int      read_resp_start_delay_cnt = -1;
+    std::deque<Burst> read_addr_queue;
+};
+
+#endif // SOFTMAX_CYCLE_H
@@ -0,0 +1,64 @@
+#ifndef SOFTMAX_DATAPATH_H
+#define SOFTMAX_DATAPATH_H
+
+#include <systemc.h>
+#include <cstdint>
+#include <vector>
+#include "utils.hpp"
+#include "Log2Exp.h"
+#include "Divider.h"
+#include "Divider_PreCompute.h"
+#include "DataTypes.hpp"
+
+using sc_uint4 = sole_uint<4>;
+using sc_uint16 = sole_uint<16>;
+using sc_uint32 = sole_uint<32>;
+using sc_uint64 = sole_uint<64>;
+
+/**
+ * @class Softmax_Datapath
+ * @brief Untimed, bit-exact copy of the Softmax PROCESS_1/2/3 datapath
+ *
+ * Reuses the same fp16 and Log2Exp/Divider functions as the pin-level
+ * modules, one 64-bit beat (4 x fp16 lanes) at a time:
+ * - process1_beat(): local max, global max update, Log2Exp powers,
+ *   Sum_Buffer update; keeps local max and packed powers like Max_FIFO / Output_FIFO
+ * - process2(): leading-one position and divider threshold of Sum_Buffer
+ * - process3_beat(): final 4 x fp16 outputs for one stored beat
+ *
+ * Global_Max_Buffer and Sum_Buffer follow Softmax::Buffer_Update and are only
+ * cleared by reset(), not between jobs.
+ */
+class Softmax_Datapath {
+public:
+    Softmax_Datapath() { reset(); }
+
+    /// Equivalent of rst: clear Global_Max_Buffer, Sum_Buffer and the FIFOs
+    void reset();
+
+    /// Start a new row: clear Global_Max_Buffer / Sum_Buffer, empty the local max / power FIFOs
+    void begin_job();
+
+    /// PROCESS_1 for one 64-bit input beat
+    void process1_beat(uint64_t data_in);
+
+    /// PROCESS_2 on the accumulated Sum_Buffer
+    void process2();
+
+    /// PROCESS_3 for stored beat 'beat' (0-based), returns 4 packed fp16 outputs
+    uint64_t process3_beat(size_t beat) const;
+
+    size_t beats() const { return local_max_fifo.size(); }
+    uint16_t global_max() const { return global_max_reg.to_uint(); }
+    uint32_t sum_buffer() const { return sum_buffer_reg.to_uint(); }
+
+private:
+    sc_uint16 global_max_reg;               ///< Global_Max_Buffer
+    sole_sum_t sum_buffer_reg;              ///< Sum_Buffer (32.16)
+    sole_ks_t ks;                           ///< PROCESS_2 Leading_One_Pos
+    sc_uint16 mux_result;                   ///< PROCESS_2 Mux_Result
+    std::vector<uint16_t> local_max_fifo;   ///< Max_FIFO contents (one entry per beat)
+    std::vector<uint16_t> power_fifo;       ///< Output_FIFO contents (packed 4 x 4-bit powers)
+};
+
+#endif // SOFTMAX_DATAPATH_H
@@ -0,0 +1,396 @@
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+#include <cstdint>
+
+/**
+ * @file Trace.hpp
+ * @brief Compile-time filtered binary trace for the SOLE SystemC model
+ *
+ * Hot-path debug output (AXI handshakes, FIFO dumps, pipeline dumps, state
+ * summaries) is recorded as fixed-size binary records instead of formatted
+ * text. Records are pushed into a lock-free single-producer/single-consumer
+ * ring buffer on the simulation thread and drained to a file by a background
+ * writer thread. The file is decoded offline with tools/trace_decode.
+ *
+ * **Build-time configuration:**
+ * - SOLE_TRACE_LEVEL      : 0 = off (default, every SOLE_TRACE() compiles to nothing),
+ *                           1 = INFO, 2 = DEBUG, 3 = VERBOSE
+ * - SOLE_TRACE_CATEGORIES : Bitmask of enabled categories (default: all)
+ * - SOLE_TRACE_RING_DEPTH : Ring buffer depth in records (power of two)
+ *
+ * **Run-time configuration:**
+ * - SOLE_TRACE_FILE (environment) : Output path (default "sole_trace.bin")
+ *
+ * **Usage:**
+ * @code
+ *   SOLE_TRACE(EV_AXI_R_HANDSHAKE, read_data_received_num, M_AXI_RDATA.read());
+ * @endcode
+ * Category and level are taken from the event table below, so the filter is a
+ * constant expression and disabled events are removed by the compiler along
+ * with the evaluation of their arguments. The arguments of a disabled event
+ * still have to compile and count as used.
+ */
+
+#ifndef SOLE_TRACE_LEVEL
+#define SOLE_TRACE_LEVEL 0
+#endif
+
+#ifndef SOLE_TRACE_CATEGORIES
+#define SOLE_TRACE_CATEGORIES 0xF
+#endif
+
+#ifndef SOLE_TRACE_RING_DEPTH
+#define SOLE_TRACE_RING_DEPTH 65536
+#endif
+
+namespace sole::trace {
+
+    /**
+     * @enum Category_t
+     * @brief Trace categories (bitmask values for SOLE_TRACE_CATEGORIES)
+     */
+    enum Category_t : uint8_t {
+        CAT_AXI      = 0x1,   ///< AXI master handshakes and testbench slave activity
+        CAT_FIFO     = 0x2,   ///< Max/Output FIFO control and contents
+        CAT_STATE    = 0x4,   ///< State machine, status register and interrupt
+        CAT_PIPELINE = 0x8    ///< Pipeline stage register dumps
+    };
+
+    /**
+     * @enum Level_t
+     * @brief Trace verbosity levels
+     */
+    enum Level_t : uint8_t {
+        LVL_OFF     = 0,   ///< Nothing recorded
+        LVL_INFO    = 1,   ///< Once-per-phase summaries and status changes
+        LVL_DEBUG   = 2,   ///< Per-handshake events
+        LVL_VERBOSE = 3    ///< Per-cycle dumps
+    };
+
+    /**
+     * @enum Event_t
+     * @brief Trace event identifiers (index into kEvents)
+     */
+    enum Event_t : uint16_t {
+        // ----- Softmax AXI master -----
+        EV_AXI_AR_ISSUE = 0,      ///< ARADDR driven                     (araddr, arlen)
+        EV_AXI_AR_HANDSHAKE,      ///< ARVALID && ARREADY                (read_addr_sent_num)
+        EV_AXI_R_HANDSHAKE,       ///< RVALID && RREADY                  (read_data_received_num, rdata)
+        EV_AXI_AW_ISSUE,          ///< AWADDR driven                     (awaddr, awlen)
+        EV_AXI_AW_HANDSHAKE,      ///< AWVALID && AWREADY                (write_addr_sent_num)
+        EV_AXI_W_CHANNEL,         ///< W channel state every PROCESS3 cycle (wvalid, wready)
+        EV_AXI_W_HANDSHAKE,       ///< WVALID && WREADY                  (write_data_sent_num, wdata)
+        EV_AXI_B_HANDSHAKE,       ///< BVALID && BREADY                  (write_response_received_num)
+        // ----- Testbench AXI slave -----
+        EV_SLAVE_AW,              ///< Slave accepted write address      (byte_addr, awlen)
+        EV_SLAVE_W,               ///< Slave accepted write data         (wdata)
+        EV_SLAVE_AW_FALLBACK,     ///< W without queued AW, address inferred (byte_addr)
+        EV_SLAVE_WRITE_ERR,       ///< Write outside test memory         (word_idx)
+        EV_SLAVE_MEM_WRITE,       ///< Memory updated                    (word_idx, byte_addr, data)
+        EV_SLAVE_B,               ///< Write response issued             (bresp)
+        EV_SLAVE_AR,              ///< Slave accepted read address       (byte_addr, arlen)
+        EV_SLAVE_READ_ERR,        ///< Read outside test memory          (word_idx)
+        EV_SLAVE_R,               ///< Read data driven                  (word_idx, rdata, rresp)
+        // ----- FIFO -----
+        EV_FIFO_READ_CTRL,        ///< PROCESS3 FIFO pop control         (axi_write_handshake, stall, max_rd_en, out_rd_en)
+        EV_FIFO_MAX_STATE,        ///< Max_FIFO pointers and output      (w_ptr, r_ptr, count, data_out)
+        EV_FIFO_MAX_SKID,         ///< Max_FIFO skid register            (skid_valid, skid_reg)
+        EV_FIFO_MAX_ENTRY,        ///< One occupied Max_FIFO SRAM entry  (idx, data)
+        // ----- State -----
+        EV_STATE_READ_DONE,       ///< End of PROCESS1 read counts       (data_received, addr_sent, max_fifo_count, output_fifo_count)
+        EV_STATE_WRITE_DONE,      ///< End of PROCESS3 write counts      (addr_sent, data_sent, resp_received)
+        EV_STATE_STATUS_HW,       ///< Status register changed           (status)
+        EV_STATE_STATUS_MMIO,     ///< Status read over MMIO changed     (status)
+        EV_STATE_INTERRUPT,       ///< Interrupt rising edge             (status)
+        // ----- Pipeline -----
+        EV_PIPE_P3_STAGE1,        ///< PROCESS_3 Stage1 register         (valid, sub_result)
+        EV_PIPE_P3_STAGE2,        ///< PROCESS_3 Stage2 register         (valid, power)
+        EV_PIPE_P3_STAGE3,        ///< PROCESS_3 Stage3 register         (valid, mux, ks, ky[3..0] nibbles)
+        EV_PIPE_P3_STAGE4,        ///< PROCESS_3 Stage4 register         (valid, output)
+        // ----- Descriptor ring -----
+        EV_RING_FETCH,            ///< Descriptor fetch issued           (head, desc_addr)
+        EV_RING_COMPLETE,         ///< Completion record written back    (new head, status, cycles)
+        EV_COUNT
+    };
+
+    /**
+     * @struct EventInfo
+     * @brief Static description of one event: filter keys and decode format
+     *
+     * The format string receives the four record arguments as unsigned long long.
+     */
+    struct EventInfo {
+        const char* name;
+        Category_t  category;
+        Level_t     level;
+        const char* format;
+    };
+
+    inline constexpr EventInfo kEvents[EV_COUNT] = {
+        {"AXI_AR_ISSUE",       CAT_AXI,      LVL_DEBUG,   "araddr=0x%08llx arlen=%llu"},
+        {"AXI_AR_HANDSHAKE",   CAT_AXI,      LVL_DEBUG,   "read_addr_sent_num=%llu"},
+        {"AXI_R_HANDSHAKE",    CAT_AXI,      LVL_DEBUG,   "num=%llu rdata=0x%016llx"},
+        {"AXI_AW_ISSUE",       CAT_AXI,      LVL_DEBUG,   "awaddr=0x%08llx awlen=%llu"},
+        {"AXI_AW_HANDSHAKE",   CAT_AXI,      LVL_DEBUG,   "write_addr_sent_num=%llu"},
+        {"AXI_W_CHANNEL",      CAT_AXI,      LVL_VERBOSE, "wvalid=%llu wready=%llu"},
+        {"AXI_W_HANDSHAKE",    CAT_AXI,      LVL_DEBUG,   "num=%llu wdata=0x%016llx"},
+        {"AXI_B_HANDSHAKE",    CAT_AXI,      LVL_DEBUG,   "write_response_received_num=%llu"},
+        {"SLAVE_AW",           CAT_AXI,      LVL_DEBUG,   "byte_addr=0x%llx awlen=%llu"},
+        {"SLAVE_W",            CAT_AXI,      LVL_DEBUG,   "wdata=0x%llx"},
+        {"SLAVE_AW_FALLBACK",  CAT_AXI,      LVL_INFO,    "inferred byte_addr=0x%llx"},
+        {"SLAVE_WRITE_ERR",    CAT_AXI,      LVL_INFO,    "word_idx=%llu out of range"},
+        {"SLAVE_MEM_WRITE",    CAT_AXI,      LVL_DEBUG,   "word_idx=%llu byte_addr=0x%llx data=0x%llx"},
+        {"SLAVE_B",            CAT_AXI,      LVL_DEBUG,   "bresp=%llu"},
+        {"SLAVE_AR",           CAT_AXI,      LVL_DEBUG,   "byte_addr=0x%llx arlen=%llu"},
+        {"SLAVE_READ_ERR",     CAT_AXI,      LVL_INFO,    "word_idx=%llu out of range"},
+        {"SLAVE_R",            CAT_AXI,      LVL_DEBUG,   "word_idx=%llu rdata=0x%llx rresp=%llu"},
+        {"FIFO_READ_CTRL",     CAT_FIFO,     LVL_VERBOSE, "axi_write_handshake=%llu process3_stall=%llu max_fifo_read_en=%llu output_fifo_read_en=%llu"},
+        {"FIFO_MAX_STATE",     CAT_FIFO,     LVL_VERBOSE, "w_ptr=%llu r_ptr=%llu count=%llu data_out=0x%04llx"},
+        {"FIFO_MAX_SKID",      CAT_FIFO,     LVL_VERBOSE, "skid_valid=%llu skid_reg=0x%04llx"},
+        {"FIFO_MAX_ENTRY",     CAT_FIFO,     LVL_VERBOSE, "[%3llu] 0x%04llx"},
+        {"STATE_READ_DONE",    CAT_STATE,    LVL_INFO,    "data_received=%llu addr_sent=%llu max_fifo_count=%llu output_fifo_count=%llu"},
+        {"STATE_WRITE_DONE",   CAT_STATE,    LVL_INFO,    "addr_sent=%llu data_sent=%llu resp_received=%llu"},
+        {"STATE_STATUS_HW",    CAT_STATE,    LVL_INFO,    "status=0x%08llx"},
+        {"STATE_STATUS_MMIO",  CAT_STATE,    LVL_INFO,    "status=0x%08llx"},
+        {"STATE_INTERRUPT",    CAT_STATE,    LVL_INFO,    "status=0x%08llx"},
+        {"PIPE_P3_STAGE1",     CAT_PIPELINE, LVL_VERBOSE, "valid=%llu sub_result=0x%llx"},
+        {"PIPE_P3_STAGE2",     CAT_PIPELINE, LVL_VERBOSE, "valid=%llu power=%llu"},
+        {"PIPE_P3_STAGE3",     CAT_PIPELINE, LVL_VERBOSE, "valid=%llu mux=0x%llx ks=%llu ky=0x%04llx"},
+        {"PIPE_P3_STAGE4",     CAT_PIPELINE, LVL_VERBOSE, "valid=%llu output=0x%016llx"},
+        {"RING_FETCH",         CAT_STATE,    LVL_INFO,    "head=%llu desc_addr=0x%08llx"},
+        {"RING_COMPLETE",      CAT_STATE,    LVL_INFO,    "head=%llu status=0x%08llx cycles=%llu"},
+    };
+
+    /**
+     * @brief Compile-time filter for one event
+     */
+    constexpr bool enabled(Event_t ev) {
+        return (kEvents[ev].category & SOLE_TRACE_CATEGORIES) != 0 &&
+               kEvents[ev].level != LVL_OFF &&
+               kEvents[ev].level <= SOLE_TRACE_LEVEL;
+    }
+
+    /**
+     * @struct Record
+     * @brief One binary trace record (48 bytes, written verbatim to the file)
+     */
+    struct Record {
+        uint64_t time;        ///< sc_time_stamp().value() (kernel resolution units, ps by default)
+        uint16_t event;       ///< Event_t
+        uint8_t  category;    ///< Category_t (copied from kEvents for standalone decoding)
+        uint8_t  level;       ///< Level_t
+        uint32_t seq;         ///< Low 32 bits of the record sequence number
+        uint64_t arg[4];      ///< Event arguments, meaning per kEvents[event].format
+    };
+    static_assert(sizeof(Record) == 48, "trace Record layout must stay fixed");
+
+    /**
+     * @struct FileHeader
+     * @brief Header at the start of every trace file
+     */
+    struct FileHeader {
+        char     magic[8];       ///< "SOLETRC\0"
+        uint32_t version;        ///< kFileVersion
+        uint32_t record_size;    ///< sizeof(Record)
+        uint64_t record_count;   ///< Filled in on close (0 if the writer did not shut down cleanly)
+    };
+    static_assert(sizeof(FileHeader) == 24, "trace FileHeader layout must stay fixed");
+
+    inline constexpr char     kFileMagic[8] = {'S', 'O', 'L', 'E', 'T', 'R', 'C', '\0'};
+    inline constexpr uint32_t kFileVersion  = 1;
+
+    /**
+     * @brief Sink for the arguments of a compiled-out SOLE_TRACE()
+     *
+     * Called only from a dead branch, so locals that feed nothing but a trace
+     * still count as used and the default build stays warning-free.
+     */
+    template <class... Args>
+    constexpr void discard(const Args&...) {}
+
+} // namespace sole::trace
+
+#if SOLE_TRACE_LEVEL > 0
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <thread>
+
+namespace sole::trace {
+
+    /**
+     * @class Ring
+     * @brief Lock-free SPSC ring of Records
+     *
+     * The simulation thread is the only producer and the writer thread the only
+     * consumer. head_ and tail_ are free-running counters, so full/empty need no
+     * extra flag.
+     */
+    class Ring {
+    public:
+        static constexpr uint64_t kDepth = SOLE_TRACE_RING_DEPTH;
+        static_assert(kDepth != 0 && (kDepth & (kDepth - 1)) == 0, "SOLE_TRACE_RING_DEPTH must be a power of two");
+
+        Ring() : buf_(new Record[kDepth]) {}
+
+        /// Producer side. Returns false when the ring is full.
+        bool try_push(const Record& r) {
+            const uint64_t head = head_.load(std::memory_order_relaxed);
+            if (head - tail_.load(std::memory_order_acquire) >= kDepth) return false;
+            buf_[head & (kDepth - 1)] = r;
+            head_.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /// Consumer side. Hands every pending record to sink(ptr, n) in at most two contiguous runs.
+        template <class Sink>
+        uint64_t drain(Sink&& sink) {
+            const uint64_t tail = tail_.load(std::memory_order_relaxed);
+            const uint64_t head = head_.load(std::memory_order_acquire);
+            const uint64_t n = head - tail;
+            if (n == 0) return 0;
+            const uint64_t first = tail & (kDepth - 1);
+            const uint64_t run = (first + n <= kDepth) ? n : (kDepth - first);
+            sink(&buf_[first], run);
+            if (run < n) sink(&buf_[0], n - run);
+            tail_.store(head, std::memory_order_release);
+            return n;
+        }
+
+    private:
+        alignas(64) std::atomic<uint64_t> head_{0};
+        alignas(64) std::atomic<uint64_t> tail_{0};
+        std::unique_ptr<Record[]> buf_;
+    };
+
+    /**
+     * @class Writer
+     * @brief Process-wide trace sink: owns the ring, the output file and the drain thread
+     *
+     * Started lazily by the first record; flushed and closed at program exit.
+     * When the ring is full the producer yields until the writer catches up, so
+     * the trace is lossless.
+     */
+    class Writer {
+    public:
+        static Writer& instance() {
+            static Writer writer;
+            return writer;
+        }
+
+        void push(const Record& r) {
+            if (!started_) start();
+            while (!ring_.try_push(r)) std::this_thread::yield();
+        }
+
+        uint32_t next_seq() { return static_cast<uint32_t>(seq_++); }
+
+        ~Writer() {
+            if (!started_) return;
+            stop_.store(true, std::memory_order_release);
+            if (thread_.joinable()) thread_.join();
+            drain();
+            if (file_) {
+                FileHeader header = make_header();
+                header.record_count = written_;
+                std::fseek(file_, 0, SEEK_SET);
+                std::fwrite(&header, sizeof(header), 1, file_);
+                std::fclose(file_);
+            }
+        }
+
+    private:
+        Writer() = default;
+
+        static FileHeader make_header() {
+            FileHeader header{};
+            std::memcpy(header.magic, kFileMagic, sizeof(header.magic));
+            header.version = kFileVersion;
+            header.record_size = sizeof(Record);
+            return header;
+        }
+
+        void start() {
+            started_ = true;
+            const char* path = std::getenv("SOLE_TRACE_FILE");
+            file_ = std::fopen(path ? path : "sole_trace.bin", "wb");
+            if (file_) {
+                FileHeader header = make_header();
+                std::fwrite(&header, sizeof(header), 1, file_);
+            }
+            thread_ = std::thread([this] {
+                while (!stop_.load(std::memory_order_acquire)) {
+                    if (drain() == 0) std::this_thread::sleep_for(std::chrono::microseconds(200));
+                }
+            });
+        }
+
+        uint64_t drain() {
+            return ring_.drain([this](const Record* r, uint64_t n) {
+                if (file_) written_ += std::fwrite(r, sizeof(Record), n, file_);
+            });
+        }
+
+        Ring               ring_;
+        std::FILE*         file_ = nullptr;
+        std::thread        thread_;
+        std::atomic<bool>  stop_{false};
+        bool               started_ = false;   // producer-only
+        uint64_t           seq_ = 0;           // producer-only
+        uint64_t           written_ = 0;       // consumer-only
+    };
+
+    template <class... Args>
+    inline void emit(Event_t ev, uint64_t time, const Args&... args) {
+        static_assert(sizeof...(Args) <= 4, "trace events carry at most four arguments");
+        Writer& writer = Writer::instance();
+        Record r{};
+        r.time = time;
+        r.event = ev;
+        r.category = kEvents[ev].category;
+        r.level = kEvents[ev].level;
+        r.seq = writer.next_seq();
+        uint64_t values[4] = {static_cast<uint64_t>(args)...};
+        std::memcpy(r.arg, values, sizeof(r.arg));
+        writer.push(r);
+    }
+
+} // namespace sole::trace
+
+/**
+ * @brief Record a trace event (arguments are evaluated only if the event is compiled in)
+ * @param ev  Event_t enumerator name without namespace (e.g. EV_AXI_R_HANDSHAKE)
+ * @param ... Up to four integral/sc_uint arguments
+ */
+#define SOLE_TRACE(ev, ...)                                                               \
+    do {                                                                                  \
+        if constexpr (::sole::trace::enabled(::sole::trace::ev)) {                        \
+            ::sole::trace::emit(::sole::trace::ev, ::sc_core::sc_time_stamp().value(),    \
+                                __VA_ARGS__);                                             \
+        } else {                                                                          \
+            ::sole::trace::discard(__VA_ARGS__);                                          \
+        }                                                                                 \
+    } while (0)
+
+/// True when at least one event of the category is compiled in (guards multi-record dumps)
+#define SOLE_TRACE_ON(cat, lvl) \
+    ((::sole::trace::cat & SOLE_TRACE_CATEGORIES) != 0 && ::sole::trace::lvl <= SOLE_TRACE_LEVEL)
+
+#else
+
+#define SOLE_TRACE(ev, ...)                                                               \
+    do {                                                                                  \
+        if (false) {                                                                      \
+            ::sole::trace::discard(__VA_ARGS__);                                          \
+        }                                                                                 \
+    } while (0)
+#define SOLE_TRACE_ON(cat, lvl) false
+
+#endif // SOLE_TRACE_LEVEL > 0
+
+#endif // TRACE_HPP
@@ -5,9 +5,10 @@
 #include <string>
 #include <iostream>
 #include <fstream>
+#include "DataTypes.hpp"
 typedef uint16_t fp16_t; 
 
-using sc_uint16 = sc_dt::sc_uint<16>;
+using sc_uint16 = sole_uint<16>;
 
 fp16_t fp16_add(fp16_t a, fp16_t b);
 fp16_t fp16_mul(fp16_t a, fp16_t b);
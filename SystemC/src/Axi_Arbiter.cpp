@@ -0,0 +1,295 @@
+#include "Axi_Arbiter.h"
+#include "Profile.hpp"
+
+Axi_Arbiter::Axi_Arbiter(sc_core::sc_module_name name, unsigned masters, unsigned outstanding_limit)
+    : sc_core::sc_module(name),
+      clk("clk"), rst("rst"),
+      S_AXI_AWADDR("S_AXI_AWADDR", masters), S_AXI_AWLEN("S_AXI_AWLEN", masters),
+      S_AXI_AWSIZE("S_AXI_AWSIZE", masters), S_AXI_AWBURST("S_AXI_AWBURST", masters),
+      S_AXI_AWVALID("S_AXI_AWVALID", masters), S_AXI_AWREADY("S_AXI_AWREADY", masters),
+      S_AXI_WDATA("S_AXI_WDATA", masters), S_AXI_WSTRB("S_AXI_WSTRB", masters),
+      S_AXI_WLAST("S_AXI_WLAST", masters), S_AXI_WVALID("S_AXI_WVALID", masters),
+      S_AXI_WREADY("S_AXI_WREADY", masters),
+      S_AXI_BRESP("S_AXI_BRESP", masters), S_AXI_BVALID("S_AXI_BVALID", masters),
+      S_AXI_BREADY("S_AXI_BREADY", masters),
+      S_AXI_ARID("S_AXI_ARID", masters), S_AXI_ARADDR("S_AXI_ARADDR", masters),
+      S_AXI_ARLEN("S_AXI_ARLEN", masters), S_AXI_ARSIZE("S_AXI_ARSIZE", masters),
+      S_AXI_ARBURST("S_AXI_ARBURST", masters), S_AXI_ARVALID("S_AXI_ARVALID", masters),
+      S_AXI_ARREADY("S_AXI_ARREADY", masters),
+      S_AXI_RID("S_AXI_RID", masters), S_AXI_RDATA("S_AXI_RDATA", masters),
+      S_AXI_RRESP("S_AXI_RRESP", masters), S_AXI_RVALID("S_AXI_RVALID", masters),
+      S_AXI_RREADY("S_AXI_RREADY", masters),
+      M_AXI_AWADDR("M_AXI_AWADDR"), M_AXI_AWLEN("M_AXI_AWLEN"), M_AXI_AWSIZE("M_AXI_AWSIZE"),
+      M_AXI_AWBURST("M_AXI_AWBURST"), M_AXI_AWVALID("M_AXI_AWVALID"), M_AXI_AWREADY("M_AXI_AWREADY"),
+      M_AXI_WDATA("M_AXI_WDATA"), M_AXI_WSTRB("M_AXI_WSTRB"), M_AXI_WLAST("M_AXI_WLAST"),
+      M_AXI_WVALID("M_AXI_WVALID"), M_AXI_WREADY("M_AXI_WREADY"),
+      M_AXI_BRESP("M_AXI_BRESP"), M_AXI_BVALID("M_AXI_BVALID"), M_AXI_BREADY("M_AXI_BREADY"),
+      M_AXI_ARID("M_AXI_ARID"), M_AXI_ARADDR("M_AXI_ARADDR"), M_AXI_ARLEN("M_AXI_ARLEN"),
+      M_AXI_ARSIZE("M_AXI_ARSIZE"), M_AXI_ARBURST("M_AXI_ARBURST"), M_AXI_ARVALID("M_AXI_ARVALID"),
+      M_AXI_ARREADY("M_AXI_ARREADY"),
+      M_AXI_RID("M_AXI_RID"), M_AXI_RDATA("M_AXI_RDATA"), M_AXI_RRESP("M_AXI_RRESP"),
+      M_AXI_RVALID("M_AXI_RVALID"), M_AXI_RREADY("M_AXI_RREADY"),
+      masters(masters),
+      outstanding_limit(outstanding_limit != 0 ? outstanding_limit : std::max(ID_COUNT / std::max(masters, 1u), 1u)),
+      stats(masters),
+      reads_in_flight(masters, 0), writes_in_flight(masters, 0),
+      ar_allowed(masters, true), aw_allowed(masters, true),
+      weights(masters, 1),
+      state_epoch("state_epoch")
+{
+    SC_METHOD(arbiter_process);
+    sensitive << clk.pos();
+
+    SC_METHOD(route_process);
+    sensitive << state_epoch << M_AXI_AWREADY << M_AXI_WREADY << M_AXI_BRESP << M_AXI_BVALID
+              << M_AXI_ARREADY << M_AXI_RID << M_AXI_RDATA << M_AXI_RRESP << M_AXI_RVALID;
+    for (unsigned m = 0; m < masters; m++) {
+        sensitive << S_AXI_AWADDR[m] << S_AXI_AWLEN[m] << S_AXI_AWSIZE[m] << S_AXI_AWBURST[m]
+                  << S_AXI_AWVALID[m] << S_AXI_WDATA[m] << S_AXI_WSTRB[m] << S_AXI_WLAST[m]
+                  << S_AXI_WVALID[m] << S_AXI_BREADY[m] << S_AXI_ARID[m] << S_AXI_ARADDR[m]
+                  << S_AXI_ARLEN[m] << S_AXI_ARSIZE[m] << S_AXI_ARBURST[m] << S_AXI_ARVALID[m]
+                  << S_AXI_RREADY[m];
+    }
+}
+
+void Axi_Arbiter::set_arbitration(Arbitration_Policy new_policy, const std::vector<unsigned>& new_weights) {
+    policy = new_policy;
+    weights.assign(masters, 1);
+    for (size_t m = 0; m < std::min<size_t>(masters, new_weights.size()); m++) {
+        weights[m] = std::max(new_weights[m], 1u);
+    }
+}
+
+void Axi_Arbiter::set_issue_limit(unsigned read_bursts, unsigned write_bursts) {
+    read_issue_limit = read_bursts;
+    write_issue_limit = write_bursts;
+}
+
+/// Limits and free ID after this edge's updates; keep_free_id holds the ARID of an AR still waiting for ARREADY
+void Axi_Arbiter::update_allowed(bool keep_free_id) {
+    if (!keep_free_id || free_id >= ID_COUNT || read_slots[free_id].valid) {
+        free_id = ID_COUNT;
+        for (unsigned id = 0; id < ID_COUNT; id++) {
+            if (!read_slots[id].valid) {
+                free_id = id;
+                break;
+            }
+        }
+    }
+    unsigned reads = 0, writes = 0;
+    for (unsigned m = 0; m < masters; m++) {
+        reads += reads_in_flight[m];
+        writes += writes_in_flight[m];
+    }
+    bool read_room = read_issue_limit == 0 || reads < read_issue_limit;
+    bool write_room = write_issue_limit == 0 || writes < write_issue_limit;
+    for (unsigned m = 0; m < masters; m++) {
+        ar_allowed[m] = reads_in_flight[m] < outstanding_limit && free_id < ID_COUNT && read_room;
+        aw_allowed[m] = writes_in_flight[m] < outstanding_limit && write_room;
+    }
+}
+
+/// First requesting master after 'current' (current itself last, unless skip_current); current if none
+unsigned Axi_Arbiter::next_grant(unsigned current, bool skip_current, const sc_core::sc_vector<sc_in<bool>>& valid,
+                                 const std::vector<bool>& allowed) const {
+    for (unsigned i = 1; i <= masters; i++) {
+        unsigned m = (current + i) % masters;
+        if (m == current && skip_current) {
+            continue;
+        }
+        if (valid[m].read() && allowed[m]) {
+            return m;
+        }
+    }
+    return current;
+}
+
+/// Grant after this edge under the policy; called only when the grant may move
+unsigned Axi_Arbiter::move_grant(unsigned current, bool handshake, unsigned& turn,
+                                 const sc_core::sc_vector<sc_in<bool>>& valid, const std::vector<bool>& allowed) const {
+    if (policy == Arbitration_Policy::FIXED_PRIORITY) {
+        unsigned best = current;
+        bool found = false;
+        for (unsigned m = 0; m < masters; m++) {
+            if (valid[m].read() && allowed[m] && (!found || weights[m] > weights[best])) {
+                best = m;
+                found = true;
+            }
+        }
+        return best;
+    }
+    if (policy == Arbitration_Policy::WEIGHTED) {
+        // The turn lasts weight bursts while the master requests; a limit that
+        // holds every master back (the issue limit) does not end it
+        turn += handshake ? 1 : 0;
+        bool others_allowed = false;
+        for (unsigned m = 0; m < masters; m++) {
+            others_allowed |= m != current && valid[m].read() && allowed[m];
+        }
+        if (turn > 0 && turn < weights[current] && valid[current].read() && (allowed[current] || !others_allowed)) {
+            return current;
+        }
+    }
+    turn = 0;
+    return next_grant(current, handshake, valid, allowed);
+}
+
+/**
+ * @brief Arbiter State
+ *
+ * Handshakes are VALID && READY as seen on the ports at the clock edge, the
+ * same values the masters and the slave sample; R beats and B responses are
+ * retired only by their own handshake. A grant only moves when the master
+ * port showed no request (the granted master idle or held at a limit) or the
+ * request was just accepted, so a VALID the slave has seen stays up, with
+ * the same ARID, until its handshake.
+ */
+void Axi_Arbiter::arbiter_process() {
+    SOLE_PROFILE_PROCESS();
+
+    if (rst.read()) {
+        for (Read_Slot& slot : read_slots) {
+            slot = Read_Slot();
+        }
+        std::fill(reads_in_flight.begin(), reads_in_flight.end(), 0);
+        std::fill(writes_in_flight.begin(), writes_in_flight.end(), 0);
+        std::fill(stats.begin(), stats.end(), Port_Stats());
+        aw_order.clear();
+        b_order.clear();
+        ar_grant = 0;
+        aw_grant = 0;
+        ar_turn = 0;
+        aw_turn = 0;
+        cycles = 0;
+        update_allowed(false);
+        state_epoch.write(state_epoch.read() + 1);
+        return;
+    }
+    cycles++;
+
+    // ===== Read Address: allocate the ID of the accepted burst =====
+    bool ar_handshake = M_AXI_ARVALID.read() && M_AXI_ARREADY.read();
+    if (ar_handshake) {
+        Read_Slot& slot = read_slots[M_AXI_ARID.read().to_uint()];
+        slot.valid = true;
+        slot.master = ar_grant;
+        slot.id = S_AXI_ARID[ar_grant].read().to_uint();
+        slot.beats_left = M_AXI_ARLEN.read().to_uint() + 1;
+        slot.issue_cycle = cycles;
+        reads_in_flight[ar_grant]++;
+        stats[ar_grant].ar_bursts++;
+    }
+
+    // ===== Read Data: free the ID after the last beat =====
+    Read_Slot& r_slot = read_slots[M_AXI_RID.read().to_uint()];
+    if (M_AXI_RVALID.read() && M_AXI_RREADY.read() && r_slot.valid) {
+        stats[r_slot.master].r_beats++;
+        if (--r_slot.beats_left == 0) {
+            Port_Stats& s = stats[r_slot.master];
+            uint64_t latency = cycles - r_slot.issue_cycle;
+            s.read_bursts_done++;
+            s.read_latency_total += latency;
+            s.read_latency_max = std::max(s.read_latency_max, latency);
+            r_slot.valid = false;
+            reads_in_flight[r_slot.master]--;
+        }
+    }
+
+    // ===== Write Response: in WLAST order =====
+    if (M_AXI_BVALID.read() && M_AXI_BREADY.read() && !b_order.empty()) {
+        const Write_Burst& burst = b_order.front();
+        Port_Stats& s = stats[burst.master];
+        uint64_t latency = cycles - burst.issue_cycle;
+        s.write_bursts_done++;
+        s.write_latency_total += latency;
+        s.write_latency_max = std::max(s.write_latency_max, latency);
+        writes_in_flight[burst.master]--;
+        b_order.pop_front();
+    }
+
+    // ===== Write Address / Data =====
+    bool aw_handshake = M_AXI_AWVALID.read() && M_AXI_AWREADY.read();
+    if (aw_handshake) {
+        aw_order.push_back({aw_grant, cycles});
+        writes_in_flight[aw_grant]++;
+        stats[aw_grant].aw_bursts++;
+    }
+    if (M_AXI_WVALID.read() && M_AXI_WREADY.read() && !aw_order.empty()) {
+        stats[aw_order.front().master].w_beats++;
+        if (M_AXI_WLAST.read()) {
+            b_order.push_back(aw_order.front());
+            aw_order.pop_front();
+        }
+    }
+
+    for (unsigned m = 0; m < masters; m++) {
+        if (S_AXI_ARVALID[m].read() && !(ar_handshake && m == ar_grant)) {
+            stats[m].ar_wait_cycles++;
+        }
+        if (S_AXI_AWVALID[m].read() && !(aw_handshake && m == aw_grant)) {
+            stats[m].aw_wait_cycles++;
+        }
+    }
+
+    // ===== Grants =====
+    update_allowed(M_AXI_ARVALID.read() && !ar_handshake);
+    if (ar_handshake || !M_AXI_ARVALID.read()) {
+        ar_grant = move_grant(ar_grant, ar_handshake, ar_turn, S_AXI_ARVALID, ar_allowed);
+    }
+    if (aw_handshake || !M_AXI_AWVALID.read()) {
+        aw_grant = move_grant(aw_grant, aw_handshake, aw_turn, S_AXI_AWVALID, aw_allowed);
+    }
+    state_epoch.write(state_epoch.read() + 1);
+}
+
+void Axi_Arbiter::route_process() {
+    SOLE_PROFILE_PROCESS();
+
+    // ===== Read Address =====
+    bool ar_go = ar_allowed[ar_grant];
+    M_AXI_ARID.write(free_id % ID_COUNT);
+    M_AXI_ARADDR.write(S_AXI_ARADDR[ar_grant].read());
+    M_AXI_ARLEN.write(S_AXI_ARLEN[ar_grant].read());
+    M_AXI_ARSIZE.write(S_AXI_ARSIZE[ar_grant].read());
+    M_AXI_ARBURST.write(S_AXI_ARBURST[ar_grant].read());
+    M_AXI_ARVALID.write(ar_go && S_AXI_ARVALID[ar_grant].read());
+
+    // ===== Read Data: the beat goes to the master of its RID, RREADY comes from that master =====
+    const Read_Slot& r_slot = read_slots[M_AXI_RID.read().to_uint()];
+    bool r_routed = M_AXI_RVALID.read() && r_slot.valid;
+    for (unsigned m = 0; m < masters; m++) {
+        S_AXI_ARREADY[m].write(m == ar_grant && ar_go && M_AXI_ARREADY.read());
+        S_AXI_RID[m].write(r_slot.id);
+        S_AXI_RDATA[m].write(M_AXI_RDATA.read());
+        S_AXI_RRESP[m].write(M_AXI_RRESP.read());
+        S_AXI_RVALID[m].write(r_routed && r_slot.master == m);
+    }
+    M_AXI_RREADY.write(r_routed && S_AXI_RREADY[r_slot.master].read());
+
+    // ===== Write Address =====
+    bool aw_go = aw_allowed[aw_grant];
+    M_AXI_AWADDR.write(S_AXI_AWADDR[aw_grant].read());
+    M_AXI_AWLEN.write(S_AXI_AWLEN[aw_grant].read());
+    M_AXI_AWSIZE.write(S_AXI_AWSIZE[aw_grant].read());
+    M_AXI_AWBURST.write(S_AXI_AWBURST[aw_grant].read());
+    M_AXI_AWVALID.write(aw_go && S_AXI_AWVALID[aw_grant].read());
+
+    // ===== Write Data: the master at the head of the AW order =====
+    bool w_routed = !aw_order.empty();
+    unsigned w_master = w_routed ? aw_order.front().master : 0;
+    M_AXI_WDATA.write(S_AXI_WDATA[w_master].read());
+    M_AXI_WSTRB.write(S_AXI_WSTRB[w_master].read());
+    M_AXI_WLAST.write(S_AXI_WLAST[w_master].read());
+    M_AXI_WVALID.write(w_routed && S_AXI_WVALID[w_master].read());
+
+    // ===== Write Response =====
+    bool b_routed = !b_order.empty();
+    unsigned b_master = b_routed ? b_order.front().master : 0;
+    M_AXI_BREADY.write(b_routed && S_AXI_BREADY[b_master].read());
+    for (unsigned m = 0; m < masters; m++) {
+        S_AXI_AWREADY[m].write(m == aw_grant && aw_go && M_AXI_AWREADY.read());
+        S_AXI_WREADY[m].write(w_routed && m == w_master && M_AXI_WREADY.read());
+        S_AXI_BRESP[m].write(M_AXI_BRESP.read());
+        S_AXI_BVALID[m].write(b_routed && m == b_master && M_AXI_BVALID.read());
+    }
+}
@@ -0,0 +1,205 @@
+// Axi_Slave_Cycle (see Softmax_Cycle.h). Kept apart from Softmax_Cycle.cpp so
+// that harnesses without SystemC (RTL/tb/SOLE_verilator_tb.cpp) can link it.
+#include "Softmax_Cycle.h"
+#include <algorithm>
+
+/**
+ * @brief Queue index of the read burst to answer next (size() = none ready)
+ *
+ * Same choice as AxiSlaveMemory::next_read_burst().
+ */
+size_t Axi_Slave_Cycle::next_read_burst() const {
+    size_t window = std::min(read_addr_queue.size(), (size_t)std::max(read_reorder, 0) + 1);
+    if (!read_addr_queue.empty() && read_addr_queue.front().passed >= (unsigned)std::max(read_reorder, 0)) {
+        window = 1;
+    }
+    for (size_t i = window; i-- > 0;) {
+        const Burst& b = read_addr_queue[i];
+        bool same_id_older = std::any_of(read_addr_queue.begin(), read_addr_queue.begin() + i,
+                                         [&](const Burst& o) { return o.id == b.id; });
+        if (b.ready <= read_cycle && !same_id_older) {
+            return i;
+        }
+    }
+    return read_addr_queue.size();
+}
+
+void Axi_Slave_Cycle::eval(const Softmax_Cycle::Axi_Pins& pins, bool rst) {
+    if (rst) {
+        awready = false;
+        wready = false;
+        bvalid = false;
+        bresp = 0;
+        write_addr_queue.clear();
+        last_write_addr = 0;
+        has_last_write_addr = false;
+        write_in_burst = false;
+        write_burst_resp = 0;
+        write_resp_queue.clear();
+        wready_pulse_enable = false;
+        wready_pulse_cnt = -1;
+
+        arready = false;
+        rvalid = false;
+        rid = 0;
+        rdata = 0;
+        rresp = 0;
+        has_addr = false;
+        read_beats_left = 0;
+        read_id = 0;
+        read_cycle = 0;
+        arready_delay_cnt = -1;
+        read_resp_start_delay_cnt = -1;
+        read_addr_queue.clear();
+        return;
+    }
+
+    // ===== Write channels =====
+    awready = true;
+
+    if (!wready_pulse_enable && pins.wvalid) {
+        wready_pulse_enable = true;
+        wready_pulse_cnt = wready_delay;
+    }
+    bool wready_next = false;
+    if (wready_pulse_enable) {
+        if (wready_delay <= 0) {
+            wready_next = true;
+        } else if (wready_pulse_cnt <= 0) {
+            wready_next = true;
+            wready_pulse_cnt = wready_delay;
+        } else {
+            wready_pulse_cnt--;
+        }
+    }
+
+    if (pins.bvalid && pins.bready && !write_resp_queue.empty()) {
+        write_resp_queue.pop_front();
+    }
+    if (pins.awvalid && pins.awready) {
+        write_addr_queue.push_back({pins.awaddr, pins.awlen, 0, 0, 0});
+    }
+    if (pins.wvalid && pins.wready) {
+        uint32_t addr;
+        if (write_in_burst) {
+            addr = last_write_addr + 8;
+        } else if (!write_addr_queue.empty()) {
+            addr = write_addr_queue.front().addr;
+            write_addr_queue.pop_front();
+        } else {
+            addr = has_last_write_addr ? (last_write_addr + 8) : 0;
+        }
+        last_write_addr = addr;
+        has_last_write_addr = true;
+        uint8_t resp = mem.write(addr, pins.wdata, pins.wstrb);
+        if (resp > write_burst_resp) {
+            write_burst_resp = resp;
+        }
+        write_in_burst = !pins.wlast;
+        if (!write_in_burst) {
+            write_resp_queue.push_back(write_burst_resp);
+            write_burst_resp = 0;
+        }
+    }
+    bvalid = !write_resp_queue.empty();
+    bresp = bvalid ? write_resp_queue.front() : 0;
+
+    // Inside a burst WREADY stays high; the wait states start again after WLAST
+    if (write_in_burst) {
+        wready_next = true;
+        wready_pulse_cnt = wready_delay;
+    }
+    wready = wready_next;
+
+    // ===== Read channels =====
+    bool arready_next = false;
+    if (arready_delay <= 0) {
+        arready_next = true;
+        arready_delay_cnt = -1;
+    } else {
+        if (arready_delay_cnt < 0 && pins.arvalid) {
+            arready_delay_cnt = arready_delay;
+        }
+        if (arready_delay_cnt == 0) {
+            arready_next = true;
+        } else if (arready_delay_cnt > 0) {
+            arready_delay_cnt--;
+        }
+    }
+    arready = arready_next;
+
+    // AxiSlaveMemory accepts the address with its new ARREADY value
+    if (pins.arvalid && arready_next) {
+        read_addr_queue.push_back({pins.araddr, pins.arlen, pins.arid,
+                                   read_cycle + (uint64_t)std::max(read_latency, 0), 0});
+        if (arready_delay > 0) {
+            arready_delay_cnt = arready_delay;
+        }
+    }
+
+    // The beat on the bus is retired by RVALID && RREADY
+    if (has_addr && pins.rvalid && pins.rready) {
+        if (read_beats_left > 0) {
+            read_addr += 8;
+            read_beats_left--;
+            addr_resp = mem.read(read_addr, addr_data);
+        } else {
+            has_addr = false;
+        }
+    }
+
+    if (!has_addr && !read_addr_queue.empty()) {
+        bool begin = false;
+        if (rvalid_delay <= 0) {
+            begin = true;
+        } else {
+            if (read_resp_start_delay_cnt < 0) {
+                read_resp_start_delay_cnt = rvalid_delay;
+            }
+            if (read_resp_start_delay_cnt > 0) {
+                read_resp_start_delay_cnt--;
+            } else {
+                begin = true;
+            }
+        }
+        // The burst to answer; without a ready one the delay stays elapsed
+        size_t next = begin ? next_read_burst() : read_addr_queue.size();
+        if (next < read_addr_queue.size()) {
+            read_addr = read_addr_queue[next].addr;
+            read_beats_left = read_addr_queue[next].len;
+            read_id = read_addr_queue[next].id;
+            addr_resp = mem.read(read_addr, addr_data);
+            for (size_t i = 0; i < next; ++i) {
+                read_addr_queue[i].passed++;
+            }
+            read_addr_queue.erase(read_addr_queue.begin() + next);
+            has_addr = true;
+            read_resp_start_delay_cnt = -1;
+        }
+    }
+    read_cycle++;
+
+    if (has_addr) {
+        rid = read_id;
+        rdata = addr_data;
+        rvalid = true;
+        rresp = addr_resp;
+    } else {
+        rvalid = false;
+        rid = 0;
+        rdata = 0;
+        rresp = 0;
+    }
+}
+
+void Axi_Slave_Cycle::commit(Softmax_Cycle::Axi_Pins& pins) const {
+    pins.awready = awready;
+    pins.wready  = wready;
+    pins.bresp   = bresp;
+    pins.bvalid  = bvalid;
+    pins.arready = arready;
+    pins.rid     = rid;
+    pins.rdata   = rdata;
+    pins.rresp   = rresp;
+    pins.rvalid  = rvalid;
+}
@@ -0,0 +1,210 @@
+#include "Descriptor_Ring.h"
+#include "Profile.hpp"
+
+using namespace sole::mmio;
+
+/// 64-bit descriptor word 'k' of a beat (lanes 4k .. 4k + 3)
+static uint64_t beat_word(const axi_data_t& beat, unsigned k) {
+    uint64_t word = 0;
+    for (unsigned lane = 0; lane < 4; lane++) {
+        word |= (uint64_t)sole_beat_lane(beat, 4 * k + lane) << (16 * lane);
+    }
+    return word;
+}
+
+static void beat_set_word(axi_data_t& beat, unsigned k, uint64_t word) {
+    for (unsigned lane = 0; lane < 4; lane++) {
+        sole_beat_set_lane(beat, 4 * k + lane, (uint16_t)(word >> (16 * lane)));
+    }
+}
+
+/**
+ * @brief Ring Controller
+ *
+ * **Handshakes:**
+ * Like the Softmax AXI processes, a handshake is VALID && READY as seen on the
+ * ports at the clock edge; VALID is dropped on the edge that sees it.
+ *
+ * **Job Start:**
+ * The Softmax engine starts on a START level in IDLE, so START is held until
+ * the status leaves IDLE (or reports the ERROR of a rejected length) and is
+ * then dropped before the row can finish. The job cycle count runs from the
+ * edge that raises START to the edge that sees DONE or ERROR.
+ *
+ * **Completion:**
+ * The completion record goes out as one beat (the beat holding descriptor
+ * word 3) whose WSTRB enables only the 8 bytes of word 3: with 8 or 16 lanes
+ * the beat also covers other descriptor words, which the processor may have
+ * reused since the fetch. HEAD advances on the B response, so a HEAD the
+ * processor reads never covers a record that is not in memory yet.
+ */
+void Descriptor_Ring::ring_process() {
+    SOLE_PROFILE_PROCESS();
+    using namespace softmax::status;
+
+    const unsigned completion_beat = RING_DESC_COMPLETION_WORD * 8 / AXI_BEAT_BYTES;
+    const unsigned completion_lane_word = RING_DESC_COMPLETION_WORD % RING_BEAT_WORDS;
+
+    M_AXI_ARID.write(0);
+    M_AXI_WSTRB.write(sc_dt::sc_uint<AXI_STRB_WIDTH>(0xFF) << (8 * completion_lane_word));
+    M_AXI_WLAST.write(true);
+    M_AXI_AWLEN.write(0);
+    M_AXI_ARLEN.write(RING_DESC_BEATS - 1);
+
+    if (rst.read()) {
+        ring_state = RING_IDLE;
+        head = 0;
+        beats_received = 0;
+        fetch_error = false;
+        completion_status = 0;
+        job_cycles = 0;
+        aw_done = false;
+        w_done = false;
+        ring_head.write(0);
+        job_start.write(false);
+        job_src.write(0);
+        job_dst.write(0);
+        job_length.write(0);
+        job_flags.write(0);
+        busy.write(false);
+        job_complete.write(false);
+        bus_owner.write(false);
+        M_AXI_AWADDR.write(0);
+        M_AXI_AWVALID.write(false);
+        M_AXI_WDATA.write(0);
+        M_AXI_WVALID.write(false);
+        M_AXI_BREADY.write(false);
+        M_AXI_ARADDR.write(0);
+        M_AXI_ARVALID.write(false);
+        M_AXI_RREADY.write(false);
+        return;
+    }
+
+    if (head_restore_pending && enable.read()) {
+        head = restored_head;
+        head_restore_pending = false;
+    }
+
+    uint32_t status = engine_status.read().to_uint();
+    bool engine_done = ((status >> STAT_DONE_BIT) & 0x1) != 0;
+    bool engine_error = ((status >> STAT_ERROR_BIT) & 0x1) != 0;
+    uint32_t engine_state = (status >> STAT_STATE_LSB) & 0x3;
+    bool writeback_begin = false;
+    bool completed = false;
+
+    switch (ring_state) {
+        case RING_IDLE: {
+            uint32_t size = ring_size.read().to_uint();
+            if (!enable.read()) {
+                head = 0;
+            } else if (size != 0 && head != ring_tail.read().to_uint() % size) {
+                // Fetch the descriptor at HEAD
+                desc_addr = ring_base.read().to_uint64() + (uint64_t)head * RING_DESC_BYTES;
+                beats_received = 0;
+                fetch_error = false;
+                M_AXI_ARADDR.write((sc_dt::sc_uint<32>)(desc_addr & 0xFFFFFFFF));
+                M_AXI_ARVALID.write(true);
+                M_AXI_RREADY.write(true);
+                bus_owner.write(true);
+                ring_state = RING_FETCH;
+                SOLE_TRACE(EV_RING_FETCH, head, (uint32_t)(desc_addr & 0xFFFFFFFF));
+            }
+            break;
+        }
+
+        case RING_FETCH:
+            if (M_AXI_ARVALID.read() && M_AXI_ARREADY.read()) {
+                M_AXI_ARVALID.write(false);
+            }
+            if (M_AXI_RVALID.read() && M_AXI_RREADY.read()) {
+                axi_data_t beat = M_AXI_RDATA.read();
+                for (unsigned k = 0; k < RING_BEAT_WORDS && beats_received * RING_BEAT_WORDS + k < RING_DESC_BYTES / 8; k++) {
+                    desc[beats_received * RING_BEAT_WORDS + k] = beat_word(beat, k);
+                }
+                fetch_error |= (M_AXI_RRESP.read() != 0x0);
+                beats_received++;
+            }
+            if (beats_received == RING_DESC_BEATS) {
+                M_AXI_RREADY.write(false);
+                bus_owner.write(false);
+                job_cycles = 0;
+                if (fetch_error) {
+                    completion_status = (1u << STAT_ERROR_BIT) | ((uint32_t)ERR_AXI_READ_ERROR << STAT_ERROR_CODE_LSB);
+                    writeback_begin = true;
+                } else {
+                    // One packed row per descriptor; flags use the REG_CONTROL layout
+                    job_src.write(desc[0]);
+                    job_dst.write(desc[1]);
+                    job_length.write(desc[2] & 0xFFFFFFFF);
+                    job_flags.write((uint32_t)(desc[2] >> 32));
+                    job_start.write(true);
+                    ring_state = RING_START;
+                }
+            }
+            break;
+
+        case RING_START:
+            job_cycles++;
+            if (engine_error) {
+                // Rejected at START (e.g. zero length)
+                job_start.write(false);
+                completion_status = status & 0xF8;
+                writeback_begin = true;
+            } else if (engine_state != STATE_IDLE) {
+                job_start.write(false);
+                ring_state = RING_RUN;
+            }
+            break;
+
+        case RING_RUN:
+            job_cycles++;
+            if (engine_done) {
+                completion_status = 1u << STAT_DONE_BIT;
+                writeback_begin = true;
+            } else if (engine_error) {
+                completion_status = status & 0xF8;
+                writeback_begin = true;
+            }
+            break;
+
+        case RING_WRITEBACK:
+            if (M_AXI_AWVALID.read() && M_AXI_AWREADY.read()) {
+                M_AXI_AWVALID.write(false);
+                aw_done = true;
+            }
+            if (M_AXI_WVALID.read() && M_AXI_WREADY.read()) {
+                M_AXI_WVALID.write(false);
+                w_done = true;
+            }
+            if (aw_done && w_done && M_AXI_BVALID.read() && M_AXI_BREADY.read()) {
+                M_AXI_BREADY.write(false);
+                bus_owner.write(false);
+                head = (head + 1) % std::max(ring_size.read().to_uint(), 1u);
+                completed = true;
+                ring_state = RING_IDLE;
+                SOLE_TRACE(EV_RING_COMPLETE, head, completion_status, job_cycles);
+            }
+            break;
+    }
+
+    // Entering WRITEBACK: address and data of the completion beat
+    if (writeback_begin) {
+        desc[RING_DESC_COMPLETION_WORD] = ((uint64_t)job_cycles << RING_CPL_CYCLES_LSB) |
+                                          (1u << RING_CPL_COMPLETE_BIT) | completion_status;
+        axi_data_t beat = 0;
+        beat_set_word(beat, completion_lane_word, desc[RING_DESC_COMPLETION_WORD]);
+        aw_done = false;
+        w_done = false;
+        M_AXI_AWADDR.write((sc_dt::sc_uint<32>)((desc_addr + (uint64_t)completion_beat * AXI_BEAT_BYTES) & 0xFFFFFFFF));
+        M_AXI_AWVALID.write(true);
+        M_AXI_WDATA.write(beat);
+        M_AXI_WVALID.write(true);
+        M_AXI_BREADY.write(true);
+        bus_owner.write(true);
+        ring_state = RING_WRITEBACK;
+    }
+
+    ring_head.write(head);
+    job_complete.write(completed);
+    busy.write(ring_state != RING_IDLE);
+}
@@ -1,4 +1,5 @@
 #include "Divider.h"
+#include "Profile.hpp"
 
 /**
  * @brief Compute the divider operation
@@ -11,20 +12,16 @@
  * 
  * FP16 format: [sign(15) | exponent(14:10) | mantissa(9:0)]
  */
-void Divider_Module::compute_divider() {
-    sc_uint4 ky_val = ky.read();
-    sc_uint4 ks_val = ks.read();
-    sc_uint16 mux_result = Mux_Result.read();
-    
+sc_uint16 divider_fp16(sc_uint4 ky_val, sole_ks_t ks_val, sc_uint16 mux_result) {
     // Step 1: Calculate difference (ky + ks)
-    // Both are 4-bit, so we need to handle signed arithmetic
+    // ky is 4-bit and ks is 5-bit, so we need to handle signed arithmetic
     // Cast to signed integers for proper subtraction
     int ky_signed = (int)ky_val.to_uint();
     int ks_signed = (int)ks_val.to_uint();
     int right_shift = ky_signed + ks_signed;
     
     // Step 2: Extract exponent from FP16 (bits 14:10)
-    sc_uint<5> exponent = mux_result.range(14, 10);
+    sole_uint<5> exponent = mux_result.range(14, 10);
     int exp_val = (int)exponent.to_uint();
     
     // Step 3: Calculate new exponent with saturation
@@ -39,13 +36,17 @@ void Divider_Module::compute_divider() {
     }
     
     // Step 4: Extract other components of FP16
-    sc_uint<1> sign = (bool)mux_result[15];
-    sc_uint<10> mantissa = mux_result.range(9, 0);
+    sole_uint<1> sign = (bool)mux_result[15];
+    sole_uint<10> mantissa = mux_result.range(9, 0);
     
     // Step 5: Reconstruct FP16 with new exponent
     // [sign(15) | exponent(14:10) | mantissa(9:0)]
-    sc_uint<16> output_val;
-    output_val = (sign, (sc_uint<5>)new_exp_val, mantissa);
+    sc_uint16 output_val = (sign.to_uint() << 15) | ((unsigned)new_exp_val << 10) | mantissa.to_uint();
     
-    Divider_Output.write(sc_uint16(output_val));
+    return output_val;
+}
+
+void Divider_Module::compute_divider() {
+    SOLE_PROFILE_PROCESS();
+    Divider_Output.write(divider_fp16(ky.read(), ks.read(), Mux_Result.read()));
 }
@@ -1,36 +1,37 @@
 #include "Divider_PreCompute.h"
+#include "Profile.hpp"
 #include <cmath>
 #include <cstring>
 
 /**
- * @brief Find the position of the leading one bit in the integer part (bits 31-16)
+ * @brief Find the position of the leading one bit in the integer part (bits 47-16)
  * 
- * The 32-bit input consists of:
- *   - Bits 31-16: 16-bit integer part
+ * The 48-bit input consists of:
+ *   - Bits 47-16: 32-bit integer part
  *   - Bits 15-0: 16-bit decimal part
  * 
- * Scans bits 31 down to 16 to find the first '1' bit in the integer part.
- * Returns the bit position relative to bit 16 (0-15 range).
+ * Scans bits 47 down to 16 to find the first '1' bit in the integer part.
+ * Returns the bit position relative to bit 16 (0-31 range).
  * If the integer part is all zeros, returns 0.
  */
-sc_uint4 find_leading_one_pos(sc_uint32 input) {
-    uint32_t val = input.to_uint();
+sole_ks_t find_leading_one_pos(sole_sum_t input) {
+    uint64_t val = input.to_uint64();
     
-    // Extract the integer part (bits 31-16)
-    uint32_t integer_part = (val >> 16) & 0xFFFF;
+    // Extract the integer part (bits 47-16)
+    uint32_t integer_part = (uint32_t)((val >> 16) & 0xFFFFFFFF);
     // If integer part is 0, return 0
     if (integer_part == 0) {
-        return sc_uint4(0);
+        return sole_ks_t(0);
     }
     
     // Find the position of the most significant bit set to 1 in the integer part
-    // Scan from bit 15 down to bit 0 of the integer part
-    for (int i = 15; i >= 0; i--) {
+    // Scan from bit 31 down to bit 0 of the integer part
+    for (int i = 31; i >= 0; i--) {
         if ((integer_part >> i) & 1) {
-            return sc_uint4(i);
+            return sole_ks_t(i);
         }
     }
-    return sc_uint4(0);
+    return sole_ks_t(0);
 }
 
 
@@ -43,13 +44,11 @@ sc_uint4 find_leading_one_pos(sc_uint32 input) {
  * 3. If leading_pos == 0: Extracts the first decimal place (bit 15 of decimal part)
  * 4. Selects threshold value based on that bit
  */
-void Divider_PreCompute_Module::compute_threshold() {
-    sc_uint32 input_val = input.read();
-    uint32_t val = input_val.to_uint();
+sc_uint16 divider_threshold(sole_sum_t input_val) {
+    uint64_t val = input_val.to_uint64();
     
     // Step 1: Find the leading one position
-    sc_uint4 leading_pos = find_leading_one_pos(input_val);
-    Leading_One_Pos.write(leading_pos);
+    sole_ks_t leading_pos = find_leading_one_pos(input_val);
     
     // Step 2: Extract the bit to determine Is_Over_Half
     sc_uint1 is_over_half;
@@ -70,5 +69,12 @@ void Divider_PreCompute_Module::compute_threshold() {
         threshold = sc_uint16(0x388B);
     }
     
-    Mux_Result.write(threshold);
+    return threshold;
+}
+
+void Divider_PreCompute_Module::compute_threshold() {
+    SOLE_PROFILE_PROCESS();
+    sole_sum_t input_val = input.read();
+    Leading_One_Pos.write(find_leading_one_pos(input_val));
+    Mux_Result.write(divider_threshold(input_val));
 }
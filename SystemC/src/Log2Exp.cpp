@@ -1,4 +1,5 @@
 #include "Log2Exp.h"
+#include "Profile.hpp"
 #include <iostream>
 #include <bitset>
 #include <iomanip>
@@ -6,15 +7,20 @@
 
 
 
-void Log2Exp::process() {
+/**
+ * @brief Log2Exp datapath: FP16 difference -> 4-bit power-of-two exponent
+ *
+ * Shared by the Log2Exp module and the transaction-level SOLE model.
+ */
+sc_uint4 log2exp_fp16(sc_uint16 fp16_in_val) {
     // =======================================================================
     // Step 1: Extract FP16 components
     // FP16 format: [Sign(1)] [Exponent(5 bits)] [Mantissa(10 bits)]
     // Exponent range: 0-31, with bias of 15
     // =======================================================================
-    sc_dt::sc_uint<16> fp16_val = fp16_in.read();
-    sc_dt::sc_uint<5> exp_bits = fp16_val.range(14, 10);
-    sc_dt::sc_uint<10> mant_bits = fp16_val.range(9, 0);  
+    sole_uint<16> fp16_val = fp16_in_val;
+    sole_uint<5> exp_bits = fp16_val.range(14, 10);
+    sole_uint<10> mant_bits = fp16_val.range(9, 0);  
     int exponent_val = (int)exp_bits.to_uint();  // FP16 exponent value (0-31)
 
     // =======================================================================
@@ -22,19 +28,19 @@ void Log2Exp::process() {
     // Fixed-point format Q1.4: 1 integer bit + 4 fractional bits
     // Result: [implicit_1(1)] [mant_bits(10)] [padding(4)] = 18 bits total
     // =======================================================================
-    sc_dt::sc_uint<4> one_bits = 1;
-    sc_dt::sc_uint<4> zero_bits = 0;
-    sc_uint<18> mant_val = ((one_bits.to_uint() << 14) | (mant_bits.to_uint() << 4)) & 0x3FFFF;
-    sc_uint<18> op1 = mant_val;                                     
-    sc_uint<18> op2 = (mant_val >> 1) ;                             
-    sc_uint<18> op3 = (mant_val >> 4) ;                             
+    sole_uint<4> one_bits = 1;
+    sole_uint<4> zero_bits = 0;
+    sole_uint<18> mant_val = ((one_bits.to_uint() << 14) | (mant_bits.to_uint() << 4)) & 0x3FFFF;
+    sole_uint<18> op1 = mant_val;                                     
+    sole_uint<18> op2 = (mant_val >> 1) ;                             
+    sole_uint<18> op3 = (mant_val >> 4) ;                             
     
     // =======================================================================
     // Step 3: Sum the three operations
     // Compute: op1 + op2 - op3
     // This approximates the logarithmic function for the mantissa
     // =======================================================================
-    sc_uint<18> sum = op1 + op2 - op3;
+    sole_uint<18> sum = op1 + op2 - op3;
 
     // =======================================================================
     // Step 4: Apply exponent shift
@@ -45,7 +51,7 @@ void Log2Exp::process() {
     // =======================================================================
     int actual_exp_val = exponent_val - 15;
     
-    sc_uint<18> shifted_value;
+    sole_uint<18> shifted_value;
     if (actual_exp_val <= 0) {
         // If actual exponent is negative or zero, shift RIGHT (move decimal point left)
         shifted_value = (sum >> (-actual_exp_val));
@@ -59,7 +65,7 @@ void Log2Exp::process() {
     // Extract bits [17:14] to get 4-bit integer result
     // These bits represent the integer portion after fixed-point operations
     // =======================================================================
-    sc_dt::sc_uint<4> shift_res = shifted_value.range(17, 14).to_uint();  // Extract bits [17:14]
+    sole_uint<4> shift_res = shifted_value.range(17, 14).to_uint();  // Extract bits [17:14]
     
     // =======================================================================
     // Step 6: Multiplexer logic - Select output based on exponent
@@ -68,7 +74,7 @@ void Log2Exp::process() {
     // exponent_val == 18 AND sum[15]==1: Output 0xF (transition boundary)
     // else: Output computed shift_res
     // =======================================================================
-    sc_dt::sc_uint<4> output;
+    sole_uint<4> output;
     if (exponent_val <= 13) {
         output = 0x0;  // 0000 - exponent too small
     } else if (exponent_val >= 19) {
@@ -79,5 +85,10 @@ void Log2Exp::process() {
         output = shift_res;  // Normal case: use computed result
     }
 
-    result_out.write(output);
+    return output;
+}
+
+void Log2Exp::process() {
+    SOLE_PROFILE_PROCESS();
+    result_out.write(log2exp_fp16(fp16_in.read()));
 }
@@ -1,4 +1,5 @@
 #include "MaxUnit.h"
+#include "Profile.hpp"
 #include "utils.hpp"
 #include <iomanip>
 #include <cstdint>
@@ -6,40 +7,62 @@
 /**
  * @brief Stage 1 Combinational Logic - Parallel FP16 Comparisons
  * 
- * Compares A vs B and C vs D in parallel using fp16_max function.
- * Results are stored in R1_next and R2_next, which will be latched
- * on the next clock edge.
+ * Reduces the inputs pairwise with fp16_max for MAXUNIT_STAGE1_LEVELS levels
+ * (A vs B and C vs D for 4 lanes). Results are stored in R_next[], which
+ * will be latched on the next clock edge.
  */
 void MaxUnit::stage1_comb_logic() {
-    R1_next.write(fp16_max(A.read(), B.read()));
-    R2_next.write(fp16_max(C.read(), D.read()));
+    SOLE_PROFILE_PROCESS();
+    sc_uint16 level[SOLE_LANES];
+    for (int i = 0; i < SOLE_LANES; i++) {
+        level[i] = In[i].read();
+    }
+    for (int n = SOLE_LANES; n > MAXUNIT_REGS; n /= 2) {
+        for (int i = 0; i < n / 2; i++) {
+            level[i] = fp16_max(level[2 * i], level[2 * i + 1]);
+        }
+    }
+    for (int i = 0; i < MAXUNIT_REGS; i++) {
+        R_next[i].write(level[i]);
+    }
 }
 
 /**
  * @brief Stage 1 Register Update - Clock-driven Update
  * 
- * Updates pipeline registers R1_reg and R2_reg on positive clock edge.
+ * Updates pipeline registers R_reg[] on positive clock edge.
  * On reset (rst=1), registers are cleared to 0.
  * Otherwise, registers capture the combinational logic outputs.
  */
 void MaxUnit::stage1_register_update() {
-    if (rst.read()) {   // Reset
-        R1_reg.write(0);
-        R2_reg.write(0);
-    } else { 
-        R1_reg.write(R1_next.read());
-        R2_reg.write(R2_next.read());
+    SOLE_PROFILE_PROCESS();
+    for (int i = 0; i < MAXUNIT_REGS; i++) {
+        if (rst.read()) {   // Reset
+            R_reg[i].write(0);
+        } else {
+            R_reg[i].write(R_next[i].read());
+        }
     }
 }
 
 /**
- * @brief Stage 2 Combinational Logic - Final Comparison
+ * @brief Stage 2 Combinational Logic - Final Comparisons
  * 
- * Compares the two pipeline register values to produce the final maximum.
+ * Reduces the pipeline register values pairwise down to the final maximum.
  * No latching occurs at this stage - output is combinational.
  */
 void MaxUnit::stage2_comb_logic() {
-    Max_Out.write(fp16_max(R1_reg.read(), R2_reg.read()));
+    SOLE_PROFILE_PROCESS();
+    sc_uint16 level[MAXUNIT_REGS];
+    for (int i = 0; i < MAXUNIT_REGS; i++) {
+        level[i] = R_reg[i].read();
+    }
+    for (int n = MAXUNIT_REGS; n > 1; n /= 2) {
+        for (int i = 0; i < n / 2; i++) {
+            level[i] = fp16_max(level[2 * i], level[2 * i + 1]);
+        }
+    }
+    Max_Out.write(level[0]);
 }
 /*
 void MaxUnit::Print_Stage_Regs() {
@@ -49,9 +72,9 @@ void MaxUnit::Print_Stage_Regs() {
 
         std::cerr << CYAN;
         std::cerr << "[MaxUnit Pipeline] @" << sc_time_stamp() << "\n";
-        std::cerr << " R1_reg: 0x" << std::hex << std::uppercase << std::setw(4) << std::setfill('0') 
-                  << static_cast<uint16_t>(R1_reg.read()) << "\n";
-        std::cerr << " R2_reg: 0x" << std::setw(4) << static_cast<uint16_t>(R2_reg.read()) << "\n";
+        std::cerr << " R_reg[0]: 0x" << std::hex << std::uppercase << std::setw(4) << std::setfill('0') 
+                  << static_cast<uint16_t>(R_reg[0].read()) << "\n";
+        std::cerr << " R_reg[1]: 0x" << std::setw(4) << static_cast<uint16_t>(R_reg[1].read()) << "\n";
         std::cerr << " Max_Out: 0x" << std::setw(4) << static_cast<uint16_t>(Max_Out.read()) << "\n";
         std::cerr << RESET << std::flush;
 
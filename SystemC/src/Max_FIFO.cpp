@@ -1,4 +1,5 @@
 #include "Max_FIFO.h"
+#include "Profile.hpp"
 #include <iomanip>
 #include <cstdint>
 #include <sstream>
@@ -13,6 +14,7 @@ static constexpr unsigned FIFO_ADDR_MASK = (1u << MAX_FIFO_ADDR_BITS) - 1u;
  * Full: (write_addr + 1) modulo FIFO depth == read_addr
  */
 void Max_FIFO::update_flags() {
+    SOLE_PROFILE_PROCESS();
     max_fifo_addr_t w_ptr = write_addr_sig.read();
     max_fifo_addr_t r_ptr = read_addr_sig.read();
     
@@ -35,6 +37,7 @@ void Max_FIFO::update_flags() {
  *   - If read_ready=1: Increment read_addr (modulo FIFO depth)
  */
 void Max_FIFO::pointer_update() {
+    SOLE_PROFILE_PROCESS();
     if (rst.read()) {
         // Reset both pointers to 0
         write_addr_sig.write(0);
@@ -58,6 +61,7 @@ void Max_FIFO::pointer_update() {
 }
 
 void Max_FIFO::count_update() {
+    SOLE_PROFILE_PROCESS();
     if (rst.read() || clear.read()) {
         count.write(0);
         return;
@@ -77,6 +81,7 @@ void Max_FIFO::count_update() {
 }
 
 void Max_FIFO::gate_signals() {
+    SOLE_PROFILE_PROCESS();
     // Keep write protection against full and continuously prefetch reads
     // while there is buffered capacity (skid + in-flight return < 2).
     // This keeps output data ready even when read_ready toggles.
@@ -99,6 +104,7 @@ void Max_FIFO::gate_signals() {
 }
 
 void Max_FIFO::output_pipeline_update() {
+    SOLE_PROFILE_PROCESS();
     if (rst.read() || clear.read()) {
         skid_reg_sig.write(0);
         skid_valid_sig.write(false);
@@ -138,6 +144,7 @@ void Max_FIFO::output_pipeline_update() {
  * Note: Data has 1-cycle latency due to SRAM pipeline register.
  */
 void Max_FIFO::read_output() {
+    SOLE_PROFILE_PROCESS();
     if (skid_valid_sig.read()) {
         data_out.write(skid_reg_sig.read());
     } else {
@@ -147,6 +154,7 @@ void Max_FIFO::read_output() {
 }
 
 void Max_FIFO::read_data_valid_flag() {
+    SOLE_PROFILE_PROCESS();
     read_valid.write(sram_output_data_valid.read() || skid_valid_sig.read());
 }
 
@@ -159,57 +167,16 @@ void Max_FIFO::Print_Push_Count() {
 }
 */
 void Max_FIFO::Print_FIFO_SRAM() {
+    SOLE_PROFILE_PROCESS();
     max_fifo_addr_t w_ptr = write_addr_sig.read();
     max_fifo_addr_t r_ptr = read_addr_sig.read();
-    std::cout << sc_time_stamp() << " " << "\033[35m" << "[MAX_FIFO] SRAM State (push order): " << std::endl;
+    SOLE_TRACE(EV_FIFO_MAX_STATE, w_ptr, r_ptr, count.read(), data_out.read());
+    SOLE_TRACE(EV_FIFO_MAX_SKID, skid_valid_sig.read(), skid_reg_sig.read());
 
-    // Compute occupancy (number of stored elements)
+    // Entries from read pointer up to (but not including) write pointer, in push order
     max_fifo_addr_t occ = w_ptr - r_ptr;
-    bool anyPrinted = false;
-    if (occ != 0) {
-        // Print entries from read pointer up to (but not including) write pointer
-        // Group output: five printed data entries per line.
-        unsigned printed_in_line = 0;
-        const std::size_t column_width = 26; // fixed width per entry including markers
-        for (unsigned k = 0; k < static_cast<unsigned>(occ); ++k) {
-            unsigned idx = (static_cast<unsigned>(r_ptr.to_uint()) + k) & FIFO_ADDR_MASK;
-            sc_uint16 data = sram->debug_peek(static_cast<int>(idx));
-
-            anyPrinted = true;
-
-            // Build the entry string, append markers, then pad to fixed width
-            std::ostringstream oss;
-            oss << "  [" << std::setw(3) << idx << "] 0x"
-                << std::hex << std::setw(4) << std::setfill('0') << static_cast<uint16_t>(data)
-                << std::dec << std::setfill(' ');
-
-            // Markers
-            if (idx == r_ptr.to_uint()) oss << " <-R";
-            if (idx == ((w_ptr.to_uint() + FIFO_ADDR_MASK) & FIFO_ADDR_MASK)) oss << " <-last";
-
-            std::string entry = oss.str();
-            if (entry.size() < column_width) entry.append(column_width - entry.size(), ' ');
-
-            std::cout << entry;
-
-            printed_in_line++;
-            if (printed_in_line >= 5) {
-                std::cout << std::endl;
-                printed_in_line = 0;
-            }
-        }
-
-        // If the last line wasn't terminated (fewer than 5 items), end it now
-        if (printed_in_line != 0) std::cout << std::endl;
-    }
-
-    if (!anyPrinted) {
-        std::cout << "  <no valid data>" << std::endl;
+    for (unsigned k = 0; k < static_cast<unsigned>(occ); ++k) {
+        unsigned idx = (static_cast<unsigned>(r_ptr.to_uint()) + k) & FIFO_ADDR_MASK;
+        SOLE_TRACE(EV_FIFO_MAX_ENTRY, idx, sram->debug_peek(static_cast<int>(idx)));
     }
-    std::cout << "data_out=0x" << std::hex << std::setw(4) << std::setfill('0') << static_cast<uint16_t>(data_out.read()) 
-              << " count=" << std::dec << count.read()
-              << " skid_valid=" << skid_valid_sig.read()
-              << " skid_reg=0x" << std::hex << std::setw(4) << std::setfill('0') << static_cast<uint16_t>(skid_reg_sig.read())
-              << std::dec << std::setfill(' ') << std::endl;
-    std::cout << "\033[0m";
 }
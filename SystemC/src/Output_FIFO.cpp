@@ -1,4 +1,5 @@
 #include "Output_FIFO.h"
+#include "Profile.hpp"
 #include <iomanip>
 #include <cstdint>
 #include <sstream>
@@ -13,6 +14,7 @@ static constexpr unsigned FIFO_ADDR_MASK = (1u << OUTPUT_FIFO_ADDR_BITS) - 1u;
  * Full: (write_addr + 1) % 1024 == read_addr
  */
 void Output_FIFO::update_flags() {
+    SOLE_PROFILE_PROCESS();
     output_fifo_addr_t w_ptr = write_addr_sig.read();
     output_fifo_addr_t r_ptr = read_addr_sig.read();
     
@@ -35,6 +37,7 @@ void Output_FIFO::update_flags() {
  *   - If read_en=1: Increment read_addr (modulo 1024)
  */
 void Output_FIFO::pointer_update() {
+    SOLE_PROFILE_PROCESS();
     if (rst.read()) {
         // Reset both pointers to 0
         write_addr_sig.write(0);
@@ -58,6 +61,7 @@ void Output_FIFO::pointer_update() {
 }
 
 void Output_FIFO::count_update() {
+    SOLE_PROFILE_PROCESS();
     if (rst.read() || clear.read()) {
         count.write(0);
         return;
@@ -83,6 +87,7 @@ void Output_FIFO::count_update() {
  * Note: Data has 1-cycle latency due to SRAM pipeline register.
  */
 void Output_FIFO::read_output() {
+    SOLE_PROFILE_PROCESS();
     if (skid_valid_sig.read()) {
         data_out.write(skid_reg_sig.read());
     } else {
@@ -91,6 +96,7 @@ void Output_FIFO::read_output() {
 }
 
 void Output_FIFO::gate_signals() {
+    SOLE_PROFILE_PROCESS();
     // Keep write protection against full and continuously prefetch reads
     // while there is buffered capacity (skid + in-flight return < 2).
     // This keeps output data ready even when read_ready toggles.
@@ -113,6 +119,7 @@ void Output_FIFO::gate_signals() {
 }
 
 void Output_FIFO::output_pipeline_update() {
+    SOLE_PROFILE_PROCESS();
     if (rst.read() || clear.read()) {
         skid_reg_sig.write(0);
         skid_valid_sig.write(false);
@@ -120,7 +127,7 @@ void Output_FIFO::output_pipeline_update() {
         return;
     }
 
-    sc_uint16 skid_reg_next = skid_reg_sig.read();
+    output_fifo_data_t skid_reg_next = skid_reg_sig.read();
     bool skid_valid_next = skid_valid_sig.read();
 
     const bool consume_skid = read_ready.read() && skid_valid_next;
@@ -130,7 +137,7 @@ void Output_FIFO::output_pipeline_update() {
 
     const bool new_data_valid = sram_output_data_valid.read();
     if (new_data_valid) {
-        const sc_uint16 new_data = sram_rdata_sig.read();
+        const output_fifo_data_t new_data = sram_rdata_sig.read();
         // Data can bypass directly only when there is no skid data and the
         // downstream consumes this cycle; otherwise retain it in skid.
         const bool bypass_consumed = read_ready.read() && !skid_valid_sig.read();
@@ -146,6 +153,7 @@ void Output_FIFO::output_pipeline_update() {
 }
 
 void Output_FIFO::read_data_valid_flag() {
+    SOLE_PROFILE_PROCESS();
     read_valid.write(sram_output_data_valid.read() || skid_valid_sig.read());
 }
 /*
@@ -1,4 +1,5 @@
 #include "PROCESS_1.h"
+#include "Profile.hpp"
 #include "utils.hpp"
 #include <cmath>
 #include <iostream>
@@ -19,20 +20,21 @@ static sc_uint16 fp16_subtract(sc_uint16 a_bits, sc_uint16 b_bits) {
 /**
  * @brief Stage 1 Combinational Logic
  * 
- * Captures 4 fp16 input values from the 64-bit input
+ * Captures SOLE_LANES fp16 input values from the AXI beat
  * - DataIn_unpacked[0] = bits [15:0]
  * - DataIn_unpacked[1] = bits [31:16]
- * - DataIn_unpacked[2] = bits [47:32]
- * - DataIn_unpacked[3] = bits [63:48]
+ * - ...
+ * - DataIn_unpacked[i] = bits [16i+15:16i]
  * Propagates data_valid flag from AXI read channel.
  * Generates Stage1_Next (Stage1_Data structure).
  */
 void PROCESS_1_Module::Stage1_Comb() {
-    sc_uint64 input = DataIn_64bits.read();
+    SOLE_PROFILE_PROCESS();
+    sole_beat_t input = DataIn_64bits.read();
     Stage1_Data stage1_data;
     
-    for (int i = 0; i < 4; i++) {
-        sc_uint16 unpacked = (input >> (i * 16)) & 0xFFFF;
+    for (int i = 0; i < SOLE_LANES; i++) {
+        sc_uint16 unpacked = sole_beat_lane(input, i);
         DataIn_unpacked[i].write(unpacked);     //for maxunit input
         stage1_data.DataIn[i] = unpacked;
     }
@@ -45,16 +47,17 @@ void PROCESS_1_Module::Stage1_Comb() {
 /**
  * @brief Stage 2 Combinational Logic
  * 
- * Combines Maximum value from MaxUnit with DataIn[4] values.
+ * Combines Maximum value from MaxUnit with DataIn[SOLE_LANES] values.
  * Propagates data_valid flag from Stage1.
  * Generates Stage2_Next (Stage2_Data structure).
  */
 void PROCESS_1_Module::Stage2_Comb() {
+    SOLE_PROFILE_PROCESS();
     Stage1_Data stage1_data = Stage1_Reg.read();
     Stage2_Data stage2_data;
     
     // Copy DataIn values from Stage1_Reg
-    for (int i = 0; i < 4; i++) {
+    for (int i = 0; i < SOLE_LANES; i++) {
         stage2_data.DataIn[i] = stage1_data.DataIn[i];
     }
     
@@ -76,25 +79,26 @@ void PROCESS_1_Module::Stage2_Comb() {
 /**
  * @brief Stage 3 Combinational Logic
  * 
- * Computes 5 fp16 differences:
- * - diff[0..3]: DataIn[i] - Max_Out
- * - diff[4]: Max_Out - Global_Max
+ * Computes SOLE_LANES+1 fp16 differences:
+ * - diff[0..SOLE_LANES-1]: DataIn[i] - Max_Out
+ * - diff[SOLE_LANES]: Max_Out - Global_Max
  * Propagates data_valid flag from Stage2.
  * Generates Stage3_Next (Stage3_Data structure).
  */
 void PROCESS_1_Module::Stage3_Comb() {
+    SOLE_PROFILE_PROCESS();
     Stage2_Data stage2_data = Stage2_Reg.read();
     sc_uint16 global_max = Global_Max.read();
     Stage3_Data stage3_data;
     
-    // Compute 4 differences: DataIn[i] - Max_Out
-    for (int i = 0; i < 4; i++) {
+    // Compute SOLE_LANES differences: DataIn[i] - Max_Out
+    for (int i = 0; i < SOLE_LANES; i++) {
         sc_uint16 datain = stage2_data.DataIn[i];
         stage3_data.diff[i] = fp16_subtract(datain, stage2_data.Max_Out);
     }
     
     // Compute Max_Out - Global_Max
-    stage3_data.diff[4] = fp16_subtract(stage2_data.Max_Out, global_max);
+    stage3_data.diff[SOLE_LANES] = fp16_subtract(stage2_data.Max_Out, global_max);
     
     // Propagate data_valid from Stage2
     stage3_data.data_valid = stage2_data.data_valid;
@@ -105,22 +109,23 @@ void PROCESS_1_Module::Stage3_Comb() {
 /**
  * @brief Stage 4 Combinational Logic 
  * 
- * Routes the 5 fp16 differences from Stage3_Reg to Log2Exp module inputs.
- * Collects 5 4-bit outputs from Log2Exp modules.
+ * Routes the SOLE_LANES+1 fp16 differences from Stage3_Reg to Log2Exp module inputs.
+ * Collects SOLE_LANES+1 4-bit outputs from Log2Exp modules.
  * Propagates data_valid flag from Stage3.
  * Generates Stage4_Next (Stage4_Data structure with Log2Exp outputs).
  */
 void PROCESS_1_Module::Stage4_Comb() {
+    SOLE_PROFILE_PROCESS();
     
     // Route each fp16 difference to the corresponding Log2Exp input
     Stage3_Data stage3_data = Stage3_Reg.read();
-    for (int i = 0; i < 5; i++) {
+    for (int i = 0; i <= SOLE_LANES; i++) {
         log2exp_in[i].write(stage3_data.diff[i]);
     }
     
     // Note: Log2Exp outputs are combinational, so we read them here for Stage4_Next
     Stage4_Data stage4_data;
-    for (int i = 0; i < 5; i++) {
+    for (int i = 0; i <= SOLE_LANES; i++) {
         stage4_data.power[i] = log2exp_out[i].read();
     }
     
@@ -133,34 +138,36 @@ void PROCESS_1_Module::Stage4_Comb() {
 /**
  * @brief Stage 5 Combinational Logic 
  * 
- * Packs the 4 4-bit exponents (from power[0..3]) into a 16-bit vector:
+ * Packs the SOLE_LANES 4-bit exponents (from power[0..SOLE_LANES-1]) into a
+ * 4*SOLE_LANES-bit vector (16 bits for 4 lanes):
  * - bits [3:0]   = power[0]
  * - bits [7:4]   = power[1]
- * - bits [11:8]  = power[2]
- * - bits [15:12] = power[3]
+ * - ...
+ * - bits [4i+3:4i] = power[i]
  * 
  * Connects packed power vector to Reduction module input.
- * Extracts the 5th 4-bit value (power[4]) as right shift amount.
+ * Extracts the last 4-bit value (power[SOLE_LANES]) as right shift amount.
  * Propagates data_valid flag from Stage4.
  * Generates Stage5_Next (Stage5_Data structure).
  */
 void PROCESS_1_Module::Stage5_Comb() {
+    SOLE_PROFILE_PROCESS();
     Stage4_Data stage4_data = Stage4_Reg.read();
 
-    // Pack 4 4-bit values into 16-bit power vector
-    sc_uint16 packed = 0;
-    for (int i = 0; i < 4; i++) {
-        sc_uint16 temp = (sc_uint16)(stage4_data.power[i].to_uint());
+    // Pack SOLE_LANES 4-bit values into the power vector
+    sole_power_vector_t packed = 0;
+    for (int i = 0; i < SOLE_LANES; i++) {
+        sole_power_vector_t temp = (sole_power_vector_t)(stage4_data.power[i].to_uint());
         packed = packed | (temp << (i * 4));
     }
 
     // Connect packed power vector to Reduction module input
     Reduction_In.write(packed);
     
-    // Extract the 5th 4-bit value as right shift amount
+    // Extract the last 4-bit value as right shift amount
     Stage5_Data stage5_data;
     stage5_data.Power_of_Two_Vector = packed;
-    stage5_data.Right_Shift_Num = stage4_data.power[4];
+    stage5_data.Right_Shift_Num = stage4_data.power[SOLE_LANES];
     
     // Propagate data_valid from Stage4
     stage5_data.data_valid = stage4_data.data_valid;
@@ -179,10 +186,11 @@ void PROCESS_1_Module::Stage5_Comb() {
  * Stage5_Reg <= Stage5_Next
  */
 void PROCESS_1_Module::Pipeline_Update() {
+    SOLE_PROFILE_PROCESS();
     if (rst.read()) {
         // Reset stage 1 Pipline
         Stage1_Data reset_data1;
-        for (int i = 0; i < 4; i++) {
+        for (int i = 0; i < SOLE_LANES; i++) {
             reset_data1.DataIn[i] = 0;
         }
         reset_data1.data_valid = false;
@@ -190,21 +198,21 @@ void PROCESS_1_Module::Pipeline_Update() {
         // Reset stage 2 Pipline
         Stage2_Data reset_data2;
         reset_data2.Max_Out = 0;
-        for (int i = 0; i < 4; i++) {
+        for (int i = 0; i < SOLE_LANES; i++) {
             reset_data2.DataIn[i] = 0;
         }
         reset_data2.data_valid = false;
         Stage2_Reg.write(reset_data2);
         // Reset stage 3 Pipline
         Stage3_Data reset_data3;
-        for (int i = 0; i < 5; i++) {
+        for (int i = 0; i <= SOLE_LANES; i++) {
             reset_data3.diff[i] = 0;
         }
         reset_data3.data_valid = false;
         Stage3_Reg.write(reset_data3);
         // Reset stage 4 Pipline
         Stage4_Data reset_data4;
-        for (int i = 0; i < 5; i++) {
+        for (int i = 0; i <= SOLE_LANES; i++) {
             reset_data4.power[i] = 0;
         }
         reset_data4.data_valid = false;
@@ -238,29 +246,22 @@ void PROCESS_1_Module::Pipeline_Update() {
  * 4. stage5_valid: From Stage5_Reg data_valid flag (Output_FIFO write enable)
  */
 void PROCESS_1_Module::Output_Comb() {
-    Stage1_Data stage1_data = Stage1_Reg.read();
+    SOLE_PROFILE_PROCESS();
     Stage5_Data stage5_data = Stage5_Reg.read();
     
-    // DEBUG: Track when validity signals are active
-    static sc_uint32 valid_active_count = 0;
-    static bool was_valid_prev = false;
-    bool stage1_v = stage1_data.data_valid;
-    bool stage5_v = stage5_data.data_valid;
-    bool is_valid = stage1_v || stage5_v;
-    
     // Output 1: Power_of_Two_Vector
     Power_of_Two_Vector.write(stage5_data.Power_of_Two_Vector);
     
     // Output 2: Sum_Buffer_Update
-    sc_uint32 sum_buffer_in = Sum_Buffer_In.read();
-    sc_uint32 reduction_output = Reduction_Output.read();
+    sole_sum_t sum_buffer_in = Sum_Buffer_In.read();
+    sole_sum_t reduction_output = Reduction_Output.read();
     uint32_t shift_val = stage5_data.Right_Shift_Num.to_uint();
     
     // Perform right shift
-    sc_uint32 shifted_value = sum_buffer_in >> shift_val;
+    sole_sum_t shifted_value = sum_buffer_in >> shift_val;
     
     // Add the reduction output
-    sc_uint32 final_result = shifted_value + reduction_output;
+    sole_sum_t final_result = shifted_value + reduction_output;
     
     Sum_Buffer_Update.write(final_result);
     
@@ -1,4 +1,5 @@
 #include "PROCESS_2.h"
+#include "Profile.hpp"
 #include "utils.hpp"
 #include <cmath>
 #include <iomanip>
@@ -15,6 +16,7 @@
  * Latency: 0 ns (combinational)
  */
 void PROCESS_2_Module::Input_Comb() {
+    SOLE_PROFILE_PROCESS();
     Pre_Compute_In_Signal.write(Pre_Compute_In.read());
 }
 
@@ -30,8 +32,10 @@ void PROCESS_2_Module::Input_Comb() {
  * Latency: 0 ns (combinational)
  */
 void PROCESS_2_Module::Output_Comb() {
+    SOLE_PROFILE_PROCESS();
     Leading_One_Pos_Out.write(Output_Reg_Lo_Pos.read());
     Mux_Result_Out.write(Output_Reg_Mux_Result.read());
+    Output_Valid.write(Output_Reg_Valid.read());
 }
 
 /**
@@ -48,6 +52,10 @@ void PROCESS_2_Module::Output_Comb() {
  * - Else (stall_output=1): Registers retain their current values unchanged
  *   (pipeline hold - prevents further propagation of data)
  * 
+ * Output_Reg_Valid is set when the registers sample while Pre_Compute_Valid=1
+ * and cleared on reset or while Pre_Compute_Valid=0 (input not final yet);
+ * a hold keeps it unchanged.
+ * 
  * **Example Timeline:**
  * Cycle 0: Input=0x00010000, Stall=0 → Reg=1, Output=1
  * Cycle 1: Input=0x00020000, Stall=1 → Reg=1 (unchanged), Output=1
@@ -58,12 +66,19 @@ void PROCESS_2_Module::Output_Comb() {
  * Latency: Guarded by stall signal (0 or 1 cycle delay)
  */
 void PROCESS_2_Module::Output_Stall() {
+    SOLE_PROFILE_PROCESS();
     if (rst.read()) {
         // RESET: Force all output registers to initial state (0)
         Output_Reg_Lo_Pos.write(0);
         Output_Reg_Mux_Result.write(0);
-    } 
-    else if (enable.read() == false) {
+        Output_Reg_Valid.write(false);
+        return;
+    }
+    if (Pre_Compute_Valid.read() == false) {
+        // INPUT NOT FINAL: whatever the registers sample is not the result yet
+        Output_Reg_Valid.write(false);
+    }
+    if (enable.read() == false) {
         // ENABLE LOW: Module disabled, hold all outputs (stall)
         // Registers maintain current values (no write occurs)
     }
@@ -72,6 +87,9 @@ void PROCESS_2_Module::Output_Stall() {
         // stall_output=0 allows new data to propagate through the pipeline
         Output_Reg_Lo_Pos.write(Leading_One_Pos_Out_Signal.read());
         Output_Reg_Mux_Result.write(Mux_Result_Out_Signal.read());
+        if (Pre_Compute_Valid.read()) {
+            Output_Reg_Valid.write(true);
+        }
     }
     // STALL & ENABLE HIGH: else condition - registers maintain current values (no write occurs)
     // This prevents data propagation downstream when pipeline needs to be held
@@ -81,7 +99,7 @@ void PROCESS_2_Module::Print_Stage_Regs() {
     const char* YELLOW = "\033[36m";
     const char* RESET  = "\033[0m";
 
-    sc_uint4 lo_pos = Output_Reg_Lo_Pos.read();
+    sole_ks_t lo_pos = Output_Reg_Lo_Pos.read();
     sc_uint16 mux_result = Output_Reg_Mux_Result.read();
 
     std::cerr << YELLOW;
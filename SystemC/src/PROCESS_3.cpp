@@ -1,4 +1,5 @@
 #include "PROCESS_3.h"
+#include "Profile.hpp"
 #include "utils.hpp"
 #include <cmath>
 #include <iostream>
@@ -17,6 +18,7 @@ static sc_uint16 fp16_subtract(sc_uint16 a_bits, sc_uint16 b_bits) {
 }
 
 void PROCESS_3_Module::Stage1_Comb() {
+    SOLE_PROFILE_PROCESS();
     process3_pipeline::Stage1_Data stage1_data;
     sc_uint16 local_max = Local_Max.read();
     sc_uint16 global_max = Global_Max.read();
@@ -29,6 +31,7 @@ void PROCESS_3_Module::Stage1_Comb() {
 
 
 void PROCESS_3_Module::Stage2_Comb() {
+    SOLE_PROFILE_PROCESS();
     process3_pipeline::Stage1_Data stage1_data = Stage1_Reg.read();
     process3_pipeline::Stage2_Data stage2_data;
     stage2_data.Power = log2exp_out.read();
@@ -37,17 +40,18 @@ void PROCESS_3_Module::Stage2_Comb() {
 }
 
 void PROCESS_3_Module::Stage3_Comb() {
+    SOLE_PROFILE_PROCESS();
     process3_pipeline::Stage2_Data stage2_data = Stage2_Reg.read();
     sc_uint16 Mux_Result = Mux_Result_In.read();
-    sc_uint4 ks = ks_In.read();
-    sc_uint16 ky_4 = Output_Buffer_In.read();
+    sole_ks_t ks = ks_In.read();
+    sole_power_vector_t ky_packed = Output_Buffer_In.read();
 
     process3_pipeline::Stage3_Data stage3_data;
     stage3_data.Mux_Result = Mux_Result;
     stage3_data.ks = ks;
     stage3_data.data_valid = stage2_data.data_valid;  // Propagate validity from Stage2
-    for (int i = 0; i < 4; i++) {
-        sc_uint4 ky = ky_4.range(i*4+3, i*4);
+    for (int i = 0; i < SOLE_LANES; i++) {
+        sc_uint4 ky = ky_packed.range(i*4+3, i*4);
         // Extend to 5-bit for addition, then clamp to 0-15
         sc_uint5 sum = ((sc_uint5)stage2_data.Power) + ((sc_uint5)ky);
         
@@ -62,6 +66,7 @@ void PROCESS_3_Module::Stage3_Comb() {
 
 
 void PROCESS_3_Module::Pipeline_Update() {
+    SOLE_PROFILE_PROCESS();
     if (rst.read()) {
         // Reset all pipeline stages
         process3_pipeline::Stage1_Data reset_data1;
@@ -78,7 +83,7 @@ void PROCESS_3_Module::Pipeline_Update() {
         reset_data3.Mux_Result = 0;
         reset_data3.ks = 0;
         reset_data3.data_valid = false;
-        for (int i = 0; i < 4; i++) {
+        for (int i = 0; i < SOLE_LANES; i++) {
             reset_data3.ky[i] = 0;
         }
         Stage3_Reg.write(reset_data3);
@@ -109,13 +114,12 @@ void PROCESS_3_Module::Pipeline_Update() {
 
 
 void PROCESS_3_Module::Stage4_Comb() {
+    SOLE_PROFILE_PROCESS();
     process3_pipeline::Stage4_Data stage4_data;
     Stage3_Data stage3_data = Stage3_Reg.read();
-    sc_uint64 packed = 0;
-    for (int i = 0; i < 4; i++) {
-        sc_uint16 divider_out = Divider_Output[i].read();
-        sc_uint64 temp = (sc_uint64)(divider_out.to_uint());
-        packed = packed | (temp << (i * 16));
+    sole_beat_t packed = 0;
+    for (int i = 0; i < SOLE_LANES; i++) {
+        sole_beat_set_lane(packed, i, (uint16_t)Divider_Output[i].read().to_uint());
     }
     stage4_data.Output = packed;
     stage4_data.data_valid = stage3_data.data_valid;  // Propagate validity from Stage3
@@ -123,47 +127,51 @@ void PROCESS_3_Module::Stage4_Comb() {
 }
 
 void PROCESS_3_Module::Output_Comb() {
+    SOLE_PROFILE_PROCESS();
     Stage4_Data stage4_data = Stage4_Reg.read();
     Output_Vector.write(stage4_data.Output);
     stage4_valid.write(stage4_data.data_valid);
 }
 
 void PROCESS_3_Module::Extract_Stage1_Data() {
+    SOLE_PROFILE_PROCESS();
     process3_pipeline::Stage1_Data stage1_data = Stage1_Reg.read();
     // Pass Stage1_Reg.Sub_Result (sc_uint16) directly to Log2Exp input
     stage1_sub_result_sig.write(stage1_data.Sub_Result);
 }
 
 void PROCESS_3_Module::Extract_Stage3_Data() {
+    SOLE_PROFILE_PROCESS();
     process3_pipeline::Stage3_Data stage3_data = Stage3_Reg.read();
     // Convert Stage3_Reg members to correct types for Divider inputs
     // Note: Divider expects sc_uint types, not sc_bv
     stage3_mux_result_sig.write(stage3_data.Mux_Result);
     stage3_ks_sig.write(stage3_data.ks);
-    for (int i = 0; i < 4; i++) {
+    stage3_valid.write(stage3_data.data_valid);
+    for (int i = 0; i < SOLE_LANES; i++) {
         stage3_ky_sig[i].write(stage3_data.ky[i]);
     }
 }
 
-// Print all pipeline stage registers on clock edge in yellow
+// Trace all pipeline stage registers on clock edge
 void PROCESS_3_Module::Print_Stage_Regs() {
+    SOLE_PROFILE_PROCESS();
     if(enable.read())
     {
-        const char* YELLOW = "\033[33m";
-        const char* RESET  = "\033[0m";
-
         auto s1 = Stage1_Reg.read();
         auto s2 = Stage2_Reg.read();
         auto s3 = Stage3_Reg.read();
         auto s4 = Stage4_Reg.read();
 
-        std::cerr << YELLOW;
-        std::cerr << "[PIPELINE DUMP] (Process3) @" << sc_time_stamp() << "\n";
-        std::cerr << " Stage1: " << s1 << "\n";
-        std::cerr << " Stage2: " << s2 << "\n";
-        std::cerr << " Stage3: " << s3 << "\n";
-        std::cerr << " Stage4: " << s4 << "\n";
-        //std::cerr << " Output_Vector: " << Output_Vector.read() << "\n";
-        std::cerr << RESET << std::flush;
+        uint64_t ky_packed = 0;
+        for (int i = 0; i < SOLE_LANES; i++) {
+            ky_packed |= (uint64_t)s3.ky[i].to_uint() << (4 * i);
+        }
+
+        SOLE_TRACE(EV_PIPE_P3_STAGE1, s1.data_valid, s1.Sub_Result);
+        SOLE_TRACE(EV_PIPE_P3_STAGE2, s2.data_valid, s2.Power);
+        SOLE_TRACE(EV_PIPE_P3_STAGE3, s3.data_valid, s3.Mux_Result, s3.ks, ky_packed);
+        // Wide beats trace their low four lanes
+        SOLE_TRACE(EV_PIPE_P3_STAGE4, s4.data_valid, s4.Output.to_uint64());
     }
 }
@@ -1,21 +1,23 @@
 #include "Reduction.h"
+#include "Profile.hpp"
 #include <cmath>
 #include <iomanip>
 
 /**
- * @brief Compute exponential values for each of the 4 inputs
+ * @brief Compute exponential values for each of the SOLE_LANES inputs
  * 
- * Extracts 4 signed 4-bit values from the 16-bit Input_Vector and computes
+ * Extracts SOLE_LANES signed 4-bit values from Input_Vector and computes
  * 2^(-x_i) for each. Results are stored in exp_out[] signals.
  * 
- * Input packing: bits [3:0]=x0, [7:4]=x1, [11:8]=x2, [15:12]=x3
+ * Input packing: bits [3:0]=x0, [7:4]=x1, [11:8]=x2, [15:12]=x3, ...
  */
 void Reduction_Module::compute_exponentials() {
-    sc_dt::sc_uint<16> input_vec = Input_Vector.read();
+    SOLE_PROFILE_PROCESS();
+    sole_power_vector_t input_vec = Input_Vector.read();
     
-    // Extract 4 signed 4-bit values from the 16-bit input
-    for (int i = 0; i < 4; i++) {
-        sc_dt::sc_uint<4> power = input_vec.range(i*4 + 3, i*4);
+    // Extract the signed 4-bit values from the packed input
+    for (int i = 0; i < SOLE_LANES; i++) {
+        sole_uint<4> power = input_vec.range(i*4 + 3, i*4);
     
         // Compute 2^(-x_i) and store in exp_out[i]
         sc_uint32 exp_value = 0x00010000 >> power;
@@ -26,19 +28,26 @@ void Reduction_Module::compute_exponentials() {
 /**
  * @brief Stage 1: Parallel binary additions
  * 
- * Performs two parallel 32-bit additions:
- * - stage1_add0 = exp_out[0] + exp_out[1]
- * - stage1_add1 = exp_out[2] + exp_out[3]
+ * Adds the exponentials pairwise for REDUCTION_STAGE1_LEVELS levels,
+ * for 4 lanes:
+ * - stage1_add[0] = exp_out[0] + exp_out[1]
+ * - stage1_add[1] = exp_out[2] + exp_out[3]
  */
 void Reduction_Module::stage1_additions() {
-    sc_uint32 exp0 = exp_out[0].read();
-    sc_uint32 exp1 = exp_out[1].read();
-    sc_uint32 exp2 = exp_out[2].read();
-    sc_uint32 exp3 = exp_out[3].read();
+    SOLE_PROFILE_PROCESS();
+    sc_uint32 level[SOLE_LANES];
+    for (int i = 0; i < SOLE_LANES; i++) {
+        level[i] = exp_out[i].read();
+    }
     
-    // Perform two parallel additions
-    stage1_add0.write(exp0 + exp1);
-    stage1_add1.write(exp2 + exp3);
+    for (int n = SOLE_LANES; n > REDUCTION_REGS; n /= 2) {
+        for (int i = 0; i < n / 2; i++) {
+            level[i] = level[2 * i] + level[2 * i + 1];
+        }
+    }
+    for (int i = 0; i < REDUCTION_REGS; i++) {
+        stage1_add[i].write(level[i]);
+    }
 }
 
 /**
@@ -49,28 +58,35 @@ void Reduction_Module::stage1_additions() {
  * Resets on rst signal.
  */
 void Reduction_Module::pipeline_register_update() {
-    if (rst.read()) {
-        pipe_add0_reg.write(0);
-        pipe_add1_reg.write(0);
-    } else {
-        pipe_add0_reg.write(stage1_add0.read());
-        pipe_add1_reg.write(stage1_add1.read());
+    SOLE_PROFILE_PROCESS();
+    for (int i = 0; i < REDUCTION_REGS; i++) {
+        if (rst.read()) {
+            pipe_add_reg[i].write(0);
+        } else {
+            pipe_add_reg[i].write(stage1_add[i].read());
+        }
     }
 }
 
 /**
  * @brief Stage 2: Final binary addition
  * 
- * Performs the final 32-bit addition to reduce the two intermediate
- * sums to a single output.
- * 
- * final_sum = pipe_add0_reg + pipe_add1_reg
+ * Reduces the pipeline registers pairwise to a single output
+ * (final_sum = pipe_add_reg[0] + pipe_add_reg[1] for 4 lanes).
  */
 void Reduction_Module::stage2_addition() {
-    sc_uint32 add0 = pipe_add0_reg.read();
-    sc_uint32 add1 = pipe_add1_reg.read();
+    SOLE_PROFILE_PROCESS();
+    sc_uint32 level[REDUCTION_REGS];
+    for (int i = 0; i < REDUCTION_REGS; i++) {
+        level[i] = pipe_add_reg[i].read();
+    }
     
-    final_sum.write(add0 + add1);
+    for (int n = REDUCTION_REGS; n > 1; n /= 2) {
+        for (int i = 0; i < n / 2; i++) {
+            level[i] = level[2 * i] + level[2 * i + 1];
+        }
+    }
+    final_sum.write(level[0]);
 }
 
 /**
@@ -79,5 +95,6 @@ void Reduction_Module::stage2_addition() {
  * Propagates the final sum to the output port.
  */
 void Reduction_Module::update_output() {
+    SOLE_PROFILE_PROCESS();
     Output_Sum.write(final_sum.read());
 }
@@ -1,4 +1,5 @@
 #include "SOLE.h"
+#include "Profile.hpp"
 
 using namespace sole::mmio;
 
@@ -18,6 +19,9 @@ using namespace sole::mmio;
  * **Processor Access Permissions (MMIO Register File):**
  * - REG_CONTROL (0x00): Write-only to Processor (Softmax/Norm read-only)
  *   * Bit[0]: START signal for initiating computation
+ *   * Bit[15:8]: BURST_LEN, max AXI burst length - 1 (0 = single beat)
+ *   * Bit[23:16]: READ_OUTSTANDING, max AR bursts in flight (0 = 64)
+ *   * Bit[24]: REREAD, Bit[25]: RING (descriptor ring mode)
  *   * Bit[31]: MODE selection (0=SoftMax, 1=Norm)
  * - REG_STATUS (0x04): Read-only to Processor (Softmax/Norm write-only)
  *   * Bit[0]: DONE - operation completed
@@ -31,6 +35,13 @@ using namespace sole::mmio;
  *   * Lower 32-bits of 64-bit data length
  * - REG_LENGTH_H (0x14): Write-only to Processor (Softmax/Norm read-only)
  *   * Upper 32-bits of 64-bit data length
+ * - REG_ROW_COUNT (0x24): rows processed by one START (0 = 1)
+ * - REG_SRC_ROW_STRIDE / REG_DST_ROW_STRIDE (0x28 / 0x2C): row strides in bytes (0 = packed)
+ * - REG_RING_BASE_L/H, REG_RING_SIZE (0x30 / 0x34 / 0x38): descriptor ring address and size
+ * - REG_RING_TAIL (0x3C): producer index; the write is the ring doorbell
+ * - REG_RING_HEAD (0x40): Read-only, consumer index from the descriptor ring
+ * - REG_COMPLETED_JOBS (0x44): Read = completion counter, Write = acknowledge up to the value
+ * - REG_IRQ_COUNT_THRESHOLD / REG_IRQ_TIMEOUT_CYCLES (0x48 / 0x4C): interrupt coalescing
  * 
  * **Operation Flow:**
  * 1. Processor writes configuration (Control=start, Addr/Length) via writes
@@ -42,17 +53,55 @@ using namespace sole::mmio;
  * Register reads are performed combinationally based on current proc_addr and proc_we.
  */
 void SOLE::mmio_access_process() {
+    SOLE_PROFILE_PROCESS();
+    // Checkpoint restore: load the whole register file at once
+    if (restore_pending) {
+        reg_control.write(pending_registers.control);
+        reg_src_addr_base_l.write(pending_registers.src_addr_base_l);
+        reg_src_addr_base_h.write(pending_registers.src_addr_base_h);
+        reg_dst_addr_base_l.write(pending_registers.dst_addr_base_l);
+        reg_dst_addr_base_h.write(pending_registers.dst_addr_base_h);
+        reg_length_l.write(pending_registers.length_l);
+        reg_length_h.write(pending_registers.length_h);
+        reg_row_count.write(pending_registers.row_count);
+        reg_src_row_stride.write(pending_registers.src_row_stride);
+        reg_dst_row_stride.write(pending_registers.dst_row_stride);
+        reg_ring_base_l.write(pending_registers.ring_base_l);
+        reg_ring_base_h.write(pending_registers.ring_base_h);
+        reg_ring_size.write(pending_registers.ring_size);
+        reg_ring_tail.write(pending_registers.ring_tail);
+        reg_irq_count_threshold.write(pending_registers.irq_count_threshold);
+        reg_irq_timeout_cycles.write(pending_registers.irq_timeout_cycles);
+        reg_completed_ack.write(pending_registers.completed_ack);
+        restore_pending = false;
+    }
+
     // Extract register offset from lower 8 bits of proc_addr
     sc_uint8 reg_offset = proc_addr.read() & ADDR_OFFSET_MASK;
     
-    // DEBUG
-    static int debug_count = 0;
-    if (debug_count++ < 100) {
-        // MMIO access - removed verbose debug output
+    // Reset clears the register file (as SOLE.sv does), so a new run does not
+    // start from the previous run's length and addresses
+    if (rst.read()) {
+        reg_control.write(0);
+        reg_src_addr_base_l.write(0);
+        reg_src_addr_base_h.write(0);
+        reg_dst_addr_base_l.write(0);
+        reg_dst_addr_base_h.write(0);
+        reg_length_l.write(0);
+        reg_length_h.write(0);
+        reg_row_count.write(0);
+        reg_src_row_stride.write(0);
+        reg_dst_row_stride.write(0);
+        reg_ring_base_l.write(0);
+        reg_ring_base_h.write(0);
+        reg_ring_size.write(0);
+        reg_ring_tail.write(0);
+        reg_completed_ack.write(0);
+        reg_irq_count_threshold.write(0);
+        reg_irq_timeout_cycles.write(0);
     }
-    
     // Handle write operations (proc_we == 1)
-    if (proc_we.read() == true) {
+    else if (proc_we.read() == true) {
         sc_uint32 write_data = proc_wdata.read();
         
         // Register write - debug removed
@@ -108,6 +157,53 @@ void SOLE::mmio_access_process() {
             case REG_RESERVED:
                 // Reserved register - ignore write
                 break;
+
+            case REG_ROW_COUNT:
+                // Rows processed by one START (0 = 1)
+                reg_row_count.write(write_data);
+                break;
+
+            case REG_SRC_ROW_STRIDE:
+                reg_src_row_stride.write(write_data);
+                break;
+
+            case REG_DST_ROW_STRIDE:
+                reg_dst_row_stride.write(write_data);
+                break;
+
+            case REG_RING_BASE_L:
+                reg_ring_base_l.write(write_data);
+                break;
+
+            case REG_RING_BASE_H:
+                reg_ring_base_h.write(write_data);
+                break;
+
+            case REG_RING_SIZE:
+                reg_ring_size.write(write_data);
+                break;
+
+            case REG_RING_TAIL:
+                // Doorbell: the ring runs descriptors until HEAD reaches the new TAIL
+                reg_ring_tail.write(write_data);
+                break;
+
+            case REG_RING_HEAD:
+                // Read-only (owned by the descriptor ring) - ignore writes
+                break;
+
+            case REG_COMPLETED_JOBS:
+                // Acknowledge: completions up to this count no longer hold the coalesced interrupt
+                reg_completed_ack.write(write_data);
+                break;
+
+            case REG_IRQ_COUNT_THRESHOLD:
+                reg_irq_count_threshold.write(write_data);
+                break;
+
+            case REG_IRQ_TIMEOUT_CYCLES:
+                reg_irq_timeout_cycles.write(write_data);
+                break;
                 
             default:
                 // Invalid offset - no operation
@@ -145,6 +241,39 @@ void SOLE::mmio_access_process() {
         case REG_LENGTH_H:
             read_data = reg_length_h.read();
             break;
+        case REG_ROW_COUNT:
+            read_data = reg_row_count.read();
+            break;
+        case REG_SRC_ROW_STRIDE:
+            read_data = reg_src_row_stride.read();
+            break;
+        case REG_DST_ROW_STRIDE:
+            read_data = reg_dst_row_stride.read();
+            break;
+        case REG_RING_BASE_L:
+            read_data = reg_ring_base_l.read();
+            break;
+        case REG_RING_BASE_H:
+            read_data = reg_ring_base_h.read();
+            break;
+        case REG_RING_SIZE:
+            read_data = reg_ring_size.read();
+            break;
+        case REG_RING_TAIL:
+            read_data = reg_ring_tail.read();
+            break;
+        case REG_RING_HEAD:
+            read_data = ring_head.read();
+            break;
+        case REG_COMPLETED_JOBS:
+            read_data = reg_completed_jobs.read();
+            break;
+        case REG_IRQ_COUNT_THRESHOLD:
+            read_data = reg_irq_count_threshold.read();
+            break;
+        case REG_IRQ_TIMEOUT_CYCLES:
+            read_data = reg_irq_timeout_cycles.read();
+            break;
         case REG_RESERVED:
         default:
             // All other registers are write-only - return 0x0 on read
@@ -153,7 +282,7 @@ void SOLE::mmio_access_process() {
     }
     
     // Write read data to output port
-    proc_rdata.write(read_data);
+    proc_rdata.write(read_data.to_uint());
 
     // --- Status Update Logic ---
     sc_uint32 status = softmax_status.read();
@@ -192,6 +321,13 @@ void SOLE::mmio_access_process() {
  * - Base Address: {REG_ADDR_BASE_H, REG_ADDR_BASE_L}
  * - Data Length: {REG_LENGTH_H, REG_LENGTH_L}
  * 
+ * **Descriptor Ring (REG_CONTROL[25]):**
+ * Softmax takes START, addresses, length and the REG_CONTROL fields of the
+ * current descriptor from the ring (one packed row; START bit and row
+ * registers ignored). The ring drives the master ports while ring_bus_owner
+ * (descriptor fetch and completion write, Softmax idle); the slave side of
+ * every channel goes to both.
+ *
  * **AXI Master Signal Routing:**
  * When Mode=0 (SoftMax):
  * - Mirrors Softmax write address channel → M_AXI_AW*
@@ -208,30 +344,48 @@ void SOLE::mmio_access_process() {
  * - All SOLE Master response signals
  */
 void SOLE::demux_logic() {
+    SOLE_PROFILE_PROCESS();
     // Extract Mode and Start signals from Control register
     sc_uint32 ctrl = reg_control.read();
     
-    // DEBUG: Print control register value (removed for cleaner output)
-    static int debug_count = 0;
-    
+    bool ring_mode = (ctrl >> CTRL_RING_BIT) & 0x1;
     bool new_start = (ctrl >> CTRL_START_BIT) & 0x1;
-    start.write(new_start);
+    start.write(ring_mode ? ring_job_start.read() : new_start);
     mode.write((ctrl >> CTRL_MODE_BIT) & 0x1);
+    ring_enable.write(ring_mode);
     
     // Extract Mode and Start signals from Control register
     sc_uint64 src_addr = ((sc_uint64)reg_src_addr_base_h.read() << 32) | 
                          (sc_uint64)reg_src_addr_base_l.read();
-    src_addr_base.write(src_addr);
+    src_addr_base.write(ring_mode ? ring_job_src.read() : src_addr);
     
     // Construct 64-bit destination address from high and low 32-bits
     sc_uint64 dst_addr = ((sc_uint64)reg_dst_addr_base_h.read() << 32) | 
                          (sc_uint64)reg_dst_addr_base_l.read();
-    dst_addr_base.write(dst_addr);
+    dst_addr_base.write(ring_mode ? ring_job_dst.read() : dst_addr);
     
     // Construct 64-bit length from high and low 32-bits
     sc_uint64 length = ((sc_uint64)reg_length_h.read() << 32) | 
                        (sc_uint64)reg_length_l.read();
-    data_length.write(length);
+    data_length.write(ring_mode ? ring_job_length.read() : length);
+
+    // Job fields in the REG_CONTROL layout: the register, or the descriptor flags
+    sc_uint32 job_ctrl = ring_mode ? ring_job_flags.read() : ctrl;
+    // Max AXI burst length - 1 (AxLEN encoding); kept when START clears
+    burst_len.write((job_ctrl >> CTRL_BURST_LEN_LSB) & 0xFF);
+    // Max AR bursts in flight (0 = one per read ID)
+    read_outstanding.write((job_ctrl >> CTRL_READ_OUTSTANDING_LSB) & 0xFF);
+    // Two-pass re-read mode (always on above DATA_LENGTH_MAX)
+    reread.write((job_ctrl >> CTRL_REREAD_BIT) & 1);
+    // Batched rows: count and byte strides (0 = packed rows; a descriptor is one row)
+    row_count.write(ring_mode ? sc_uint32(0) : reg_row_count.read());
+    src_row_stride.write(ring_mode ? sc_uint32(0) : reg_src_row_stride.read());
+    dst_row_stride.write(ring_mode ? sc_uint32(0) : reg_dst_row_stride.read());
+
+    // Descriptor ring configuration
+    ring_base.write(((sc_uint64)reg_ring_base_h.read() << 32) | (sc_uint64)reg_ring_base_l.read());
+    ring_size.write(reg_ring_size.read());
+    ring_tail.write(reg_ring_tail.read());
     
 
     
@@ -241,22 +395,36 @@ void SOLE::demux_logic() {
         softmax_enable.write(start.read());
         // NOTE: softmax_busy is driven by Softmax module itself, NOT by SOLE
         
-        // Route Softmax AXI Master signals to SOLE Master output ports
-        M_AXI_AWADDR.write(softmax_awaddr.read());
-        M_AXI_AWVALID.write(softmax_awvalid.read());
+        // Route Softmax (or, during descriptor fetch / completion, ring) AXI Master signals
+        // to SOLE Master output ports
+        bool ring_bus = ring_bus_owner.read();
+        M_AXI_AWADDR.write(ring_bus ? ring_awaddr.read() : softmax_awaddr.read());
+        M_AXI_AWLEN.write(ring_bus ? ring_awlen.read() : softmax_awlen.read());
+        M_AXI_AWSIZE.write(softmax_awsize.read());
+        M_AXI_AWBURST.write(softmax_awburst.read());
+        M_AXI_AWVALID.write(ring_bus ? ring_awvalid.read() : softmax_awvalid.read());
         softmax_awready.write(M_AXI_AWREADY.read());
+        ring_awready.write(M_AXI_AWREADY.read());
         
-        M_AXI_WDATA.write(softmax_wdata.read());
-        M_AXI_WSTRB.write(softmax_wstrb.read());
-        M_AXI_WVALID.write(softmax_wvalid.read());
+        M_AXI_WDATA.write(ring_bus ? ring_wdata.read() : softmax_wdata.read());
+        M_AXI_WSTRB.write(ring_bus ? ring_wstrb.read() : softmax_wstrb.read());
+        M_AXI_WLAST.write(ring_bus ? ring_wlast.read() : softmax_wlast.read());
+        M_AXI_WVALID.write(ring_bus ? ring_wvalid.read() : softmax_wvalid.read());
         softmax_wready.write(M_AXI_WREADY.read());
+        ring_wready.write(M_AXI_WREADY.read());
         
         softmax_bresp.write(M_AXI_BRESP.read());
         softmax_bvalid.write(M_AXI_BVALID.read());
-        M_AXI_BREADY.write(softmax_bready.read());
+        ring_bresp.write(M_AXI_BRESP.read());
+        ring_bvalid.write(M_AXI_BVALID.read());
+        M_AXI_BREADY.write(ring_bus ? ring_bready.read() : softmax_bready.read());
         
-        M_AXI_ARADDR.write(softmax_araddr.read());
-        M_AXI_ARVALID.write(softmax_arvalid.read());
+        M_AXI_ARID.write(ring_bus ? ring_arid.read() : softmax_arid.read());
+        M_AXI_ARADDR.write(ring_bus ? ring_araddr.read() : softmax_araddr.read());
+        M_AXI_ARLEN.write(ring_bus ? ring_arlen.read() : softmax_arlen.read());
+        M_AXI_ARSIZE.write(softmax_arsize.read());
+        M_AXI_ARBURST.write(softmax_arburst.read());
+        M_AXI_ARVALID.write(ring_bus ? ring_arvalid.read() : softmax_arvalid.read());
         
         // NOTE: M_AXI_ARVALID is driven directly by axi_read_address_process in Softmax,
         // not by demux_logic, to avoid delta-cycle timing issues between SC_METHOD processes
@@ -264,35 +432,165 @@ void SOLE::demux_logic() {
         // M_AXI_ARVALID.write(demux_arvalid);  // SKIP THIS - Softmax drives it directly
         
         softmax_arready.write(M_AXI_ARREADY.read());
+        softmax_rid.write(M_AXI_RID.read());
         softmax_rdata.write(M_AXI_RDATA.read());
         softmax_rresp.write(M_AXI_RRESP.read());
         softmax_rvalid.write(M_AXI_RVALID.read());
-        M_AXI_RREADY.write(softmax_rready.read());
+        ring_arready.write(M_AXI_ARREADY.read());
+        ring_rdata.write(M_AXI_RDATA.read());
+        ring_rresp.write(M_AXI_RRESP.read());
+        ring_rvalid.write(M_AXI_RVALID.read());
+        M_AXI_RREADY.write(ring_bus ? ring_rready.read() : softmax_rready.read());
         
     } else {
         // Route to Norm Engine (placeholder - not yet implemented)
         // Clear Master signals when Norm is selected
         M_AXI_AWADDR.write(0);
+        M_AXI_AWLEN.write(0);
         M_AXI_AWVALID.write(false);
         M_AXI_WDATA.write(0);
         M_AXI_WSTRB.write(0);
+        M_AXI_WLAST.write(false);
         M_AXI_WVALID.write(false);
         M_AXI_BREADY.write(false);
+        M_AXI_ARID.write(0);
         M_AXI_ARADDR.write(0);
+        M_AXI_ARLEN.write(0);
         M_AXI_ARVALID.write(false);
         M_AXI_RREADY.write(false);
     }
 }
 
+/**
+ * @brief Completion Counter and Interrupt Coalescing
+ *
+ * **Completions:**
+ * - Register mode: the DONE pulse of REG_STATUS, or ERROR rising (an error
+ *   held while START stays high counts once)
+ * - Ring mode: the descriptor ring's job_complete pulse, after the completion
+ *   record is in memory (the engine DONE of the descriptor is not counted again)
+ *
+ * **Coalescing (REG_IRQ_COUNT_THRESHOLD != 0):**
+ * pending = REG_COMPLETED_JOBS - acknowledged count (wraps like the counter).
+ * irq_coalesced rises when pending reaches the threshold, or when pending has
+ * been non-zero for REG_IRQ_TIMEOUT_CYCLES (0 = no timeout); it stays high
+ * until an acknowledge brings pending back under the threshold, and the
+ * timeout restarts when pending returns to 0.
+ */
+void SOLE::completion_counter_process() {
+    SOLE_PROFILE_PROCESS();
+    if (rst.read()) {
+        reg_completed_jobs.write(0);
+        irq_coalesced.write(false);
+        last_error = false;
+        irq_wait_cycles = 0;
+        return;
+    }
+
+    // Checkpoint restore: continue from the saved count, acknowledge and coalescing state
+    // (mmio_access_process loads the registers at this edge, visible from the next one)
+    uint32_t completed_jobs = reg_completed_jobs.read().to_uint();
+    uint32_t completed_ack = reg_completed_ack.read().to_uint();
+    uint32_t threshold = reg_irq_count_threshold.read().to_uint();
+    uint32_t timeout = reg_irq_timeout_cycles.read().to_uint();
+    if (counter_restore_pending) {
+        completed_jobs = pending_registers.completed_jobs;
+        completed_ack = pending_registers.completed_ack;
+        threshold = pending_registers.irq_count_threshold;
+        timeout = pending_registers.irq_timeout_cycles;
+        irq_wait_cycles = pending_registers.irq_wait_cycles;
+        last_error = pending_registers.last_error != 0;
+        counter_restore_pending = false;
+    }
+
+    sc_uint32 status = reg_status.read();
+    bool done = ((status >> STAT_DONE_BIT) & 0x1) != 0;
+    bool error = ((status >> STAT_ERROR_BIT) & 0x1) != 0;
+    bool ring_mode = ((reg_control.read() >> CTRL_RING_BIT) & 0x1) != 0;
+    bool completed = ring_mode ? ring_job_complete.read() : (done || (error && !last_error));
+    last_error = error;
+
+    completed_jobs += completed ? 1 : 0;
+    uint32_t pending = completed_jobs - completed_ack;
+    reg_completed_jobs.write(completed_jobs);
+
+    irq_wait_cycles = pending ? (irq_wait_cycles == UINT32_MAX ? irq_wait_cycles : irq_wait_cycles + 1) : 0;
+    irq_coalesced.write(threshold != 0 && pending != 0 &&
+                        (pending >= threshold || (timeout != 0 && irq_wait_cycles >= timeout)));
+}
+
 void SOLE::interrupt_update_process() {
+    SOLE_PROFILE_PROCESS();
     if (rst.read()) {
         interrupt.write(false);
         return;
     }
 
+    if (reg_irq_count_threshold.read() != 0) {
+        interrupt.write(irq_coalesced.read());
+        return;
+    }
+
     sc_uint32 status = reg_status.read();
     bool done = ((status >> STAT_DONE_BIT) & 0x1) != 0;
     bool error = ((status >> STAT_ERROR_BIT) & 0x1) != 0;
     interrupt.write(done || error);
 }
 
+SOLE::Register_File SOLE::save_registers() const {
+    Register_File regs;
+    regs.control         = reg_control.read().to_uint();
+    regs.src_addr_base_l = reg_src_addr_base_l.read().to_uint();
+    regs.src_addr_base_h = reg_src_addr_base_h.read().to_uint();
+    regs.dst_addr_base_l = reg_dst_addr_base_l.read().to_uint();
+    regs.dst_addr_base_h = reg_dst_addr_base_h.read().to_uint();
+    regs.length_l        = reg_length_l.read().to_uint();
+    regs.length_h        = reg_length_h.read().to_uint();
+    regs.row_count       = reg_row_count.read().to_uint();
+    regs.src_row_stride  = reg_src_row_stride.read().to_uint();
+    regs.dst_row_stride  = reg_dst_row_stride.read().to_uint();
+    regs.ring_base_l     = reg_ring_base_l.read().to_uint();
+    regs.ring_base_h     = reg_ring_base_h.read().to_uint();
+    regs.ring_size       = reg_ring_size.read().to_uint();
+    regs.ring_tail       = reg_ring_tail.read().to_uint();
+    regs.ring_head       = ring_head.read().to_uint();
+    regs.irq_count_threshold = reg_irq_count_threshold.read().to_uint();
+    regs.irq_timeout_cycles  = reg_irq_timeout_cycles.read().to_uint();
+    regs.completed_jobs  = reg_completed_jobs.read().to_uint();
+    regs.completed_ack   = reg_completed_ack.read().to_uint();
+    regs.irq_wait_cycles = irq_wait_cycles;
+    regs.last_error      = last_error ? 1 : 0;
+    return regs;
+}
+
+void SOLE::restore_registers(const Register_File& regs) {
+    pending_registers = regs;
+    restore_pending = true;
+    counter_restore_pending = true;
+    if ((regs.control >> CTRL_RING_BIT) & 0x1) {
+        ring_unit->restore_head(regs.ring_head);
+    }
+}
+
+uint64_t SOLE::idle_cycle_limit() const {
+    if (restore_pending || counter_restore_pending || ring_job_complete.read() ||
+        ((reg_status.read() >> STAT_DONE_BIT) & 0x1) != 0) {
+        return 0;
+    }
+    uint64_t limit = std::min(softmax_unit->idle_cycle_limit(), ring_unit->idle_cycle_limit());
+    // irq_coalesced rises at the edge where irq_wait_cycles reaches the timeout
+    uint32_t pending = reg_completed_jobs.read().to_uint() - reg_completed_ack.read().to_uint();
+    uint32_t timeout = reg_irq_timeout_cycles.read().to_uint();
+    if (pending != 0 && timeout != 0 && irq_wait_cycles < timeout) {
+        limit = std::min<uint64_t>(limit, timeout - irq_wait_cycles - 1);
+    }
+    return limit;
+}
+
+void SOLE::skip_cycles(uint64_t cycles) {
+    softmax_unit->skip_cycles(cycles);
+    ring_unit->skip_cycles(cycles);
+    if (reg_completed_jobs.read() != reg_completed_ack.read()) {
+        irq_wait_cycles = (uint32_t)std::min<uint64_t>((uint64_t)irq_wait_cycles + cycles, UINT32_MAX);
+    }
+}
@@ -0,0 +1,218 @@
+#include "SOLE_AT.h"
+#include <algorithm>
+
+using namespace softmax::status;
+
+/**
+ * @brief One SoftMax row: PROCESS1 -> PROCESS2 -> PROCESS3
+ *
+ * PROCESS1 ends P1_DRAIN_CYCLES after the datapath has consumed the last input
+ * beat (one beat per cycle, in address order); PROCESS3 ends P3_DRAIN_CYCLES
+ * after the last write response. AXI response errors are reported as a one-cycle
+ * error flag at the end of the phase, the run itself continues.
+ */
+void SOLE_AT::run_softmax(uint64_t src_addr, uint64_t dst_addr, uint64_t length) {
+    const size_t beats = (length + 3) / 4;
+    run_stats = Stats();
+
+    // ===== PROCESS1: read input, local/global max, Sum_Buffer =====
+    set_status(STATE_PROCESS1, false, ERR_NONE);
+    sc_core::sc_time phase_start = sc_core::sc_time_stamp();
+    beat_buffer.assign(beats, 0);
+    beat_time.assign(beats, sc_core::SC_ZERO_TIME);
+    bool ok = transfer(tlm::TLM_READ_COMMAND, src_addr, beats,
+                       phase_start + clk_period * (double)READ_ISSUE_CYCLES);
+
+    datapath.begin_job();
+    sc_core::sc_time consumed = beat_time[0];
+    for (size_t i = 0; i < beats; i++) {
+        if (i > 0) {
+            consumed = std::max(beat_time[i], consumed + clk_period);
+        }
+        datapath.process1_beat(beat_buffer[i]);
+    }
+    finish_phase(STATE_PROCESS1, consumed + clk_period * (double)P1_DRAIN_CYCLES,
+                 ok ? ERR_NONE : ERR_AXI_READ_ERROR);
+    run_stats.process1_time = sc_core::sc_time_stamp() - phase_start;
+
+    // ===== PROCESS2: leading one / divider threshold =====
+    datapath.process2();
+    run_phase(STATE_PROCESS2, P2_CYCLES, sc_core::SC_ZERO_TIME, ERR_NONE);
+
+    // ===== PROCESS3: divide and write back =====
+    set_status(STATE_PROCESS3, false, ERR_NONE);
+    phase_start = sc_core::sc_time_stamp();
+    for (size_t i = 0; i < beats; i++) {
+        beat_buffer[i] = datapath.process3_beat(i);
+    }
+    ok = transfer(tlm::TLM_WRITE_COMMAND, dst_addr, beats,
+                  phase_start + clk_period * (double)P3_FILL_CYCLES);
+    finish_phase(STATE_PROCESS3, last_response + clk_period * (double)P3_DRAIN_CYCLES,
+                 ok ? ERR_NONE : ERR_AXI_WRITE_ERROR);
+    run_stats.process3_time = sc_core::sc_time_stamp() - phase_start;
+}
+
+/**
+ * @brief Descriptor fetch / completion record through the same request flow
+ * as the row data (burst length and outstanding limits of the Config)
+ */
+bool SOLE_AT::ring_access(tlm::tlm_command cmd, uint64_t addr, uint64_t* data, size_t words) {
+    beat_buffer.assign(data, data + words);
+    beat_time.assign(words, sc_core::SC_ZERO_TIME);
+    bool ok = transfer(cmd, addr, words, sc_core::sc_time_stamp());
+    if (cmd == tlm::TLM_READ_COMMAND) {
+        std::copy(beat_buffer.begin(), beat_buffer.end(), data);
+    }
+    return ok;
+}
+
+bool SOLE_AT::transfer(tlm::tlm_command cmd, uint64_t addr, size_t beats, const sc_core::sc_time& first_issue) {
+    const bool is_read = (cmd == tlm::TLM_READ_COMMAND);
+    const size_t burst = is_read ? config.read_burst_beats : config.write_burst_beats;
+    const size_t max_outstanding = is_read ? config.max_outstanding_reads : config.max_outstanding_writes;
+    const size_t requests = (beats + burst - 1) / burst;
+
+    requests_completed = 0;
+    response_error = false;
+    request_pending = nullptr;
+    last_response = sc_core::SC_ZERO_TIME;
+
+    size_t next_beat = 0;
+    sc_core::sc_time next_issue = first_issue;
+    while (requests_completed < requests) {
+        if (next_beat < beats && request_pending == nullptr && in_flight.size() < max_outstanding) {
+            // Writes: a request goes out once its first beat has left the divider
+            sc_core::sc_time ready = next_issue;
+            if (!is_read) {
+                ready = std::max(ready, first_issue + clk_period * (double)next_beat);
+            }
+            if (sc_core::sc_time_stamp() < ready) {
+                wait(ready - sc_core::sc_time_stamp(), transfer_event);
+                continue;
+            }
+            size_t count = std::min(burst, beats - next_beat);
+            issue_request(cmd, addr + next_beat * sizeof(uint64_t), next_beat, count);
+            next_beat += count;
+            // AR takes one cycle, W one cycle per data beat
+            next_issue = sc_core::sc_time_stamp() + clk_period * (double)(is_read ? 1 : count);
+            continue;
+        }
+        wait(transfer_event);
+    }
+    return !response_error;
+}
+
+void SOLE_AT::issue_request(tlm::tlm_command cmd, uint64_t addr, size_t first_beat, size_t beats) {
+    tlm::tlm_generic_payload* trans = pool.allocate();
+    trans->acquire();
+    trans->set_command(cmd);
+    trans->set_address(addr);
+    trans->set_data_ptr(reinterpret_cast<unsigned char*>(&beat_buffer[first_beat]));
+    trans->set_data_length(beats * sizeof(uint64_t));
+    trans->set_streaming_width(beats * sizeof(uint64_t));
+    trans->set_byte_enable_ptr(nullptr);
+    trans->set_dmi_allowed(false);
+    trans->set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+
+    in_flight[trans] = Request{first_beat, beats, false};
+    request_pending = trans;
+    if (cmd == tlm::TLM_READ_COMMAND) {
+        run_stats.read_requests++;
+        run_stats.peak_outstanding_reads = std::max<unsigned>(run_stats.peak_outstanding_reads, in_flight.size());
+    } else {
+        run_stats.write_requests++;
+        run_stats.peak_outstanding_writes = std::max<unsigned>(run_stats.peak_outstanding_writes, in_flight.size());
+    }
+
+    tlm::tlm_phase phase = tlm::BEGIN_REQ;
+    sc_core::sc_time delay = sc_core::SC_ZERO_TIME;
+    tlm::tlm_sync_enum status = mem_socket->nb_transport_fw(*trans, phase, delay);
+    if (status == tlm::TLM_UPDATED) {
+        peq.notify(*trans, phase, delay);
+    } else if (status == tlm::TLM_COMPLETED) {
+        in_flight[trans].completed_by_target = true;
+        peq.notify(*trans, tlm::BEGIN_RESP, delay);
+    }
+}
+
+tlm::tlm_sync_enum SOLE_AT::nb_transport_bw(tlm::tlm_generic_payload& trans, tlm::tlm_phase& phase, sc_core::sc_time& delay) {
+    peq.notify(trans, phase, delay);
+    return tlm::TLM_ACCEPTED;
+}
+
+/**
+ * @brief Protocol steps of the requests in flight, at their annotated time
+ *
+ * END_REQ frees the request channel. BEGIN_RESP (which implies END_REQ) records
+ * the beat arrival times and answers END_RESP once the response has been
+ * transferred: burst beats cycles for a read, one cycle for a write response.
+ * The model's own END_RESP retires the request.
+ */
+void SOLE_AT::peq_callback(tlm::tlm_generic_payload& trans, const tlm::tlm_phase& phase) {
+    auto it = in_flight.find(&trans);
+    if (it == in_flight.end()) {
+        SC_REPORT_ERROR("SOLE_AT", "protocol phase for a payload that is not in flight");
+        return;
+    }
+    Request& req = it->second;
+    sc_core::sc_time now = sc_core::sc_time_stamp();
+
+    if (phase == tlm::END_REQ) {
+        if (request_pending == &trans) {
+            request_pending = nullptr;
+        }
+    } else if (phase == tlm::BEGIN_RESP) {
+        if (request_pending == &trans) {
+            request_pending = nullptr;
+        }
+        if (trans.is_response_error()) {
+            response_error = true;
+        }
+        sc_core::sc_time transfer_time = clk_period;
+        if (trans.is_read()) {
+            for (size_t k = 0; k < req.beats; k++) {
+                beat_time[req.first_beat + k] = now + clk_period * (double)k;
+            }
+            transfer_time = clk_period * (double)req.beats;
+        }
+        last_response = std::max(last_response, now);
+        if (!req.completed_by_target) {
+            tlm::tlm_phase end_phase = tlm::END_RESP;
+            sc_core::sc_time delay = transfer_time;
+            mem_socket->nb_transport_fw(trans, end_phase, delay);
+        }
+        peq.notify(trans, tlm::END_RESP, transfer_time);
+    } else if (phase == tlm::END_RESP) {
+        in_flight.erase(it);
+        requests_completed++;
+        trans.release();
+    } else {
+        SC_REPORT_ERROR("SOLE_AT", "unexpected protocol phase on mem_socket");
+    }
+    transfer_event.notify(sc_core::SC_ZERO_TIME);
+}
+
+void SOLE_AT::finish_phase(State_t state, const sc_core::sc_time& end, uint8_t error_code) {
+    sc_core::sc_time now = sc_core::sc_time_stamp();
+    if (error_code != ERR_NONE) {
+        sc_core::sc_time flag_time = std::max(now, end - clk_period);
+        wait(flag_time - now);
+        set_status(state, false, error_code);
+        wait(clk_period);
+        return;
+    }
+    if (end > now) {
+        wait(end - now);
+    }
+}
+
+tlm::tlm_generic_payload* SOLE_AT::Payload_Pool::allocate() {
+    if (free_list.empty()) {
+        payloads.emplace_back(new tlm::tlm_generic_payload());
+        payloads.back()->set_mm(this);
+        return payloads.back().get();
+    }
+    tlm::tlm_generic_payload* trans = free_list.back();
+    free_list.pop_back();
+    return trans;
+}
@@ -0,0 +1,92 @@
+#include "SOLE_LT.h"
+#include <cstring>
+
+using namespace softmax::status;
+
+/**
+ * @brief One SoftMax row: PROCESS1 -> PROCESS2 -> PROCESS3
+ *
+ * Source beats are fetched in one bulk access at the start of PROCESS1 and the
+ * results are stored in one bulk access at the start of PROCESS3. AXI response
+ * errors are reported as a one-cycle error flag, the run itself continues.
+ */
+void SOLE_LT::run_softmax(uint64_t src_addr, uint64_t dst_addr, uint64_t length) {
+    const size_t beats = (length + 3) / 4;
+
+    // ===== PROCESS1: read input, local/global max, Sum_Buffer =====
+    sc_core::sc_time delay = sc_core::SC_ZERO_TIME;
+    beat_buffer.assign(beats, 0);
+    bool ok = mem_access(tlm::TLM_READ_COMMAND, src_addr, beat_buffer.data(), beats, delay);
+
+    datapath.begin_job();
+    for (size_t i = 0; i < beats; i++) {
+        datapath.process1_beat(beat_buffer[i]);
+    }
+    run_phase(STATE_PROCESS1, beats + P1_PIPELINE_CYCLES, delay, ok ? ERR_NONE : ERR_AXI_READ_ERROR);
+
+    // ===== PROCESS2: leading one / divider threshold =====
+    datapath.process2();
+    run_phase(STATE_PROCESS2, P2_CYCLES, sc_core::SC_ZERO_TIME, ERR_NONE);
+
+    // ===== PROCESS3: divide and write back =====
+    delay = sc_core::SC_ZERO_TIME;
+    for (size_t i = 0; i < beats; i++) {
+        beat_buffer[i] = datapath.process3_beat(i);
+    }
+    ok = mem_access(tlm::TLM_WRITE_COMMAND, dst_addr, beat_buffer.data(), beats, delay);
+    run_phase(STATE_PROCESS3, beats + P3_PIPELINE_CYCLES, delay, ok ? ERR_NONE : ERR_AXI_WRITE_ERROR);
+}
+
+bool SOLE_LT::ring_access(tlm::tlm_command cmd, uint64_t addr, uint64_t* data, size_t words) {
+    sc_core::sc_time delay = sc_core::SC_ZERO_TIME;
+    bool ok = mem_access(cmd, addr, data, words, delay);
+    wait(delay);
+    return ok;
+}
+
+bool SOLE_LT::mem_access(tlm::tlm_command cmd, uint64_t addr, uint64_t* data, size_t beats, sc_core::sc_time& delay) {
+    const bool is_read = (cmd == tlm::TLM_READ_COMMAND);
+    const size_t bytes = beats * sizeof(uint64_t);
+
+    // DMI fast path
+    if (dmi_valid && addr >= dmi_data.get_start_address() &&
+        addr + bytes - 1 <= dmi_data.get_end_address() &&
+        (is_read ? dmi_data.is_read_allowed() : dmi_data.is_write_allowed())) {
+        unsigned char* ptr = dmi_data.get_dmi_ptr() + (addr - dmi_data.get_start_address());
+        if (is_read) {
+            std::memcpy(data, ptr, bytes);
+            delay += dmi_data.get_read_latency() * (double)beats;
+        } else {
+            std::memcpy(ptr, data, bytes);
+            delay += dmi_data.get_write_latency() * (double)beats;
+        }
+        return true;
+    }
+
+    tlm::tlm_generic_payload trans;
+    trans.set_command(cmd);
+    trans.set_address(addr);
+    trans.set_data_ptr(reinterpret_cast<unsigned char*>(data));
+    trans.set_data_length(bytes);
+    trans.set_streaming_width(bytes);
+    trans.set_byte_enable_ptr(nullptr);
+    trans.set_dmi_allowed(false);
+    trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+
+    mem_socket->b_transport(trans, delay);
+    if (trans.is_response_error()) {
+        return false;
+    }
+
+    if (trans.is_dmi_allowed()) {
+        dmi_data.init();
+        dmi_valid = mem_socket->get_direct_mem_ptr(trans, dmi_data);
+    }
+    return true;
+}
+
+void SOLE_LT::invalidate_direct_mem_ptr(sc_dt::uint64 start_range, sc_dt::uint64 end_range) {
+    if (dmi_valid && start_range <= dmi_data.get_end_address() && end_range >= dmi_data.get_start_address()) {
+        dmi_valid = false;
+    }
+}
@@ -0,0 +1,130 @@
+#include "SOLE_Multi.h"
+#include "Profile.hpp"
+
+SOLE_Multi::SOLE_Multi(sc_core::sc_module_name name, unsigned engine_count, unsigned outstanding_limit)
+    : sc_core::sc_module(name),
+      clk("clk"), rst("rst"), proc_addr("proc_addr"), proc_wdata("proc_wdata"), proc_we("proc_we"),
+      proc_rdata("proc_rdata"), interrupt("interrupt"),
+      M_AXI_AWADDR("M_AXI_AWADDR"), M_AXI_AWLEN("M_AXI_AWLEN"), M_AXI_AWSIZE("M_AXI_AWSIZE"),
+      M_AXI_AWBURST("M_AXI_AWBURST"), M_AXI_AWVALID("M_AXI_AWVALID"), M_AXI_AWREADY("M_AXI_AWREADY"),
+      M_AXI_WDATA("M_AXI_WDATA"), M_AXI_WSTRB("M_AXI_WSTRB"), M_AXI_WLAST("M_AXI_WLAST"),
+      M_AXI_WVALID("M_AXI_WVALID"), M_AXI_WREADY("M_AXI_WREADY"),
+      M_AXI_BRESP("M_AXI_BRESP"), M_AXI_BVALID("M_AXI_BVALID"), M_AXI_BREADY("M_AXI_BREADY"),
+      M_AXI_ARID("M_AXI_ARID"), M_AXI_ARADDR("M_AXI_ARADDR"), M_AXI_ARLEN("M_AXI_ARLEN"),
+      M_AXI_ARSIZE("M_AXI_ARSIZE"), M_AXI_ARBURST("M_AXI_ARBURST"), M_AXI_ARVALID("M_AXI_ARVALID"),
+      M_AXI_ARREADY("M_AXI_ARREADY"),
+      M_AXI_RID("M_AXI_RID"), M_AXI_RDATA("M_AXI_RDATA"), M_AXI_RRESP("M_AXI_RRESP"),
+      M_AXI_RVALID("M_AXI_RVALID"), M_AXI_RREADY("M_AXI_RREADY"),
+      engine_count(engine_count),
+      engines("engine", engine_count),
+      engine_we("engine_we", engine_count), engine_rdata("engine_rdata", engine_count),
+      engine_interrupt("engine_interrupt", engine_count),
+      awaddr("awaddr", engine_count), awlen("awlen", engine_count), awsize("awsize", engine_count),
+      awburst("awburst", engine_count), awvalid("awvalid", engine_count), awready("awready", engine_count),
+      wdata("wdata", engine_count), wstrb("wstrb", engine_count), wlast("wlast", engine_count),
+      wvalid("wvalid", engine_count), wready("wready", engine_count),
+      bresp("bresp", engine_count), bvalid("bvalid", engine_count), bready("bready", engine_count),
+      arid("arid", engine_count), araddr("araddr", engine_count), arlen("arlen", engine_count),
+      arsize("arsize", engine_count), arburst("arburst", engine_count), arvalid("arvalid", engine_count),
+      arready("arready", engine_count),
+      rid("rid", engine_count), rdata("rdata", engine_count), rresp("rresp", engine_count),
+      rvalid("rvalid", engine_count), rready("rready", engine_count)
+{
+    std::cout << "Constructing SOLE_Multi module (" << engine_count << " engines)..." << std::endl;
+
+    // ===== Instantiate the AXI Arbiter =====
+    arbiter = new Axi_Arbiter("arbiter", engine_count, outstanding_limit);
+    arbiter->set_issue_limit(2 * engine_count, 2 * engine_count);
+    arbiter->clk(clk);
+    arbiter->rst(rst);
+    arbiter->M_AXI_AWADDR(M_AXI_AWADDR);
+    arbiter->M_AXI_AWLEN(M_AXI_AWLEN);
+    arbiter->M_AXI_AWSIZE(M_AXI_AWSIZE);
+    arbiter->M_AXI_AWBURST(M_AXI_AWBURST);
+    arbiter->M_AXI_AWVALID(M_AXI_AWVALID);
+    arbiter->M_AXI_AWREADY(M_AXI_AWREADY);
+    arbiter->M_AXI_WDATA(M_AXI_WDATA);
+    arbiter->M_AXI_WSTRB(M_AXI_WSTRB);
+    arbiter->M_AXI_WLAST(M_AXI_WLAST);
+    arbiter->M_AXI_WVALID(M_AXI_WVALID);
+    arbiter->M_AXI_WREADY(M_AXI_WREADY);
+    arbiter->M_AXI_BRESP(M_AXI_BRESP);
+    arbiter->M_AXI_BVALID(M_AXI_BVALID);
+    arbiter->M_AXI_BREADY(M_AXI_BREADY);
+    arbiter->M_AXI_ARID(M_AXI_ARID);
+    arbiter->M_AXI_ARADDR(M_AXI_ARADDR);
+    arbiter->M_AXI_ARLEN(M_AXI_ARLEN);
+    arbiter->M_AXI_ARSIZE(M_AXI_ARSIZE);
+    arbiter->M_AXI_ARBURST(M_AXI_ARBURST);
+    arbiter->M_AXI_ARVALID(M_AXI_ARVALID);
+    arbiter->M_AXI_ARREADY(M_AXI_ARREADY);
+    arbiter->M_AXI_RID(M_AXI_RID);
+    arbiter->M_AXI_RDATA(M_AXI_RDATA);
+    arbiter->M_AXI_RRESP(M_AXI_RRESP);
+    arbiter->M_AXI_RVALID(M_AXI_RVALID);
+    arbiter->M_AXI_RREADY(M_AXI_RREADY);
+
+    // ===== Connect the Engines =====
+    for (unsigned e = 0; e < engine_count; e++) {
+        SOLE& engine = engines[e];
+        engine.clk(clk);
+        engine.rst(rst);
+        engine.proc_addr(proc_addr);
+        engine.proc_wdata(proc_wdata);
+        engine.proc_we(engine_we[e]);
+        engine.proc_rdata(engine_rdata[e]);
+        engine.interrupt(engine_interrupt[e]);
+        engine.set_bus_share(2 * engine_count - 1);
+
+        engine.M_AXI_AWADDR(awaddr[e]);      arbiter->S_AXI_AWADDR[e](awaddr[e]);
+        engine.M_AXI_AWLEN(awlen[e]);        arbiter->S_AXI_AWLEN[e](awlen[e]);
+        engine.M_AXI_AWSIZE(awsize[e]);      arbiter->S_AXI_AWSIZE[e](awsize[e]);
+        engine.M_AXI_AWBURST(awburst[e]);    arbiter->S_AXI_AWBURST[e](awburst[e]);
+        engine.M_AXI_AWVALID(awvalid[e]);    arbiter->S_AXI_AWVALID[e](awvalid[e]);
+        engine.M_AXI_AWREADY(awready[e]);    arbiter->S_AXI_AWREADY[e](awready[e]);
+        engine.M_AXI_WDATA(wdata[e]);        arbiter->S_AXI_WDATA[e](wdata[e]);
+        engine.M_AXI_WSTRB(wstrb[e]);        arbiter->S_AXI_WSTRB[e](wstrb[e]);
+        engine.M_AXI_WLAST(wlast[e]);        arbiter->S_AXI_WLAST[e](wlast[e]);
+        engine.M_AXI_WVALID(wvalid[e]);      arbiter->S_AXI_WVALID[e](wvalid[e]);
+        engine.M_AXI_WREADY(wready[e]);      arbiter->S_AXI_WREADY[e](wready[e]);
+        engine.M_AXI_BRESP(bresp[e]);        arbiter->S_AXI_BRESP[e](bresp[e]);
+        engine.M_AXI_BVALID(bvalid[e]);      arbiter->S_AXI_BVALID[e](bvalid[e]);
+        engine.M_AXI_BREADY(bready[e]);      arbiter->S_AXI_BREADY[e](bready[e]);
+        engine.M_AXI_ARID(arid[e]);          arbiter->S_AXI_ARID[e](arid[e]);
+        engine.M_AXI_ARADDR(araddr[e]);      arbiter->S_AXI_ARADDR[e](araddr[e]);
+        engine.M_AXI_ARLEN(arlen[e]);        arbiter->S_AXI_ARLEN[e](arlen[e]);
+        engine.M_AXI_ARSIZE(arsize[e]);      arbiter->S_AXI_ARSIZE[e](arsize[e]);
+        engine.M_AXI_ARBURST(arburst[e]);    arbiter->S_AXI_ARBURST[e](arburst[e]);
+        engine.M_AXI_ARVALID(arvalid[e]);    arbiter->S_AXI_ARVALID[e](arvalid[e]);
+        engine.M_AXI_ARREADY(arready[e]);    arbiter->S_AXI_ARREADY[e](arready[e]);
+        engine.M_AXI_RID(rid[e]);            arbiter->S_AXI_RID[e](rid[e]);
+        engine.M_AXI_RDATA(rdata[e]);        arbiter->S_AXI_RDATA[e](rdata[e]);
+        engine.M_AXI_RRESP(rresp[e]);        arbiter->S_AXI_RRESP[e](rresp[e]);
+        engine.M_AXI_RVALID(rvalid[e]);      arbiter->S_AXI_RVALID[e](rvalid[e]);
+        engine.M_AXI_RREADY(rready[e]);      arbiter->S_AXI_RREADY[e](rready[e]);
+    }
+
+    SC_METHOD(mmio_decode_process);
+    sensitive << proc_addr << proc_we;
+    for (unsigned e = 0; e < engine_count; e++) {
+        sensitive << engine_rdata[e] << engine_interrupt[e];
+    }
+
+    std::cout << "SOLE_Multi Module Construction Complete: " << name << std::endl;
+}
+
+SOLE_Multi::~SOLE_Multi() {
+    delete arbiter;
+}
+
+void SOLE_Multi::mmio_decode_process() {
+    SOLE_PROFILE_PROCESS();
+    uint32_t select = proc_addr.read().to_uint() >> ENGINE_WINDOW_SHIFT;
+    bool irq = false;
+    for (unsigned e = 0; e < engine_count; e++) {
+        engine_we[e].write(proc_we.read() && select == e);
+        irq |= engine_interrupt[e].read();
+    }
+    proc_rdata.write(select < engine_count ? engine_rdata[select].read() : sc_dt::sc_uint<32>(0));
+    interrupt.write(irq);
+}
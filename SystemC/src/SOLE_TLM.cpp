@@ -0,0 +1,347 @@
+#include "SOLE_TLM.h"
+#include <algorithm>
+#include <cstring>
+
+using namespace sole::mmio;
+using namespace softmax::status;
+
+/**
+ * @brief Processor MMIO Access (TLM target)
+ *
+ * Same register file and read-back values as SOLE::mmio_access_process(),
+ * including the row batching (0x24 - 0x2C) and descriptor ring (0x30 - 0x40)
+ * registers. Every write wakes the engine thread, which re-evaluates START,
+ * Length and the ring doorbell, and re-evaluates the interrupt (acknowledge /
+ * coalescing registers).
+ */
+void SOLE_TLM::mmio_b_transport(tlm::tlm_generic_payload& trans, sc_core::sc_time& delay) {
+    if (mmio_access(trans) && trans.is_write()) {
+        mmio_written.notify(delay);
+        irq_written.notify(delay);
+    }
+}
+
+/**
+ * @brief Debug read of the MMIO register file (no side effects, writes ignored)
+ */
+unsigned int SOLE_TLM::mmio_transport_dbg(tlm::tlm_generic_payload& trans) {
+    if (!trans.is_read()) {
+        return 0;
+    }
+    return mmio_access(trans) ? 4 : 0;
+}
+
+bool SOLE_TLM::mmio_access(tlm::tlm_generic_payload& trans) {
+    if (trans.get_data_length() != 4 || trans.get_streaming_width() < 4) {
+        trans.set_response_status(tlm::TLM_BURST_ERROR_RESPONSE);
+        return false;
+    }
+    if (trans.get_byte_enable_ptr() != nullptr) {
+        trans.set_response_status(tlm::TLM_BYTE_ENABLE_ERROR_RESPONSE);
+        return false;
+    }
+
+    uint32_t reg_offset = trans.get_address() & ADDR_OFFSET_MASK;
+    uint32_t data = 0;
+
+    if (trans.is_write()) {
+        std::memcpy(&data, trans.get_data_ptr(), 4);
+        switch (reg_offset) {
+            case REG_CONTROL:          reg_control = data;          break;
+            case REG_SRC_ADDR_BASE_L:  reg_src_addr_base_l = data;  break;
+            case REG_SRC_ADDR_BASE_H:  reg_src_addr_base_h = data;  break;
+            case REG_DST_ADDR_BASE_L:  reg_dst_addr_base_l = data;  break;
+            case REG_DST_ADDR_BASE_H:  reg_dst_addr_base_h = data;  break;
+            case REG_LENGTH_L:         reg_length_l = data;         break;
+            case REG_LENGTH_H:         reg_length_h = data;         break;
+            case REG_ROW_COUNT:        reg_row_count = data;        break;
+            case REG_SRC_ROW_STRIDE:   reg_src_row_stride = data;   break;
+            case REG_DST_ROW_STRIDE:   reg_dst_row_stride = data;   break;
+            case REG_RING_BASE_L:      reg_ring_base_l = data;      break;
+            case REG_RING_BASE_H:      reg_ring_base_h = data;      break;
+            case REG_RING_SIZE:        reg_ring_size = data;        break;
+            case REG_RING_TAIL:
+                // Doorbell: the ring runs descriptors until HEAD reaches the new TAIL
+                reg_ring_tail = data;
+                break;
+            case REG_COMPLETED_JOBS:
+                // Acknowledge: completions up to this count no longer hold the coalesced interrupt
+                reg_completed_ack = data;
+                break;
+            case REG_IRQ_COUNT_THRESHOLD:
+                reg_irq_count_threshold = data;
+                break;
+            case REG_IRQ_TIMEOUT_CYCLES:
+                reg_irq_timeout_cycles = data;
+                break;
+            case REG_STATUS:           // Read-only from Processor
+            case REG_RING_HEAD:        // Read-only (owned by the descriptor ring)
+            case REG_RESERVED:
+            default:
+                break;
+        }
+    } else if (trans.is_read()) {
+        switch (reg_offset) {
+            case REG_STATUS:           data = reg_status;           break;
+            case REG_CONTROL:          data = reg_control;          break;
+            case REG_SRC_ADDR_BASE_L:  data = reg_src_addr_base_l;  break;
+            case REG_SRC_ADDR_BASE_H:  data = reg_src_addr_base_h;  break;
+            case REG_DST_ADDR_BASE_L:  data = reg_dst_addr_base_l;  break;
+            case REG_DST_ADDR_BASE_H:  data = reg_dst_addr_base_h;  break;
+            case REG_LENGTH_L:         data = reg_length_l;         break;
+            case REG_LENGTH_H:         data = reg_length_h;         break;
+            case REG_ROW_COUNT:        data = reg_row_count;        break;
+            case REG_SRC_ROW_STRIDE:   data = reg_src_row_stride;   break;
+            case REG_DST_ROW_STRIDE:   data = reg_dst_row_stride;   break;
+            case REG_RING_BASE_L:      data = reg_ring_base_l;      break;
+            case REG_RING_BASE_H:      data = reg_ring_base_h;      break;
+            case REG_RING_SIZE:        data = reg_ring_size;        break;
+            case REG_RING_TAIL:        data = reg_ring_tail;        break;
+            case REG_RING_HEAD:        data = ring_head;            break;
+            case REG_COMPLETED_JOBS:   data = reg_completed_jobs;   break;
+            case REG_IRQ_COUNT_THRESHOLD: data = reg_irq_count_threshold; break;
+            case REG_IRQ_TIMEOUT_CYCLES:  data = reg_irq_timeout_cycles;  break;
+            case REG_RESERVED:
+            default:
+                data = 0x0;
+                break;
+        }
+        std::memcpy(trans.get_data_ptr(), &data, 4);
+    }
+
+    trans.set_response_status(tlm::TLM_OK_RESPONSE);
+    return true;
+}
+
+/**
+ * @brief Engine Control Thread
+ *
+ * IDLE behaviour of Softmax + SOLE::demux_logic:
+ * - START=1 with MODE=0 starts a SoftMax run (MODE=1 selects the Norm placeholder: no-op)
+ * - START=1 with Length zero or above DATA_LENGTH_MAX raises ERR_DATA_LENGTH_INVALID,
+ *   held until the registers change
+ * - START is level sensitive and is not auto-cleared (same as the pin-level model)
+ * - CTRL_RING_BIT: START and the job registers are ignored; while HEAD differs
+ *   from REG_RING_TAIL (mod REG_RING_SIZE) the descriptor at HEAD is run, the
+ *   first one START_LATENCY_CYCLES after the doorbell. Clearing the bit in IDLE
+ *   resets HEAD to 0 (Descriptor_Ring).
+ */
+void SOLE_TLM::engine_thread() {
+    set_status(STATE_IDLE, false, ERR_NONE);
+    bool ring_running = false;
+
+    while (true) {
+        bool start = (reg_control >> CTRL_START_BIT) & 0x1;
+        bool mode = (reg_control >> CTRL_MODE_BIT) & 0x1;
+        bool ring = (reg_control >> CTRL_RING_BIT) & 0x1;
+        uint64_t length = ((uint64_t)reg_length_h << 32) | reg_length_l;
+
+        if (ring) {
+            if (reg_ring_size == 0 || ring_head == reg_ring_tail % reg_ring_size) {
+                ring_running = false;
+                wait(mmio_written);
+                continue;
+            }
+            if (!ring_running) {
+                wait(clk_period * (double)START_LATENCY_CYCLES);
+                ring_running = true;
+            }
+            run_descriptor();
+            continue;
+        }
+        ring_head = 0;
+        ring_running = false;
+
+        if (!start || mode) {
+            wait(mmio_written);
+            continue;
+        }
+
+        if (length == 0 || length > DATA_LENGTH_MAX) {
+            set_status(STATE_IDLE, false, ERR_DATA_LENGTH_INVALID);
+            wait(mmio_written);
+            set_status(STATE_IDLE, false, ERR_NONE);
+            continue;
+        }
+
+        wait(clk_period * (double)START_LATENCY_CYCLES);
+        run_rows(length);
+    }
+}
+
+/**
+ * @brief Row batching (Softmax row loop)
+ *
+ * Row r reads src_base + r * REG_SRC_ROW_STRIDE and writes dst_base +
+ * r * REG_DST_ROW_STRIDE; a stride of 0 packs the rows (beats * 8 bytes).
+ * REG_ROW_COUNT 0 is one row. DONE, and so the completion count, once after
+ * the last row.
+ */
+void SOLE_TLM::run_rows(uint64_t length) {
+    const uint64_t row_bytes = (length + 3) / 4 * sizeof(uint64_t);
+    const uint64_t src_stride = reg_src_row_stride ? reg_src_row_stride : row_bytes;
+    const uint64_t dst_stride = reg_dst_row_stride ? reg_dst_row_stride : row_bytes;
+    const uint32_t rows = std::max(reg_row_count, 1u);
+
+    for (uint32_t r = 0; r < rows; r++) {
+        run_softmax(src_addr_base() + r * src_stride, dst_addr_base() + r * dst_stride, length);
+    }
+    done_pulse();
+}
+
+/**
+ * @brief One descriptor (Descriptor_Ring FETCH -> START -> RUN -> WRITEBACK)
+ *
+ * Words 0 - 2 give the source, destination and length of one packed row; the
+ * flags of word 2 only set pin-level AXI parameters and are not modelled.
+ * The completion record carries the first DONE / ERROR status of the job (an
+ * AXI error is reported although the row still runs to DONE) and the cycles
+ * from START to DONE / ERROR. Only word 3 is written back. A descriptor read
+ * error skips the job and records ERR_AXI_READ_ERROR. HEAD advances and the
+ * completion is counted once the record is written.
+ */
+void SOLE_TLM::run_descriptor() {
+    const uint64_t ring_base = ((uint64_t)reg_ring_base_h << 32) | reg_ring_base_l;
+    const uint64_t desc_addr = ring_base + (uint64_t)ring_head * RING_DESC_BYTES;
+    uint64_t desc[RING_DESC_BYTES / 8] = {};
+
+    // ===== FETCH =====
+    sc_core::sc_time phase_start = sc_core::sc_time_stamp();
+    bool fetched = ring_access(tlm::TLM_READ_COMMAND, desc_addr, desc, RING_DESC_BYTES / 8);
+    wait_until(phase_start + clk_period * (double)RING_FETCH_CYCLES);
+
+    uint64_t job_cycles = 0;
+    if (!fetched) {
+        ring_job_status = (1u << STAT_ERROR_BIT) | ((uint32_t)ERR_AXI_READ_ERROR << STAT_ERROR_CODE_LSB);
+    } else {
+        // ===== START / RUN =====
+        const uint64_t length = desc[2] & 0xFFFFFFFF;
+        const sc_core::sc_time job_start = sc_core::sc_time_stamp();
+        ring_job = true;
+        ring_job_status = 0;
+        wait(clk_period * (double)RING_START_CYCLES);
+        if (length == 0 || length > DATA_LENGTH_MAX) {
+            // Rejected at START: the ring sees the ERROR and drops START
+            set_status(STATE_IDLE, false, ERR_DATA_LENGTH_INVALID);
+            wait(clk_period);
+            job_cycles = (uint64_t)((sc_core::sc_time_stamp() - job_start) / clk_period);
+            set_status(STATE_IDLE, false, ERR_NONE);
+        } else {
+            run_softmax(desc[0], desc[1], length);
+            set_status(STATE_IDLE, true, ERR_NONE);
+            job_cycles = (uint64_t)((sc_core::sc_time_stamp() - job_start) / clk_period);
+        }
+        ring_job = false;
+    }
+
+    // ===== WRITEBACK: completion record (word 3 only) =====
+    phase_start = sc_core::sc_time_stamp();
+    uint64_t record = (job_cycles << RING_CPL_CYCLES_LSB) | (1u << RING_CPL_COMPLETE_BIT) | ring_job_status;
+    if ((reg_status >> STAT_DONE_BIT) & 0x1) {
+        wait(clk_period);
+        set_status(STATE_IDLE, false, ERR_NONE);
+    }
+    ring_access(tlm::TLM_WRITE_COMMAND, desc_addr + RING_DESC_COMPLETION_WORD * sizeof(uint64_t), &record, 1);
+    wait_until(phase_start + clk_period * (double)RING_WRITEBACK_CYCLES);
+
+    ring_head = (ring_head + 1) % std::max(reg_ring_size, 1u);
+    count_completion();
+}
+
+void SOLE_TLM::count_completion() {
+    completions_in_flight++;
+    completion_event.notify(clk_period);
+}
+
+void SOLE_TLM::wait_until(const sc_core::sc_time& end) {
+    if (end > sc_core::sc_time_stamp()) {
+        wait(end - sc_core::sc_time_stamp());
+    }
+}
+
+void SOLE_TLM::set_status(State_t state, bool done, uint8_t error_code) {
+    bool error = (error_code != ERR_NONE);
+    reg_status = ((uint32_t)done << STAT_DONE_BIT) |
+                 ((uint32_t)(state & 0x3) << STAT_STATE_LSB) |
+                 ((uint32_t)error << STAT_ERROR_BIT) |
+                 ((uint32_t)(error_code & 0xF) << STAT_ERROR_CODE_LSB);
+    // A job completes at DONE or when ERROR rises (an error held while START stays high counts once).
+    // A descriptor completes at its write-back instead.
+    if (ring_job) {
+        if (ring_job_status == 0 && (done || error)) {
+            ring_job_status = error ? (reg_status & 0xF8) : (1u << STAT_DONE_BIT);
+        }
+    } else if (done || (error && !last_error)) {
+        count_completion();
+    }
+    last_error = error;
+    update_interrupt();
+}
+
+/**
+ * @brief Completion Counter (SOLE::completion_counter_process)
+ *
+ * SOLE counts a completion on the clock edge after DONE / ERROR appears in
+ * REG_STATUS; completion_event fires one cycle after set_status() for the same
+ * timing. pending = REG_COMPLETED_JOBS - acknowledged count (wrapping); the
+ * timeout starts when pending leaves 0.
+ */
+void SOLE_TLM::completion_method() {
+    if (reg_completed_jobs == reg_completed_ack) {
+        pending_since = sc_core::sc_time_stamp();
+    }
+    reg_completed_jobs += completions_in_flight;
+    completions_in_flight = 0;
+    update_interrupt();
+}
+
+void SOLE_TLM::interrupt_method() {
+    update_interrupt();
+}
+
+/**
+ * @brief Interrupt Output (SOLE::interrupt_update_process)
+ *
+ * REG_IRQ_COUNT_THRESHOLD = 0: interrupt = DONE || ERROR of REG_STATUS.
+ * Otherwise the coalesced level: pending >= threshold, or pending non-zero
+ * for REG_IRQ_TIMEOUT_CYCLES cycles (SOLE counts the cycle of the completion
+ * as the first, so the deadline is pending_since + timeout - 1 cycles); held
+ * until an acknowledge brings pending back under the threshold.
+ */
+void SOLE_TLM::update_interrupt() {
+    if (reg_irq_count_threshold == 0) {
+        irq_timeout.cancel();
+        interrupt.write(((reg_status >> STAT_DONE_BIT) & 0x1) || ((reg_status >> STAT_ERROR_BIT) & 0x1));
+        return;
+    }
+
+    uint32_t pending = reg_completed_jobs - reg_completed_ack;
+    bool coalesced = pending != 0 && pending >= reg_irq_count_threshold;
+    irq_timeout.cancel();
+    if (pending != 0 && !coalesced && reg_irq_timeout_cycles != 0) {
+        sc_core::sc_time deadline = pending_since + clk_period * (double)(reg_irq_timeout_cycles - 1);
+        if (sc_core::sc_time_stamp() >= deadline) {
+            coalesced = true;
+        } else {
+            irq_timeout.notify(deadline - sc_core::sc_time_stamp());
+        }
+    }
+    interrupt.write(coalesced);
+}
+
+void SOLE_TLM::run_phase(State_t state, unsigned cycles, const sc_core::sc_time& extra, uint8_t error_code) {
+    set_status(state, false, ERR_NONE);
+    if (error_code == ERR_NONE) {
+        wait(clk_period * (double)cycles + extra);
+        return;
+    }
+    wait(clk_period * (double)(cycles - 1) + extra);
+    set_status(state, false, error_code);
+    wait(clk_period);
+}
+
+void SOLE_TLM::done_pulse() {
+    set_status(STATE_IDLE, true, ERR_NONE);
+    wait(clk_period);
+    set_status(STATE_IDLE, false, ERR_NONE);
+}
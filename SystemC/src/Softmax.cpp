@@ -1,6 +1,6 @@
 #include "Softmax.h"
+#include "Profile.hpp"
 #include "utils.hpp"
-#include <iomanip>
 
 /**
  * @brief FIFO Control Logic Manager
@@ -25,6 +25,17 @@
  * - Max_FIFO: Read-only (PROCESS_3 consumes Local_Max data)
  * - Output_FIFO: Read-only (PROCESS_3 consumes Power_of_Two data)
  * 
+ * **Batched rows:** PROCESS1 writes bank fifo_bank while PROCESS3 reads bank
+ * p3_bank (fifo_bank_select), so the two states may be active at the same time.
+ * 
+ * **Re-read mode (reread_mode):**
+ * - PROCESS1: no FIFO access, only the global max and sum are kept
+ * - PROCESS3: the second read pass writes both FIFOs (PROCESS_1 stage1 / stage5)
+ *   and PROCESS_3 reads them. A local max is popped only when it is there and
+ *   Output_FIFO already holds the power vector of the same beat (more entries
+ *   than the beats PROCESS_3 popped from Max_FIFO but not from Output_FIFO),
+ *   because stage2 pops that vector two cycles later without waiting.
+ * 
  * **Error Condition:**
  * - Clear signals active when has_error flag is set
  * - Allows FIFO reset on error detection
@@ -35,15 +46,20 @@
  * - Invalid reads (timeout or missing data) result in write_en=0
  */
 void Softmax::manage_fifo_control() {
+    SOLE_PROFILE_PROCESS();
     using namespace softmax::status;
     bool reset = rst.read();
     bool error = has_error.read();
     sc_uint2 current_state = state.read();
+    bool p3_now = p3_active.read();
+    bool reread_now = reread_mode.read();
 
     // ============ FIFO Write Control ============
+    // Written by PROCESS_1: in PROCESS1, or in PROCESS3 by the re-read pass
     bool max_fifo_write = process1_stage1_valid.read();
     bool output_fifo_write = process1_stage5_valid.read();
-    bool fifo_write_disable = reset || error || (current_state != STATE_PROCESS1);
+    bool write_active = reread_now ? p3_now : (current_state == STATE_PROCESS1);
+    bool fifo_write_disable = reset || error || !write_active;
     if(fifo_write_disable) {
         max_fifo_write_en.write(false);
         output_fifo_write_en.write(false);
@@ -53,13 +69,17 @@ void Softmax::manage_fifo_control() {
     }
 
     // ============ FIFO Read Control ============
-    bool fifo_read_disable = reset || error || (current_state != STATE_PROCESS3);
+    bool fifo_read_disable = reset || error || !p3_now;
     if(fifo_read_disable) {
         max_fifo_read_en.write(false);
         output_fifo_read_en.write(false);
     } else {
         bool max_fifo_pop = !process3_stall.read();  
         bool output_fifo_pop = (!process3_stall.read()) && process3_stage2_valid.read();  
+        if (reread_now) {
+            max_fifo_pop = max_fifo_pop && max_fifo_read_data_valid.read() &&
+                           output_fifo_count.read() > reread_pending_sig.read();
+        }
 
         max_fifo_read_en.write(max_fifo_pop);           
         output_fifo_read_en.write(output_fifo_pop);      
@@ -70,12 +90,50 @@ void Softmax::manage_fifo_control() {
     output_fifo_clear.write(reset || error);
 }
 
+/**
+ * @brief Ping-pong FIFO bank routing (combinational)
+ * 
+ * The FIFO control signals above are per role: write enables, counts and full
+ * flags belong to the bank PROCESS1 fills (fifo_bank), read enables and read
+ * data to the bank PROCESS3 drains (p3_bank). Single rows and re-read rows only
+ * use bank 0.
+ */
+void Softmax::fifo_bank_select() {
+    SOLE_PROFILE_PROCESS();
+    unsigned fe = fifo_bank.read() ? 1 : 0;
+    unsigned be = p3_bank.read() ? 1 : 0;
+
+    for (unsigned b = 0; b < SOFTMAX_FIFO_BANKS; b++) {
+        bank_max_fifo_write_en[b].write(max_fifo_write_en.read() && fe == b);
+        bank_output_fifo_write_en[b].write(output_fifo_write_en.read() && fe == b);
+        bank_max_fifo_read_en[b].write(max_fifo_read_en.read() && be == b);
+        bank_output_fifo_read_en[b].write(output_fifo_read_en.read() && be == b);
+    }
+
+    max_fifo_full.write(bank_max_fifo_full[fe].read());
+    max_fifo_empty.write(bank_max_fifo_empty[fe].read());
+    max_fifo_count.write(bank_max_fifo_count[fe].read());
+    output_fifo_full.write(bank_output_fifo_full[fe].read());
+    output_fifo_empty.write(bank_output_fifo_empty[fe].read());
+    output_fifo_count.write(bank_output_fifo_count[fe].read());
+
+    max_fifo_read_data_valid.write(bank_max_fifo_read_data_valid[be].read());
+    Local_Max_Signal.write(bank_local_max[be].read());
+    output_fifo_read_data_valid.write(bank_output_fifo_read_data_valid[be].read());
+    Output_Buffer_In_Signal.write(bank_output_buffer[be].read());
+}
+
 /**
  * @brief State Transition & Process Control Handler
  * 
  * **Functional Overview:**
  * Implements the core state machine transitions and process enable signals.
  * Handles the 4-state pipeline: IDLE → PROCESS1 → PROCESS2 → PROCESS3 → IDLE
+ * as two machines: the front end (state: IDLE → PROCESS1 → PROCESS2) and the
+ * PROCESS3 back end (p3_active). When PROCESS2 is done the row is handed off
+ * (handoff_flag): its global max and the PROCESS_2 outputs are latched for
+ * PROCESS_3 and the back end starts. A single row runs the same cycles as one
+ * sequential state machine; the reported state is PROCESS3 while p3_active.
  * Delegates data counter updates to data_counter_update() for cleaner code.
  * 
  * **State 0 (IDLE):**
@@ -91,25 +149,53 @@ void Softmax::manage_fifo_control() {
  * 
  * **State 2 (PROCESS2):**
  * - Enables PROCESS_2 (autonomous computation)
- * - Counts cycles until processing complete
- * - Transitions to PROCESS3 when complete
+ * - Waits for PROCESS_2 Output_Valid (ks / mux registers loaded from the final Sum_Buffer)
+ * - Transitions to PROCESS3 when complete (one cycle: Divider_PreCompute is combinational)
  * 
- * **State 3 (PROCESS3):**
+ * **State 3 (PROCESS3, back end):**
  * - Enables PROCESS_3 (writes to AXI + computes)
  * - Data counter incremented by data_counter_update() on AXI writes
  * - Transitions to IDLE when all data written
  * - Clears error flags on successful completion
+ * - Front end state 3: the row is done with PROCESS2 but PROCESS3 is still busy
+ * 
+ * **Batched rows (row_count > 1):**
+ * START latches the base addresses as the first row. At the hand-off the front
+ * end goes straight on to PROCESS1 of the next row (row_start_flag) with both
+ * addresses advanced by their row strides (0 = packed rows) and the other FIFO
+ * bank, so the next row is read while PROCESS3 writes the current one. The
+ * next row waits in state 3 if it finishes PROCESS2 before PROCESS3 is free.
+ * In re-read mode PROCESS3 needs PROCESS_1 and the read channel, so the next
+ * row starts when PROCESS3 finishes (bank 0 only, no overlap). The global max
+ * and sum restart on row_start_flag; PROCESS_3 and its bank are flushed when
+ * PROCESS3 finishes a row (the last one too, for the next START). Only the
+ * last row raises DONE.
  */
 void Softmax::execute_state_transition() {
+    SOLE_PROFILE_PROCESS();
     using namespace softmax::status;
     
     sc_uint2 current_state = state.read();
     bool p1_finish = process1_finish_flag.read();
+    bool p2_finish = process2_finish_flag.read();
     bool p3_finish = process3_finish_flag.read();
-    bool start_signal = start.read();
+    bool handoff = handoff_flag.read();
+    bool row_start = row_start_flag.read();
      
     if(rst.read() == true) {
         state.write(STATE_IDLE);
+        reread_mode.write(false);
+        row_index_sig.write(0);
+        row_src_addr.write(0);
+        row_dst_addr.write(0);
+        fifo_bank.write(false);
+        p3_active.write(false);
+        p3_bank.write(false);
+        p3_row_sig.write(0);
+        p3_dst_addr.write(0);
+        p3_global_max.write(0);
+        p3_ks.write(0);
+        p3_mux_result.write(0);
         process_1_enable.write(false);
         process_2_enable.write(false);
         process_3_enable.write(false);
@@ -119,95 +205,122 @@ void Softmax::execute_state_transition() {
     // ===== Error Handling: Force return to IDLE if error detected =====
     if (has_error.read()) {
         state.write(STATE_IDLE);
+        p3_active.write(false);
         process_1_enable.write(false);
         process_2_enable.write(false);
         process_3_enable.write(false);
         return; 
     }
-    
+
+    // ===== PROCESS3 back end =====
+    bool p3_next = p3_active.read();
+    if (handoff) {
+        // The row leaves PROCESS2: PROCESS_3 gets its bank, global max and divider precompute
+        p3_next = true;
+        p3_bank.write(fifo_bank.read());
+        p3_row_sig.write(row_index_sig.read());
+        p3_dst_addr.write(row_dst_addr.read());
+        p3_global_max.write(Global_Max_Buffer_Out.read());
+        p3_ks.write(Leading_One_Pos_Out_Signal.read());
+        p3_mux_result.write(Mux_Result_Out_Signal.read());
+    } else if (p3_finish) {
+        // All write operations of the row complete
+        p3_next = false;
+    }
+
+    // ===== Front end =====
+    sc_uint2 next_state = current_state;
     switch (current_state) {
         case STATE_IDLE:
-            // ===== IDLE State: Wait for START =====
-            process_1_enable.write(false);
-            process_2_enable.write(false);
-            process_3_enable.write(false);
-
-            if (start_signal) {
-                state.write(STATE_PROCESS1);
-                process_1_enable.write(true);
+            // ===== IDLE State: Wait for START (or the next re-read row) =====
+            if (row_start) {
+                next_state = STATE_PROCESS1;
             }
             break;
             
-        case STATE_PROCESS1: {
+        case STATE_PROCESS1:
             // ===== PROCESS1 State: Read from Memory & Compute =====
-            process_1_enable.write(true);
-            process_2_enable.write(false);
-            process_3_enable.write(false);
             if (p1_finish) {
-                state.write(STATE_PROCESS2);
-                process_1_enable.write(false);
-                process_2_enable.write(true);
+                next_state = STATE_PROCESS2;
             } 
             break;
-        }
             
-        case STATE_PROCESS2: {
-            process_1_enable.write(false);
-            process_2_enable.write(true);
-            process_3_enable.write(false);
-            
-            // Counter to track PROCESS2 execution time
-            static sc_dt::sc_uint<32> process2_cycle_counter = 0;
-            if (process_2_enable.read()) {
-                process2_cycle_counter++;
-                if (process2_cycle_counter >= 10) {     // Assumed: PROCESS2 takes total 10 cycles
-                    state.write(STATE_PROCESS3);
-                    process_2_enable.write(false);
-                    process_3_enable.write(true);
-                    process2_cycle_counter = 0;
-                }
-            }
-            break;
-        }
-            
-        case STATE_PROCESS3: {
-            process_1_enable.write(false);
-            process_2_enable.write(false);
-            process_3_enable.write(true);
-            if (p3_finish) {
-                // All write operations complete: transition to IDLE
-                state.write(STATE_IDLE);
-                process_3_enable.write(false);
+        case STATE_PROCESS2:
+        case STATE_PROCESS3:
+            // Done with PROCESS2: hand the row to PROCESS3, or wait until it is free
+            if (handoff) {
+                next_state = row_start ? STATE_PROCESS1 : STATE_IDLE;
+            } else if (p2_finish) {
+                next_state = STATE_PROCESS3;
             }
             break;
-        }
 
         default:
             // ===== Invalid State: Return to IDLE =====
-            state.write(STATE_IDLE);
+            next_state = STATE_IDLE;
             break;
     }
+
+    if (row_start) {
+        if (current_state == STATE_IDLE && !p3_active.read()) {
+            // START: the first row; rows longer than the FIFOs always take the two-pass re-read mode
+            reread_mode.write(reread.read() || data_length.read() > DATA_LENGTH_MAX);
+            row_index_sig.write(0);
+            row_src_addr.write(src_addr_base.read());
+            row_dst_addr.write(dst_addr_base.read());
+            fifo_bank.write(false);
+        } else {
+            // Next row of a batched job, in the other bank unless PROCESS3 re-reads through bank 0
+            uint64_t row_bytes = (data_length.read() + SOLE_LANES - 1) / SOLE_LANES * AXI_BEAT_BYTES;
+            uint64_t src_stride = src_row_stride.read() ? (uint64_t)src_row_stride.read() : row_bytes;
+            uint64_t dst_stride = dst_row_stride.read() ? (uint64_t)dst_row_stride.read() : row_bytes;
+            row_index_sig.write(row_index_sig.read() + 1);
+            row_src_addr.write(row_src_addr.read() + src_stride);
+            row_dst_addr.write(row_dst_addr.read() + dst_stride);
+            fifo_bank.write(!reread_mode.read() && !fifo_bank.read());
+        }
+    }
+
+    state.write(next_state);
+    p3_active.write(p3_next);
+    // Re-read: PROCESS_1 recomputes the beats in PROCESS3
+    process_1_enable.write(next_state == STATE_PROCESS1 || (p3_next && reread_mode.read()));
+    process_2_enable.write(next_state == STATE_PROCESS2);
+    process_3_enable.write(p3_next);
 }
 
 // Transition to PROCESS2 when ALL conditions are met:
-// Note: Each AXI transfer = 4 elements (64-bit / 16-bit FP16)
-// 1. All valid data has been pushed to BOTH FIFOs (push_count_max * 4 >= total_length)
-// 2. All valid data has been pushed to Output FIFO (push_count_output * 4 >= total_length)
-// 3. ALL read data responses received from AXI (read_data_received * 4 >= total_length) 
-
-// Transition to IDLE when ALL write operations are complete:
-// - write_addr_sent_num * 4 >= data_length (all addresses sent)
-// - write_data_sent_num * 4 >= data_length (all data sent)
-// - write_response_received_num * 4 >= data_length (all responses received)
+// Note: Each AXI transfer = SOLE_LANES elements (AXI_DATA_WIDTH / 16-bit FP16; 4 for 64-bit)
+// 1. All valid data has been pushed to BOTH FIFOs (push_count_max * SOLE_LANES >= total_length)
+// 2. All valid data has been pushed to Output FIFO (push_count_output * SOLE_LANES >= total_length)
+// 3. ALL read data responses received from AXI (read_data_received * SOLE_LANES >= total_length) 
+// In re-read mode the FIFOs stay empty in PROCESS1; 1 and 2 become: every beat has
+// been accumulated into Sum_Buffer (sum_update_count * SOLE_LANES >= total_length)
+
+// PROCESS2 is done when PROCESS_2 reports valid output registers (Output_Valid): Sum_Buffer
+// is final once PROCESS1 finishes, so this is the first PROCESS2 cycle
+
+// PROCESS3 is done when ALL write operations are complete:
+// - write_addr_sent_num * SOLE_LANES >= data_length (all addresses sent)
+// - write_data_sent_num * SOLE_LANES >= data_length (all data sent)
+// - write_response_received_num * SOLE_LANES >= data_length (all responses received)
+// row_next_flag: another row of the job follows the one PROCESS3 finished
+
+// Hand-off when PROCESS2 is done (or the row already waits) and PROCESS3 is free or
+// finishing. A row starts on START, at the hand-off while rows remain (FIFO mode),
+// or in re-read mode when PROCESS3 finishes and rows remain.
 void Softmax::state_transition_flag() {
+    SOLE_PROFILE_PROCESS();
 
     sc_uint64 total_length = data_length.read();
     sc_uint2 state_now = state.read();
+    bool p3_now = p3_active.read();
 
     // for process1 finish condition
     sc_uint32 push_count_max = max_fifo_count.read();
     sc_uint32 push_count_output = output_fifo_count.read();
-    sc_uint32 read_data_received = read_data_received_count_sig.read();
+    sc_uint32 read_data_delivered = read_data_delivered_count_sig.read();
+    sc_uint32 sum_update_count = sum_update_count_sig.read();
 
     // for process3 finish condition
     sc_uint32 write_addr_count = write_addr_sent_num_sig.read();
@@ -215,18 +328,34 @@ void Softmax::state_transition_flag() {
     sc_uint32 write_response_count = write_response_received_num_sig.read();
     
     // Determine finish conditions for each process
-    bool p1_finish = (read_data_received * 4 >= total_length) && 
-                     (push_count_max * 4 >= total_length) &&   
-                     (push_count_output * 4 >= total_length) && 
+    bool p1_pushed = reread_mode.read()
+                   ? (sum_update_count * SOLE_LANES >= total_length)
+                   : (push_count_max * SOLE_LANES >= total_length) &&
+                     (push_count_output * SOLE_LANES >= total_length);
+    bool p1_finish = (read_data_delivered * SOLE_LANES >= total_length) && 
+                     p1_pushed && 
                      state_now == STATE_PROCESS1;  
 
-    bool p3_finish = (write_addr_count * 4 >= total_length) && 
-                     (write_data_count * 4 >= total_length) && 
-                     (write_response_count * 4 >= total_length) &&
-                     state_now == STATE_PROCESS3;
+    bool p2_finish = state_now == STATE_PROCESS2 && process2_output_valid_Signal.read();
+
+    bool p3_finish = (write_addr_count * SOLE_LANES >= total_length) && 
+                     (write_data_count * SOLE_LANES >= total_length) && 
+                     (write_response_count * SOLE_LANES >= total_length) &&
+                     p3_now;
+
+    uint32_t rows = row_count.read() ? row_count.read().to_uint() : 1;
+    bool front_more_rows = row_index_sig.read() + 1 < rows;
+    bool handoff = (p2_finish || state_now == STATE_PROCESS3) && (!p3_now || p3_finish);
+    bool first_row = state_now == STATE_IDLE && !p3_now && start.read();
+    bool next_row = front_more_rows &&
+                    (reread_mode.read() ? (state_now == STATE_IDLE && p3_finish) : handoff);
 
     process1_finish_flag.write(p1_finish);
+    process2_finish_flag.write(p2_finish);
     process3_finish_flag.write(p3_finish);
+    row_next_flag.write(p3_finish && p3_row_sig.read() + 1 < rows);
+    handoff_flag.write(handoff);
+    row_start_flag.write(first_row || next_row);
 }
 
 /**
@@ -245,10 +374,11 @@ void Softmax::state_transition_flag() {
  * [0]        done (1-bit done flag, pulses HIGH for one clock when PROCESS3 completes)
  */
 void Softmax::status_update_process() {
+    SOLE_PROFILE_PROCESS();
     using namespace softmax::status;
     
-    // Get current state and error info
-    sc_uint2 current_state = state.read();
+    // Get current state and error info (PROCESS3 while the back end is busy)
+    sc_uint2 current_state = p3_active.read() ? sc_uint2(STATE_PROCESS3) : state.read();
     uint8_t error_code = error_code_sig.read();
     bool has_err = has_error.read();
     bool done_signal = done_pulse.read();
@@ -281,6 +411,7 @@ void Softmax::status_update_process() {
  * registers when it should be held (frozen).
  */
 void Softmax::manage_process2_stall() {
+    SOLE_PROFILE_PROCESS();
     using namespace softmax::status;
     
     sc_uint2 current_state = state.read();
@@ -289,27 +420,29 @@ void Softmax::manage_process2_stall() {
     } else {
         stall_process2_output_Signal.write(true);
     }
+    // Buffer_Update freezes Sum_Buffer outside PROCESS1; a row waiting in state 3 keeps it
+    process2_input_valid_Signal.write(current_state == STATE_PROCESS2 || current_state == STATE_PROCESS3);
 }
 
 void Softmax::Buffer_Update() {
+    SOLE_PROFILE_PROCESS();
     using namespace softmax::status;
     
     // Global_Max_Buffer and Sum_Buffer logic with stage-based validity tracking
     // Also count valid data pushes to FIFOs based on stage validity flags
     
-    static sc_uint16 global_max_reg = 0;        // Register to store FP16 max value
-    static sc_uint32 sum_buffer_reg = 0;        // Register to store sum value
-    
     sc_uint2 current_state = state.read();
     bool stage1_valid = process1_stage1_valid.read();   // Stage1 validity for Global_Max_Buffer
     bool stage5_valid = process1_stage5_valid.read();   // Stage5 validity for Sum_Buffer
 
-    if (rst.read()) {
-        // Reset both buffers on reset signal
+    if (rst.read() || row_start_flag.read()) {
+        // Reset both buffers on reset signal, and for every row (PROCESS3 has latched the previous global max)
         global_max_reg = 0;
         sum_buffer_reg = 0;
+        sum_update_num = 0;
         Global_Max_Buffer_Out.write(0);
         Sum_Buffer_Out.write(0);
+        sum_update_count_sig.write(0);
     } 
     else if (current_state == STATE_PROCESS1) {  
         // Update Global_Max_Buffer only when Stage1 data is valid
@@ -320,8 +453,10 @@ void Softmax::Buffer_Update() {
         
         // Update Sum_Buffer only when Stage5 data is valid
         if (stage5_valid) {
-            sc_uint32 incoming_sum = Sum_Buffer_In.read();
+            sole_sum_t incoming_sum = Sum_Buffer_In.read();
             sum_buffer_reg = incoming_sum;
+            sum_update_num++;
+            sum_update_count_sig.write(sum_update_num);
         }
         
         // Write updated values to outputs (combinational)
@@ -332,11 +467,15 @@ void Softmax::Buffer_Update() {
         // Transitioning out of PROCESS1: keep outputs stable
         Global_Max_Buffer_Out.write(global_max_reg);
         Sum_Buffer_Out.write(sum_buffer_reg);
+        sum_update_num = 0;
+        sum_update_count_sig.write(0);
     }
     else {
-        // Other states: Maintain outputs (stall)
+        // Other states: Maintain outputs (stall); the PROCESS3 re-read pass does not touch them.
         Global_Max_Buffer_Out.write(global_max_reg);
         Sum_Buffer_Out.write(sum_buffer_reg);
+        sum_update_num = 0;
+        sum_update_count_sig.write(0);
     }
 }
 
@@ -344,99 +483,202 @@ void Softmax::Buffer_Update() {
  * @brief AXI Read Address Generation Process (Proper Handshake)
  * 
  * **Functional Overview:**
- * Implements proper AXI4-Lite read address handshake:
+ * Implements proper AXI4 read address handshake:
  * - ARVALID/ARREADY handshake: only advance when both high
  * - RVALID/RREADY handshake: only advance when both high
  * - Tracks read addresses sent vs data received (inflight)
  * - Detects missing data (addr sent but data not received)
  * 
+ * **Bursts:**
+ * Each AR requests up to burst_len + 1 INCR beats (ARLEN = beats - 1), cut
+ * short at the end of the data and at 4 KB boundaries (axi_burst_beats()).
+ * burst_len = 0 issues one single-beat AR per 64-bit word.
+ * 
+ * **Outstanding reads and IDs:**
+ * Bursts get ARID = (AR handshake count) % AXI_READ_MAX_OUTSTANDING, so all
+ * bursts in flight have different IDs and the slave may answer them in any
+ * order (beats of one burst stay in order). The read tracker read_txn[ARID]
+ * holds the first beat index and length of each outstanding burst; an R beat
+ * is beat read_txn[RID].start + read_txn[RID].received of the job.
+ * A new AR is issued only while
+ * - fewer than read_outstanding bursts (REG_CONTROL[23:16], 0 or more than
+ *   64 = AXI_READ_MAX_OUTSTANDING) have not been fully handed to PROCESS1, and
+ * - the beats requested but not handed on, plus the new burst, fit in the
+ *   AXI_READ_ROB_DEPTH-beat reorder buffer,
+ * so the reorder buffer never overflows and RREADY stays high.
+ * 
+ * **Reorder buffer:**
+ * PROCESS1 takes one beat per cycle in order (validity_signal_update): the
+ * reorder buffer entry of the next beat if it arrived early, else the R beat
+ * on the bus if it is the next beat (RID == read_head_id_sig, including a beat
+ * returned in the cycle its AR is accepted), which bypasses the buffer. Any other R beat is stored. With an in-order slave every beat
+ * bypasses, so the timing is the same as without the buffer.
+ * 
  * **Tracking:**
- * - read_addr_sent_num: increments when ARVALID && ARREADY
+ * - read_addr_sent_num: increases by ARLEN + 1 when ARVALID && ARREADY
  * - read_data_received_num: increments when RVALID && RREADY
+ * - read_data_delivered_num: increments when PROCESS1 takes a beat
  * - inflight_data = read_addr_sent_num - read_data_received_num
  * - At end of PROCESS1: inflight_data must be 0
  * 
- * **Operation:**
+ * **Re-read pass:**
+ * In re-read mode the counters restart in PROCESS2 and the whole input is read
+ * again in PROCESS3. PROCESS3 cannot stall PROCESS_1, so a burst is issued only
+ * while the beats requested but not yet popped from Max_FIFO by PROCESS_3,
+ * plus the new burst, fit in AXI_REREAD_WINDOW_BEATS; the FIFOs never fill.
  */
 void Softmax::axi_read_address_process() {
+    SOLE_PROFILE_PROCESS();
     using namespace softmax::status;
     
     sc_uint2 current_state = state.read();
     sc_uint64 total_length = data_length.read();
-    sc_uint64 src_base = src_addr_base.read();
-    
-    static sc_uint32 read_addr_sent_num = 0;
-    static sc_uint32 read_data_received_num = 0;
-    static sc_uint32 read_data_timeout_counter = 0;
+    sc_uint64 src_base = row_src_addr.read();
+    uint64_t total_beats = (total_length + SOLE_LANES - 1) / SOLE_LANES;
+    uint32_t max_beats = std::min((uint32_t)burst_len.read() + 1, AXI_READ_ROB_DEPTH);
+    uint32_t max_txns = read_outstanding.read();
+    if (max_txns == 0 || max_txns > AXI_READ_MAX_OUTSTANDING) {
+        max_txns = AXI_READ_MAX_OUTSTANDING;
+    }
+    bool reread_pass = p3_active.read() && reread_mode.read();
+    if (reread_pass) {
+        max_beats = std::min(max_beats, AXI_REREAD_WINDOW_BEATS);
+    }
    
-    const sc_uint32 READ_DATA_TIMEOUT_LIMIT = 100;
+    M_AXI_ARSIZE.write(AXI_SIZE_BEAT);
+    M_AXI_ARBURST.write(AXI_BURST_INCR);
       
     if (rst.read()) {
+        M_AXI_ARID.write(0);
+        M_AXI_ARADDR.write(0);
+        M_AXI_ARLEN.write(0);
+        M_AXI_ARVALID.write(false);
+        M_AXI_RREADY.write(false);
         read_addr_sent_num = 0;
         read_data_received_num = 0;
+        read_data_delivered_num = 0;
+        read_txn_issued = 0;
+        read_txn_retired = 0;
+        reread_max_popped_num = 0;
+        reread_output_popped_num = 0;
+        std::fill(std::begin(rob_valid), std::end(rob_valid), false);
         read_data_received_count_sig.write(0);
+        read_data_delivered_count_sig.write(0);
         read_addr_sent_num_sig.write(0);
-        read_data_timeout_counter = 0;
-
+        reread_pending_sig.write(0);
     }
-    else if (current_state == STATE_PROCESS1) {
+    else if (current_state == STATE_PROCESS1 || (reread_pass && !row_next_flag.read())) {
         
         //====================READ ADDR========================
-        // READ_ADDR Handshake occurred:
+        // READ_ADDR Handshake occurred: the whole burst is requested under ARID
         bool READ_ADDR_handshake = M_AXI_ARVALID.read() && M_AXI_ARREADY.read();
         if (READ_ADDR_handshake) { 
-            read_addr_sent_num++;
+            Read_Txn& txn = read_txn[M_AXI_ARID.read().to_uint()];
+            txn.start = read_addr_sent_num;
+            txn.beats = (uint32_t)M_AXI_ARLEN.read() + 1;
+            txn.received = 0;
+            read_addr_sent_num += txn.beats;
+            read_txn_issued++;
             read_addr_sent_num_sig.write(read_addr_sent_num);
-            std::cerr << "[ADDR_READ_HANDSHAKE] read_addr_sent_num now " << read_addr_sent_num 
-                    << " @" << sc_time_stamp() << std::endl;
+            SOLE_TRACE(EV_AXI_AR_HANDSHAKE, read_addr_sent_num);
         }
 
-        if (read_addr_sent_num * 4 < total_length) {
-            // DIRECT WRITE to M_AXI ports to avoid delta-cycle timing issues
-            sc_uint64 next_src_addr = src_base + (sc_uint64)read_addr_sent_num * 8;
-            M_AXI_ARADDR.write((sc_dt::sc_uint<32>)(next_src_addr & 0xFFFFFFFF));
-            M_AXI_ARVALID.write(true);  // ← DIRECT WRITE TO PORT, not to internal signal
-            std::cerr << "[ARADDR]" << (sc_dt::sc_uint<32>)(next_src_addr & 0xFFFFFFFF)
-                            << " @" << sc_time_stamp() << std::endl;
-
-        } else {
-            // All reads sent, deassert ARVALID
-            M_AXI_ARVALID.write(false);  
-        }
-        
         //====================READ DATA========================
-        // READ_DATA Handshake occurred:
+        // READ_DATA Handshake occurred: bypassed to PROCESS1 or kept in the reorder buffer
         bool READ_DATA_handshake = M_AXI_RVALID.read() && M_AXI_RREADY.read();
         if (READ_DATA_handshake) { 
+            Read_Txn& txn = read_txn[M_AXI_RID.read().to_uint()];
+            uint32_t beat = txn.start + txn.received;
+            txn.received++;
             read_data_received_num++;
-            sc_uint64 data = M_AXI_RDATA.read();
-            std::cerr << "[READ_DATA_HANDSHAKE] Num: " << std::dec << read_data_received_num 
-                    << " READ DATA : 0x" 
-                    << std::hex << std::setfill('0')
-                    << std::setw(4) << data.range(63, 48) << " "
-                    << std::setw(4) << data.range(47, 32) << " "
-                    << std::setw(4) << data.range(31, 16) << " "
-                    << std::setw(4) << data.range(15, 0)
-                    << " @" << sc_time_stamp() << std::dec << std::endl;
+            bool head_issued = read_head_issued_sig.read() || READ_ADDR_handshake;
+            bool bypass = !rob_head_valid_sig.read() && head_issued &&
+                          M_AXI_RID.read() == read_head_id_sig.read();
+            if (!bypass) {
+                rob_data[beat % AXI_READ_ROB_DEPTH] = M_AXI_RDATA.read();
+                rob_valid[beat % AXI_READ_ROB_DEPTH] = true;
+            }
+            SOLE_TRACE(EV_AXI_R_HANDSHAKE, read_data_received_num, M_AXI_RDATA.read().to_uint64());
+        }
+
+        // PROCESS1 took the next in-order beat; the burst retires after its last beat
+        if (process1_read_data_valid.read()) {
+            rob_valid[read_data_delivered_num % AXI_READ_ROB_DEPTH] = false;
+            read_data_delivered_num++;
+            const Read_Txn& head = read_txn[read_head_id_sig.read().to_uint()];
+            if (read_data_delivered_num == head.start + head.beats) {
+                read_txn_retired++;
+            }
         }
         
         read_data_received_count_sig.write(read_data_received_num);  // Update signal for state machine
+        read_data_delivered_count_sig.write(read_data_delivered_num);
+
+        // Re-read pass: beats PROCESS_3 took from the FIFOs
+        if (reread_pass) {
+            if (max_fifo_read_en.read() && max_fifo_read_data_valid.read()) {
+                reread_max_popped_num++;
+            }
+            if (output_fifo_read_en.read() && output_fifo_read_data_valid.read()) {
+                reread_output_popped_num++;
+            }
+            reread_pending_sig.write(reread_max_popped_num - reread_output_popped_num);
+        }
+
+        // Issue the next burst while the outstanding and reorder buffer limits allow it
+        uint32_t outstanding_beats = read_addr_sent_num - read_data_delivered_num;
+        if (read_addr_sent_num * SOLE_LANES < total_length) {
+            // DIRECT WRITE to M_AXI ports to avoid delta-cycle timing issues
+            sc_uint64 next_src_addr = src_base + (sc_uint64)read_addr_sent_num * AXI_BEAT_BYTES;
+            uint32_t beats = axi_burst_beats(next_src_addr, total_beats - read_addr_sent_num, max_beats);
+            bool can_issue = (read_txn_issued - read_txn_retired < max_txns) &&
+                             (outstanding_beats + beats <= AXI_READ_ROB_DEPTH) &&
+                             (!reread_pass || read_addr_sent_num - reread_max_popped_num + beats <= AXI_REREAD_WINDOW_BEATS);
+            M_AXI_ARID.write(read_txn_issued % AXI_READ_MAX_OUTSTANDING);
+            M_AXI_ARADDR.write((sc_dt::sc_uint<32>)(next_src_addr & 0xFFFFFFFF));
+            M_AXI_ARLEN.write(beats - 1);
+            M_AXI_ARVALID.write(can_issue);  // ← DIRECT WRITE TO PORT, not to internal signal
+            if (can_issue) {
+                SOLE_TRACE(EV_AXI_AR_ISSUE, next_src_addr & 0xFFFFFFFF, beats - 1);
+            }
+
+        } else {
+            // All reads sent, deassert ARVALID
+            M_AXI_ARVALID.write(false);  
+        }
         
         // Set M_AXI_RREADY signal
-        if (read_data_received_num * 4 < total_length) {
+        if (read_data_received_num * SOLE_LANES < total_length) {
             M_AXI_RREADY.write(true);
         } else {
             M_AXI_RREADY.write(false);      // All Read Data received
         }
     }
     else {
-        // Not in read states
+        // Not in read states, or the re-read pass of a row that is followed by another row
+        // (an error can leave early beats in the reorder buffer)
+        if (read_txn_issued != 0) {
+            std::fill(std::begin(rob_valid), std::end(rob_valid), false);
+        }
         read_addr_sent_num = 0;
         read_data_received_num = 0;
+        read_data_delivered_num = 0;
+        read_txn_issued = 0;
+        read_txn_retired = 0;
+        reread_max_popped_num = 0;
+        reread_output_popped_num = 0;
         read_addr_sent_num_sig.write(0);
         read_data_received_count_sig.write(0);
-        read_data_timeout_counter = 0;
+        read_data_delivered_count_sig.write(0);
+        reread_pending_sig.write(0);
     }
+
+    // Next in-order beat for validity_signal_update
+    uint32_t head = read_data_delivered_num % AXI_READ_ROB_DEPTH;
+    read_head_id_sig.write(read_txn_retired % AXI_READ_MAX_OUTSTANDING);
+    read_head_issued_sig.write(read_txn_retired < read_txn_issued);
+    rob_head_valid_sig.write(rob_valid[head]);
+    rob_head_data_sig.write(rob_data[head]);
 }
 
 /**
@@ -456,28 +698,38 @@ void Softmax::axi_read_address_process() {
  *   - If M_AXI_AWREADY=0 OR M_AXI_WREADY=0: Write stalled, stall PROCESS_3 output
  * 
  * **Address Calculation:**
- * write_address = dst_base + (write_addr_sent_num * 8)
+ * write_address = dst_base + (write_addr_sent_num * AXI_BEAT_BYTES)
  * Uses write_addr_sent_num (not write_data_sent_num) as the index
+ * 
+ * **Bursts:**
+ * Each AW covers up to burst_len + 1 beats (AWLEN = beats - 1), split with
+ * axi_burst_beats() like the read side. The W channel walks the same bursts
+ * (write_burst_end) to drive WLAST, and every B acknowledges a whole burst:
+ * the AW handshake pushes the burst's beat count into write_burst_beats and
+ * the B handshake pops it. A new AW waits while AXI_WRITE_MAX_OUTSTANDING
+ * bursts have no B yet.
+ * All three counters count beats, so the finish and mismatch checks are the
+ * same for any burst length.
  */
 void Softmax::axi_write_request_process() {
+    SOLE_PROFILE_PROCESS();
     using namespace softmax::status;
     
-    sc_uint2 current_state = state.read();
     sc_uint64 total_length = data_length.read();
-    sc_uint64 dst_base = dst_addr_base.read();
+    sc_uint64 dst_base = p3_dst_addr.read();
     bool stage4_valid = process3_stage4_valid.read();  // Check PROCESS_3 Stage4 validity (aligned with M_AXI_WDATA)
-
-    // Static counters for tracking write operations
-    static sc_uint32 write_addr_sent_num = 0;
-    static sc_uint32 write_data_sent_num = 0;
-    static sc_uint32 write_response_received_num = 0;
-    static bool prev_stage3_valid = false;
-    static bool prev_stall = false;
+    uint64_t total_beats = (total_length + SOLE_LANES - 1) / SOLE_LANES;
+    uint32_t max_beats = (uint32_t)burst_len.read() + 1;
+    
+    M_AXI_AWSIZE.write(AXI_SIZE_BEAT);
+    M_AXI_AWBURST.write(AXI_BURST_INCR);
     
     if (rst.read()) {
         M_AXI_AWADDR.write(0);
+        M_AXI_AWLEN.write(0);
         M_AXI_AWVALID.write(false);
         M_AXI_WSTRB.write(0);
+        M_AXI_WLAST.write(false);
         M_AXI_WVALID.write(false);
         M_AXI_BREADY.write(false);
         write_addr_sent_num_sig.write(0);
@@ -486,28 +738,44 @@ void Softmax::axi_write_request_process() {
         write_addr_sent_num = 0;
         write_data_sent_num = 0;
         write_response_received_num = 0;
-        prev_stage3_valid = false;
-        prev_stall = false;
+        write_burst_end = 0;
+        write_burst_head = 0;
+        write_burst_count = 0;
     }
-    else if (current_state == STATE_PROCESS3) {
+    else if (p3_active.read() && !row_next_flag.read()) {
         
         // During PROCESS3: manage write handshakes based on data validity
         //====================WRITE ADDR========================
-        // WRITE_ADDR Handshake occurred:
+        // WRITE_RESP Handshake occurred: pop the beats of the oldest burst
+        // (a B without an outstanding burst acknowledges nothing)
+        bool WRITE_RESP_handshake = M_AXI_BVALID.read() && M_AXI_BREADY.read();
+        if (WRITE_RESP_handshake && write_burst_count > 0) {
+            write_response_received_num += write_burst_beats[write_burst_head];
+            write_response_received_num_sig.write(write_response_received_num);
+            write_burst_head = (write_burst_head + 1) % AXI_WRITE_MAX_OUTSTANDING;
+            write_burst_count--;
+            SOLE_TRACE(EV_AXI_B_HANDSHAKE, write_response_received_num);
+        }
+
+        // WRITE_ADDR Handshake occurred: push the beats of the burst
         bool WRITE_ADDR_handshake = M_AXI_AWVALID.read() && M_AXI_AWREADY.read();
         if (WRITE_ADDR_handshake) { 
-            write_addr_sent_num++;
+            write_addr_sent_num += (uint32_t)M_AXI_AWLEN.read() + 1;
             write_addr_sent_num_sig.write(write_addr_sent_num);
-            std::cerr << "[WRITE_ADDR_HANDSHAKE] write_addr_sent_num now " << write_addr_sent_num 
-                    << " @" << sc_time_stamp() << std::endl;
+            write_burst_beats[(write_burst_head + write_burst_count) % AXI_WRITE_MAX_OUTSTANDING] =
+                (uint16_t)(M_AXI_AWLEN.read() + 1);
+            write_burst_count++;
+            SOLE_TRACE(EV_AXI_AW_HANDSHAKE, write_addr_sent_num);
         }
         
-        if (write_addr_sent_num * 4 < total_length && stage4_valid) {
-            sc_uint64 next_dst_addr = dst_base + (sc_uint64)write_addr_sent_num * 8;
+        if (write_addr_sent_num * SOLE_LANES < total_length && stage4_valid &&
+            write_burst_count < AXI_WRITE_MAX_OUTSTANDING) {
+            sc_uint64 next_dst_addr = dst_base + (sc_uint64)write_addr_sent_num * AXI_BEAT_BYTES;
+            uint32_t beats = axi_burst_beats(next_dst_addr, total_beats - write_addr_sent_num, max_beats);
             M_AXI_AWADDR.write((sc_dt::sc_uint<32>)(next_dst_addr & 0xFFFFFFFF));
+            M_AXI_AWLEN.write(beats - 1);
             M_AXI_AWVALID.write(true);  
-            std::cerr << "[AWADDR]" << (sc_dt::sc_uint<32>)(next_dst_addr & 0xFFFFFFFF)
-                            << " @" << sc_time_stamp() << std::endl;
+            SOLE_TRACE(EV_AXI_AW_ISSUE, next_dst_addr & 0xFFFFFFFF, beats - 1);
 
         } else {
             // All writes sent, deassert AWVALID
@@ -516,34 +784,26 @@ void Softmax::axi_write_request_process() {
 
 
         //====================WRITE DATA========================
-        M_AXI_WSTRB.write(0xFF);    // Set write strb to enabled all 8 bytes when writing
+        M_AXI_WSTRB.write(~sc_dt::sc_uint<AXI_STRB_WIDTH>(0));    // Enable all bytes of the beat when writing
 
         bool WRITE_DATA_handshake = M_AXI_WVALID.read() && M_AXI_WREADY.read();
-        std::cerr << "\033[35m" << "M_AXI_WVALID: " << M_AXI_WVALID.read() << " M_AXI_WREADY: " << M_AXI_WREADY.read() << "\033[0m" << " @" << sc_time_stamp()<< std::endl;
+        SOLE_TRACE(EV_AXI_W_CHANNEL, M_AXI_WVALID.read(), M_AXI_WREADY.read());
         if (WRITE_DATA_handshake) { 
             write_data_sent_num++;
             write_data_sent_num_sig.write(write_data_sent_num);
+            SOLE_TRACE(EV_AXI_W_HANDSHAKE, write_data_sent_num, M_AXI_WDATA.read().to_uint64());
+        }
 
-            sc_uint64 data = M_AXI_WDATA.read();
-            std::cerr << "\033[34m" << "[WRITE_DATA_HANDSHAKE] " << "\033[34m" <<"Num: " << std::dec << write_data_sent_num 
-                    << "\033[34m" << " WRITE DATA : 0x" 
-                    << std::hex << std::setfill('0')
-                    << std::setw(4) << data.range(63, 48) << " "
-                    << std::setw(4) << data.range(47, 32) << " "
-                    << std::setw(4) << data.range(31, 16) << " "
-                    << std::setw(4) << data.range(15, 0)
-                    << "\033[0m" << " @" << sc_time_stamp() << std::dec << std::endl;
+        // Next W beat starts a new burst: find where it ends
+        if (write_data_sent_num >= write_burst_end && write_data_sent_num < total_beats) {
+            sc_uint64 burst_addr = dst_base + (sc_uint64)write_data_sent_num * AXI_BEAT_BYTES;
+            write_burst_end = write_data_sent_num + axi_burst_beats(burst_addr, total_beats - write_data_sent_num, max_beats);
         }
-        /*sc_uint64 data_1 = M_AXI_WDATA.read();
-        std::cerr << "[WRITE_DATA] " << "\033[34m" << "DATA : 0x"   
-                    << std::hex 
-                    << data_1.range(63, 48) << " "
-                    << data_1.range(47, 32) << " "
-                    << data_1.range(31, 16) << " "
-                    << data_1.range(15, 0)
-                    << "\033[0m" << " @" << sc_time_stamp() << std::dec << std::endl;*/
-
-        if (write_data_sent_num * 4 < total_length && stage4_valid) {
+        M_AXI_WLAST.write(write_data_sent_num + 1 == write_burst_end);
+
+        // WVALID is registered: after a handshake the stage3 beat (or a bubble) moves into stage4
+        bool next_w_valid = WRITE_DATA_handshake ? process3_stage3_valid.read() : stage4_valid;
+        if (write_data_sent_num * SOLE_LANES < total_length && next_w_valid) {
             M_AXI_WVALID.write(true);  
         } else {
             M_AXI_WVALID.write(false);  
@@ -551,21 +811,15 @@ void Softmax::axi_write_request_process() {
 
         //====================WRITE RESPONSE========================
         M_AXI_BREADY.write(true);
-  
-        bool WRITE_RESP_handshake = M_AXI_BVALID.read() && M_AXI_BREADY.read();
-        if (WRITE_RESP_handshake) { 
-            write_response_received_num++;
-            write_response_received_num_sig.write(write_response_received_num);
-            std::cerr << "\033[1;34m" << "[WRITE_RESP_HANDSHAKE] write_response_received_num now " << write_response_received_num 
-                    << "\033[0m" << " @" << sc_time_stamp() << std::endl;
-        }
 
     }
     else {
-        // Not in write states
+        // Not in write states, or PROCESS3 finished a row that is followed by another row
         M_AXI_AWADDR.write(0);
+        M_AXI_AWLEN.write(0);
         M_AXI_AWVALID.write(false);
         M_AXI_WSTRB.write(0);
+        M_AXI_WLAST.write(false);
         M_AXI_WVALID.write(false);
         M_AXI_BREADY.write(false);
         write_addr_sent_num_sig.write(0);
@@ -574,8 +828,9 @@ void Softmax::axi_write_request_process() {
         write_addr_sent_num = 0;
         write_data_sent_num = 0;
         write_response_received_num = 0;
-        prev_stage3_valid = false;
-        prev_stall = false;
+        write_burst_end = 0;
+        write_burst_head = 0;
+        write_burst_count = 0;
     }
 }
 
@@ -586,12 +841,13 @@ void Softmax::axi_write_request_process() {
  * - Once slave is ready and handshake succeeds, clear stall signal
  */
 void Softmax::stall_process3_control() {
-    sc_uint2 state_now = state.read();
-    // Data has arrived at stage4 (aligned with M_AXI_WDATA), but AXI slave is not ready to accept data
-    bool STALL_PROCESS = process3_stage4_valid.read() && !M_AXI_WREADY.read();
+    SOLE_PROFILE_PROCESS();
+    // Data has arrived at stage4 (aligned with M_AXI_WDATA), but the W handshake has not taken it yet
+    // (slave not ready, or WVALID not yet raised for a beat that follows a bubble)
+    bool STALL_PROCESS = process3_stage4_valid.read() && !(M_AXI_WVALID.read() && M_AXI_WREADY.read());
     if (rst.read()) {
         process3_stall.write(false);
-    } else if (state_now == STATE_PROCESS3) {
+    } else if (p3_active.read()) {
         process3_stall.write(STALL_PROCESS);
     } else {
         process3_stall.write(false);
@@ -600,20 +856,27 @@ void Softmax::stall_process3_control() {
 
 
 void Softmax::validity_signal_update() {
-    process1_read_data_valid.write( M_AXI_RVALID.read() && M_AXI_RREADY.read());
+    SOLE_PROFILE_PROCESS();
+    bool r_handshake = M_AXI_RVALID.read() && M_AXI_RREADY.read();
+    // A slave may return the first beat in the cycle its AR is accepted
+    bool head_issued = read_head_issued_sig.read() || (M_AXI_ARVALID.read() && M_AXI_ARREADY.read());
+    bool bypass = r_handshake && head_issued && M_AXI_RID.read() == read_head_id_sig.read();
+    if (rob_head_valid_sig.read()) {
+        process1_read_data_valid.write(true);
+        process1_read_data.write(rob_head_data_sig.read());
+    } else {
+        process1_read_data_valid.write(bypass);
+        process1_read_data.write(M_AXI_RDATA.read());
+    }
     process3_read_data_valid.write(max_fifo_read_en.read());
 
 }
 
 void Softmax::dubug_print() {
-    bool max_fifo_pop = !process3_stall.read();  
-    bool output_fifo_pop = (!process3_stall.read()) && process3_stage2_valid.read();
-
+    SOLE_PROFILE_PROCESS();
     bool axi_write_handshake = (M_AXI_WVALID.read() && M_AXI_WREADY.read());
-    std::cerr << "\033[32m" << "[axi_write_handshake]: " << axi_write_handshake 
-              << "[process3_stall]: " << process3_stall.read() << "\033[0m" << " @" << sc_time_stamp() << std::endl;
-    std::cerr << "\033[32m" << "[max_fifo_read_en]: " << max_fifo_read_en.read() 
-              << "[output_fifo_read_en]: " << output_fifo_read_en.read() << "\033[0m" << " @" << sc_time_stamp() << std::endl;
+    SOLE_TRACE(EV_FIFO_READ_CTRL, axi_write_handshake, process3_stall.read(),
+               max_fifo_read_en.read(), output_fifo_read_en.read());
 }
  
 
@@ -631,26 +894,30 @@ void Softmax::dubug_print() {
  * Clock 2: p3_finish=1, p3_finish_prev=1 → No rising edge → done_pulse=0, p3_finish_prev=1
  * 
  * This ensures only ONE clock cycle with done_pulse=1
+ * A batched job (row_count > 1) pulses only when its last row completes.
  */
 void Softmax::done_pulse_handler() {
+    SOLE_PROFILE_PROCESS();
     sc_uint32 waddr_count = write_addr_sent_num_sig.read();
     sc_uint32 wdata_count = write_data_sent_num_sig.read();
     sc_uint32 wresp_count = write_response_received_num_sig.read();
     sc_uint64 length = data_length.read();
     
     // Check if all write operations are complete
-    bool p3_finish = (waddr_count * 4 >= length) && 
-                     (wdata_count * 4 >= length) && 
-                     (wresp_count * 4 >= length);
+    bool p3_finish = (waddr_count * SOLE_LANES >= length) && 
+                     (wdata_count * SOLE_LANES >= length) && 
+                     (wresp_count * SOLE_LANES >= length);
     
     // Read previous cycle's p3_finish state
     bool p3_finish_prev = done_pulse_prev.read();
+    uint32_t rows = row_count.read() ? row_count.read().to_uint() : 1;
+    bool last_row = p3_row_sig.read() + 1 >= rows;
     
     if (rst.read()) {
         done_pulse.write(false);
         done_pulse_prev.write(false);
     }
-    else if (p3_finish && !p3_finish_prev) {
+    else if (p3_finish && !p3_finish_prev && last_row) {
         done_pulse.write(true);
     }
     else {
@@ -662,19 +929,23 @@ void Softmax::done_pulse_handler() {
 }
 
 void Softmax::error_detection_process() {
+    SOLE_PROFILE_PROCESS();
     using namespace softmax::status;
     
     sc_uint2 current_state = state.read();
+    bool p3_now = p3_active.read();
     sc_uint64 total_length = data_length.read();
     bool start_signal = start.read();
-    
-    // Static counters for timeout detection (maintained across cycles)
-    static sc_uint32 read_timeout_counter = 0;
-    static sc_uint32 write_timeout_counter = 0;
+    // Read channel in use: PROCESS1, and PROCESS3 in re-read mode
+    bool read_pass = (current_state == STATE_PROCESS1) || (p3_now && reread_mode.read());
+    // No-handshake limit: on a shared port other masters' bursts may be served first
+    const uint32_t timeout_threshold = AXI_TIMEOUT_THRESHOLD + bus_bursts_ahead * ((uint32_t)burst_len.read() + 1);
     
     // Check for error conditions
     bool error_detected = false;
     uint8_t error_code = ERR_NONE;
+    read_timeout_counting = false;
+    write_timeout_counting = false;
     
     // ===== Check for Invalid State =====
     // Ensure current_state is within valid range (0-3)
@@ -684,9 +955,10 @@ void Softmax::error_detection_process() {
     }
     
     // ===== Check for Data Length Error =====
-    // Data length is invalid at start: zero or exceeds configured DATA_LENGTH_MAX.
-    if (!error_detected && current_state == STATE_IDLE && start_signal &&
-        (total_length == 0 || total_length > DATA_LENGTH_MAX)) {
+    // Data length is invalid at start: zero or above DATA_LENGTH_REREAD_MAX (longer rows
+    // than DATA_LENGTH_MAX run in re-read mode).
+    if (!error_detected && current_state == STATE_IDLE && !p3_now && start_signal &&
+        (total_length == 0 || total_length > DATA_LENGTH_REREAD_MAX)) {
         error_detected = true;
         error_code = ERR_DATA_LENGTH_INVALID;
     }
@@ -704,7 +976,7 @@ void Softmax::error_detection_process() {
     }
     
     // ===== Check for AXI Read Error =====
-    if (!error_detected && current_state == STATE_PROCESS1) {
+    if (!error_detected && read_pass) {
         // Check AXI read response error
         // RRESP: 2'b00 = OKAY, 2'b01 = EXOKAY, 2'b10 = SLVERR, 2'b11 = DECERR
         bool read_error_occurred = M_AXI_RVALID.read() && M_AXI_RREADY.read() && 
@@ -725,16 +997,13 @@ void Softmax::error_detection_process() {
             error_detected = true;
             error_code = ERR_AXI_READ_DATA_MISSING;
         }
-        // Debugging: print the number of addresses sent and data received at the end of PROCESS1
-        std::cerr << "-----------[Data Read Details]---------" << std::endl;
-        std::cerr << "   Read Data Received: " << data_received << std::endl;
-        std::cerr << "   Read Addr Sent: " << addr_sent << std::endl;
-        std::cerr << "   Max FIFO Count: " << max_fifo_count.read() << std::endl;
-        std::cerr << "   Output FIFO Count: " << output_fifo_count.read() << std::endl;
+        // Debugging: record the number of addresses sent and data received at the end of PROCESS1
+        SOLE_TRACE(EV_STATE_READ_DONE, data_received, addr_sent,
+                   max_fifo_count.read(), output_fifo_count.read());
     }
     
     // ===== Check for AXI Write Error =====
-    if (!error_detected && current_state == STATE_PROCESS3) {
+    if (!error_detected && p3_now) {
         // Check AXI write response error
         // BRESP: 2'b00 = OKAY, 2'b01 = EXOKAY, 2'b10 = SLVERR, 2'b11 = DECERR
         bool write_error_occurred = M_AXI_BVALID.read() && M_AXI_BREADY.read() && 
@@ -758,44 +1027,44 @@ void Softmax::error_detection_process() {
             error_detected = true;
             error_code = ERR_AXI_WRITE_RESPONSE_MISMATCH;
         }
-        std::cerr << "-----------[Data Write Details]---------" << std::endl;
-        std::cerr << "   Write Addr Count: " << addr_sent << std::endl;
-        std::cerr << "   Write Data Count: " << data_sent << std::endl;
-        std::cerr << "   Write Response Count: " << resp_received << std::endl;
-        
+        SOLE_TRACE(EV_STATE_WRITE_DONE, addr_sent, data_sent, resp_received);
     }
     
     // ===== Check for AXI Read Timeout =====
     // Track READ_DATA handshake (M_AXI_RVALID && M_AXI_RREADY) inactivity
-    if (!error_detected && current_state == STATE_PROCESS1) {
+    if (!error_detected && read_pass) {
         bool read_data_handshake = M_AXI_RVALID.read() && M_AXI_RREADY.read();
         bool read_addr_handshake = M_AXI_ARVALID.read() && M_AXI_ARREADY.read();
         bool any_read_handshake = read_data_handshake || read_addr_handshake;
         sc_uint32 pack_received = read_data_received_count_sig.read();
-        sc_uint64 data_received = (sc_uint64)pack_received * 4;
+        sc_uint64 data_received = (sc_uint64)pack_received * SOLE_LANES;
+        // The re-read pass also waits for PROCESS3 (read window): only count with an AR or R pending
+        bool read_waiting = (current_state == STATE_PROCESS1) || M_AXI_ARVALID.read() ||
+                            (read_addr_sent_num_sig.read() > pack_received);
         
-        if (any_read_handshake) {
+        if (any_read_handshake || !read_waiting) {
             // Handshake occurred: reset timeout counter
             read_timeout_counter = 0;
         } else if (data_received < total_length) {
             // No handshake and transfer incomplete: increment timeout counter
             read_timeout_counter++;
+            read_timeout_counting = true;
             
-            // Timeout detected if counter >= AXI_TIMEOUT_THRESHOLD
-            if (read_timeout_counter >= AXI_TIMEOUT_THRESHOLD) {
+            // Timeout detected if counter >= timeout_threshold
+            if (read_timeout_counter >= timeout_threshold) {
                 error_detected = true;
                 error_code = ERR_AXI_READ_TIMEOUT;
             }
         }
     }
-    // When not in PROCESS1, reset read timeout counter
-    else if (current_state != STATE_PROCESS1) {
+    // When the read channel is not in use, reset read timeout counter
+    else if (!read_pass) {
         read_timeout_counter = 0;
     }
     
     // ===== Check for AXI Write Timeout =====
     // Track any write handshake inactivity (AWVALID&&AWREADY OR WVALID&&WREADY OR BVALID&&BREADY)
-    if (!error_detected && current_state == STATE_PROCESS3) {
+    if (!error_detected && p3_now) {
         bool write_addr_handshake = M_AXI_AWVALID.read() && M_AXI_AWREADY.read();
         bool write_data_handshake = M_AXI_WVALID.read() && M_AXI_WREADY.read();
         bool write_resp_handshake = M_AXI_BVALID.read() && M_AXI_BREADY.read();
@@ -803,9 +1072,9 @@ void Softmax::error_detection_process() {
         sc_uint32 addr_pack_sent = write_addr_sent_num_sig.read();
         sc_uint32 data_pack_sent = write_data_sent_num_sig.read();
         sc_uint32 resp_received = write_response_received_num_sig.read();
-        sc_uint64 addr_sent = (sc_uint64)addr_pack_sent * 4;
-        sc_uint64 data_sent = (sc_uint64)data_pack_sent * 4;
-        sc_uint64 resp_recv = (sc_uint64)resp_received * 4;
+        sc_uint64 addr_sent = (sc_uint64)addr_pack_sent * SOLE_LANES;
+        sc_uint64 data_sent = (sc_uint64)data_pack_sent * SOLE_LANES;
+        sc_uint64 resp_recv = (sc_uint64)resp_received * SOLE_LANES;
         
         // Check if transfer incomplete
         bool transfer_incomplete = (addr_sent < total_length) || (data_sent < total_length) || (resp_recv < total_length);
@@ -815,22 +1084,24 @@ void Softmax::error_detection_process() {
             // Any write handshake occurred: reset timeout counter
             write_timeout_counter = 0;
         } else if (transfer_incomplete && !any_write_handshake &&
-                   (M_AXI_AWVALID.read() || M_AXI_WVALID.read() || M_AXI_BREADY.read())) {
-            // No handshake while AWVALID/WVALID/BVALID is asserted: increment timeout counter.
+                   (M_AXI_AWVALID.read() || M_AXI_WVALID.read() ||
+                    (M_AXI_BREADY.read() && resp_received < addr_pack_sent))) {
+            // No handshake while AWVALID/WVALID is asserted or a B is due: increment timeout counter.
             write_timeout_counter++;
+            write_timeout_counting = true;
         } else {
             // Do not count idle pipeline bubbles as AXI timeout.
             write_timeout_counter = 0;
         }
             
-        // Timeout detected if counter >= AXI_TIMEOUT_THRESHOLD
-        if (write_timeout_counter >= AXI_TIMEOUT_THRESHOLD) {
+        // Timeout detected if counter >= timeout_threshold
+        if (write_timeout_counter >= timeout_threshold) {
             error_detected = true;
             error_code = ERR_AXI_WRITE_TIMEOUT;
         }
     }
     // When not in PROCESS3, reset write timeout counter
-    else if (current_state != STATE_PROCESS3) {
+    else if (!p3_now) {
         write_timeout_counter = 0;
     }
     
@@ -838,3 +1109,27 @@ void Softmax::error_detection_process() {
     has_error.write(error_detected);
     error_code_sig.write(error_code);
 }
+
+uint64_t Softmax::idle_cycle_limit() const {
+    const uint32_t timeout_threshold = AXI_TIMEOUT_THRESHOLD + bus_bursts_ahead * ((uint32_t)burst_len.read() + 1);
+    uint64_t limit = UINT64_MAX;
+    // A counting counter reaches the threshold (and raises the error) at a real edge
+    if (read_timeout_counting) {
+        uint32_t count = read_timeout_counter.to_uint();
+        limit = std::min<uint64_t>(limit, count + 1 < timeout_threshold ? timeout_threshold - count - 1 : 0);
+    }
+    if (write_timeout_counting) {
+        uint32_t count = write_timeout_counter.to_uint();
+        limit = std::min<uint64_t>(limit, count + 1 < timeout_threshold ? timeout_threshold - count - 1 : 0);
+    }
+    return limit;
+}
+
+void Softmax::skip_cycles(uint64_t cycles) {
+    if (read_timeout_counting) {
+        read_timeout_counter += (uint32_t)cycles;
+    }
+    if (write_timeout_counting) {
+        write_timeout_counter += (uint32_t)cycles;
+    }
+}
@@ -0,0 +1,665 @@
+#include "Softmax_Cycle.h"
+#include "Softmax.h"
+#include "Log2Exp.h"
+#include "Divider.h"
+#include "Divider_PreCompute.h"
+#include "utils.hpp"
+
+using namespace softmax::status;
+
+static constexpr uint32_t MAX_FIFO_MASK = (1u << MAX_FIFO_ADDR_BITS) - 1u;
+static constexpr uint32_t OUTPUT_FIFO_MASK = (1u << OUTPUT_FIFO_ADDR_BITS) - 1u;
+static_assert(Softmax_Cycle::READ_MAX_OUTSTANDING == AXI_READ_MAX_OUTSTANDING, "read tracker size");
+static_assert(Softmax_Cycle::READ_ROB_DEPTH == AXI_READ_ROB_DEPTH, "reorder buffer size");
+static_assert(SOLE_LANES == 4, "the cycle model is the 4-lane (64-bit AXI) datapath");
+
+/**
+ * @brief FP16 subtraction, same as PROCESS_1 / PROCESS_3
+ */
+static uint16_t fp16_subtract(uint16_t a_bits, uint16_t b_bits) {
+    return fp16_add((fp16_t)a_bits, (fp16_t)(b_bits ^ 0x8000));
+}
+
+static uint16_t fp16_max16(uint16_t a_bits, uint16_t b_bits) {
+    return fp16_max(sc_uint16(a_bits), sc_uint16(b_bits)).to_uint();
+}
+
+static uint8_t log2exp(uint16_t fp16_in_val) {
+    return log2exp_fp16(sc_uint16(fp16_in_val)).to_uint();
+}
+
+Softmax_Cycle::Softmax_Cycle()
+    : cur(), nxt(), w(),
+      max_fifo_mem(MAX_FIFO_MASK + 1, 0), out_fifo_mem(OUTPUT_FIFO_MASK + 1, 0) {
+    commit_pins();
+}
+
+void Softmax_Cycle::commit_pins() {
+    axi.awaddr  = cur.awaddr;
+    axi.awlen   = cur.awlen;
+    axi.awvalid = cur.awvalid;
+    axi.wdata   = cur.p3_s4.Output;
+    axi.wstrb   = cur.wstrb;
+    axi.wlast   = cur.wlast;
+    axi.wvalid  = cur.wvalid;
+    axi.bready  = cur.bready;
+    axi.arid    = cur.arid;
+    axi.araddr  = cur.araddr;
+    axi.arlen   = cur.arlen;
+    axi.arvalid = cur.arvalid;
+    axi.rready  = cur.rready;
+}
+
+uint32_t Softmax_Cycle::status() const {
+    uint32_t status_value = 0;
+    if (cur.done_pulse) {
+        status_value |= (1 << 0);
+    }
+    status_value |= ((uint32_t)(cur.state & 0x3) << 1);
+    if (cur.has_error) {
+        status_value |= (1 << 3);
+    }
+    status_value |= ((uint32_t)(cur.error_code & 0xF) << 4);
+    return status_value;
+}
+
+/**
+ * @brief Max_FIFO / Output_FIFO flags, gate_signals, read_output and read_data_valid_flag
+ */
+void Softmax_Cycle::settle_fifo(const Fifo& f, uint32_t mask, bool write_en, bool read_ready,
+                                bool& we, bool& re, bool& full, bool& read_valid, uint16_t& data_out) const {
+    bool empty = (f.write_addr == f.read_addr);
+    full = (((f.write_addr + 1) & mask) == f.read_addr);
+
+    unsigned buffered = (f.skid_valid ? 1u : 0u) + (f.sram_output_data_valid ? 1u : 0u);
+    we = write_en && !full;
+    re = false;
+    if (!empty) {
+        if (read_ready) {
+            re = (buffered < 2u);
+        } else {
+            re = !f.skid_valid && !f.sram_output_data_valid;
+        }
+    }
+    read_valid = f.sram_output_data_valid || f.skid_valid;
+    data_out = f.skid_valid ? f.skid_reg : f.sram_rdata;
+}
+
+/**
+ * @brief Combinational logic of the current cycle (every SC_METHOD not on clk.pos())
+ *
+ * The PROCESS_2 output stall register is level-sensitive (its SC_METHOD has no
+ * clock), so it is updated here as well.
+ */
+void Softmax_Cycle::settle() {
+    Regs& r = cur;
+
+    // update_rst_modules
+    w.rst_modules = rst || r.has_error;
+
+    // PROCESS_2: Output_Stall (stall_output = state != PROCESS2, Pre_Compute_Valid = state 2 or 3)
+    if (w.rst_modules) {
+        r.p2_lo_pos = 0;
+        r.p2_mux_result = 0;
+        r.p2_output_valid = false;
+    } else {
+        if (r.state != STATE_PROCESS2 && r.state != STATE_PROCESS3) {
+            r.p2_output_valid = false;
+        }
+        if (r.process_2_enable && r.state == STATE_PROCESS2) {
+            r.p2_lo_pos = find_leading_one_pos(sole_sum_t(r.Sum_Buffer_Out)).to_uint();
+            r.p2_mux_result = divider_threshold(sole_sum_t(r.Sum_Buffer_Out)).to_uint();
+            r.p2_output_valid = true;
+        }
+    }
+
+    // validity_signal_update (process1 side): reorder buffer head, else the next beat on R
+    bool head_issued = r.read_head_issued || (r.arvalid && axi.arready);
+    bool bypass = axi.rvalid && r.rready && head_issued && axi.rid == r.read_head_id;
+    if (r.rob_head_valid) {
+        w.p1_read_data_valid = true;
+        w.p1_read_data = r.rob_head_data;
+    } else {
+        w.p1_read_data_valid = bypass;
+        w.p1_read_data = axi.rdata;
+    }
+
+    // PROCESS_1: MaxUnit stage 2 and Output_Comb (Reduction final_sum)
+    w.Max_Out = fp16_max16(r.max_R1, r.max_R2);
+    uint32_t reduction_output = r.pipe_add0 + r.pipe_add1;
+    w.Sum_Buffer_Update = (r.Sum_Buffer_Out >> r.p1_s5.Right_Shift_Num) + reduction_output;
+
+    // state_transition_flag
+    uint64_t total_length = data_length;
+    w.p1_finish = ((uint64_t)r.read_data_delivered_count_sig * 4 >= total_length) &&
+                  ((uint64_t)r.max_fifo.count * 4 >= total_length) &&
+                  ((uint64_t)r.out_fifo.count * 4 >= total_length) &&
+                  r.state == STATE_PROCESS1;
+    w.p3_finish = ((uint64_t)r.write_addr_sent_num_sig * 4 >= total_length) &&
+                  ((uint64_t)r.write_data_sent_num_sig * 4 >= total_length) &&
+                  ((uint64_t)r.write_response_received_num_sig * 4 >= total_length) &&
+                  r.state == STATE_PROCESS3;
+
+    // stall_process3_control
+    if (rst) {
+        w.p3_stall = false;
+    } else if (r.state == STATE_PROCESS3) {
+        w.p3_stall = r.p3_s4.data_valid && !axi.wready;
+    } else {
+        w.p3_stall = false;
+    }
+
+    // manage_fifo_control
+    bool fifo_write_disable = rst || r.has_error || (r.state != STATE_PROCESS1);
+    w.max_fifo_write_en = fifo_write_disable ? false : r.p1_s1.data_valid;
+    w.out_fifo_write_en = fifo_write_disable ? false : r.p1_s5.data_valid;
+    bool fifo_read_disable = rst || r.has_error || (r.state != STATE_PROCESS3);
+    w.max_fifo_read_en = fifo_read_disable ? false : !w.p3_stall;
+    w.out_fifo_read_en = fifo_read_disable ? false : (!w.p3_stall && r.p3_s2.data_valid);
+    w.fifo_clear = rst || r.has_error;
+
+    // Max_FIFO / Output_FIFO
+    settle_fifo(r.max_fifo, MAX_FIFO_MASK, w.max_fifo_write_en, w.max_fifo_read_en,
+                w.max_we, w.max_re, w.max_full, w.max_read_valid, w.max_data_out);
+    settle_fifo(r.out_fifo, OUTPUT_FIFO_MASK, w.out_fifo_write_en, w.out_fifo_read_en,
+                w.out_we, w.out_re, w.out_full, w.out_read_valid, w.out_data_out);
+}
+
+/**
+ * @brief Max_FIFO / Output_FIFO clocked processes and their SRAM
+ *
+ * pointer_update, count_update, output_pipeline_update and SRAM::memory_process.
+ * The SRAM array is only read and written here, so it is updated in place.
+ */
+void Softmax_Cycle::eval_fifo(const Fifo& f, Fifo& n, uint32_t mask, std::vector<uint16_t>& mem,
+                              bool& mem_clear, bool we, bool re, bool read_ready, bool read_valid,
+                              uint16_t data_in) {
+    bool reset = w.rst_modules;
+    bool clear = w.fifo_clear;
+
+    // pointer_update
+    if (reset) {
+        n.write_addr = 0;
+        n.read_addr = 0;
+    } else if (clear) {
+        n.read_addr = f.write_addr;
+    } else {
+        if (we) {
+            n.write_addr = (f.write_addr + 1) & mask;
+        }
+        if (re) {
+            n.read_addr = (f.read_addr + 1) & mask;
+        }
+    }
+
+    // count_update
+    if (reset || clear) {
+        n.count = 0;
+    } else {
+        bool accepted_read_handshake = read_ready && read_valid;
+        if (we && !accepted_read_handshake) {
+            n.count = (f.count + 1) & mask;
+        } else if (!we && accepted_read_handshake) {
+            n.count = (f.count - 1) & mask;
+        }
+    }
+
+    // output_pipeline_update
+    if (reset || clear) {
+        n.skid_reg = 0;
+        n.skid_valid = false;
+        n.sram_output_data_valid = false;
+    } else {
+        bool skid_valid_next = f.skid_valid;
+        if (read_ready && skid_valid_next) {
+            skid_valid_next = false;
+        }
+        if (f.sram_output_data_valid) {
+            bool bypass_consumed = read_ready && !f.skid_valid;
+            if (!bypass_consumed) {
+                skid_valid_next = true;
+                n.skid_reg = f.sram_rdata;
+            }
+        }
+        n.skid_valid = skid_valid_next;
+        n.sram_output_data_valid = re;
+    }
+
+    // SRAM::memory_process (rdata_reg keeps its value through reset)
+    if (reset) {
+        if (!mem_clear) {
+            std::fill(mem.begin(), mem.end(), 0);
+            mem_clear = true;
+        }
+        n.sram_rdata = 0;
+    } else {
+        if (we) {
+            mem[f.write_addr] = data_in;
+            mem_clear = false;
+        }
+        if (re) {
+            n.sram_rdata_reg = mem[f.read_addr];
+        }
+        n.sram_rdata = n.sram_rdata_reg;
+    }
+}
+
+/**
+ * @brief Next value of every clocked register (every SC_METHOD on clk.pos())
+ */
+void Softmax_Cycle::eval() {
+    settle();
+
+    const Regs& r = cur;
+    Regs& n = nxt;
+    n = cur;
+
+    uint64_t total_length = data_length;
+    uint64_t total_beats = (total_length + 3) / 4;
+    uint32_t max_beats = (uint32_t)burst_len + 1;
+    uint32_t max_txns = read_outstanding;
+    if (max_txns == 0 || max_txns > READ_MAX_OUTSTANDING) {
+        max_txns = READ_MAX_OUTSTANDING;
+    }
+
+    // ===== Buffer_Update =====
+    if (rst) {
+        n.global_max_reg = 0;
+        n.sum_buffer_reg = 0;
+        n.Global_Max_Buffer_Out = 0;
+        n.Sum_Buffer_Out = 0;
+    } else {
+        if (r.state == STATE_PROCESS1) {
+            if (r.p1_s1.data_valid) {
+                n.global_max_reg = fp16_max16(r.global_max_reg, w.Max_Out);
+            }
+            if (r.p1_s5.data_valid) {
+                n.sum_buffer_reg = w.Sum_Buffer_Update;
+            }
+        }
+        n.Global_Max_Buffer_Out = n.global_max_reg;
+        n.Sum_Buffer_Out = n.sum_buffer_reg;
+    }
+
+    // ===== axi_read_address_process =====
+    if (rst) {
+        n.arid = 0;
+        n.araddr = 0;
+        n.arlen = 0;
+        n.arvalid = false;
+        n.rready = false;
+        n.read_addr_sent_num = 0;
+        n.read_data_received_num = 0;
+        n.read_data_delivered_num = 0;
+        n.read_txn_issued = 0;
+        n.read_txn_retired = 0;
+        std::fill(std::begin(rob_valid), std::end(rob_valid), false);
+        n.read_data_received_count_sig = 0;
+        n.read_data_delivered_count_sig = 0;
+        n.read_addr_sent_num_sig = 0;
+    } else if (r.state == STATE_PROCESS1) {
+        bool ar_handshake = r.arvalid && axi.arready;
+        if (ar_handshake) {
+            Read_Txn& txn = read_txn[r.arid];
+            txn.start = n.read_addr_sent_num;
+            txn.beats = (uint32_t)r.arlen + 1;
+            txn.received = 0;
+            n.read_addr_sent_num += txn.beats;
+            n.read_txn_issued++;
+            n.read_addr_sent_num_sig = n.read_addr_sent_num;
+        }
+
+        if (axi.rvalid && r.rready) {
+            Read_Txn& txn = read_txn[axi.rid];
+            uint32_t beat = txn.start + txn.received;
+            txn.received++;
+            n.read_data_received_num++;
+            bool bypass = !r.rob_head_valid && (r.read_head_issued || ar_handshake) &&
+                          axi.rid == r.read_head_id;
+            if (!bypass) {
+                rob_data[beat % READ_ROB_DEPTH] = axi.rdata;
+                rob_valid[beat % READ_ROB_DEPTH] = true;
+            }
+        }
+
+        if (w.p1_read_data_valid) {
+            rob_valid[n.read_data_delivered_num % READ_ROB_DEPTH] = false;
+            n.read_data_delivered_num++;
+            const Read_Txn& head = read_txn[r.read_head_id];
+            if (n.read_data_delivered_num == head.start + head.beats) {
+                n.read_txn_retired++;
+            }
+        }
+        n.read_data_received_count_sig = n.read_data_received_num;
+        n.read_data_delivered_count_sig = n.read_data_delivered_num;
+
+        uint32_t outstanding_beats = n.read_addr_sent_num - n.read_data_delivered_num;
+        if ((uint64_t)n.read_addr_sent_num * 4 < total_length) {
+            uint64_t addr = src_addr_base + (uint64_t)n.read_addr_sent_num * 8;
+            uint32_t beats = axi_burst_beats(addr, total_beats - n.read_addr_sent_num, std::min(max_beats, READ_ROB_DEPTH));
+            n.arid = (uint8_t)(n.read_txn_issued % READ_MAX_OUTSTANDING);
+            n.araddr = (uint32_t)addr;
+            n.arlen = (uint8_t)(beats - 1);
+            n.arvalid = (n.read_txn_issued - n.read_txn_retired < max_txns) &&
+                        (outstanding_beats + beats <= READ_ROB_DEPTH);
+        } else {
+            n.arvalid = false;
+        }
+
+        n.rready = ((uint64_t)n.read_data_received_num * 4 < total_length);
+    } else {
+        if (r.read_txn_issued != 0) {
+            std::fill(std::begin(rob_valid), std::end(rob_valid), false);
+        }
+        n.read_addr_sent_num = 0;
+        n.read_data_received_num = 0;
+        n.read_data_delivered_num = 0;
+        n.read_txn_issued = 0;
+        n.read_txn_retired = 0;
+        n.read_addr_sent_num_sig = 0;
+        n.read_data_received_count_sig = 0;
+        n.read_data_delivered_count_sig = 0;
+    }
+    uint32_t rob_head = n.read_data_delivered_num % READ_ROB_DEPTH;
+    n.read_head_id = (uint8_t)(n.read_txn_retired % READ_MAX_OUTSTANDING);
+    n.read_head_issued = n.read_txn_retired < n.read_txn_issued;
+    n.rob_head_valid = rob_valid[rob_head];
+    n.rob_head_data = rob_data[rob_head];
+
+    // ===== axi_write_request_process =====
+    bool stage4_valid = r.p3_s4.data_valid;
+    if (!rst && r.state == STATE_PROCESS3) {
+        // B pops the beats of the oldest AW burst, the AW handshake pushes its burst
+        if (axi.bvalid && r.bready && r.write_burst_count > 0) {
+            n.write_response_received_num += write_burst_beats[r.write_burst_head];
+            n.write_response_received_num_sig = n.write_response_received_num;
+            n.write_burst_head = (uint8_t)((r.write_burst_head + 1) % WRITE_MAX_OUTSTANDING);
+            n.write_burst_count--;
+        }
+        if (r.awvalid && axi.awready) {
+            n.write_addr_sent_num += (uint32_t)r.awlen + 1;
+            n.write_addr_sent_num_sig = n.write_addr_sent_num;
+            write_burst_beats[(r.write_burst_head + r.write_burst_count) % WRITE_MAX_OUTSTANDING] =
+                (uint16_t)(r.awlen + 1);
+            n.write_burst_count++;
+        }
+        if ((uint64_t)n.write_addr_sent_num * 4 < total_length && stage4_valid &&
+            n.write_burst_count < WRITE_MAX_OUTSTANDING) {
+            uint64_t addr = dst_addr_base + (uint64_t)n.write_addr_sent_num * 8;
+            n.awaddr = (uint32_t)addr;
+            n.awlen = (uint8_t)(axi_burst_beats(addr, total_beats - n.write_addr_sent_num, max_beats) - 1);
+            n.awvalid = true;
+        } else {
+            n.awvalid = false;
+        }
+
+        n.wstrb = 0xFF;
+        if (r.wvalid && axi.wready) {
+            n.write_data_sent_num++;
+            n.write_data_sent_num_sig = n.write_data_sent_num;
+        }
+        if (n.write_data_sent_num >= n.write_burst_end && n.write_data_sent_num < total_beats) {
+            uint64_t addr = dst_addr_base + (uint64_t)n.write_data_sent_num * 8;
+            n.write_burst_end = n.write_data_sent_num +
+                                axi_burst_beats(addr, total_beats - n.write_data_sent_num, max_beats);
+        }
+        n.wlast = (n.write_data_sent_num + 1 == n.write_burst_end);
+        n.wvalid = ((uint64_t)n.write_data_sent_num * 4 < total_length && stage4_valid);
+
+        n.bready = true;
+    } else {
+        // Reset and every state but PROCESS3
+        n.awaddr = 0;
+        n.awlen = 0;
+        n.awvalid = false;
+        n.wstrb = 0;
+        n.wlast = false;
+        n.wvalid = false;
+        n.bready = false;
+        n.write_addr_sent_num_sig = 0;
+        n.write_data_sent_num_sig = 0;
+        n.write_response_received_num_sig = 0;
+        n.write_addr_sent_num = 0;
+        n.write_data_sent_num = 0;
+        n.write_response_received_num = 0;
+        n.write_burst_end = 0;
+        n.write_burst_head = 0;
+        n.write_burst_count = 0;
+    }
+
+    // ===== execute_state_transition =====
+    if (rst || r.has_error) {
+        n.state = STATE_IDLE;
+        n.process_1_enable = false;
+        n.process_2_enable = false;
+        n.process_3_enable = false;
+    } else {
+        switch (r.state) {
+            case STATE_IDLE:
+                n.process_1_enable = false;
+                n.process_2_enable = false;
+                n.process_3_enable = false;
+                if (start) {
+                    n.state = STATE_PROCESS1;
+                    n.process_1_enable = true;
+                }
+                break;
+            case STATE_PROCESS1:
+                n.process_1_enable = true;
+                n.process_2_enable = false;
+                n.process_3_enable = false;
+                if (w.p1_finish) {
+                    n.state = STATE_PROCESS2;
+                    n.process_1_enable = false;
+                    n.process_2_enable = true;
+                }
+                break;
+            case STATE_PROCESS2:
+                n.process_1_enable = false;
+                n.process_2_enable = true;
+                n.process_3_enable = false;
+                if (r.p2_output_valid) {
+                    n.state = STATE_PROCESS3;
+                    n.process_2_enable = false;
+                    n.process_3_enable = true;
+                }
+                break;
+            case STATE_PROCESS3:
+                n.process_1_enable = false;
+                n.process_2_enable = false;
+                n.process_3_enable = true;
+                if (w.p3_finish) {
+                    n.state = STATE_IDLE;
+                    n.process_3_enable = false;
+                }
+                break;
+            default:
+                n.state = STATE_IDLE;
+                break;
+        }
+    }
+
+    // ===== done_pulse_handler =====
+    bool all_written = ((uint64_t)r.write_addr_sent_num_sig * 4 >= total_length) &&
+                       ((uint64_t)r.write_data_sent_num_sig * 4 >= total_length) &&
+                       ((uint64_t)r.write_response_received_num_sig * 4 >= total_length);
+    n.done_pulse = !rst && all_written && !r.done_pulse_prev;
+    n.done_pulse_prev = all_written;
+
+    // ===== error_detection_process =====
+    bool error_detected = false;
+    uint8_t error_code = ERR_NONE;
+
+    if (r.state == STATE_IDLE && start && (total_length == 0 || total_length > DATA_LENGTH_MAX)) {
+        error_detected = true;
+        error_code = ERR_DATA_LENGTH_INVALID;
+    }
+    if (!error_detected && w.max_full && r.p1_s1.data_valid) {
+        error_detected = true;
+        error_code = ERR_MAX_FIFO_OVERFLOW;
+    }
+    if (!error_detected && w.out_full && r.p1_s5.data_valid) {
+        error_detected = true;
+        error_code = ERR_OUTPUT_FIFO_OVERFLOW;
+    }
+    if (!error_detected && r.state == STATE_PROCESS1 && axi.rvalid && r.rready && axi.rresp != 0) {
+        error_detected = true;
+        error_code = ERR_AXI_READ_ERROR;
+    }
+    if (!error_detected && w.p1_finish && r.read_addr_sent_num_sig != r.read_data_received_count_sig) {
+        error_detected = true;
+        error_code = ERR_AXI_READ_DATA_MISSING;
+    }
+    if (!error_detected && r.state == STATE_PROCESS3 && axi.bvalid && r.bready && axi.bresp != 0) {
+        error_detected = true;
+        error_code = ERR_AXI_WRITE_ERROR;
+    }
+    if (!error_detected && w.p3_finish &&
+        (r.write_addr_sent_num_sig != r.write_data_sent_num_sig ||
+         r.write_addr_sent_num_sig != r.write_response_received_num_sig)) {
+        error_detected = true;
+        error_code = ERR_AXI_WRITE_RESPONSE_MISMATCH;
+    }
+
+    // Read timeout: cycles in PROCESS1 without an AR or R handshake
+    if (!error_detected && r.state == STATE_PROCESS1) {
+        bool any_read_handshake = (axi.rvalid && r.rready) || (r.arvalid && axi.arready);
+        if (any_read_handshake) {
+            n.read_timeout_counter = 0;
+        } else if ((uint64_t)r.read_data_received_count_sig * 4 < total_length) {
+            n.read_timeout_counter++;
+            if (n.read_timeout_counter >= AXI_TIMEOUT_THRESHOLD) {
+                error_detected = true;
+                error_code = ERR_AXI_READ_TIMEOUT;
+            }
+        }
+    } else if (r.state != STATE_PROCESS1) {
+        n.read_timeout_counter = 0;
+    }
+
+    // Write timeout: cycles in PROCESS3 with a request pending but no handshake
+    if (!error_detected && r.state == STATE_PROCESS3) {
+        bool any_write_handshake = (r.awvalid && axi.awready) || (r.wvalid && axi.wready) ||
+                                   (axi.bvalid && r.bready);
+        bool transfer_incomplete = ((uint64_t)r.write_addr_sent_num_sig * 4 < total_length) ||
+                                   ((uint64_t)r.write_data_sent_num_sig * 4 < total_length) ||
+                                   ((uint64_t)r.write_response_received_num_sig * 4 < total_length);
+        if (any_write_handshake) {
+            n.write_timeout_counter = 0;
+        } else if (transfer_incomplete && (r.awvalid || r.wvalid || r.bready)) {
+            n.write_timeout_counter++;
+        } else {
+            n.write_timeout_counter = 0;
+        }
+        if (n.write_timeout_counter >= AXI_TIMEOUT_THRESHOLD) {
+            error_detected = true;
+            error_code = ERR_AXI_WRITE_TIMEOUT;
+        }
+    } else if (r.state != STATE_PROCESS3) {
+        n.write_timeout_counter = 0;
+    }
+
+    n.has_error = error_detected;
+    n.error_code = error_code;
+
+    // ===== PROCESS_1: Pipeline_Update, MaxUnit and Reduction registers =====
+    uint16_t lane[4];
+    for (int i = 0; i < 4; i++) {
+        lane[i] = (uint16_t)(w.p1_read_data >> (i * 16));
+    }
+    if (w.rst_modules) {
+        n.p1_s1 = P1_Stage1();
+        n.p1_s2 = P1_Stage2();
+        n.p1_s3 = P1_Stage3();
+        n.p1_s4 = P1_Stage4();
+        n.p1_s5 = P1_Stage5();
+        n.max_R1 = 0;
+        n.max_R2 = 0;
+        n.pipe_add0 = 0;
+        n.pipe_add1 = 0;
+    } else {
+        if (r.process_1_enable) {
+            for (int i = 0; i < 4; i++) {
+                n.p1_s1.DataIn[i] = lane[i];
+            }
+            n.p1_s1.data_valid = w.p1_read_data_valid;
+
+            for (int i = 0; i < 4; i++) {
+                n.p1_s2.DataIn[i] = r.p1_s1.DataIn[i];
+            }
+            n.p1_s2.Max_Out = w.Max_Out;
+            n.p1_s2.data_valid = r.p1_s1.data_valid;
+
+            for (int i = 0; i < 4; i++) {
+                n.p1_s3.diff[i] = fp16_subtract(r.p1_s2.DataIn[i], r.p1_s2.Max_Out);
+            }
+            n.p1_s3.diff[4] = fp16_subtract(r.p1_s2.Max_Out, r.Global_Max_Buffer_Out);
+            n.p1_s3.data_valid = r.p1_s2.data_valid;
+
+            for (int i = 0; i < 5; i++) {
+                n.p1_s4.power[i] = log2exp(r.p1_s3.diff[i]);
+            }
+            n.p1_s4.data_valid = r.p1_s3.data_valid;
+
+            uint16_t packed = 0;
+            for (int i = 0; i < 4; i++) {
+                packed |= (uint16_t)(r.p1_s4.power[i] << (i * 4));
+            }
+            n.p1_s5.Power_of_Two_Vector = packed;
+            n.p1_s5.Right_Shift_Num = r.p1_s4.power[4];
+            n.p1_s5.data_valid = r.p1_s4.data_valid;
+        }
+
+        // MaxUnit stage 1 and Reduction stage 1 are not gated by enable
+        n.max_R1 = fp16_max16(lane[0], lane[1]);
+        n.max_R2 = fp16_max16(lane[2], lane[3]);
+        uint32_t exp_out[4];
+        for (int i = 0; i < 4; i++) {
+            exp_out[i] = 0x00010000u >> r.p1_s4.power[i];
+        }
+        n.pipe_add0 = exp_out[0] + exp_out[1];
+        n.pipe_add1 = exp_out[2] + exp_out[3];
+    }
+
+    // ===== PROCESS_3: Pipeline_Update =====
+    if (w.rst_modules) {
+        n.p3_s1 = P3_Stage1();
+        n.p3_s2 = P3_Stage2();
+        n.p3_s3 = P3_Stage3();
+        n.p3_s4 = P3_Stage4();
+    } else if (r.process_3_enable && !w.p3_stall) {
+        n.p3_s1.Sub_Result = fp16_subtract(w.max_data_out, r.Global_Max_Buffer_Out);
+        n.p3_s1.data_valid = w.max_fifo_read_en;
+
+        n.p3_s2.Power = log2exp(r.p3_s1.Sub_Result);
+        n.p3_s2.data_valid = r.p3_s1.data_valid;
+
+        n.p3_s3.Mux_Result = r.p2_mux_result;
+        n.p3_s3.ks = r.p2_lo_pos;
+        for (int i = 0; i < 4; i++) {
+            unsigned sum = r.p3_s2.Power + ((w.out_data_out >> (i * 4)) & 0xF);
+            n.p3_s3.ky[i] = (sum > 15) ? 15 : sum;
+        }
+        n.p3_s3.data_valid = r.p3_s2.data_valid;
+
+        uint64_t packed = 0;
+        for (int i = 0; i < 4; i++) {
+            sc_uint16 divider_out = divider_fp16(sc_uint4(r.p3_s3.ky[i]), sole_ks_t(r.p3_s3.ks),
+                                                 sc_uint16(r.p3_s3.Mux_Result));
+            packed |= (uint64_t)divider_out.to_uint() << (i * 16);
+        }
+        n.p3_s4.Output = packed;
+        n.p3_s4.data_valid = r.p3_s3.data_valid;
+    }
+
+    // ===== Max_FIFO / Output_FIFO =====
+    eval_fifo(r.max_fifo, n.max_fifo, MAX_FIFO_MASK, max_fifo_mem, max_fifo_mem_clear,
+              w.max_we, w.max_re, w.max_fifo_read_en, w.max_read_valid, w.Max_Out);
+    eval_fifo(r.out_fifo, n.out_fifo, OUTPUT_FIFO_MASK, out_fifo_mem, out_fifo_mem_clear,
+              w.out_we, w.out_re, w.out_fifo_read_en, w.out_read_valid, r.p1_s5.Power_of_Two_Vector);
+}
+
+void Softmax_Cycle::commit() {
+    cur = nxt;
+    commit_pins();
+}
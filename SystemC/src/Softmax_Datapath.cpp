@@ -0,0 +1,93 @@
+#include "Softmax_Datapath.h"
+
+static_assert(SOLE_LANES == 4, "the TLM datapath is the 4-lane (64-bit AXI) datapath");
+
+/**
+ * @brief FP16 subtraction implementation
+ *
+ * Same as PROCESS_1 / PROCESS_3: a - b = a + (b with sign flipped).
+ */
+static sc_uint16 fp16_subtract(sc_uint16 a_bits, sc_uint16 b_bits) {
+    sc_uint16 r = fp16_add((fp16_t)(a_bits.to_uint()), (fp16_t)(b_bits.to_uint()) ^ 0x8000);
+    return r;
+}
+
+void Softmax_Datapath::reset() {
+    ks = 0;
+    mux_result = 0;
+    begin_job();
+}
+
+/**
+ * @brief Row start (Softmax row_start_flag)
+ *
+ * Global_Max_Buffer and Sum_Buffer restart for every row, as in the pin-level
+ * model; without this a row would inherit the global max of the previous job.
+ */
+void Softmax_Datapath::begin_job() {
+    global_max_reg = 0;
+    sum_buffer_reg = 0;
+    local_max_fifo.clear();
+    power_fifo.clear();
+}
+
+/**
+ * @brief PROCESS_1 for one beat
+ *
+ * Mirrors the PROCESS_1 pipeline stages:
+ * - Stage1/2: unpack 4 fp16 lanes, MaxUnit local max, Global_Max_Buffer update
+ * - Stage3/4: diff[i] = x[i] - local max, diff[4] = local max - global max, Log2Exp
+ * - Stage5/Output: pack powers, Reduction sum of 2^(-power),
+ *   Sum_Buffer = (Sum_Buffer >> power[4]) + reduction
+ */
+void Softmax_Datapath::process1_beat(uint64_t data_in) {
+    sc_uint16 lane[4];
+    for (int i = 0; i < 4; i++) {
+        lane[i] = (data_in >> (i * 16)) & 0xFFFF;
+    }
+
+    sc_uint16 local_max = fp16_max(fp16_max(lane[0], lane[1]), fp16_max(lane[2], lane[3]));
+    global_max_reg = fp16_max(global_max_reg, local_max);
+
+    uint16_t packed = 0;
+    sc_uint32 reduction = 0;
+    for (int i = 0; i < 4; i++) {
+        sc_uint4 power = log2exp_fp16(fp16_subtract(lane[i], local_max));
+        packed |= (uint16_t)(power.to_uint() << (i * 4));
+        reduction += (sc_uint32)(0x00010000 >> power.to_uint());
+    }
+    sc_uint4 right_shift = log2exp_fp16(fp16_subtract(local_max, global_max_reg));
+    sum_buffer_reg = (sum_buffer_reg >> right_shift.to_uint()) + reduction;
+
+    local_max_fifo.push_back(local_max.to_uint());
+    power_fifo.push_back(packed);
+}
+
+/**
+ * @brief PROCESS_2: Divider_PreCompute on the final Sum_Buffer
+ */
+void Softmax_Datapath::process2() {
+    ks = find_leading_one_pos(sum_buffer_reg);
+    mux_result = divider_threshold(sum_buffer_reg);
+}
+
+/**
+ * @brief PROCESS_3 for one stored beat
+ *
+ * Mirrors the PROCESS_3 pipeline stages:
+ * - Stage1/2: power = Log2Exp(local max - global max)
+ * - Stage3: ky[i] = min(15, power + power_fifo[i])
+ * - Stage4: Divider for each lane, packed into 64 bits
+ */
+uint64_t Softmax_Datapath::process3_beat(size_t beat) const {
+    sc_uint4 power = log2exp_fp16(fp16_subtract(local_max_fifo[beat], global_max_reg));
+    uint16_t ky_4 = power_fifo[beat];
+
+    uint64_t packed = 0;
+    for (int i = 0; i < 4; i++) {
+        unsigned sum = power.to_uint() + ((ky_4 >> (i * 4)) & 0xF);
+        sc_uint4 ky = (sum > 15) ? 15u : sum;
+        packed |= (uint64_t)divider_fp16(ky, ks, mux_result).to_uint() << (i * 16);
+    }
+    return packed;
+}
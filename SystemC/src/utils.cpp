@@ -264,8 +264,8 @@ sc_uint16 fp16_max(sc_uint16 a_bits, sc_uint16 b_bits) {
     bool b_sign = b_bits[15];
     
     // Get Exponent + Mantissa
-    sc_dt::sc_uint<15> a_rest = a_bits.range(14, 0);
-    sc_dt::sc_uint<15> b_rest = b_bits.range(14, 0);
+    sole_uint<15> a_rest = a_bits.range(14, 0);
+    sole_uint<15> b_rest = b_bits.range(14, 0);
 
     // (Sign Bit) compare
     if (a_sign == 0 && b_sign == 1) {
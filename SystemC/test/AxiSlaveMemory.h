@@ -0,0 +1,637 @@
+#ifndef AXI_SLAVE_MEMORY_H
+#define AXI_SLAVE_MEMORY_H
+
+// Pin-level AXI4 slave memory model shared by the SOLE testbenches
+// (SOLE_test, SOLE_multi_test).
+
+#include <systemc>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <stdexcept>
+#include <vector>
+#include "../include/Softmax.h"
+#include "../include/Trace.hpp"
+#include "../include/Profile.hpp"
+
+using namespace sc_core;
+using namespace sc_dt;
+
+// Default wait states of the model; may be overridden on the compiler command line (-D)
+#ifndef AXI_READ_ARREADY_DELAY
+#define AXI_READ_ARREADY_DELAY 0   // Cycles after ARVALID become high before ARREADY goes high
+#endif
+#ifndef AXI_READ_RVALID_DELAY
+#define AXI_READ_RVALID_DELAY  0   // Cycles after Read Address Handshake success before RVALID goes high
+#endif
+#ifndef AXI_WRITE_WREADY_DELAY
+#define AXI_WRITE_WREADY_DELAY 0   // Cycles after WVALID become high before WREADY goes high
+#endif
+#ifndef AXI_READ_LATENCY
+#define AXI_READ_LATENCY 0         // Pipelined cycles from AR handshake until the slave may start the burst
+#endif
+#ifndef AXI_READ_REORDER
+#define AXI_READ_REORDER 0         // Slave returns the youngest ready burst among the oldest N + 1 (0 = in order)
+#endif
+
+constexpr unsigned AXI_BEAT_WORDS = AXI_BEAT_BYTES / 8;   // 64-bit memory words per beat
+
+/// One AXI beat from AXI_BEAT_WORDS consecutive 64-bit memory words (lowest word = lanes 0..3)
+inline axi_data_t beat_from_words(const uint64_t* words) {
+    axi_data_t beat = 0;
+    for (int lane = 0; lane < SOLE_LANES; lane++) {
+        sole_beat_set_lane(beat, lane, (uint16_t)(words[lane / 4] >> (16 * (lane % 4))));
+    }
+    return beat;
+}
+
+/// Store one AXI beat into AXI_BEAT_WORDS consecutive 64-bit memory words (bytes enabled by strb)
+inline void beat_to_words(const axi_data_t& beat, uint64_t* words, const sc_uint<AXI_STRB_WIDTH>& strb) {
+    uint64_t data[AXI_BEAT_WORDS] = {};
+    for (int lane = 0; lane < SOLE_LANES; lane++) {
+        data[lane / 4] |= (uint64_t)sole_beat_lane(beat, lane) << (16 * (lane % 4));
+    }
+    for (unsigned w = 0; w < AXI_BEAT_WORDS; w++) {
+        uint64_t mask = 0;
+        for (unsigned b = 0; b < 8; b++) {
+            if (strb[8 * w + b]) mask |= 0xFFull << (8 * b);
+        }
+        words[w] = (words[w] & ~mask) | (data[w] & mask);
+    }
+}
+
+// ===== Mock AXI4 Slave Memory Model =====
+/**
+ * @class AxiSlaveMemory
+ * @brief Simulates an AXI4 slave device with internal memory storage
+ * 
+ * This module provides:
+ * - Simple read/write memory with configurable base address
+ * - AXI4 slave protocol response (ready/valid handshaking) with 8-byte INCR
+ *   bursts: AWLEN / ARLEN beats per address, a write burst ends at WLAST
+ * - Automatic response generation for all AXI transactions
+ * - Wait states per burst: a read burst starts rvalid_delay cycles after the
+ *   previous one and then returns one beat per cycle; WREADY waits
+ *   wready_delay cycles before the first beat of a write burst and stays high
+ *   until WLAST, which gets the single B response of the burst
+ * - AXI handshakes on the response channels: an R beat or a B response stays
+ *   on the bus until VALID && READY at a clock edge, and only then is the next
+ *   one driven (B responses queue in WLAST order)
+ * - Backdoor (DMI-style) access for the host side: get_dmi_ptr() and bulk
+ *   load()/dump() copy whole byte ranges without simulated time or AXI traffic.
+ *   Words are stored in host byte order (little-endian, as on the AXI bus), so
+ *   FP16 element i of a packed buffer is at byte offset 2 * i.
+ * - Wait states (ARREADY / RVALID / WREADY delays) that can be changed between
+ *   runs with set_wait_states() while the bus is idle
+ * - Read IDs (set_read_model()): every burst is answered with RID = its ARID.
+ *   read_latency is a pipelined latency (a burst may start read_latency
+ *   cycles after its AR handshake, whatever else is in flight), and with
+ *   read_reorder = N the next burst is the youngest ready one among the oldest
+ *   N + 1 queued, skipping any with the ID of an older queued burst (a burst
+ *   is passed over at most N times)
+ * - Idle sleep (set_fast_forward()): a channel whose outputs would stay the
+ *   same on the next edge stops evaluating clock edges until rst or one of its
+ *   VALID inputs changes, then resumes with the following edge
+ * - Stopped clock (idle_cycle_limit() / skip_cycles()): while no handshake is
+ *   due, the edges before the next WREADY / ARREADY / RVALID level change may
+ *   be skipped and accounted for in one step
+ */
+SC_MODULE(AxiSlaveMemory) {
+    // AXI4 Slave Ports
+    sc_in<bool>                               clk;
+    sc_in<bool>                               rst;
+    
+    // Write Address Channel
+    sc_in<sc_uint<AXI_ADDR_WIDTH>>            S_AXI_AWADDR;
+    sc_in<sc_uint<8>>                         S_AXI_AWLEN;
+    sc_in<bool>                               S_AXI_AWVALID;
+    sc_out<bool>                              S_AXI_AWREADY;
+    
+    // Write Data Channel
+    sc_in<axi_data_t>                         S_AXI_WDATA;
+    sc_in<sc_uint<AXI_STRB_WIDTH>>            S_AXI_WSTRB;
+    sc_in<bool>                               S_AXI_WLAST;
+    sc_in<bool>                               S_AXI_WVALID;
+    sc_out<bool>                              S_AXI_WREADY;
+    
+    // Write Response Channel
+    sc_out<sc_uint<2>>                        S_AXI_BRESP;
+    sc_out<bool>                              S_AXI_BVALID;
+    sc_in<bool>                               S_AXI_BREADY;
+    
+    // Read Address Channel
+    sc_in<sc_uint<AXI_ID_WIDTH>>              S_AXI_ARID;
+    sc_in<sc_uint<AXI_ADDR_WIDTH>>            S_AXI_ARADDR;
+    sc_in<sc_uint<8>>                         S_AXI_ARLEN;
+    sc_in<bool>                               S_AXI_ARVALID;
+    sc_out<bool>                              S_AXI_ARREADY;
+    
+    // Read Data Channel
+    sc_out<sc_uint<AXI_ID_WIDTH>>             S_AXI_RID;
+    sc_out<axi_data_t>                        S_AXI_RDATA;
+    sc_out<sc_uint<2>>                        S_AXI_RRESP;
+    sc_out<bool>                              S_AXI_RVALID;
+    sc_in<bool>                               S_AXI_RREADY;
+    
+    // Internal memory storage (64-bit words)
+    std::vector<uint64_t> memory;
+
+    // Wait states (see AXI_READ_ARREADY_DELAY / AXI_READ_RVALID_DELAY / AXI_WRITE_WREADY_DELAY)
+    int arready_delay = AXI_READ_ARREADY_DELAY;
+    int rvalid_delay = AXI_READ_RVALID_DELAY;
+    int wready_delay = AXI_WRITE_WREADY_DELAY;
+    int read_latency = AXI_READ_LATENCY;
+    int read_reorder = AXI_READ_REORDER;
+
+    // Idle sleep (see set_fast_forward())
+    bool fast_forward = false;
+    bool write_sleeping = false;
+    bool read_sleeping = false;
+    
+    // Internal signals
+    sc_signal<sc_uint<AXI_ADDR_WIDTH>>        write_addr;
+    sc_signal<axi_data_t>                     write_data;
+    sc_signal<sc_uint<AXI_ADDR_WIDTH>>        read_addr;
+    sc_signal<bool>                           write_pending;
+    sc_signal<bool>                           read_pending;
+
+    /// Accepted AW / AR: start address and AxLEN (reads: ARID and the first cycle it may start)
+    struct Burst {
+        sc_uint<AXI_ADDR_WIDTH> addr;
+        unsigned                len;
+        unsigned                id = 0;
+        uint64_t                ready = 0;
+        unsigned                passed = 0;  ///< Times a younger burst was answered first
+    };
+
+    // Write channel state
+    sc_uint<AXI_ADDR_WIDTH>                   write_addr_buf;
+    std::deque<Burst>                         write_addr_queue;
+    sc_uint<AXI_ADDR_WIDTH>                   last_write_addr;
+    bool                                      has_last_write_addr = false;
+    bool                                      write_in_burst = false;   ///< Beats accepted, WLAST not yet
+    unsigned                                  write_burst_resp = 0;     ///< Worst BRESP of the current burst
+    std::deque<unsigned>                      write_resp_queue;         ///< BRESP of finished bursts; front is on the bus
+    bool                                      wready_pulse_enable = false;
+    int                                       wready_pulse_cnt = -1;
+
+    // Read channel state
+    sc_uint<AXI_ADDR_WIDTH>                   addr_buf;
+    bool                                      has_addr = false;
+    unsigned                                  read_beats_left = 0;      ///< Beats of the current burst after addr_buf
+    unsigned                                  read_id = 0;              ///< RID of the current burst
+    uint64_t                                  read_cycle = 0;           ///< Evaluated read channel edges since reset
+    int                                       arready_delay_cnt = -1;
+    int                                       read_resp_start_delay_cnt = -1;
+    std::deque<Burst>                         read_addr_queue;
+    
+    SC_HAS_PROCESS(AxiSlaveMemory);
+    
+    AxiSlaveMemory(sc_module_name name, size_t words) : sc_module(name), memory(words, 0) {
+        // Register processes
+        SC_METHOD(axi_write_process);
+        sensitive << clk.pos() ;
+        SC_METHOD(axi_read_process);
+        sensitive << clk.pos() ;
+    }
+
+    // ===== Backdoor Access =====
+    /// Raw pointer to byte address 0; valid for dmi_size() bytes
+    unsigned char* get_dmi_ptr() { return reinterpret_cast<unsigned char*>(memory.data()); }
+    size_t dmi_size() const { return sizeof(uint64_t) * memory.size(); }
+
+    /// Zero the whole memory
+    void clear() { std::fill(memory.begin(), memory.end(), 0); }
+
+    /// New wait states; takes effect with the next transaction (apply during reset)
+    void set_wait_states(int arready, int rvalid, int wready) {
+        arready_delay = arready;
+        rvalid_delay = rvalid;
+        wready_delay = wready;
+    }
+
+    /// Read latency / reorder window; takes effect with the next transaction (apply during reset)
+    void set_read_model(int latency, int reorder) {
+        read_latency = latency;
+        read_reorder = reorder;
+    }
+
+    /// Let idle channels skip clock edges; outputs are the same as with per-edge evaluation
+    void set_fast_forward(bool on) { fast_forward = on; }
+
+    /**
+     * @brief Clock edges that may be skipped without changing an output (stopped clock)
+     * 0 while a handshake is due or the next edge drives a new level; otherwise
+     * the edges until the next WREADY pulse, ARREADY or the start of the next
+     * read burst. Assumes the master holds its outputs over the skipped edges.
+     */
+    uint64_t idle_cycle_limit() const {
+        uint64_t limit = UINT64_MAX;
+        if (rst.read()) {
+            return limit;
+        }
+        if (!write_sleeping) {
+            bool wready = true;  // WREADY at the next edge
+            if (!write_in_burst && wready_pulse_enable && wready_delay > 0) {
+                wready = wready_pulse_cnt <= 0;
+                limit = wready ? 0 : (uint64_t)wready_pulse_cnt;
+            } else if (!write_in_burst && !wready_pulse_enable) {
+                wready = false;
+                limit = S_AXI_WVALID.read() ? 0 : limit;
+            }
+            if (!S_AXI_AWREADY.read() || S_AXI_AWVALID.read() || S_AXI_WREADY.read() != wready ||
+                (S_AXI_WVALID.read() && S_AXI_WREADY.read()) ||
+                S_AXI_BVALID.read() == write_resp_queue.empty() || (S_AXI_BVALID.read() && S_AXI_BREADY.read())) {
+                limit = 0;
+            }
+        }
+        if (!read_sleeping) {
+            bool arready = true;  // ARREADY at the next edge
+            if (arready_delay > 0 && arready_delay_cnt != 0) {
+                arready = false;
+                limit = std::min<uint64_t>(limit, arready_delay_cnt > 0 ? (uint64_t)arready_delay_cnt
+                                                                        : (S_AXI_ARVALID.read() ? 0 : UINT64_MAX));
+            }
+            if (S_AXI_ARREADY.read() != arready || (S_AXI_ARVALID.read() && arready) ||
+                S_AXI_RVALID.read() != has_addr || (S_AXI_RVALID.read() && S_AXI_RREADY.read())) {
+                limit = 0;
+            }
+            if (!has_addr && !read_addr_queue.empty()) {
+                // A burst starts at the first edge with the RVALID delay elapsed and a burst ready
+                uint64_t delay = rvalid_delay <= 0 ? 0
+                               : (uint64_t)(read_resp_start_delay_cnt < 0 ? rvalid_delay : read_resp_start_delay_cnt);
+                uint64_t ready = next_read_ready();
+                limit = std::min(limit, std::max(delay, ready > read_cycle ? ready - read_cycle : 0));
+            }
+        }
+        return limit;
+    }
+
+    /// Account for 'cycles' skipped edges (at most idle_cycle_limit())
+    void skip_cycles(uint64_t cycles) {
+        if (rst.read()) {
+            return;
+        }
+        if (!write_sleeping && !write_in_burst && wready_pulse_enable && wready_delay > 0) {
+            wready_pulse_cnt -= (int)cycles;
+        }
+        if (!read_sleeping) {
+            if (arready_delay > 0 && arready_delay_cnt > 0) {
+                arready_delay_cnt -= (int)cycles;
+            }
+            if (!has_addr && !read_addr_queue.empty() && rvalid_delay > 0) {
+                int delay = read_resp_start_delay_cnt < 0 ? rvalid_delay : read_resp_start_delay_cnt;
+                read_resp_start_delay_cnt = delay - (int)std::min<uint64_t>(cycles, (uint64_t)delay);
+            }
+            read_cycle += cycles;
+        }
+    }
+
+    /// Copy 'bytes' bytes from 'src' to byte address 'byte_addr'; false if out of range
+    bool load(uint64_t byte_addr, const void* src, size_t bytes) {
+        if (byte_addr > dmi_size() || bytes > dmi_size() - byte_addr) {
+            return false;
+        }
+        memcpy(get_dmi_ptr() + byte_addr, src, bytes);
+        return true;
+    }
+
+    /// Copy 'bytes' bytes from byte address 'byte_addr' to 'dst'; false if out of range
+    bool dump(uint64_t byte_addr, void* dst, size_t bytes) const {
+        if (byte_addr > dmi_size() || bytes > dmi_size() - byte_addr) {
+            return false;
+        }
+        memcpy(dst, reinterpret_cast<const unsigned char*>(memory.data()) + byte_addr, bytes);
+        return true;
+    }
+
+    /**
+     * @brief AXI Write Process
+     * Handles AXI4-Lite write address, write data, and write response channels
+     * 
+     * Key Fix: 
+     * - AXI address is in BYTES (8-byte aligned for 64-bit data)
+     * - Convert byte address to 64-bit word index: word_idx = byte_addr >> 3
+     * - Track address and data arrival independently with flags
+     * - Execute write when BOTH address and data have arrived
+     */
+    void axi_write_process() {
+        SOLE_PROFILE_PROCESS();
+        if (write_sleeping) {
+            // Woken by rst / AWVALID / WVALID: the next edge is the first one that can differ
+            write_sleeping = false;
+            next_trigger(clk.posedge_event());
+            return;
+        }
+        if (rst.read() == true) {  // If reset IS active (true), disable everything
+            S_AXI_AWREADY.write(false);
+            S_AXI_WREADY.write(false);
+            S_AXI_BVALID.write(false);
+            S_AXI_BRESP.write(0);
+            write_addr_queue.clear();
+            last_write_addr = 0;
+            has_last_write_addr = false;
+            write_in_burst = false;
+            write_burst_resp = 0;
+            write_resp_queue.clear();
+            wready_pulse_enable = false;
+            wready_pulse_cnt = -1;
+            if (fast_forward) {
+                write_sleeping = true;
+                next_trigger(rst.value_changed_event());
+            }
+            return;
+        }
+        
+        // Normal operation: rst == false
+        // Keep AWREADY high so address channel can run ahead; queued addresses
+        // are paired with W beats in order.
+        bool awready = true;
+        S_AXI_AWREADY.write(awready);
+        
+        // WREADY pulse model:
+        // after first WVALID is seen, wait N cycles then pulse WREADY high for 1 cycle,
+        // then repeat (wait N cycles, pulse 1 cycle).
+        if (!wready_pulse_enable && S_AXI_WVALID.read()) {
+            wready_pulse_enable = true;
+            wready_pulse_cnt = wready_delay;
+        }
+
+        bool wready = false;
+        if (wready_pulse_enable) {
+            if (wready_delay <= 0) {
+                wready = true;
+            } else if (wready_pulse_cnt <= 0) {
+                wready = true;
+                wready_pulse_cnt = wready_delay;
+            } else {
+                wready_pulse_cnt--;
+            }
+        }
+        // Handshake must be detected using READY/VALID values visible on ports this cycle.
+        // Using local "awready/wready" can create a one-cycle mismatch with the master.
+        bool aw_handshake = S_AXI_AWVALID.read() && S_AXI_AWREADY.read();
+        bool w_handshake = S_AXI_WVALID.read() && S_AXI_WREADY.read();
+
+        // The B response on the bus is retired only by BVALID && BREADY
+        if (S_AXI_BVALID.read() && S_AXI_BREADY.read() && !write_resp_queue.empty()) {
+            write_resp_queue.pop_front();
+        }
+        
+        if (aw_handshake) {
+            write_addr_buf = S_AXI_AWADDR.read();
+            write_addr_queue.push_back({write_addr_buf, (unsigned)S_AXI_AWLEN.read()});
+            SOLE_TRACE(EV_SLAVE_AW, (uint32_t)(write_addr_buf), S_AXI_AWLEN.read().to_uint());
+        }
+        
+        // Every W burst gets one B response, queued at WLAST and driven from the next edge
+        if (w_handshake) {
+            axi_data_t write_data_buf = S_AXI_WDATA.read();
+            SOLE_TRACE(EV_SLAVE_W, write_data_buf.to_uint64());
+
+            if (write_in_burst) {
+                write_addr_buf = last_write_addr + AXI_BEAT_BYTES;
+            } else if (!write_addr_queue.empty()) {
+                write_addr_buf = write_addr_queue.front().addr;
+                write_addr_queue.pop_front();
+            } else {
+                write_addr_buf = has_last_write_addr ? (last_write_addr + AXI_BEAT_BYTES) : 0;
+                SOLE_TRACE(EV_SLAVE_AW_FALLBACK, (uint32_t)write_addr_buf);
+            }
+            last_write_addr = write_addr_buf;
+            has_last_write_addr = true;
+
+            uint32_t byte_addr = (uint32_t)(write_addr_buf);
+            uint32_t word_idx = byte_addr >> 3;
+
+            if (word_idx + AXI_BEAT_WORDS > memory.size()) {
+                SOLE_TRACE(EV_SLAVE_WRITE_ERR, word_idx);
+                write_burst_resp = 2;  // SLVERR
+            } else {
+                SOLE_TRACE(EV_SLAVE_MEM_WRITE, word_idx, byte_addr, write_data_buf.to_uint64());
+                beat_to_words(write_data_buf, &memory[word_idx], S_AXI_WSTRB.read());
+            }
+
+            write_in_burst = !S_AXI_WLAST.read();
+            if (!write_in_burst) {
+                write_resp_queue.push_back(write_burst_resp);  // OKAY unless a beat was out of range
+                SOLE_TRACE(EV_SLAVE_B, write_burst_resp);
+                write_burst_resp = 0;
+            }
+        }
+        S_AXI_BVALID.write(!write_resp_queue.empty());
+        S_AXI_BRESP.write(write_resp_queue.empty() ? 0u : write_resp_queue.front());
+
+        // Inside a burst WREADY stays high; the wait states start again after WLAST
+        if (write_in_burst) {
+            wready = true;
+            wready_pulse_cnt = wready_delay;
+        }
+        S_AXI_WREADY.write(wready);
+
+        // Idle: no address or data in flight and a WREADY level that no longer changes
+        bool wready_steady = !wready_pulse_enable || wready_delay <= 0;
+        if (fast_forward && !S_AXI_AWVALID.read() && !S_AXI_WVALID.read() && write_addr_queue.empty() &&
+            write_resp_queue.empty() && wready_steady) {
+            write_sleeping = true;
+            next_trigger(rst.value_changed_event() | S_AXI_AWVALID.value_changed_event() |
+                         S_AXI_WVALID.value_changed_event());
+        }
+    }
+    
+    /**
+     * @brief Queue index of the read burst to answer next (size() = none ready)
+     * In order unless read_reorder > 0: then the youngest burst whose latency
+     * has elapsed among the oldest read_reorder + 1, as long as no older queued
+     * burst has the same ID (AXI keeps same-ID reads in order). The oldest
+     * burst is passed over at most read_reorder times.
+     */
+    size_t next_read_burst() const {
+        size_t window = std::min(read_addr_queue.size(), (size_t)std::max(read_reorder, 0) + 1);
+        if (!read_addr_queue.empty() && read_addr_queue.front().passed >= (unsigned)std::max(read_reorder, 0)) {
+            window = 1;
+        }
+        for (size_t i = window; i-- > 0;) {
+            const Burst& b = read_addr_queue[i];
+            bool same_id_older = std::any_of(read_addr_queue.begin(), read_addr_queue.begin() + i,
+                                             [&](const Burst& o) { return o.id == b.id; });
+            if (b.ready <= read_cycle && !same_id_older) {
+                return i;
+            }
+        }
+        return read_addr_queue.size();
+    }
+
+    /// First read_cycle at which next_read_burst() finds a burst (the queue must not be empty)
+    uint64_t next_read_ready() const {
+        size_t window = std::min(read_addr_queue.size(), (size_t)std::max(read_reorder, 0) + 1);
+        if (read_addr_queue.front().passed >= (unsigned)std::max(read_reorder, 0)) {
+            window = 1;
+        }
+        uint64_t ready = UINT64_MAX;
+        for (size_t i = 0; i < window; ++i) {
+            const Burst& b = read_addr_queue[i];
+            bool same_id_older = std::any_of(read_addr_queue.begin(), read_addr_queue.begin() + i,
+                                             [&](const Burst& o) { return o.id == b.id; });
+            if (!same_id_older) {
+                ready = std::min(ready, b.ready);
+            }
+        }
+        return ready;
+    }
+
+    /**
+     * @brief AXI Read Process
+     * Handles AXI4 read address and read data channels
+     * 
+     * Simplified behavior:
+     * - Capture read address and ARLEN from S_AXI_ARADDR / S_AXI_ARLEN when valid
+     * - On next clock cycle, return data immediately, ARLEN+1 consecutive
+     *   8-byte beats per address
+     * - AXI address is in BYTES (8-byte aligned for 64-bit data)
+     * - Convert byte address to 64-bit word index: word_idx = byte_addr >> 3
+     */
+    void axi_read_process() {
+        SOLE_PROFILE_PROCESS();
+        if (read_sleeping) {
+            // Woken by rst / ARVALID: the next edge is the first one that can differ
+            read_sleeping = false;
+            next_trigger(clk.posedge_event());
+            return;
+        }
+        if (rst.read() == true) {  // If reset IS active (true), disable everything
+            S_AXI_ARREADY.write(false);
+            S_AXI_RVALID.write(false);
+            S_AXI_RID.write(0);
+            S_AXI_RDATA.write(0);
+            S_AXI_RRESP.write(0);
+            has_addr = false;
+            read_beats_left = 0;
+            read_id = 0;
+            read_cycle = 0;
+            arready_delay_cnt = -1;
+            read_resp_start_delay_cnt = -1;
+            read_addr_queue.clear();
+            if (fast_forward) {
+                read_sleeping = true;
+                next_trigger(rst.value_changed_event());
+            }
+            return;
+        }
+        
+        // Normal operation: rst == false
+        // For delay=0 keep old behavior: ARREADY always high.
+        bool arready = false;
+        if (arready_delay <= 0) {
+            arready = true;
+            arready_delay_cnt = -1;
+        } else {
+            // Keep countdown stable after first request to avoid starvation.
+            if (arready_delay_cnt < 0 && S_AXI_ARVALID.read()) {
+                arready_delay_cnt = arready_delay;
+            }
+            if (arready_delay_cnt == 0) {
+                arready = true;
+            } else if (arready_delay_cnt > 0) {
+                arready_delay_cnt--;
+            }
+        }
+        S_AXI_ARREADY.write(arready);
+        
+        // Capture read address when read address handshake occurs
+        if (S_AXI_ARVALID.read() && arready) {
+            sc_uint<AXI_ADDR_WIDTH> ar_addr = S_AXI_ARADDR.read();
+            read_addr_queue.push_back({ar_addr, (unsigned)S_AXI_ARLEN.read(), S_AXI_ARID.read().to_uint(),
+                                       read_cycle + (uint64_t)std::max(read_latency, 0)});
+            // Rearm delay for next transaction when AR delay is enabled.
+            if (arready_delay > 0) {
+                arready_delay_cnt = arready_delay;
+                // ARREADY was already high (AR after an idle gap): the master sees this
+                // handshake now, so drop ARREADY or it would take the next AR as accepted
+                if (S_AXI_ARREADY.read()) {
+                    S_AXI_ARREADY.write(false);
+                }
+            }
+
+            SOLE_TRACE(EV_SLAVE_AR, (uint32_t)(ar_addr), S_AXI_ARLEN.read().to_uint());
+        }
+
+        // The R beat on the bus is retired only by RVALID && RREADY: next beat of
+        // the burst, or the burst is done and the next one may start below
+        if (has_addr && S_AXI_RVALID.read() && S_AXI_RREADY.read()) {
+            if (read_beats_left > 0) {
+                addr_buf = addr_buf + AXI_BEAT_BYTES;
+                read_beats_left--;
+            } else {
+                has_addr = false;
+            }
+        }
+
+        // Start next read response when idle and there is pending AR request.
+        // rvalid_delay is modeled as response start latency per burst.
+        if (!has_addr && !read_addr_queue.empty()) {
+            bool begin = false;
+            if (rvalid_delay <= 0) {
+                begin = true;
+            } else {
+                if (read_resp_start_delay_cnt < 0) {
+                    read_resp_start_delay_cnt = rvalid_delay;
+                }
+                if (read_resp_start_delay_cnt > 0) {
+                    read_resp_start_delay_cnt--;
+                } else {
+                    begin = true;
+                }
+            }
+            // The burst to answer; without a ready one the delay stays elapsed
+            size_t next = begin ? next_read_burst() : read_addr_queue.size();
+            if (next < read_addr_queue.size()) {
+                addr_buf = read_addr_queue[next].addr;
+                read_beats_left = read_addr_queue[next].len;
+                read_id = read_addr_queue[next].id;
+                for (size_t i = 0; i < next; ++i) {
+                    read_addr_queue[i].passed++;
+                }
+                read_addr_queue.erase(read_addr_queue.begin() + next);
+                has_addr = true;
+                read_resp_start_delay_cnt = -1;
+            }
+        }
+        read_cycle++;
+        
+        // Read Data Channel: drive the beat at the current address until it is taken
+        if (has_addr) {
+            uint32_t addr_val = (uint32_t)(addr_buf);
+            uint32_t word_idx = addr_val >> 3;
+
+            // Bounds check to prevent out-of-bounds reads
+            if (word_idx + AXI_BEAT_WORDS > memory.size()) {
+                SOLE_TRACE(EV_SLAVE_READ_ERR, word_idx);
+                throw std::runtime_error("Read address out of bounds in AxiSlaveMemory");
+            }
+            // Read one beat (AXI_BEAT_WORDS 64-bit words) from memory at word_idx
+            axi_data_t data_to_read = beat_from_words(&memory[word_idx]);
+            S_AXI_RID.write(read_id);
+            S_AXI_RDATA.write(data_to_read);
+            S_AXI_RVALID.write(true);
+            S_AXI_RRESP.write(0);  // OKAY response
+            SOLE_TRACE(EV_SLAVE_R, word_idx, data_to_read.to_uint64(), 0);
+        } else {
+            S_AXI_RVALID.write(false);
+            S_AXI_RID.write(0);
+            S_AXI_RDATA.write(0);
+            S_AXI_RRESP.write(0);
+
+            // Idle: nothing queued and ARREADY already at the level it keeps without ARVALID
+            bool arready_steady = (arready_delay <= 0) ||
+                                  (arready_delay_cnt == 0 && arready) || (arready_delay_cnt < 0 && !arready);
+            if (fast_forward && !S_AXI_ARVALID.read() && read_addr_queue.empty() && arready_steady) {
+                read_sleeping = true;
+                next_trigger(rst.value_changed_event() | S_AXI_ARVALID.value_changed_event());
+            }
+        }
+    }
+};
+
+#endif // AXI_SLAVE_MEMORY_H
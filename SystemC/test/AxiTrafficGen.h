@@ -0,0 +1,220 @@
+#ifndef AXI_TRAFFIC_GEN_H
+#define AXI_TRAFFIC_GEN_H
+
+// Synthetic AXI4 master for background traffic in the SOLE testbenches
+// (SOLE_contention_test): stands in for the other masters of the SoC.
+
+#include <systemc>
+#include <algorithm>
+#include <cstdint>
+#include "../include/Softmax.h"
+#include "../include/Profile.hpp"
+
+using namespace sc_core;
+using namespace sc_dt;
+
+// ===== Synthetic AXI4 Master =====
+/**
+ * @class AxiTrafficGen
+ * @brief Issues random INCR read / write bursts at a configured share of the bus
+ *
+ * - Rate: a token bucket earns load_percent tokens per cycle and a burst costs
+ *   100 per beat, so load_percent = 30 asks for 0.3 beats per cycle (reads and
+ *   writes together). Unused tokens are capped at one burst, so a master that
+ *   was held back does not catch up with a long back-to-back run.
+ * - Each burst is a read with probability read_percent, at a random
+ *   burst-aligned address of [base, base + size); at most outstanding bursts
+ *   per direction are in flight.
+ * - The same pin protocol as the SOLE master port: VALID stays up until its
+ *   handshake and the W beats of a burst follow its AW handshake in order.
+ *   RREADY and BREADY are high on ready_percent of the cycles (always at the
+ *   default 100), drawn from a separate generator so the traffic pattern does
+ *   not change with it.
+ */
+SC_MODULE(AxiTrafficGen) {
+    struct Config {
+        unsigned load_percent = 0;      ///< Requested beats per 100 cycles (0 = idle)
+        unsigned read_percent = 50;     ///< Share of bursts that are reads
+        unsigned burst_len = 15;        ///< AxLEN (beats - 1)
+        unsigned outstanding = 4;       ///< Bursts in flight per direction
+        unsigned ready_percent = 100;   ///< Share of cycles with RREADY / BREADY high
+        uint64_t base = 0;              ///< Byte address of the traffic region
+        uint64_t size = 0;              ///< Region size in bytes
+        uint32_t seed = 1;
+    };
+
+    sc_in<bool>                               clk;
+    sc_in<bool>                               rst;
+
+    sc_out<sc_uint<AXI_ADDR_WIDTH>>           M_AXI_AWADDR;
+    sc_out<sc_uint<8>>                        M_AXI_AWLEN;
+    sc_out<sc_uint<3>>                        M_AXI_AWSIZE;
+    sc_out<sc_uint<2>>                        M_AXI_AWBURST;
+    sc_out<bool>                              M_AXI_AWVALID;
+    sc_in<bool>                               M_AXI_AWREADY;
+    sc_out<axi_data_t>                        M_AXI_WDATA;
+    sc_out<sc_uint<AXI_STRB_WIDTH>>           M_AXI_WSTRB;
+    sc_out<bool>                              M_AXI_WLAST;
+    sc_out<bool>                              M_AXI_WVALID;
+    sc_in<bool>                               M_AXI_WREADY;
+    sc_in<sc_uint<2>>                         M_AXI_BRESP;
+    sc_in<bool>                               M_AXI_BVALID;
+    sc_out<bool>                              M_AXI_BREADY;
+    sc_out<sc_uint<AXI_ID_WIDTH>>             M_AXI_ARID;
+    sc_out<sc_uint<AXI_ADDR_WIDTH>>           M_AXI_ARADDR;
+    sc_out<sc_uint<8>>                        M_AXI_ARLEN;
+    sc_out<sc_uint<3>>                        M_AXI_ARSIZE;
+    sc_out<sc_uint<2>>                        M_AXI_ARBURST;
+    sc_out<bool>                              M_AXI_ARVALID;
+    sc_in<bool>                               M_AXI_ARREADY;
+    sc_in<sc_uint<AXI_ID_WIDTH>>              M_AXI_RID;
+    sc_in<axi_data_t>                         M_AXI_RDATA;
+    sc_in<sc_uint<2>>                         M_AXI_RRESP;
+    sc_in<bool>                               M_AXI_RVALID;
+    sc_out<bool>                              M_AXI_RREADY;
+
+    Config                                    config;
+
+    // Counters since reset
+    uint64_t                                  read_bursts = 0;      ///< Accepted AR
+    uint64_t                                  write_bursts = 0;     ///< Accepted AW
+    uint64_t                                  r_beats = 0;
+    uint64_t                                  w_beats = 0;
+    uint64_t                                  b_responses = 0;
+    uint64_t                                  error_responses = 0;  ///< RRESP / BRESP != OKAY
+
+    SC_HAS_PROCESS(AxiTrafficGen);
+
+    AxiTrafficGen(sc_module_name name, const Config& traffic_config) : sc_module(name), config(traffic_config) {
+        SC_METHOD(traffic_process);
+        sensitive << clk.pos();
+    }
+
+    void traffic_process() {
+        SOLE_PROFILE_PROCESS();
+        const unsigned beats = config.burst_len + 1;
+        const uint64_t burst_cost = 100ull * beats;
+
+        if (rst.read()) {
+            lcg = config.seed;
+            ready_lcg = config.seed ^ 0x5A5A5A5Au;
+            tokens = 0;
+            ar_pending = aw_pending = false;
+            reads_in_flight = writes_in_flight = 0;
+            w_queued = 0;
+            w_beats_left = 0;
+            burst_r_beats = 0;
+            next_id = 0;
+            read_bursts = write_bursts = r_beats = w_beats = b_responses = error_responses = 0;
+            M_AXI_ARVALID.write(false);
+            M_AXI_AWVALID.write(false);
+            M_AXI_WVALID.write(false);
+            M_AXI_WLAST.write(false);
+            M_AXI_RREADY.write(false);
+            M_AXI_BREADY.write(false);
+            return;
+        }
+
+        // ===== Handshakes of the last cycle =====
+        if (M_AXI_ARVALID.read() && M_AXI_ARREADY.read()) {
+            ar_pending = false;
+            reads_in_flight++;
+            read_bursts++;
+        }
+        if (M_AXI_RVALID.read() && M_AXI_RREADY.read()) {
+            r_beats++;
+            error_responses += M_AXI_RRESP.read() != 0;
+            if (++burst_r_beats == beats) {     // All bursts have the same length
+                burst_r_beats = 0;
+                reads_in_flight--;
+            }
+        }
+        if (M_AXI_AWVALID.read() && M_AXI_AWREADY.read()) {
+            aw_pending = false;
+            writes_in_flight++;
+            write_bursts++;
+            w_queued++;
+        }
+        if (M_AXI_WVALID.read() && M_AXI_WREADY.read()) {
+            w_beats++;
+            w_beats_left--;
+        }
+        if (M_AXI_BVALID.read() && M_AXI_BREADY.read()) {
+            b_responses++;
+            error_responses += M_AXI_BRESP.read() != 0;
+            writes_in_flight--;
+        }
+
+        // ===== New burst =====
+        tokens = std::min(tokens + config.load_percent, burst_cost);
+        uint64_t slots = config.size / (beats * AXI_BEAT_BYTES);
+        if (config.load_percent != 0 && slots != 0 && tokens >= burst_cost && !ar_pending && !aw_pending) {
+            bool read = next_random() % 100 < config.read_percent;
+            uint64_t addr = config.base + (next_random() % slots) * beats * AXI_BEAT_BYTES;
+            if (read && reads_in_flight < config.outstanding) {
+                ar_pending = true;
+                M_AXI_ARID.write(next_id++ % (1u << AXI_ID_WIDTH));
+                M_AXI_ARADDR.write(addr);
+                M_AXI_ARLEN.write(config.burst_len);
+                M_AXI_ARSIZE.write(AXI_SIZE_BEAT);
+                M_AXI_ARBURST.write(AXI_BURST_INCR);
+                tokens -= burst_cost;
+            } else if (!read && writes_in_flight < config.outstanding) {
+                aw_pending = true;
+                M_AXI_AWADDR.write(addr);
+                M_AXI_AWLEN.write(config.burst_len);
+                M_AXI_AWSIZE.write(AXI_SIZE_BEAT);
+                M_AXI_AWBURST.write(AXI_BURST_INCR);
+                tokens -= burst_cost;
+            }
+        }
+        M_AXI_ARVALID.write(ar_pending);
+        M_AXI_AWVALID.write(aw_pending);
+
+        // ===== Write data: the bursts of accepted AWs, in order =====
+        if (w_beats_left == 0 && w_queued != 0) {
+            w_queued--;
+            w_beats_left = beats;
+        }
+        axi_data_t data = 0;
+        data = (uint64_t)w_beats;
+        M_AXI_WDATA.write(data);
+        M_AXI_WSTRB.write(~sc_uint<AXI_STRB_WIDTH>(0));
+        M_AXI_WLAST.write(w_beats_left == 1);
+        M_AXI_WVALID.write(w_beats_left != 0);
+
+        // Back-pressure on R / B: READY may drop while VALID is up
+        if (config.ready_percent >= 100) {
+            M_AXI_RREADY.write(true);
+            M_AXI_BREADY.write(true);
+        } else {
+            M_AXI_RREADY.write(next_ready_random() % 100 < config.ready_percent);
+            M_AXI_BREADY.write(next_ready_random() % 100 < config.ready_percent);
+        }
+    }
+
+private:
+    uint32_t                                  lcg = 1;
+    uint32_t                                  ready_lcg = 1;
+    uint64_t                                  tokens = 0;
+    bool                                      ar_pending = false;
+    bool                                      aw_pending = false;
+    unsigned                                  reads_in_flight = 0;
+    unsigned                                  writes_in_flight = 0;
+    unsigned                                  w_queued = 0;         ///< Accepted AWs whose W has not started
+    unsigned                                  w_beats_left = 0;     ///< Of the burst on W
+    unsigned                                  burst_r_beats = 0;
+    unsigned                                  next_id = 0;
+
+    uint32_t next_random() {
+        lcg = lcg * 1103515245u + 12345u;
+        return lcg >> 8;
+    }
+
+    uint32_t next_ready_random() {
+        ready_lcg = ready_lcg * 1103515245u + 12345u;
+        return ready_lcg >> 8;
+    }
+};
+
+#endif // AXI_TRAFFIC_GEN_H
@@ -9,8 +9,8 @@
 #include "../src/Divider_PreCompute.cpp"
 
 SC_MODULE(Divider_PreCompute_TestBench) {
-    sc_signal<sc_uint32> input_sig;
-    sc_signal<sc_uint4>  leading_one_pos_sig;
+    sc_signal<sole_sum_t> input_sig;
+    sc_signal<sole_ks_t>  leading_one_pos_sig;
     sc_signal<sc_uint16> threshold_result_sig;
 
     Divider_PreCompute_Module *dut;
@@ -24,23 +24,23 @@ SC_MODULE(Divider_PreCompute_TestBench) {
         SC_THREAD(test_stimulus);
     }
 
-    void print_test_case(int test_num, const std::string& description, uint32_t input, 
+    void print_test_case(int test_num, const std::string& description, uint64_t input, 
                         int expected_pos, int expected_is_over_half, uint16_t expected_threshold) {
         std::cout << "\n" << std::string(100, '=') << std::endl;
         std::cout << "Test " << test_num << ": " << description << std::endl;
         std::cout << std::string(100, '=') << std::endl;
-        std::cout << "Input: 0x" << std::hex << std::setfill('0') << std::setw(8) << input << std::dec << std::endl;
-        std::cout << "Binary (32-bit): " << std::bitset<32>(input) << std::endl;
-        std::cout << "                 " << "||||||||||||||||||XXXXXXXXXXXXXXXX" << std::endl;
-        std::cout << "                 " << "Integer(31-16)   Decimal(15-0)" << std::endl;
+        std::cout << "Input: 0x" << std::hex << std::setfill('0') << std::setw(12) << input << std::dec << std::endl;
+        std::cout << "Binary (48-bit): " << std::bitset<48>(input) << std::endl;
+        std::cout << "                 " << "||||||||||||||||||||||||||||||||||XXXXXXXXXXXXXXXX" << std::endl;
+        std::cout << "                 " << "Integer(47-16)                   Decimal(15-0)" << std::endl;
         
         // Show integer and decimal parts
-        uint32_t integer_part = (input >> 16) & 0xFFFF;
-        uint32_t decimal_part = input & 0xFFFF;
-        std::cout << "\nInteger Part (bits 31-16):" << std::endl;
-        std::cout << "  Hex: 0x" << std::hex << std::setfill('0') << std::setw(4) << integer_part << std::dec << std::endl;
+        uint32_t integer_part = (uint32_t)((input >> 16) & 0xFFFFFFFF);
+        uint32_t decimal_part = (uint32_t)(input & 0xFFFF);
+        std::cout << "\nInteger Part (bits 47-16):" << std::endl;
+        std::cout << "  Hex: 0x" << std::hex << std::setfill('0') << std::setw(8) << integer_part << std::dec << std::endl;
         std::cout << "  Decimal: " << integer_part << std::endl;
-        std::cout << "  Binary: " << std::bitset<16>(integer_part) << std::endl;
+        std::cout << "  Binary: " << std::bitset<32>(integer_part) << std::endl;
         
         std::cout << "\nDecimal Part (bits 15-0):" << std::endl;
         std::cout << "  Hex: 0x" << std::hex << std::setfill('0') << std::setw(4) << decimal_part << std::dec << std::endl;
@@ -52,7 +52,7 @@ SC_MODULE(Divider_PreCompute_TestBench) {
         if (expected_pos == 0) {
             std::cout << "    (Integer part is all zeros, using first decimal place bit)" << std::endl;
         } else {
-            std::cout << "    (Leading one found at bit " << (16 + expected_pos) << " in 32-bit input)" << std::endl;
+            std::cout << "    (Leading one found at bit " << (16 + expected_pos) << " in 48-bit input)" << std::endl;
         }
         std::cout << "  Is_Over_Half: " << expected_is_over_half << std::endl;
         if (expected_pos == 0) {
@@ -68,13 +68,13 @@ SC_MODULE(Divider_PreCompute_TestBench) {
     }
 
     void run_test(int& test_count, int& passed, int test_num, const std::string& description, 
-                  uint32_t input, int expected_pos, int expected_is_over_half, uint16_t expected_threshold) {
+                  uint64_t input, int expected_pos, int expected_is_over_half, uint16_t expected_threshold) {
         print_test_case(test_num, description, input, expected_pos, expected_is_over_half, expected_threshold);
         
-        input_sig.write(sc_uint32(input));
+        input_sig.write(sole_sum_t(input));
         wait(1, SC_NS);
         
-        sc_uint4 actual_pos = leading_one_pos_sig.read();
+        sole_ks_t actual_pos = leading_one_pos_sig.read();
         sc_uint16 actual_threshold = threshold_result_sig.read();
         
         std::cout << "\nActual Results:" << std::endl;
@@ -200,6 +200,16 @@ SC_MODULE(Divider_PreCompute_TestBench) {
         run_test(test_count, passed, 19, "Integer=0x0000, all zeros, leading at pos 0",
                 0x00000000, 0, 0, 0x388B);
 
+        // Test 20: Integer part = 0x00010000 (sum of more than 65535 elements), leading one at position 16
+        // is_over_half from bit 15 = 0
+        run_test(test_count, passed, 20, "Integer=0x00010000, leading at pos 16, bit[15]=0",
+                0x000100000000ULL, 16, 0, 0x388B);
+
+        // Test 21: Integer part = 0xC0000000, leading one at position 31
+        // is_over_half from bit 30 = 1
+        run_test(test_count, passed, 21, "Integer=0xC0000000, leading at pos 31, bit[30]=1",
+                0xC00000000000ULL, 31, 1, 0x3A8B);
+
         // Summary
         std::cout << "\n\n" << std::string(100, '=') << std::endl;
         std::cout << "TEST SUMMARY" << std::endl;
@@ -226,9 +236,9 @@ int sc_main(int argc, char* argv[]) {
     std::cout << "\n" << std::string(100, '=') << std::endl;
     std::cout << "DIVIDER_PRECOMPUTE MODULE COMPREHENSIVE TEST" << std::endl;
     std::cout << std::string(100, '=') << std::endl;
-    std::cout << "Input format: 32-bit value (16-bit integer part | 16-bit decimal part)" << std::endl;
-    std::cout << "              bits 31-16: integer part, bits 15-0: decimal part" << std::endl;
-    std::cout << "\nLeading_One_Pos: Position of leading one in integer part (0-15)" << std::endl;
+    std::cout << "Input format: 48-bit value (32-bit integer part | 16-bit decimal part)" << std::endl;
+    std::cout << "              bits 47-16: integer part, bits 15-0: decimal part" << std::endl;
+    std::cout << "\nLeading_One_Pos: Position of leading one in integer part (0-31)" << std::endl;
     std::cout << "Is_Over_Half: Determined by:" << std::endl;
     std::cout << "  - If Leading_One_Pos == 0: bit 15 (first decimal place)" << std::endl;
     std::cout << "  - If Leading_One_Pos >  0: bit at (Leading_One_Pos - 1) in integer part" << std::endl;
@@ -47,11 +47,11 @@ uint16_t float_to_fp16(float value) {
 
 SC_MODULE(Divider_TestBench) {
     // Test bench signals
-    sc_signal<sc_uint32> input_sig;          // 32-bit input to Divider_PreCompute
+    sc_signal<sole_sum_t> input_sig;         // 48-bit input to Divider_PreCompute
     sc_signal<sc_uint4>  ky_sig;             // 4-bit ky input to Divider
     
     // Internal connection signals
-    sc_signal<sc_uint4>  leading_one_pos_sig;   // Leading_One_Pos output from PreCompute -> ks input to Divider
+    sc_signal<sole_ks_t> leading_one_pos_sig;   // Leading_One_Pos output from PreCompute -> ks input to Divider
     sc_signal<sc_uint16> mux_result_sig;        // Mux_Result output from PreCompute -> Mux_Result input to Divider
     sc_signal<sc_uint16> divider_output_sig;    // Final output from Divider
 
@@ -88,7 +88,7 @@ SC_MODULE(Divider_TestBench) {
         std::cout << "  Float value: " << fp16_to_float(val) << std::endl;
     }
 
-    void print_test_header(int test_num, sc_uint32 input_val, sc_uint4 ky, sc_uint4 ks) {
+    void print_test_header(int test_num, sc_uint32 input_val, sc_uint4 ky, sole_ks_t ks) {
         std::cout << "\n" << std::string(120, '=') << std::endl;
         std::cout << "Test " << test_num << ": ";
         std::cout << "input=0x" << std::hex << std::setw(8) << std::setfill('0') << input_val.to_uint() << std::dec << std::setfill(' ');
@@ -96,7 +96,7 @@ SC_MODULE(Divider_TestBench) {
         std::cout << std::string(120, '=') << std::endl;
     }
 
-    void print_all_signals(sc_uint32 input_val, sc_uint4 ky, sc_uint4 ks, sc_uint16 mux_in, sc_uint16 divider_out, 
+    void print_all_signals(sc_uint32 input_val, sc_uint4 ky, sole_ks_t ks, sc_uint16 mux_in, sc_uint16 divider_out, 
                           float qy_golden, float s_golden, float qy_s_golden) {
         int sign_in = (mux_in.to_uint() >> 15) & 0x1;
         int exp_in = (mux_in.to_uint() >> 10) & 0x1F;
@@ -193,7 +193,7 @@ SC_MODULE(Divider_TestBench) {
             wait(1, SC_NS);
             
             // Read outputs from PreCompute
-            sc_uint4 ks_computed = leading_one_pos_sig.read();
+            sole_ks_t ks_computed = leading_one_pos_sig.read();
             sc_uint16 mux_computed = mux_result_sig.read();
             
             // Calculate golden data using input_sig as S (32-bit fixed point: 16 bits int + 16 bits decimal)
@@ -15,10 +15,10 @@ SC_MODULE(MaxUnit_TestBench) {
         dut = new MaxUnit("MaxUnit_DUT");
         dut->clk(clk_sig);
         dut->rst(rst_sig);
-        dut->A(A_sig);
-        dut->B(B_sig);
-        dut->C(C_sig);
-        dut->D(D_sig);
+        dut->In[0](A_sig);
+        dut->In[1](B_sig);
+        dut->In[2](C_sig);
+        dut->In[3](D_sig);
         dut->Max_Out(Max_Out_sig);
 
         SC_THREAD(clk_gen);
@@ -11,11 +11,13 @@ SC_MODULE(PROCESS_2_TestBench) {
     sc_signal<bool>          rst;
     sc_signal<bool>          enable;
     sc_signal<bool>          stall_output;
-    sc_signal<sc_uint32>     pre_compute_in;
+    sc_signal<sole_sum_t>    pre_compute_in;
+    sc_signal<bool>          pre_compute_valid;
     
     // Output signals
-    sc_signal<sc_uint4>      leading_one_pos_out;
+    sc_signal<sole_ks_t>     leading_one_pos_out;
     sc_signal<sc_uint16>     mux_result_out;
+    sc_signal<bool>          output_valid;
 
     // DUT
     PROCESS_2_Module *dut;
@@ -29,6 +31,8 @@ SC_MODULE(PROCESS_2_TestBench) {
         dut->Pre_Compute_In(pre_compute_in);
         dut->Leading_One_Pos_Out(leading_one_pos_out);
         dut->Mux_Result_Out(mux_result_out);
+        dut->Pre_Compute_Valid(pre_compute_valid);
+        dut->Output_Valid(output_valid);
 
         SC_THREAD(test_stimulus);
     }
@@ -40,7 +44,8 @@ SC_MODULE(PROCESS_2_TestBench) {
                   << " | Stall:" << (stall_output.read() ? "1" : "0")
                   << " | Input:0x" << std::hex << std::setfill('0') << std::setw(8) << pre_compute_in.read().to_uint() << std::dec
                   << " | LO_Pos:" << std::setw(2) << leading_one_pos_out.read().to_uint()
-                  << " | Mux:0x" << std::hex << std::setfill('0') << std::setw(4) << mux_result_out.read().to_uint() << std::dec;
+                  << " | Mux:0x" << std::hex << std::setfill('0') << std::setw(4) << mux_result_out.read().to_uint() << std::dec
+                  << " | Valid:" << (output_valid.read() ? "1" : "0");
         if (!description.empty()) {
             std::cout << " | " << description;
         }
@@ -54,8 +59,8 @@ SC_MODULE(PROCESS_2_TestBench) {
         std::cout << "\nModule Overview:" << std::endl;
         std::cout << "  - Wraps Divider_PreCompute_Module" << std::endl;
         std::cout << "  - Adds output stalling capability via Output_Reg signals" << std::endl;
-        std::cout << "  - Inputs:  clk, rst, enable, stall_output, Pre_Compute_In (32-bit)" << std::endl;
-        std::cout << "  - Outputs: Leading_One_Pos_Out (4-bit), Mux_Result_Out (16-bit)" << std::endl;
+        std::cout << "  - Inputs:  clk, rst, enable, stall_output, Pre_Compute_In (48-bit), Pre_Compute_Valid" << std::endl;
+        std::cout << "  - Outputs: Leading_One_Pos_Out (5-bit), Mux_Result_Out (16-bit), Output_Valid" << std::endl;
         std::cout << std::string(120, '=') << std::endl;
 
         // Initialize all signals
@@ -63,6 +68,7 @@ SC_MODULE(PROCESS_2_TestBench) {
         enable.write(true);
         stall_output.write(false);
         pre_compute_in.write(0);
+        pre_compute_valid.write(true);
         
         // Wait for initial simulation to settle
         wait(10, SC_NS);
@@ -88,7 +94,7 @@ SC_MODULE(PROCESS_2_TestBench) {
         stall_output.write(false);
         wait(20, SC_NS);
         
-        sc_uint4 actual_lo = leading_one_pos_out.read();
+        sole_ks_t actual_lo = leading_one_pos_out.read();
         sc_uint16 actual_mux = mux_result_out.read();
         print_snapshot(2, "Input applied");
         std::cout << "Result: Leading_One_Pos=" << actual_lo.to_uint() << ", Mux_Result=0x" 
@@ -203,7 +209,7 @@ SC_MODULE(PROCESS_2_TestBench) {
         stall_output.write(false);
         wait(20, SC_NS);
         
-        sc_uint4 output_value1 = leading_one_pos_out.read();
+        sole_ks_t output_value1 = leading_one_pos_out.read();
         sc_uint16 output_mux1 = mux_result_out.read();
         print_snapshot(15, "Initial value loaded");
         std::cout << "Loaded: LO_Pos=" << output_value1.to_uint() << ", Mux=0x" 
@@ -217,7 +223,7 @@ SC_MODULE(PROCESS_2_TestBench) {
         
         for (int i = 0; i < 3; i++) {
             wait(10, SC_NS);
-            sc_uint4 stalled_lo = leading_one_pos_out.read();
+            sole_ks_t stalled_lo = leading_one_pos_out.read();
             sc_uint16 stalled_mux = mux_result_out.read();
             print_snapshot(16 + i, "STALLED - Output held");
             std::cout << "  Output: LO_Pos=" << stalled_lo.to_uint() << " (should be " << output_value1.to_uint() 
@@ -235,7 +241,7 @@ SC_MODULE(PROCESS_2_TestBench) {
         
         for (int i = 0; i < 3; i++) {
             wait(10, SC_NS);
-            sc_uint4 released_lo = leading_one_pos_out.read();
+            sole_ks_t released_lo = leading_one_pos_out.read();
             sc_uint16 released_mux = mux_result_out.read();
             print_snapshot(19 + i, "RELEASED - Output updated");
             std::cout << "  Output: LO_Pos=" << released_lo.to_uint() << " (expected 2), Mux=0x" 
@@ -261,7 +267,7 @@ SC_MODULE(PROCESS_2_TestBench) {
             pre_compute_in.write(test_inputs[cycle]);
             stall_output.write(false);
             wait(15, SC_NS);
-            sc_uint4 lo_loaded = leading_one_pos_out.read();
+            sole_ks_t lo_loaded = leading_one_pos_out.read();
             print_snapshot(22 + cycle * 2, "Load phase");
             std::cout << "  Loaded: LO_Pos=" << lo_loaded.to_uint() << " (expected " << expected_pos[cycle] << ")" << std::endl;
             
@@ -271,7 +277,7 @@ SC_MODULE(PROCESS_2_TestBench) {
                 stall_output.write(true);
                 pre_compute_in.write(next_input);
                 wait(15, SC_NS);
-                sc_uint4 lo_stalled = leading_one_pos_out.read();
+                sole_ks_t lo_stalled = leading_one_pos_out.read();
                 print_snapshot(23 + cycle * 2, "Stall phase");
                 std::cout << "  Stalled: LO_Pos=" << lo_stalled.to_uint() << " (should remain " << lo_loaded.to_uint() << ")" << std::endl;
                 
@@ -283,6 +289,58 @@ SC_MODULE(PROCESS_2_TestBench) {
             }
         }
 
+        // Test Case 9: Pre_Compute_Valid / Output_Valid handshake
+        std::cout << "\n>>> TEST CASE 9: Pre_Compute_Valid / Output_Valid Handshake" << std::endl;
+        std::cout << std::string(100, '-') << std::endl;
+
+        // 9.1: Input still accumulating (stalled, not valid) -> Output_Valid low
+        stall_output.write(true);
+        pre_compute_valid.write(false);
+        pre_compute_in.write(0x00060000);
+        wait(10, SC_NS);
+        print_snapshot(30, "Input not final");
+        if (!output_valid.read()) {
+            std::cout << "✓ Output_Valid=0 while Pre_Compute_Valid=0" << std::endl;
+        } else {
+            std::cout << "✗ Output_Valid set before the input is final" << std::endl;
+        }
+
+        // 9.2: Final input and stall released -> result and Output_Valid in the same cycle
+        pre_compute_valid.write(true);
+        stall_output.write(false);
+        wait(SC_ZERO_TIME);
+        wait(SC_ZERO_TIME);
+        wait(SC_ZERO_TIME);
+        print_snapshot(31, "Input final, stall released");
+        if (output_valid.read() && leading_one_pos_out.read().to_uint() == 2 &&
+            mux_result_out.read().to_uint() == 0x3A8B) {
+            std::cout << "✓ Output_Valid=1 with Position=2, Mux=0x3A8B in the first cycle" << std::endl;
+        } else {
+            std::cout << "✗ Output_Valid/result not ready in the first cycle" << std::endl;
+        }
+
+        // 9.3: Stall again -> result and Output_Valid held
+        stall_output.write(true);
+        pre_compute_in.write(0x00010000);
+        wait(10, SC_NS);
+        print_snapshot(32, "Stalled after load");
+        if (output_valid.read() && leading_one_pos_out.read().to_uint() == 2) {
+            std::cout << "✓ Output_Valid and result held during stall" << std::endl;
+        } else {
+            std::cout << "✗ Output_Valid or result lost during stall" << std::endl;
+        }
+
+        // 9.4: Reset clears Output_Valid
+        rst.write(true);
+        wait(10, SC_NS);
+        print_snapshot(33, "Reset");
+        if (!output_valid.read()) {
+            std::cout << "✓ Output_Valid cleared by reset" << std::endl;
+        } else {
+            std::cout << "✗ Output_Valid not cleared by reset" << std::endl;
+        }
+        rst.write(false);
+
         // Summary
         std::cout << "\n" << std::string(120, '=') << std::endl;
         std::cout << "COMPREHENSIVE STALL MECHANISM TEST COMPLETE" << std::endl;
@@ -291,6 +349,7 @@ SC_MODULE(PROCESS_2_TestBench) {
         std::cout << "  ✓ Output updates correctly when stall_output=0" << std::endl;
         std::cout << "  ✓ Multiple stall/release cycles work as expected" << std::endl;
         std::cout << "  ✓ Input changes during stall are ignored until stall is released" << std::endl;
+        std::cout << "  ✓ Output_Valid follows Pre_Compute_Valid within one cycle" << std::endl;
         std::cout << std::string(120, '=') << std::endl;
 
         sc_stop();
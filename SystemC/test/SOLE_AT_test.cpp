@@ -0,0 +1,598 @@
+#include <systemc>
+#include <tlm.h>
+#include <tlm_utils/simple_initiator_socket.h>
+#include <tlm_utils/simple_target_socket.h>
+#include <tlm_utils/peq_with_cb_and_phase.h>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include <cstdlib>
+#include <cmath>
+#include <map>
+#include <vector>
+#include "../include/SOLE_AT.h"
+#include "../include/SOLE_MMIO.hpp"
+#include "../Csim/Softmax.h"
+#include "test_utils.h"
+
+using namespace sc_core;
+using namespace sc_dt;
+using namespace std;
+using namespace sole::mmio;
+
+#define TEST_DATA_SIZE 2048          // Same memory size as SOLE_test (words)
+#define MAX_TIMEOUT_CYCLES 100000
+#define SWEEP_LENGTH 4096            // Elements per run of the latency sweep
+
+static void output_memory_to_log(std::ostream* log, const vector<uint64_t>& memory, int start_word, size_t length) {
+    if (log && log->good()) {
+        (*log) << "\n[MEMORY DUMP]\n Address(word) | Data (Hex)\n";
+        for (size_t i = 0; i < length; i++) {
+            uint64_t data = memory[start_word + i];
+            (*log) << "   " << dec << setfill(' ') << setw(5) << (start_word + i)
+            << "  :  0x " << hex << setfill('0') << setw(4) << (uint16_t)((data >> 48) & 0xFFFF) << " "
+            << setw(4) << (uint16_t)((data >> 32) & 0xFFFF) << " "
+            << setw(4) << (uint16_t)((data >> 16) & 0xFFFF) << " "
+            << setw(4) << (uint16_t)(data & 0xFFFF) << dec << "\n";
+        }
+    }
+}
+
+// ===== AT Memory Model =====
+/**
+ * @class AtMemory
+ * @brief TLM-2.0 AT target memory (64-bit words, byte addressed)
+ *
+ * - END_REQ accept_cycles after BEGIN_REQ
+ * - BEGIN_RESP read_latency cycles after BEGIN_REQ (write_latency after the last
+ *   write beat), responses in order of readiness, one at a time
+ * - read_response_gap idle cycles between the END_RESP of a read and the next BEGIN_RESP
+ * - Out-of-range accesses return TLM_ADDRESS_ERROR_RESPONSE
+ *
+ * The default timing is that of the SOLE_test AxiSlaveMemory with zero wait
+ * states; AXI_READ_RVALID_DELAY = D corresponds to read_latency = D + 1 and
+ * read_response_gap = D.
+ */
+SC_MODULE(AtMemory) {
+    struct Timing {
+        unsigned accept_cycles = 0;
+        unsigned read_latency  = 1;
+        unsigned write_latency = 2;
+        unsigned read_response_gap = 0;
+    };
+
+    tlm_utils::simple_target_socket<AtMemory, 64> socket;
+    vector<uint64_t> memory;
+
+    SC_HAS_PROCESS(AtMemory);
+    AtMemory(sc_module_name name, const Timing& timing, sc_time clk_period = sc_time(1, SC_NS))
+        : sc_module(name), socket("socket"), memory(TEST_DATA_SIZE, 0),
+        timing(timing), clk_period(clk_period), peq("peq", this, &AtMemory::peq_callback),
+        response_busy(false)
+    {
+        socket.register_nb_transport_fw(this, &AtMemory::nb_transport_fw);
+        SC_THREAD(response_thread);
+    }
+
+private:
+    Timing  timing;
+    sc_time clk_period;
+    tlm_utils::peq_with_cb_and_phase<AtMemory> peq;
+    multimap<sc_time, tlm::tlm_generic_payload*> responses;  ///< Ready time -> request
+    bool     response_busy;
+    sc_time  response_free;
+    sc_event response_event;
+
+    tlm::tlm_sync_enum nb_transport_fw(tlm::tlm_generic_payload& trans, tlm::tlm_phase& phase, sc_time& delay) {
+        peq.notify(trans, phase, delay);
+        return tlm::TLM_ACCEPTED;
+    }
+
+    void peq_callback(tlm::tlm_generic_payload& trans, const tlm::tlm_phase& phase) {
+        if (phase == tlm::BEGIN_REQ) {
+            trans.acquire();
+            tlm::tlm_phase end_req = tlm::END_REQ;
+            sc_time delay = clk_period * (double)timing.accept_cycles;
+            socket->nb_transport_bw(trans, end_req, delay);
+
+            unsigned latency = timing.read_latency;
+            if (trans.is_write()) {
+                latency = timing.write_latency + trans.get_data_length() / sizeof(uint64_t) - 1;
+            }
+            responses.insert(make_pair(sc_time_stamp() + clk_period * (double)latency, &trans));
+        } else if (phase == tlm::END_RESP) {
+            end_response(trans);
+        }
+        response_event.notify(SC_ZERO_TIME);
+    }
+
+    void response_thread() {
+        while (true) {
+            if (response_busy || responses.empty()) {
+                wait(response_event);
+                continue;
+            }
+            sc_time when = max(responses.begin()->first, response_free);
+            if (sc_time_stamp() < when) {
+                wait(when - sc_time_stamp(), response_event);
+                continue;
+            }
+            tlm::tlm_generic_payload* trans = responses.begin()->second;
+            responses.erase(responses.begin());
+            access(*trans);
+
+            response_busy = true;
+            tlm::tlm_phase phase = tlm::BEGIN_RESP;
+            sc_time delay = SC_ZERO_TIME;
+            tlm::tlm_sync_enum status = socket->nb_transport_bw(*trans, phase, delay);
+            if (status == tlm::TLM_COMPLETED) {
+                end_response(*trans);
+            }
+        }
+    }
+
+    void end_response(tlm::tlm_generic_payload& trans) {
+        response_busy = false;
+        response_free = sc_time_stamp();
+        if (trans.is_read()) {
+            response_free += clk_period * (double)timing.read_response_gap;
+        }
+        trans.release();
+    }
+
+    void access(tlm::tlm_generic_payload& trans) {
+        uint64_t addr = trans.get_address();
+        unsigned int len = trans.get_data_length();
+        if (addr + len > memory.size() * sizeof(uint64_t) || trans.get_byte_enable_ptr() != nullptr) {
+            trans.set_response_status(tlm::TLM_ADDRESS_ERROR_RESPONSE);
+            return;
+        }
+        unsigned char* mem = reinterpret_cast<unsigned char*>(memory.data()) + addr;
+        if (trans.is_read()) {
+            memcpy(trans.get_data_ptr(), mem, len);
+        } else if (trans.is_write()) {
+            memcpy(mem, trans.get_data_ptr(), len);
+        }
+        trans.set_response_status(tlm::TLM_OK_RESPONSE);
+    }
+};
+
+// ===== DUT + memory + MMIO master =====
+SC_MODULE(SOLE_AT_System) {
+    tlm_utils::simple_initiator_socket<SOLE_AT_System> mmio_socket;
+    sc_signal<bool> interrupt;
+
+    SOLE_AT*  dut;
+    AtMemory* mem;
+
+    SOLE_AT_System(sc_module_name name, const SOLE_AT::Config& config, const AtMemory::Timing& timing)
+        : sc_module(name), mmio_socket("mmio_socket"), interrupt("interrupt")
+    {
+        dut = new SOLE_AT("SOLE_AT_DUT", config);
+        mem = new AtMemory("AtMemory", timing);
+
+        mmio_socket.bind(dut->mmio_socket);
+        dut->mem_socket.bind(mem->socket);
+        dut->interrupt(interrupt);
+    }
+
+    ~SOLE_AT_System() {
+        delete dut;
+        delete mem;
+    }
+
+    /// Returns false on an error response
+    bool mmio_write(uint32_t offset, uint32_t value) {
+        tlm::tlm_generic_payload trans;
+        sc_time delay = SC_ZERO_TIME;
+        trans.set_command(tlm::TLM_WRITE_COMMAND);
+        trans.set_address(offset);
+        trans.set_data_ptr(reinterpret_cast<unsigned char*>(&value));
+        trans.set_data_length(4);
+        trans.set_streaming_width(4);
+        trans.set_byte_enable_ptr(nullptr);
+        trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+        mmio_socket->b_transport(trans, delay);
+        if (trans.is_response_error()) {
+            cerr << "[ERROR] MMIO write failed @0x" << hex << offset << dec << endl;
+        }
+        wait(delay);
+        return !trans.is_response_error();
+    }
+
+    uint32_t mmio_read(uint32_t offset) {
+        uint32_t value = 0;
+        tlm::tlm_generic_payload trans;
+        sc_time delay = SC_ZERO_TIME;
+        trans.set_command(tlm::TLM_READ_COMMAND);
+        trans.set_address(offset);
+        trans.set_data_ptr(reinterpret_cast<unsigned char*>(&value));
+        trans.set_data_length(4);
+        trans.set_streaming_width(4);
+        trans.set_byte_enable_ptr(nullptr);
+        trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+        mmio_socket->b_transport(trans, delay);
+        wait(delay);
+        return value;
+    }
+
+    /// Wait for interrupt, bounded by MAX_TIMEOUT_CYCLES
+    bool wait_interrupt() {
+        if (interrupt.read()) return true;
+        wait(sc_time(MAX_TIMEOUT_CYCLES, SC_NS), interrupt.posedge_event());
+        return interrupt.read();
+    }
+
+    /// Wait for interrupt to deassert, bounded by MAX_TIMEOUT_CYCLES
+    bool wait_interrupt_clear() {
+        if (!interrupt.read()) return true;
+        wait(sc_time(MAX_TIMEOUT_CYCLES, SC_NS), interrupt.negedge_event());
+        return !interrupt.read();
+    }
+
+    void start_run(uint32_t src_byte_addr, uint32_t dst_byte_addr, uint32_t length) {
+        mmio_write(REG_SRC_ADDR_BASE_L, src_byte_addr);
+        mmio_write(REG_SRC_ADDR_BASE_H, 0);
+        mmio_write(REG_DST_ADDR_BASE_L, dst_byte_addr);
+        mmio_write(REG_DST_ADDR_BASE_H, 0);
+        mmio_write(REG_LENGTH_L, length);
+        mmio_write(REG_LENGTH_H, 0);
+    }
+
+    /// Program, pulse START and wait for the interrupt; returns the execution time in cycles
+    long long run(uint32_t src_byte_addr, uint32_t dst_byte_addr, uint32_t length) {
+        start_run(src_byte_addr, dst_byte_addr, length);
+        sc_time start_time = sc_time_stamp();
+        mmio_write(REG_CONTROL, 0x1);
+        mmio_write(REG_CONTROL, 0x0);
+        if (!wait_interrupt()) {
+            return -1;
+        }
+        return (long long)((sc_time_stamp() - start_time) / sc_time(1, SC_NS));
+    }
+};
+
+/// One point of the interconnect sweep
+struct SweepPoint {
+    unsigned latency;        ///< Read latency (cycles)
+    unsigned outstanding;    ///< Max outstanding reads and writes
+    unsigned burst;          ///< Beats per request
+    SOLE_AT_System* sys;
+    long long exec_cycles;
+    long long p1_cycles;
+};
+
+// ===== Testbench =====
+SC_MODULE(SOLE_AT_TestBench) {
+    SOLE_AT_System*    main_sys;
+    vector<SweepPoint> sweep;
+    unsigned           read_wait;   ///< Read wait states of the main run (SOLE_AT_READ_WAIT)
+
+    int test_total;
+    int test_passed;
+    int test_failed;
+
+    SC_HAS_PROCESS(SOLE_AT_TestBench);
+    SOLE_AT_TestBench(sc_module_name name) : sc_module(name), read_wait(0),
+        test_total(0), test_passed(0), test_failed(0)
+    {
+        // Main run: the SOLE_test AxiSlaveMemory timing, optionally with
+        // AXI_READ_RVALID_DELAY read wait states (SOLE_AT_READ_WAIT=<cycles>)
+        if (const char* env = getenv("SOLE_AT_READ_WAIT")) {
+            read_wait = (unsigned)atoi(env);
+        }
+        AtMemory::Timing timing;
+        timing.read_latency = read_wait + 1;
+        timing.read_response_gap = read_wait;
+        main_sys = new SOLE_AT_System("main", SOLE_AT::Config(), timing);
+
+        const unsigned latencies[] = {1, 8, 32};
+        const unsigned outstanding[] = {1, 4, 16, 64};
+        const unsigned bursts[] = {1, 4, 16};
+        for (unsigned lat : latencies) {
+            for (unsigned out : outstanding) {
+                for (unsigned burst : bursts) {
+                    SOLE_AT::Config config;
+                    config.max_outstanding_reads = out;
+                    config.max_outstanding_writes = out;
+                    config.read_burst_beats = burst;
+                    config.write_burst_beats = burst;
+                    AtMemory::Timing sweep_timing;
+                    sweep_timing.read_latency = lat;
+                    std::ostringstream sys_name;
+                    sys_name << "sweep_l" << lat << "_o" << out << "_b" << burst;
+                    sweep.push_back(SweepPoint{lat, out, burst,
+                        new SOLE_AT_System(sys_name.str().c_str(), config, sweep_timing), -1, -1});
+                }
+            }
+        }
+
+        SC_THREAD(test_stimulus);
+    }
+
+    ~SOLE_AT_TestBench() {
+        delete main_sys;
+        for (SweepPoint& p : sweep) {
+            delete p.sys;
+        }
+    }
+
+    void verify_test(bool condition, const string& test_name) {
+        test_total++;
+        if (condition) {
+            cout << "[PASS] " << test_name << endl;
+            test_passed++;
+        } else {
+            cout << "[FAIL] " << test_name << endl;
+            test_failed++;
+        }
+    }
+
+    // ===== Latency / outstanding / burst sweep =====
+    void run_sweep(ofstream& test_log) {
+        const int INPUT_START_WORD = 0;
+        const int OUTPUT_START_WORD = 1024;
+        const long long beats = (SWEEP_LENGTH + 3) / 4;
+
+        for (SweepPoint& p : sweep) {
+            uint32_t seed = 12345;
+            for (long long i = 0; i < beats; i++) {
+                uint64_t packed = 0;
+                for (int j = 0; j < 4; j++) {
+                    seed = seed * 1103515245u + 12345u;
+                    float v = (float)((int)((seed >> 16) % 8000) - 4000) / 1000.0f;
+                    packed |= (uint64_t)float_to_fp16(v) << (j * 16);
+                }
+                p.sys->mem->memory[INPUT_START_WORD + i] = packed;
+            }
+            p.exec_cycles = p.sys->run(INPUT_START_WORD * 8, OUTPUT_START_WORD * 8, SWEEP_LENGTH);
+            p.p1_cycles = (long long)(p.sys->dut->stats().process1_time / sc_time(1, SC_NS));
+            p.sys->wait_interrupt_clear();
+        }
+
+        std::ostringstream table;
+        table << "\n[SWEEP] n=" << SWEEP_LENGTH << " (" << beats << " beats), write latency 2 cycles\n";
+        table << " Latency | Outstanding | Burst | PROCESS1 | Exec (cycles) | Read B/cycle\n";
+        for (const SweepPoint& p : sweep) {
+            table << setfill(' ') << setw(8) << p.latency << " | " << setw(11) << p.outstanding
+                  << " | " << setw(5) << p.burst << " | " << setw(8) << p.p1_cycles
+                  << " | " << setw(13) << p.exec_cycles << " | "
+                  << fixed << setprecision(3) << setw(12) << (double)(beats * 8) / (double)p.p1_cycles << "\n";
+        }
+        cout << table.str();
+        test_log << table.str();
+
+        bool all_done = true;
+        bool same_output = true;
+        bool closed_form = true;
+        bool monotonic = true;
+        const vector<uint64_t>& ref = sweep.front().sys->mem->memory;
+        for (const SweepPoint& p : sweep) {
+            all_done = all_done && p.exec_cycles > 0;
+            same_output = same_output && std::equal(ref.begin() + OUTPUT_START_WORD, ref.begin() + OUTPUT_START_WORD + beats,
+                                                    p.sys->mem->memory.begin() + OUTPUT_START_WORD);
+            if (p.burst == 1) {
+                // One request at a time: a read every latency + 1 cycles
+                if (p.outstanding == 1 &&
+                    p.p1_cycles != SOLE_AT::READ_ISSUE_CYCLES + (beats - 1) * (p.latency + 1) + p.latency + SOLE_AT::P1_DRAIN_CYCLES) {
+                    closed_form = false;
+                }
+                // Enough requests in flight to hide the latency: one beat per cycle
+                if (p.outstanding >= p.latency + 1 &&
+                    p.p1_cycles != SOLE_AT::READ_ISSUE_CYCLES + (beats - 1) + p.latency + SOLE_AT::P1_DRAIN_CYCLES) {
+                    closed_form = false;
+                }
+            }
+            for (const SweepPoint& q : sweep) {
+                if (q.burst != p.burst) continue;
+                if (q.latency == p.latency && q.outstanding > p.outstanding && q.exec_cycles > p.exec_cycles) monotonic = false;
+                if (q.outstanding == p.outstanding && q.latency > p.latency && q.exec_cycles < p.exec_cycles) monotonic = false;
+            }
+        }
+        verify_test(all_done, "Sweep: every configuration completes");
+        verify_test(same_output, "Sweep: outputs identical across interconnect configurations");
+        verify_test(closed_form, "Sweep: PROCESS1 matches closed form (1 outstanding / latency hidden)");
+        verify_test(monotonic, "Sweep: more outstanding never slower, more latency never faster");
+    }
+
+    // ===== Main Test Stimulus =====
+    void test_stimulus() {
+        const int INPUT_START_WORD = 100;
+        const int OUTPUT_START_WORD = 500;
+        SOLE_AT_System* sys = main_sys;
+
+        ofstream test_log("../test/SOLE_AT_test_Result.log");
+        if (!test_log.is_open()) {
+            cerr << "[ERROR] Failed to create SOLE_AT_test_Result.log" << endl;
+            sc_stop();
+            return;
+        }
+        test_log << "===== SOLE AT TEST LOG =====\n";
+
+        // Read input test vectors from file (one value per line)
+        vector<float> input_values;
+        ifstream data_file("SOLE_test_Data.txt");
+        if (!data_file.is_open()) {
+            data_file.open("../test/SOLE_test_Data.txt");
+        }
+        if (!data_file.is_open()) {
+            cerr << "[ERROR] Failed to open SOLE_test_Data.txt" << endl;
+            sc_stop();
+            return;
+        }
+        string line;
+        while (std::getline(data_file, line)) {
+            std::stringstream ss(line);
+            float v;
+            if (!(ss >> v)) continue;
+            input_values.push_back(v);
+        }
+        data_file.close();
+
+        const int NUM_DATA = (int)input_values.size();
+        if (NUM_DATA == 0) {
+            cerr << "[ERROR] No input data found in SOLE_test_Data.txt" << endl;
+            sc_stop();
+            return;
+        }
+        const int NUM_64BIT_WORDS = (NUM_DATA + 3) / 4;
+
+        // (1) Input data to memory
+        for (int i = 0; i < NUM_64BIT_WORDS; i++) {
+            uint64_t packed = 0;
+            for (int j = 0; j < 4 && (i * 4 + j) < NUM_DATA; j++) {
+                packed |= (uint64_t)float_to_fp16(input_values[i * 4 + j]) << (j * 16);
+            }
+            sys->mem->memory[INPUT_START_WORD + i] = packed;
+        }
+        test_log << "\n[1] Memory Input Data Write";
+        output_memory_to_log(&test_log, sys->mem->memory, INPUT_START_WORD, NUM_64BIT_WORDS);
+
+        // (2) Configure, start and wait for DONE
+        long long exec_ns = sys->run(INPUT_START_WORD * 8, OUTPUT_START_WORD * 8, NUM_DATA);
+        sc_time done_time = sc_time_stamp();
+        uint32_t status = sys->dut->status();
+        long long expected_ns = 20 + 2 * (long long)NUM_64BIT_WORDS + (long long)read_wait * NUM_64BIT_WORDS;
+
+        verify_test(exec_ns > 0 && (status & (1u << STAT_DONE_BIT)), "DONE interrupt asserted");
+        verify_test(((status >> STAT_ERROR_BIT) & 0x1) == 0, "No error on normal run");
+        verify_test(exec_ns == expected_ns, "Execution time matches pin-level model (20 + (2 + read wait) * beats ns)");
+        sys->wait_interrupt_clear();
+        verify_test(sc_time_stamp() - done_time == sc_time(1, SC_NS) && sys->mmio_read(REG_STATUS) == 0,
+                    "DONE pulse is one cycle, back to IDLE");
+
+        // (3) Results
+        test_log << "\n[5] Output Stored Back to Memory via AXI4_Lite";
+        output_memory_to_log(&test_log, sys->mem->memory, OUTPUT_START_WORD, NUM_64BIT_WORDS);
+
+        vector<float> hw_input(input_values);
+        vector<float> hw_output(NUM_DATA);
+        vector<float> sw_output(NUM_DATA);
+        SOLE_softmax(sw_output.data(), hw_input.data(), NUM_DATA);
+        test_log << "\n[4] Softmax Compute Results\n";
+        test_log << "Index |  Input  |  HW_Output  |  SW_Output  |  AbsError\n";
+        double dot = 0.0, norm_hw = 0.0, norm_sw = 0.0;
+        for (int i = 0; i < NUM_DATA; i++) {
+            uint64_t packed = sys->mem->memory[OUTPUT_START_WORD + i / 4];
+            hw_output[i] = fp16_to_float((uint16_t)((packed >> ((i % 4) * 16)) & 0xFFFF));
+            test_log << setfill(' ') << setw(3) << i << "    "
+                     << setw(7) << fixed << setprecision(6) << hw_input[i] << "  "
+                     << setw(12) << fixed << setprecision(9) << hw_output[i] << "  "
+                     << setw(12) << fixed << setprecision(9) << sw_output[i] << "   "
+                     << setw(12) << scientific << setprecision(6) << fabsf(hw_output[i] - sw_output[i]) << "\n";
+            dot += (double)hw_output[i] * (double)sw_output[i];
+            norm_hw += (double)hw_output[i] * (double)hw_output[i];
+            norm_sw += (double)sw_output[i] * (double)sw_output[i];
+        }
+        double cosine = 0.0;
+        if (norm_hw > 0.0 && norm_sw > 0.0) cosine = dot / (sqrt(norm_hw) * sqrt(norm_sw));
+        verify_test(cosine > 0.95, "Cosine similarity (HW vs SW) > 0.95");
+
+        test_log << "\n================== FINAL REPORT ================= ";
+        test_log << "\n[EXECUTION TIME] SOLE Execution Time: " << exec_ns << " ns\n";
+        test_log << "\n[ANALYSIS] Cosine Similarity (HW vs SW) = " << fixed << setprecision(9) << cosine << "\n";
+
+        // (4) Memory error: source outside the memory, error pulse then DONE
+        sys->start_run(TEST_DATA_SIZE * 8, OUTPUT_START_WORD * 8, NUM_DATA);
+        sys->mmio_write(REG_CONTROL, 0x1);
+        sys->mmio_write(REG_CONTROL, 0x0);
+        bool irq = sys->wait_interrupt();
+        status = sys->dut->status();
+        verify_test(irq && ((status >> STAT_ERROR_CODE_LSB) & 0xF) == softmax::status::ERR_AXI_READ_ERROR,
+                    "Out-of-range source raises ERR_AXI_READ_ERROR");
+        sys->wait_interrupt_clear();
+        irq = sys->wait_interrupt();
+        verify_test(irq && (sys->dut->status() & (1u << STAT_DONE_BIT)), "Run still completes with DONE after read error");
+        sys->wait_interrupt_clear();
+
+        // (5) Completion counter and coalesced interrupt (same registers as SOLE)
+        wait(1, SC_NS);
+        uint32_t completed = sys->mmio_read(REG_COMPLETED_JOBS);
+        verify_test(completed == 3, "REG_COMPLETED_JOBS counts DONE and ERROR completions");
+        sys->mmio_write(REG_COMPLETED_JOBS, completed);
+        sys->mmio_write(REG_IRQ_COUNT_THRESHOLD, 2);
+        sys->start_run(INPUT_START_WORD * 8, OUTPUT_START_WORD * 8, NUM_DATA);
+        sys->mmio_write(REG_CONTROL, 0x1);
+        sys->mmio_write(REG_CONTROL, 0x0);
+        wait(sc_time((double)(expected_ns + 2), SC_NS));
+        verify_test(!sys->interrupt.read() && sys->mmio_read(REG_COMPLETED_JOBS) == completed + 1,
+                    "Coalesced interrupt: no interrupt below the count threshold");
+        long long coalesced_ns = sys->run(INPUT_START_WORD * 8, OUTPUT_START_WORD * 8, NUM_DATA);
+        verify_test(coalesced_ns == expected_ns + 1 && sys->mmio_read(REG_COMPLETED_JOBS) == completed + 2,
+                    "Coalesced interrupt at the count threshold, one cycle after DONE");
+        sys->mmio_write(REG_COMPLETED_JOBS, completed + 2);
+        verify_test(sys->wait_interrupt_clear(), "Acknowledge clears the coalesced interrupt");
+        sys->mmio_write(REG_IRQ_COUNT_THRESHOLD, 0);
+
+        // (6) Row batching (two packed rows) and one ring descriptor through the AT request flow,
+        // checked against Softmax_Datapath
+        const int ROW_WORDS = min(NUM_64BIT_WORDS, 16);
+        const int ROW_LENGTH = min(NUM_DATA, 4 * ROW_WORDS);
+        const int BATCH_INPUT_WORD = 1600;
+        const int BATCH_OUTPUT_WORD = 1700;
+        const int RING_WORD = 1800;
+        vector<uint64_t> reference(ROW_WORDS);
+        Softmax_Datapath reference_datapath;
+        reference_datapath.begin_job();
+        for (int i = 0; i < ROW_WORDS; i++) {
+            reference_datapath.process1_beat(sys->mem->memory[INPUT_START_WORD + i]);
+        }
+        reference_datapath.process2();
+        for (int i = 0; i < ROW_WORDS; i++) {
+            reference[i] = reference_datapath.process3_beat(i);
+            sys->mem->memory[BATCH_INPUT_WORD + i] = sys->mem->memory[INPUT_START_WORD + i];
+            sys->mem->memory[BATCH_INPUT_WORD + ROW_WORDS + i] = sys->mem->memory[INPUT_START_WORD + i];
+        }
+        sys->mmio_write(REG_ROW_COUNT, 2);
+        long long batch_ns = sys->run(BATCH_INPUT_WORD * 8, BATCH_OUTPUT_WORD * 8, ROW_LENGTH);
+        sys->wait_interrupt_clear();
+        sys->mmio_write(REG_ROW_COUNT, 0);
+        bool rows_match = true;
+        for (int i = 0; i < 2 * ROW_WORDS; i++) {
+            rows_match &= sys->mem->memory[BATCH_OUTPUT_WORD + i] == reference[i % ROW_WORDS];
+        }
+        verify_test(batch_ns > 0 && rows_match, "Row batching: both rows equal the single-row datapath output");
+
+        uint64_t* desc = &sys->mem->memory[RING_WORD];
+        desc[0] = (BATCH_INPUT_WORD + ROW_WORDS) * 8;
+        desc[1] = (BATCH_OUTPUT_WORD + 2 * ROW_WORDS) * 8;
+        desc[2] = ROW_LENGTH;
+        desc[3] = 0;
+        completed = sys->mmio_read(REG_COMPLETED_JOBS);
+        sys->mmio_write(REG_RING_BASE_L, RING_WORD * 8);
+        sys->mmio_write(REG_RING_SIZE, 2);
+        sys->mmio_write(REG_CONTROL, 1u << CTRL_RING_BIT);
+        sys->mmio_write(REG_RING_TAIL, 1);
+        irq = sys->wait_interrupt();
+        sys->wait_interrupt_clear();
+        wait(SOLE_TLM::RING_WRITEBACK_CYCLES + 1, SC_NS);
+        bool ring_match = true;
+        for (int i = 0; i < ROW_WORDS; i++) {
+            ring_match &= sys->mem->memory[BATCH_OUTPUT_WORD + 2 * ROW_WORDS + i] == reference[i];
+        }
+        verify_test(irq && ring_match && sys->mmio_read(REG_RING_HEAD) == 1 &&
+                    sys->mmio_read(REG_COMPLETED_JOBS) == completed + 1 &&
+                    (desc[3] & 0xFFFFFFFF) == ((1u << RING_CPL_COMPLETE_BIT) | (1u << STAT_DONE_BIT)),
+                    "Descriptor ring: row, completion record and HEAD");
+        sys->mmio_write(REG_CONTROL, 0x0);
+
+        // (7) Interconnect sweep
+        run_sweep(test_log);
+
+        test_log << "\n[TEST SUMMARY] " << test_passed << "/" << test_total << " passed\n";
+        test_log << "\n============ END OF SOLE AT TEST LOG ============\n";
+        test_log.close();
+
+        cout << "[TEST SUMMARY] " << test_passed << "/" << test_total << " passed" << endl;
+        sc_stop();
+    }
+};
+
+// ===== Main Entry Point =====
+int sc_main(int argc, char* argv[]) {
+    SOLE_AT_TestBench testbench("SOLE_AT_TestBench");
+    sc_start();
+    return testbench.test_failed ? 1 : 0;
+}
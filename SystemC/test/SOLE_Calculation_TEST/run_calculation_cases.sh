@@ -8,14 +8,15 @@ SRC_TEST_DIR="$ROOT_DIR/test"
 CASE_DIR="$SCRIPT_DIR/testcases"
 LOG_DIR="$SCRIPT_DIR/log"
 
-DATA_FILE="$SRC_TEST_DIR/SOLE_test_Data.txt"
-RESULT_LOG="$SRC_TEST_DIR/SOLE_test_Result.log"
-MONITOR_LOG="$SRC_TEST_DIR/SOLE_test_Monitor.log"
+BATCH_FILE="$LOG_DIR/batch.txt"
+BATCH_CSV="$LOG_DIR/batch.csv"
+RUN_LOG="$LOG_DIR/sole_run.log"
 RESULTS_CSV="$SCRIPT_DIR/cosine_results.csv"
 REPORT_MD="$SCRIPT_DIR/SOLE_CALCULATION_TEST_REPORT.md"
 README_TXT="$SCRIPT_DIR/read_me.txt"
 
 BUILD_FIRST="${BUILD_FIRST:-1}"
+JOBS="${JOBS:-$(nproc)}"
 COSINE_THRESHOLD="${COSINE_THRESHOLD:-0.95}"
 
 mkdir -p "$LOG_DIR"
@@ -25,92 +26,59 @@ if [[ ! -d "$CASE_DIR" ]]; then
   exit 1
 fi
 
-if [[ ! -f "$DATA_FILE" ]]; then
-  echo "[ERROR] Missing source data file: $DATA_FILE" >&2
-  exit 1
-fi
-
 if [[ ! -d "$BUILD_DIR" ]]; then
   echo "[ERROR] Missing build directory: $BUILD_DIR" >&2
   exit 1
 fi
 
-backup_file="$(mktemp "$SCRIPT_DIR/SOLE_test_Data.txt.backup.XXXXXX")"
-cp "$DATA_FILE" "$backup_file"
-restore_data_file() {
-  cp "$backup_file" "$DATA_FILE" >/dev/null 2>&1 || true
-  rm -f "$backup_file"
-}
-trap restore_data_file EXIT
-
 if [[ "$BUILD_FIRST" == "1" ]]; then
-  echo "[INFO] Building SOLE_test..."
-  make -C "$BUILD_DIR" -j4 SOLE_test >/dev/null
+  echo "[INFO] Building SOLE_test and sole_sweep..."
+  make -C "$BUILD_DIR" -j4 SOLE_test sole_sweep >/dev/null
 fi
 
-if [[ ! -x "$BUILD_DIR/SOLE_test" ]]; then
-  echo "[ERROR] Missing executable: $BUILD_DIR/SOLE_test" >&2
-  exit 1
-fi
-
-rm -f "$LOG_DIR"/*.log
+for exe in SOLE_test sole_sweep; do
+  if [[ ! -x "$BUILD_DIR/$exe" ]]; then
+    echo "[ERROR] Missing executable: $BUILD_DIR/$exe" >&2
+    exit 1
+  fi
+done
 
-echo "case_name,input_count,execution_time_ns,cosine_similarity,cosine_gt_threshold,timeout_detected" > "$RESULTS_CSV"
+rm -f "$LOG_DIR"/*.log "$BATCH_FILE" "$BATCH_CSV"
 
-run_case() {
-  local case_file="$1"
-  local case_name
+# One batch case per testcase file: sole_sweep shards them over $JOBS SOLE_test processes
+: > "$BATCH_FILE"
+while IFS= read -r case_file; do
   case_name="$(basename "$case_file" .txt)"
-  local input_count
   input_count="$(wc -l < "$case_file" | tr -d ' ')"
-
   if [[ "$input_count" -lt 100 ]]; then
     echo "[WARN] Skip $case_name: input count < 100 ($input_count)"
-    return
+    continue
   fi
+  echo "name=$case_name input=\"$case_file\" log=\"$LOG_DIR/${case_name}_SOLE_test_Result.log\" monitor_log=\"$LOG_DIR/${case_name}_SOLE_test_Monitor.log\"" >> "$BATCH_FILE"
+done < <(find "$CASE_DIR" -maxdepth 1 -type f -name "*.txt" | sort)
 
-  cp "$case_file" "$DATA_FILE"
-
-  local run_log="$LOG_DIR/${case_name}.log"
-  rm -f "$RESULT_LOG" "$MONITOR_LOG"
+echo "[INFO] Running SOLE calculation testcases on $JOBS SOLE_test workers..."
+if [[ -s "$BATCH_FILE" ]]; then
   (
     cd "$BUILD_DIR"
-    ./SOLE_test
-  ) > "$run_log" 2>&1 || true
-
-  if [[ -f "$RESULT_LOG" ]]; then
-    cp "$RESULT_LOG" "$LOG_DIR/${case_name}_SOLE_test_Result.log"
-  fi
-  if [[ -f "$MONITOR_LOG" ]]; then
-    cp "$MONITOR_LOG" "$LOG_DIR/${case_name}_SOLE_test_Monitor.log"
-  fi
-
-  local exec_ns
-  exec_ns="$(grep -oE "\[EXECUTION TIME\] SOLE Execution Time: [0-9]+ ns" "$RESULT_LOG" 2>/dev/null | tail -n1 | grep -oE "[0-9]+" | tail -n1 || true)"
-  [[ -z "${exec_ns:-}" ]] && exec_ns="NA"
-
-  local cosine
-  cosine="$(grep -oE "\[ANALYSIS\] Cosine Similarity \(HW vs SW\) = [0-9]+(\.[0-9]+)?" "$RESULT_LOG" 2>/dev/null | tail -n1 | awk '{print $NF}' || true)"
-  [[ -z "${cosine:-}" ]] && cosine="NA"
-
-  local pass="NA"
-  if [[ "$cosine" != "NA" ]]; then
-    pass="$(awk -v c="$cosine" -v t="$COSINE_THRESHOLD" 'BEGIN{if ((c+0) > (t+0)) print "yes"; else print "no"}')"
-  fi
-
-  local timeout="no"
-  if grep -q "\[TIMEOUT\]" "$run_log" 2>/dev/null || grep -q "ERROR: Timeout waiting for done signal" "$RESULT_LOG" 2>/dev/null; then
-    timeout="yes"
-  fi
-
-  echo "$case_name,$input_count,$exec_ns,$cosine,$pass,$timeout" >> "$RESULTS_CSV"
-  echo "[CASE] $case_name count=$input_count exec=${exec_ns}ns cosine=$cosine pass(>$COSINE_THRESHOLD)=$pass timeout=$timeout"
-}
+    ./sole_sweep -b ./SOLE_test -i "$BATCH_FILE" -o "$BATCH_CSV" -j "$JOBS"
+  ) > "$RUN_LOG" 2>&1 || true
+fi
 
-echo "[INFO] Running SOLE calculation testcases..."
-while IFS= read -r case_file; do
-  run_case "$case_file"
-done < <(find "$CASE_DIR" -maxdepth 1 -type f -name "*.txt" | sort)
+echo "case_name,input_count,execution_time_ns,cosine_similarity,cosine_gt_threshold,timeout_detected" > "$RESULTS_CSV"
+if [[ -f "$BATCH_CSV" ]]; then
+  # Batch CSV: name,input_count,arready_delay,rvalid_delay,wready_delay,burst_len,read_outstanding,read_latency,read_reorder,execution_time_ns,cosine_similarity,timeout_detected,passed
+  awk -F, -v t="$COSINE_THRESHOLD" '
+    NR>1 {
+      pass = "NA";
+      if ($11 != "NA") pass = (($11+0) > (t+0)) ? "yes" : "no";
+      printf "%s,%s,%s,%s,%s,%s\n", $1, $2, $10, $11, pass, $12;
+    }' "$BATCH_CSV" >> "$RESULTS_CSV"
+elif [[ -s "$BATCH_FILE" ]]; then
+  echo "[ERROR] SOLE_test produced no summary, see $RUN_LOG" >&2
+  exit 1
+fi
+awk -F, -v t="$COSINE_THRESHOLD" 'NR>1 {printf "[CASE] %s count=%s exec=%sns cosine=%s pass(>%s)=%s timeout=%s\n", $1, $2, $3, $4, t, $5, $6}' "$RESULTS_CSV"
 
 run_time_str="$(date '+%Y-%m-%d %H:%M:%S %Z')"
 case_count="$(awk 'END{print NR-1}' "$RESULTS_CSV")"
@@ -223,6 +191,9 @@ timeout_count="$(awk -F, 'NR>1 && $6=="yes" {c++} END{print c+0}' "$RESULTS_CSV"
   echo "3) 設定 cosine 門檻（預設 0.95）"
   echo "   COSINE_THRESHOLD=0.95 ./run_calculation_cases.sh"
   echo
+  echo "4) 設定平行 worker 數（預設 nproc，sole_sweep -j）"
+  echo "   JOBS=4 ./run_calculation_cases.sh"
+  echo
   echo "輸出檔案："
   echo "- SOLE_CALCULATION_TEST_REPORT.md : 測試報告（含每個 case 的 cosine）"
   echo "- cosine_results.csv              : 機器可讀結果"
@@ -233,7 +204,7 @@ timeout_count="$(awk -F, 'NR>1 && $6=="yes" {c++} END{print c+0}' "$RESULTS_CSV"
   echo "- 少於 100 筆會自動略過"
   echo
   echo "注意事項："
-  echo "- 腳本執行後會自動還原 test/SOLE_test_Data.txt"
+  echo "- 所有 testcase 由 sole_sweep 分給 JOBS 個 SOLE_test --batch 行程平行執行，不會修改 test/SOLE_test_Data.txt"
   echo "- 需要存在可執行檔 build/SOLE_test"
 } > "$README_TXT"
 
@@ -8,9 +8,9 @@ SRC_TEST_DIR="$ROOT_DIR/test"
 PKG_DIR="$ROOT_DIR/test/SOLE_Execution_Time_TEST"
 LOG_DIR="$PKG_DIR/log"
 
-DATA_FILE="$SRC_TEST_DIR/SOLE_test_Data.txt"
-RESULT_LOG="$SRC_TEST_DIR/SOLE_test_Result.log"
-MONITOR_LOG="$SRC_TEST_DIR/SOLE_test_Monitor.log"
+BATCH_FILE="$LOG_DIR/batch.txt"
+BATCH_CSV="$LOG_DIR/batch.csv"
+RUN_LOG="$LOG_DIR/sole_run.log"
 
 RESULTS_CSV="$PKG_DIR/softmax_exec_time_results.csv"
 OVERLIMIT_CSV="$PKG_DIR/softmax_overlimit_result.csv"
@@ -18,137 +18,80 @@ PLOT_DATA_TXT="$PKG_DIR/softmax_exec_time_plot_data.txt"
 PLOT_SCRIPT="$PKG_DIR/plot_softmax_exec_time.py"
 PLOT_PNG="$PKG_DIR/softmax_exec_time_plot.png"
 REPORT_MD="$PKG_DIR/SOFTMAX_EXECUTION_TIME_REPORT.md"
+BASELINE_CSV="${BASELINE_CSV:-$PKG_DIR/softmax_exec_time_baseline.csv}"
 README_TXT="$PKG_DIR/read_me.txt"
 
 COUNTS_STR="${COUNTS:-1 2 4 8 16 32 64 96 128 160 192 256 384 512 768 1024 1536 2048 3072 4096}"
 OVER_LIMIT_COUNT="${OVER_LIMIT_COUNT:-4097}"
 BUILD_FIRST="${BUILD_FIRST:-1}"
+JOBS="${JOBS:-$(nproc)}"
 COSINE_THRESHOLD="${COSINE_THRESHOLD:-0.95}"
 
 mkdir -p "$PKG_DIR" "$LOG_DIR"
 
-if [[ ! -f "$DATA_FILE" ]]; then
-  echo "[ERROR] Missing input data file: $DATA_FILE" >&2
-  exit 1
-fi
-
 if [[ ! -d "$BUILD_DIR" ]]; then
   echo "[ERROR] Missing build directory: $BUILD_DIR" >&2
   exit 1
 fi
 
-backup_file="$(mktemp "$PKG_DIR/SOLE_test_Data.txt.backup.XXXXXX")"
-cp "$DATA_FILE" "$backup_file"
-restore_data_file() {
-  cp "$backup_file" "$DATA_FILE" >/dev/null 2>&1 || true
-  rm -f "$backup_file"
-}
-trap restore_data_file EXIT
-
 if [[ "$BUILD_FIRST" == "1" ]]; then
-  echo "[INFO] Building SOLE_test..."
-  make -C "$BUILD_DIR" -j4 SOLE_test >/dev/null
-fi
-
-if [[ ! -x "$BUILD_DIR/SOLE_test" ]]; then
-  echo "[ERROR] Missing executable: $BUILD_DIR/SOLE_test" >&2
-  exit 1
+  echo "[INFO] Building SOLE_test and sole_sweep..."
+  make -C "$BUILD_DIR" -j4 SOLE_test sole_sweep >/dev/null
 fi
 
-rm -f "$LOG_DIR"/*.log
-
-echo "input_count,execution_time_ns,cosine_similarity,cosine_gt_0_95,timeout_detected" > "$RESULTS_CSV"
-
-run_one_case() {
-  local n="$1"
-  local run_log="$LOG_DIR/sole_run_${n}.log"
-
-  awk -v n="$n" 'BEGIN{for(i=1;i<=n;i++) printf "%.6f\n", (1.0 + ((i-1)%17)*0.1)}' > "$DATA_FILE"
-
-  rm -f "$RESULT_LOG" "$MONITOR_LOG"
-  (
-    cd "$BUILD_DIR"
-    ./SOLE_test
-  ) > "$run_log" 2>&1 || true
-
-  if [[ -f "$RESULT_LOG" ]]; then
-    cp "$RESULT_LOG" "$LOG_DIR/SOLE_test_Result_case_${n}.log"
-  fi
-  if [[ -f "$MONITOR_LOG" ]]; then
-    cp "$MONITOR_LOG" "$LOG_DIR/SOLE_test_Monitor_case_${n}.log"
-  fi
-
-  local exec_ns
-  exec_ns="$(grep -oE "\[EXECUTION TIME\] SOLE Execution Time: [0-9]+ ns" "$RESULT_LOG" 2>/dev/null | tail -n1 | grep -oE "[0-9]+" | tail -n1 || true)"
-  if [[ -z "${exec_ns:-}" ]]; then
-    exec_ns="NA"
+for exe in SOLE_test sole_sweep; do
+  if [[ ! -x "$BUILD_DIR/$exe" ]]; then
+    echo "[ERROR] Missing executable: $BUILD_DIR/$exe" >&2
+    exit 1
   fi
+done
 
-  local cosine
-  cosine="$(grep -oE "\[ANALYSIS\] Cosine Similarity \(HW vs SW\) = [0-9]+(\.[0-9]+)?" "$RESULT_LOG" 2>/dev/null | tail -n1 | awk '{print $NF}' || true)"
-  if [[ -z "${cosine:-}" ]]; then
-    cosine="NA"
-  fi
+rm -f "$LOG_DIR"/*.log "$LOG_DIR"/*.txt "$BATCH_CSV"
 
-  local cosine_pass="NA"
-  if [[ "$cosine" != "NA" ]]; then
-    cosine_pass="$(awk -v c="$cosine" -v t="$COSINE_THRESHOLD" 'BEGIN{if ((c+0) > (t+0)) print "yes"; else print "no"}')"
-  fi
-
-  local timeout="no"
-  if grep -q "\[TIMEOUT\]" "$run_log" 2>/dev/null || grep -q "ERROR: Timeout waiting for done signal" "$RESULT_LOG" 2>/dev/null; then
-    timeout="yes"
-  fi
-
-  echo "$n,$exec_ns,$cosine,$cosine_pass,$timeout" >> "$RESULTS_CSV"
-  echo "[CASE] n=$n exec=${exec_ns}ns cosine=$cosine pass(>${COSINE_THRESHOLD})=$cosine_pass timeout=$timeout"
+# One batch case per input count: sole_sweep shards the cases over $JOBS SOLE_test processes
+write_case() {
+  local n="$1"
+  local data="$LOG_DIR/data_${n}.txt"
+  awk -v n="$n" 'BEGIN{for(i=1;i<=n;i++) printf "%.6f\n", (1.0 + ((i-1)%17)*0.1)}' > "$data"
+  echo "name=case_${n} input=\"$data\" log=\"$LOG_DIR/SOLE_test_Result_case_${n}.log\" monitor_log=\"$LOG_DIR/SOLE_test_Monitor_case_${n}.log\"" >> "$BATCH_FILE"
 }
 
-echo "[INFO] Running timing sweep..."
+: > "$BATCH_FILE"
 for n in $COUNTS_STR; do
-  run_one_case "$n"
+  write_case "$n"
 done
+write_case "$OVER_LIMIT_COUNT"
 
-echo "[INFO] Running over-limit case: $OVER_LIMIT_COUNT"
-over_run_log="$LOG_DIR/sole_run_${OVER_LIMIT_COUNT}.log"
-awk -v n="$OVER_LIMIT_COUNT" 'BEGIN{for(i=1;i<=n;i++) printf "%.6f\n", (1.0 + ((i-1)%17)*0.1)}' > "$DATA_FILE"
-rm -f "$RESULT_LOG" "$MONITOR_LOG"
+echo "[INFO] Running timing sweep + over-limit case ($OVER_LIMIT_COUNT) on $JOBS SOLE_test workers..."
 (
   cd "$BUILD_DIR"
-  ./SOLE_test
-) > "$over_run_log" 2>&1 || true
-
-if [[ -f "$RESULT_LOG" ]]; then
-  cp "$RESULT_LOG" "$LOG_DIR/SOLE_test_Result_case_${OVER_LIMIT_COUNT}.log"
-fi
-if [[ -f "$MONITOR_LOG" ]]; then
-  cp "$MONITOR_LOG" "$LOG_DIR/SOLE_test_Monitor_case_${OVER_LIMIT_COUNT}.log"
-fi
+  ./sole_sweep -b ./SOLE_test -i "$BATCH_FILE" -o "$BATCH_CSV" -j "$JOBS"
+) > "$RUN_LOG" 2>&1 || true
 
-over_exec_ns="$(grep -oE "\[EXECUTION TIME\] SOLE Execution Time: [0-9]+ ns" "$RESULT_LOG" 2>/dev/null | tail -n1 | grep -oE "[0-9]+" | tail -n1 || true)"
-if [[ -z "${over_exec_ns:-}" ]]; then
-  over_exec_ns="NA"
-fi
-
-over_cosine="$(grep -oE "\[ANALYSIS\] Cosine Similarity \(HW vs SW\) = [0-9]+(\.[0-9]+)?" "$RESULT_LOG" 2>/dev/null | tail -n1 | awk '{print $NF}' || true)"
-if [[ -z "${over_cosine:-}" ]]; then
-  over_cosine="NA"
+if [[ ! -f "$BATCH_CSV" ]]; then
+  echo "[ERROR] SOLE_test produced no summary, see $RUN_LOG" >&2
+  exit 1
 fi
 
-over_cosine_pass="NA"
-if [[ "$over_cosine" != "NA" ]]; then
-  over_cosine_pass="$(awk -v c="$over_cosine" -v t="$COSINE_THRESHOLD" 'BEGIN{if ((c+0) > (t+0)) print "yes"; else print "no"}')"
-fi
+# Batch CSV: name,input_count,arready_delay,rvalid_delay,wready_delay,burst_len,read_outstanding,read_latency,read_reorder,execution_time_ns,cosine_similarity,timeout_detected,passed
+to_result_rows() {
+  awk -F, -v t="$COSINE_THRESHOLD" -v want="$1" -v over="case_$OVER_LIMIT_COUNT" '
+    NR>1 && (($1 == over) == (want == "over")) {
+      pass = "NA";
+      if ($11 != "NA") pass = (($11+0) > (t+0)) ? "yes" : "no";
+      printf "%s,%s,%s,%s,%s\n", $2, $10, $11, pass, $12;
+    }' "$BATCH_CSV"
+}
 
-over_timeout="no"
-if grep -q "\[TIMEOUT\]" "$over_run_log" 2>/dev/null || grep -q "ERROR: Timeout waiting for done signal" "$RESULT_LOG" 2>/dev/null; then
-  over_timeout="yes"
-fi
+echo "input_count,execution_time_ns,cosine_similarity,cosine_gt_0_95,timeout_detected" > "$RESULTS_CSV"
+to_result_rows within >> "$RESULTS_CSV"
+awk -F, 'NR>1 {printf "[CASE] n=%s exec=%sns cosine=%s pass=%s timeout=%s\n", $1, $2, $3, $4, $5}' "$RESULTS_CSV"
 
 {
   echo "input_count,execution_time_ns,cosine_similarity,cosine_gt_0_95,timeout_detected"
-  echo "$OVER_LIMIT_COUNT,$over_exec_ns,$over_cosine,$over_cosine_pass,$over_timeout"
+  to_result_rows over
 } > "$OVERLIMIT_CSV"
+over_timeout="$(awk -F, 'NR==2 {print $5}' "$OVERLIMIT_CSV")"
 
 {
   echo "case_type,input_count,execution_time_ns,cosine_similarity,cosine_gt_threshold,timeout_detected"
@@ -177,6 +120,18 @@ x_vals="$(awk -F, 'NR>1 && $2!="NA" {if(c++) printf ", "; printf "%s", $1}' "$RE
 y_vals="$(awk -F, 'NR>1 && $2!="NA" {if(c++) printf ", "; printf "%s", $2}' "$RESULTS_CSV")"
 y_max="$(awk -F, 'NR>1 && $2!="NA" {if($2>m)m=$2} END{if(m<1)m=1; printf "%d", int(m*1.15+10)}' "$RESULTS_CSV")"
 
+# Per-count latency reduction against BASELINE_CSV (same columns as RESULTS_CSV), if present
+baseline_rows=""
+if [[ -f "$BASELINE_CSV" ]]; then
+  baseline_rows="$(awk -F, '
+    FNR==1 {next}
+    NR==FNR {base[$1] = $2; next}
+    ($1 in base) && base[$1] != "NA" && $2 != "NA" {
+      d = base[$1] - $2;
+      printf "%s,%s,%s,%d,%.1f\n", $1, base[$1], $2, d, (base[$1] > 0) ? 100.0 * d / base[$1] : 0;
+    }' "$BASELINE_CSV" "$RESULTS_CSV")"
+fi
+
 case_count="$(awk 'END{print NR-1}' "$RESULTS_CSV")"
 cosine_pass_count="$(awk -F, 'NR>1 && $4=="yes" {c++} END{print c+0}' "$RESULTS_CSV")"
 timeout_count="$(awk -F, 'NR>1 && $5=="yes" {c++} END{print c+0}' "$RESULTS_CSV")"
@@ -190,7 +145,7 @@ run_time_str="$(date '+%Y-%m-%d %H:%M:%S %Z')"
   echo
   echo "## Test Configuration"
   echo "- Testbench: test/SOLE_test.cpp"
-  echo "- Timeout macro: MAX_TIMEOUT_CYCLES=10000"
+  echo "- Timeout: per-case watchdog (SOLE_test --timeout-cycles, default 10000)"
   echo "- Build before run: $BUILD_FIRST"
   echo "- Cosine pass threshold: > $COSINE_THRESHOLD"
   echo "- Tested counts: $COUNTS_STR"
@@ -224,6 +179,17 @@ run_time_str="$(date '+%Y-%m-%d %H:%M:%S %Z')"
   ' "$RESULTS_CSV"
   echo "\`\`\`"
   echo
+  if [[ -n "$baseline_rows" ]]; then
+    echo "## Latency Reduction vs Baseline"
+    echo "Baseline: $(basename "$BASELINE_CSV")"
+    echo
+    echo "\`\`\`text"
+    printf "%-12s %-16s %-16s %-16s %-12s\n" "InputCount" "Baseline(ns)" "Current(ns)" "Reduction(ns)" "Reduction(%)"
+    printf "%-12s %-16s %-16s %-16s %-12s\n" "------------" "----------------" "----------------" "----------------" "------------"
+    echo "$baseline_rows" | awk -F, '{printf "%-12s %-16s %-16s %-16s %-12s\n", $1, $2, $3, $4, $5}'
+    echo "\`\`\`"
+    echo
+  fi
   echo "## Input Count vs Execution Time"
   echo
   if [[ "$plot_status" == "ok" ]]; then
@@ -270,12 +236,15 @@ run_time_str="$(date '+%Y-%m-%d %H:%M:%S %Z')"
   echo
   echo "## Artifacts"
   echo "- CSV: test/SOLE_Execution_Time_TEST/softmax_exec_time_results.csv"
+  if [[ -n "$baseline_rows" ]]; then
+    echo "- Baseline CSV: test/SOLE_Execution_Time_TEST/$(basename "$BASELINE_CSV")"
+  fi
   echo "- Over-limit CSV: test/SOLE_Execution_Time_TEST/softmax_overlimit_result.csv"
   echo "- Plot data TXT: test/SOLE_Execution_Time_TEST/softmax_exec_time_plot_data.txt"
   echo "- Plot image: test/SOLE_Execution_Time_TEST/softmax_exec_time_plot.png"
   echo "- Plot script: test/SOLE_Execution_Time_TEST/plot_softmax_exec_time.py"
   echo "- Main report: test/SOLE_Execution_Time_TEST/SOFTMAX_EXECUTION_TIME_REPORT.md"
-  echo "- Raw logs: test/SOLE_Execution_Time_TEST/log/*.log"
+  echo "- Raw logs: test/SOLE_Execution_Time_TEST/log/*.log (inputs: log/data_<n>.txt, batch list: log/batch.txt)"
 } > "$REPORT_MD"
 
 {
@@ -297,6 +266,12 @@ run_time_str="$(date '+%Y-%m-%d %H:%M:%S %Z')"
   echo "5) Custom cosine threshold (default is 0.95):"
   echo "   COSINE_THRESHOLD=0.95 ./run_softmax_timing_report.sh"
   echo
+  echo "6) Number of parallel SOLE_test workers (default is nproc, sole_sweep -j):"
+  echo "   JOBS=4 ./run_softmax_timing_report.sh"
+  echo
+  echo "7) Compare against another results CSV (default is softmax_exec_time_baseline.csv):"
+  echo "   BASELINE_CSV=/path/to/softmax_exec_time_results.csv ./run_softmax_timing_report.sh"
+  echo
   echo "Generated files:"
   echo "- SOFTMAX_EXECUTION_TIME_REPORT.md"
   echo "- softmax_exec_time_results.csv"
@@ -307,8 +282,9 @@ run_time_str="$(date '+%Y-%m-%d %H:%M:%S %Z')"
   echo "- log/*.log"
   echo
   echo "Notes:"
-  echo "- Script restores test/SOLE_test_Data.txt after run."
+  echo "- All cases run as SOLE_test --batch shards on JOBS sole_sweep workers; test/SOLE_test_Data.txt is not touched."
   echo "- The DUT executable must be build/SOLE_test."
+  echo "- softmax_exec_time_baseline.csv is the reference of the latency reduction table (fixed 10-cycle PROCESS2); it is never overwritten."
 } > "$README_TXT"
 
 echo "[DONE] Results CSV: $RESULTS_CSV"
@@ -0,0 +1,465 @@
+#include <systemc>
+#include <tlm.h>
+#include <tlm_utils/simple_initiator_socket.h>
+#include <tlm_utils/simple_target_socket.h>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include <cmath>
+#include <vector>
+#include "../include/SOLE_LT.h"
+#include "../include/SOLE_MMIO.hpp"
+#include "../Csim/Softmax.h"
+#include "test_utils.h"
+
+using namespace sc_core;
+using namespace sc_dt;
+using namespace std;
+using namespace sole::mmio;
+
+#define TEST_DATA_SIZE 2048          // Same memory size as SOLE_test (words)
+#define MEMORY_LATENCY_NS 0          // Latency annotated per b_transport / DMI beat
+#define MAX_TIMEOUT_CYCLES 10000
+
+static void output_memory_to_log(std::ostream* log, const vector<uint64_t>& memory, int start_word, size_t length) {
+    if (log && log->good()) {
+        (*log) << "\n[MEMORY DUMP]\n Address(word) | Data (Hex)\n";
+        for (size_t i = 0; i < length; i++) {
+            uint64_t data = memory[start_word + i];
+            (*log) << "   " << dec << setfill(' ') << setw(5) << (start_word + i)
+            << "  :  0x " << hex << setfill('0') << setw(4) << (uint16_t)((data >> 48) & 0xFFFF) << " "
+            << setw(4) << (uint16_t)((data >> 32) & 0xFFFF) << " "
+            << setw(4) << (uint16_t)((data >> 16) & 0xFFFF) << " "
+            << setw(4) << (uint16_t)(data & 0xFFFF) << dec << "\n";
+        }
+    }
+}
+
+// ===== TLM Memory Model =====
+/**
+ * @class TlmMemory
+ * @brief TLM-2.0 target memory (64-bit words, byte addressed) with DMI
+ *
+ * Out-of-range accesses return TLM_ADDRESS_ERROR_RESPONSE.
+ */
+SC_MODULE(TlmMemory) {
+    tlm_utils::simple_target_socket<TlmMemory, 64> socket;
+    vector<uint64_t> memory;
+
+    SC_HAS_PROCESS(TlmMemory);
+    TlmMemory(sc_module_name name) : sc_module(name), socket("socket"), memory(TEST_DATA_SIZE, 0) {
+        socket.register_b_transport(this, &TlmMemory::b_transport);
+        socket.register_get_direct_mem_ptr(this, &TlmMemory::get_direct_mem_ptr);
+    }
+
+    void b_transport(tlm::tlm_generic_payload& trans, sc_time& delay) {
+        uint64_t addr = trans.get_address();
+        unsigned int len = trans.get_data_length();
+        if (addr + len > memory.size() * sizeof(uint64_t) || trans.get_byte_enable_ptr() != nullptr) {
+            trans.set_response_status(tlm::TLM_ADDRESS_ERROR_RESPONSE);
+            return;
+        }
+        unsigned char* mem = reinterpret_cast<unsigned char*>(memory.data()) + addr;
+        if (trans.is_read()) {
+            memcpy(trans.get_data_ptr(), mem, len);
+        } else if (trans.is_write()) {
+            memcpy(mem, trans.get_data_ptr(), len);
+        }
+        delay += sc_time(MEMORY_LATENCY_NS, SC_NS);
+        trans.set_dmi_allowed(true);
+        trans.set_response_status(tlm::TLM_OK_RESPONSE);
+    }
+
+    bool get_direct_mem_ptr(tlm::tlm_generic_payload&, tlm::tlm_dmi& dmi) {
+        dmi.set_dmi_ptr(reinterpret_cast<unsigned char*>(memory.data()));
+        dmi.set_start_address(0);
+        dmi.set_end_address(memory.size() * sizeof(uint64_t) - 1);
+        dmi.set_granted_access(tlm::tlm_dmi::DMI_ACCESS_READ_WRITE);
+        dmi.set_read_latency(sc_time(MEMORY_LATENCY_NS, SC_NS));
+        dmi.set_write_latency(sc_time(MEMORY_LATENCY_NS, SC_NS));
+        return true;
+    }
+};
+
+// ===== Testbench =====
+SC_MODULE(SOLE_LT_TestBench) {
+    tlm_utils::simple_initiator_socket<SOLE_LT_TestBench> mmio_socket;
+    sc_signal<bool> interrupt;
+
+    SOLE_LT*   dut;
+    TlmMemory* mem;
+
+    int test_total;
+    int test_passed;
+    int test_failed;
+
+    SC_HAS_PROCESS(SOLE_LT_TestBench);
+    SOLE_LT_TestBench(sc_module_name name) : sc_module(name), mmio_socket("mmio_socket"), interrupt("interrupt"),
+        test_total(0), test_passed(0), test_failed(0)
+    {
+        dut = new SOLE_LT("SOLE_LT_DUT");
+        mem = new TlmMemory("TlmMemory");
+
+        mmio_socket.bind(dut->mmio_socket);
+        dut->mem_socket.bind(mem->socket);
+        dut->interrupt(interrupt);
+
+        SC_THREAD(test_stimulus);
+    }
+
+    ~SOLE_LT_TestBench() {
+        delete dut;
+        delete mem;
+    }
+
+    /// Returns false on an error response
+    bool mmio_write(uint32_t offset, uint32_t value) {
+        tlm::tlm_generic_payload trans;
+        sc_time delay = SC_ZERO_TIME;
+        trans.set_command(tlm::TLM_WRITE_COMMAND);
+        trans.set_address(offset);
+        trans.set_data_ptr(reinterpret_cast<unsigned char*>(&value));
+        trans.set_data_length(4);
+        trans.set_streaming_width(4);
+        trans.set_byte_enable_ptr(nullptr);
+        trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+        mmio_socket->b_transport(trans, delay);
+        if (trans.is_response_error()) {
+            cerr << "[ERROR] MMIO write failed @0x" << hex << offset << dec << endl;
+        }
+        wait(delay);
+        return !trans.is_response_error();
+    }
+
+    uint32_t mmio_read(uint32_t offset) {
+        uint32_t value = 0;
+        tlm::tlm_generic_payload trans;
+        sc_time delay = SC_ZERO_TIME;
+        trans.set_command(tlm::TLM_READ_COMMAND);
+        trans.set_address(offset);
+        trans.set_data_ptr(reinterpret_cast<unsigned char*>(&value));
+        trans.set_data_length(4);
+        trans.set_streaming_width(4);
+        trans.set_byte_enable_ptr(nullptr);
+        trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+        mmio_socket->b_transport(trans, delay);
+        wait(delay);
+        return value;
+    }
+
+    void verify_test(bool condition, const string& test_name) {
+        test_total++;
+        if (condition) {
+            cout << "[PASS] " << test_name << endl;
+            test_passed++;
+        } else {
+            cout << "[FAIL] " << test_name << endl;
+            test_failed++;
+        }
+    }
+
+    /// Wait for interrupt, bounded by MAX_TIMEOUT_CYCLES
+    bool wait_interrupt() {
+        if (interrupt.read()) return true;
+        wait(sc_time(MAX_TIMEOUT_CYCLES, SC_NS), interrupt.posedge_event());
+        return interrupt.read();
+    }
+
+    /// Wait for interrupt to deassert, bounded by MAX_TIMEOUT_CYCLES
+    bool wait_interrupt_clear() {
+        if (!interrupt.read()) return true;
+        wait(sc_time(MAX_TIMEOUT_CYCLES, SC_NS), interrupt.negedge_event());
+        return !interrupt.read();
+    }
+
+    void start_run(uint32_t src_byte_addr, uint32_t dst_byte_addr, uint32_t length) {
+        mmio_write(REG_SRC_ADDR_BASE_L, src_byte_addr);
+        mmio_write(REG_SRC_ADDR_BASE_H, 0);
+        mmio_write(REG_DST_ADDR_BASE_L, dst_byte_addr);
+        mmio_write(REG_DST_ADDR_BASE_H, 0);
+        mmio_write(REG_LENGTH_L, length);
+        mmio_write(REG_LENGTH_H, 0);
+    }
+
+    // ===== Main Test Stimulus =====
+    void test_stimulus() {
+        const int INPUT_START_WORD = 100;
+        const int OUTPUT_START_WORD = 500;
+
+        ofstream test_log("../test/SOLE_LT_test_Result.log");
+        if (!test_log.is_open()) {
+            cerr << "[ERROR] Failed to create SOLE_LT_test_Result.log" << endl;
+            sc_stop();
+            return;
+        }
+        test_log << "===== SOLE LT TEST LOG =====\n";
+
+        // Read input test vectors from file (one value per line)
+        vector<float> input_values;
+        ifstream data_file("SOLE_test_Data.txt");
+        if (!data_file.is_open()) {
+            data_file.open("../test/SOLE_test_Data.txt");
+        }
+        if (!data_file.is_open()) {
+            cerr << "[ERROR] Failed to open SOLE_test_Data.txt" << endl;
+            sc_stop();
+            return;
+        }
+        string line;
+        while (std::getline(data_file, line)) {
+            std::stringstream ss(line);
+            float v;
+            if (!(ss >> v)) continue;
+            input_values.push_back(v);
+        }
+        data_file.close();
+
+        const int NUM_DATA = (int)input_values.size();
+        if (NUM_DATA == 0) {
+            cerr << "[ERROR] No input data found in SOLE_test_Data.txt" << endl;
+            sc_stop();
+            return;
+        }
+        const int NUM_64BIT_WORDS = (NUM_DATA + 3) / 4;
+
+        // (1) Input data to memory
+        for (int i = 0; i < NUM_64BIT_WORDS; i++) {
+            uint64_t packed = 0;
+            for (int j = 0; j < 4 && (i * 4 + j) < NUM_DATA; j++) {
+                packed |= (uint64_t)float_to_fp16(input_values[i * 4 + j]) << (j * 16);
+            }
+            mem->memory[INPUT_START_WORD + i] = packed;
+        }
+        test_log << "\n[1] Memory Input Data Write";
+        output_memory_to_log(&test_log, mem->memory, INPUT_START_WORD, NUM_64BIT_WORDS);
+
+        // (2) Configure and start
+        start_run(INPUT_START_WORD * 8, OUTPUT_START_WORD * 8, NUM_DATA);
+        sc_time start_time = sc_time_stamp();
+        mmio_write(REG_CONTROL, 0x1);
+        mmio_write(REG_CONTROL, 0x0);
+
+        // (3) Wait for DONE interrupt
+        bool irq = wait_interrupt();
+        sc_time done_time = sc_time_stamp();
+        uint32_t status = dut->status();
+        long long exec_ns = (long long)((done_time - start_time) / sc_time(1, SC_NS));
+        long long expected_ns = 20 + 2 * (long long)NUM_64BIT_WORDS;
+
+        verify_test(irq && (status & (1u << STAT_DONE_BIT)), "DONE interrupt asserted");
+        verify_test(((status >> STAT_ERROR_BIT) & 0x1) == 0, "No error on normal run");
+        verify_test(exec_ns == expected_ns, "Execution time matches pin-level model (20 + 2 * beats ns)");
+        wait_interrupt_clear();
+        verify_test(sc_time_stamp() - done_time == sc_time(1, SC_NS) && mmio_read(REG_STATUS) == 0,
+                    "DONE pulse is one cycle, back to IDLE");
+
+        // (4) Results
+        test_log << "\n[5] Output Stored Back to Memory via AXI4_Lite";
+        output_memory_to_log(&test_log, mem->memory, OUTPUT_START_WORD, NUM_64BIT_WORDS);
+
+        vector<float> hw_input(input_values);
+        vector<float> hw_output(NUM_DATA);
+        vector<float> sw_output(NUM_DATA);
+        SOLE_softmax(sw_output.data(), hw_input.data(), NUM_DATA);
+        test_log << "\n[4] Softmax Compute Results\n";
+        test_log << "Index |  Input  |  HW_Output  |  SW_Output  |  AbsError\n";
+        double dot = 0.0, norm_hw = 0.0, norm_sw = 0.0;
+        for (int i = 0; i < NUM_DATA; i++) {
+            uint64_t packed = mem->memory[OUTPUT_START_WORD + i / 4];
+            hw_output[i] = fp16_to_float((uint16_t)((packed >> ((i % 4) * 16)) & 0xFFFF));
+            test_log << setfill(' ') << setw(3) << i << "    "
+                     << setw(7) << fixed << setprecision(6) << hw_input[i] << "  "
+                     << setw(12) << fixed << setprecision(9) << hw_output[i] << "  "
+                     << setw(12) << fixed << setprecision(9) << sw_output[i] << "   "
+                     << setw(12) << scientific << setprecision(6) << fabsf(hw_output[i] - sw_output[i]) << "\n";
+            dot += (double)hw_output[i] * (double)sw_output[i];
+            norm_hw += (double)hw_output[i] * (double)hw_output[i];
+            norm_sw += (double)sw_output[i] * (double)sw_output[i];
+        }
+        double cosine = 0.0;
+        if (norm_hw > 0.0 && norm_sw > 0.0) cosine = dot / (sqrt(norm_hw) * sqrt(norm_sw));
+        verify_test(cosine > 0.95, "Cosine similarity (HW vs SW) > 0.95");
+
+        test_log << "\n================== FINAL REPORT ================= ";
+        test_log << "\n[EXECUTION TIME] SOLE Execution Time: " << exec_ns << " ns\n";
+        test_log << "\n[ANALYSIS] Cosine Similarity (HW vs SW) = " << fixed << setprecision(9) << cosine << "\n";
+
+        // (5) Length error: level while START stays set
+        start_run(INPUT_START_WORD * 8, OUTPUT_START_WORD * 8, 0);
+        mmio_write(REG_CONTROL, 0x1);
+        wait(1, SC_NS);
+        status = mmio_read(REG_STATUS);
+        verify_test(interrupt.read() && ((status >> STAT_ERROR_BIT) & 0x1) &&
+                    ((status >> STAT_ERROR_CODE_LSB) & 0xF) == softmax::status::ERR_DATA_LENGTH_INVALID,
+                    "Zero length raises ERR_DATA_LENGTH_INVALID");
+        mmio_write(REG_CONTROL, 0x0);
+        wait(1, SC_NS);
+        verify_test(!interrupt.read() && mmio_read(REG_STATUS) == 0, "Error clears after deasserting START");
+
+        // (6) Memory error: source outside the memory, error pulse then DONE
+        start_run(TEST_DATA_SIZE * 8, OUTPUT_START_WORD * 8, NUM_DATA);
+        mmio_write(REG_CONTROL, 0x1);
+        mmio_write(REG_CONTROL, 0x0);
+        irq = wait_interrupt();
+        status = dut->status();
+        verify_test(irq && ((status >> STAT_ERROR_CODE_LSB) & 0xF) == softmax::status::ERR_AXI_READ_ERROR,
+                    "Out-of-range source raises ERR_AXI_READ_ERROR");
+        wait_interrupt_clear();
+        irq = wait_interrupt();
+        verify_test(irq && (dut->status() & (1u << STAT_DONE_BIT)), "Run still completes with DONE after read error");
+        wait_interrupt_clear();
+
+        // (7) Completion counter and coalesced interrupt (same registers as SOLE)
+        wait(1, SC_NS);
+        uint32_t completed = mmio_read(REG_COMPLETED_JOBS);
+        verify_test(completed == 4, "REG_COMPLETED_JOBS counts DONE and ERROR completions");
+        mmio_write(REG_COMPLETED_JOBS, completed);
+        mmio_write(REG_IRQ_COUNT_THRESHOLD, 2);
+        start_run(INPUT_START_WORD * 8, OUTPUT_START_WORD * 8, NUM_DATA);
+        mmio_write(REG_CONTROL, 0x1);
+        mmio_write(REG_CONTROL, 0x0);
+        wait(sc_time((double)(expected_ns + 2), SC_NS));
+        verify_test(!interrupt.read() && mmio_read(REG_COMPLETED_JOBS) == completed + 1,
+                    "Coalesced interrupt: no interrupt below the count threshold");
+        start_time = sc_time_stamp();
+        mmio_write(REG_CONTROL, 0x1);
+        mmio_write(REG_CONTROL, 0x0);
+        irq = wait_interrupt();
+        verify_test(irq && sc_time_stamp() - start_time == sc_time((double)(expected_ns + 1), SC_NS) &&
+                    mmio_read(REG_COMPLETED_JOBS) == completed + 2,
+                    "Coalesced interrupt at the count threshold, one cycle after DONE");
+        wait(5, SC_NS);
+        verify_test(interrupt.read(), "Coalesced interrupt held until acknowledged");
+        sc_time ack_time = sc_time_stamp();
+        mmio_write(REG_COMPLETED_JOBS, completed + 2);
+        verify_test(wait_interrupt_clear() && sc_time_stamp() == ack_time, "Acknowledge clears the coalesced interrupt");
+
+        mmio_write(REG_IRQ_COUNT_THRESHOLD, 4);
+        mmio_write(REG_IRQ_TIMEOUT_CYCLES, 10);
+        start_time = sc_time_stamp();
+        mmio_write(REG_CONTROL, 0x1);
+        mmio_write(REG_CONTROL, 0x0);
+        irq = wait_interrupt();
+        verify_test(irq && sc_time_stamp() - start_time == sc_time((double)(expected_ns + 10), SC_NS),
+                    "Coalesced interrupt on REG_IRQ_TIMEOUT_CYCLES below the threshold (DONE + timeout)");
+        mmio_write(REG_COMPLETED_JOBS, completed + 3);
+        wait_interrupt_clear();
+        mmio_write(REG_IRQ_COUNT_THRESHOLD, 0);
+        mmio_write(REG_IRQ_TIMEOUT_CYCLES, 0);
+
+        // (8) Row batching: packed source rows (the first ROW_WORDS input beats),
+        // destination rows BATCH_DST_STRIDE bytes apart, checked against Softmax_Datapath
+        const int ROWS = 3;
+        const int ROW_WORDS = min(NUM_64BIT_WORDS, 16);
+        const int ROW_LENGTH = min(NUM_DATA, 4 * ROW_WORDS);
+        const int BATCH_INPUT_WORD = 1600;
+        const int BATCH_OUTPUT_WORD = 1700;
+        const uint32_t BATCH_DST_STRIDE = (ROW_WORDS + 4) * 8;
+        vector<uint64_t> reference(ROW_WORDS);
+        Softmax_Datapath reference_datapath;
+        reference_datapath.begin_job();
+        for (int i = 0; i < ROW_WORDS; i++) {
+            reference_datapath.process1_beat(mem->memory[INPUT_START_WORD + i]);
+        }
+        reference_datapath.process2();
+        for (int i = 0; i < ROW_WORDS; i++) {
+            reference[i] = reference_datapath.process3_beat(i);
+        }
+        for (int r = 0; r < ROWS; r++) {
+            for (int i = 0; i < ROW_WORDS; i++) {
+                mem->memory[BATCH_INPUT_WORD + r * ROW_WORDS + i] = mem->memory[INPUT_START_WORD + i];
+            }
+        }
+        completed = mmio_read(REG_COMPLETED_JOBS);
+        start_run(BATCH_INPUT_WORD * 8, BATCH_OUTPUT_WORD * 8, ROW_LENGTH);
+        mmio_write(REG_ROW_COUNT, ROWS);
+        mmio_write(REG_DST_ROW_STRIDE, BATCH_DST_STRIDE);
+        verify_test(mmio_read(REG_ROW_COUNT) == ROWS && mmio_read(REG_DST_ROW_STRIDE) == BATCH_DST_STRIDE,
+                    "Row batching registers read back");
+        start_time = sc_time_stamp();
+        mmio_write(REG_CONTROL, 0x1);
+        mmio_write(REG_CONTROL, 0x0);
+        irq = wait_interrupt();
+        exec_ns = (long long)((sc_time_stamp() - start_time) / sc_time(1, SC_NS));
+        bool rows_match = true;
+        for (int r = 0; r < ROWS; r++) {
+            for (int i = 0; i < ROW_WORDS; i++) {
+                rows_match &= mem->memory[BATCH_OUTPUT_WORD + r * BATCH_DST_STRIDE / 8 + i] == reference[i];
+            }
+        }
+        verify_test(irq && rows_match, "Row batching: every row equals the single-row datapath output");
+        verify_test(exec_ns == 20 + 2 * ROW_WORDS + (ROWS - 1) * (2 * ROW_WORDS + 17),
+                    "Row batching: rows back to back, DONE after the last row");
+        wait_interrupt_clear();
+        wait(1, SC_NS);
+        verify_test(mmio_read(REG_COMPLETED_JOBS) == completed + 1, "Row batching: one completion per START");
+        mmio_write(REG_COMPLETED_JOBS, ++completed);
+        mmio_write(REG_ROW_COUNT, 0);
+        mmio_write(REG_DST_ROW_STRIDE, 0);
+
+        // (9) Descriptor ring: two rows around a zero-length descriptor, interrupt after all three
+        const int RING_WORD = 1800;
+        const int RING_OUTPUT_WORD = 1850;
+        const uint64_t JOB_CYCLES = 2 * ROW_WORDS + 18;
+        const uint64_t RING_LENGTH[3] = {(uint64_t)ROW_LENGTH, 0, (uint64_t)ROW_LENGTH};
+        for (int k = 0; k < 3; k++) {
+            uint64_t* desc = &mem->memory[RING_WORD + k * RING_DESC_BYTES / 8];
+            desc[0] = (BATCH_INPUT_WORD + k * ROW_WORDS) * 8;
+            desc[1] = (RING_OUTPUT_WORD + k * ROW_WORDS) * 8;
+            desc[2] = RING_LENGTH[k];
+            desc[3] = 0xDEADBEEFull;
+        }
+        mmio_write(REG_IRQ_COUNT_THRESHOLD, 3);
+        mmio_write(REG_RING_BASE_L, RING_WORD * 8);
+        mmio_write(REG_RING_BASE_H, 0);
+        mmio_write(REG_RING_SIZE, 4);
+        mmio_write(REG_CONTROL, 1u << CTRL_RING_BIT);
+        start_time = sc_time_stamp();
+        mmio_write(REG_RING_TAIL, 3);
+        irq = wait_interrupt();
+        exec_ns = (long long)((sc_time_stamp() - start_time) / sc_time(1, SC_NS));
+        const uint64_t* record = &mem->memory[RING_WORD + RING_DESC_COMPLETION_WORD];
+        const uint64_t DONE_RECORD = (1ull << RING_CPL_COMPLETE_BIT) | (1u << STAT_DONE_BIT);
+        bool ring_match = true;
+        for (int k = 0; k < 3; k += 2) {
+            for (int i = 0; i < ROW_WORDS; i++) {
+                ring_match &= mem->memory[RING_OUTPUT_WORD + k * ROW_WORDS + i] == reference[i];
+            }
+        }
+        verify_test(irq && mmio_read(REG_RING_HEAD) == 3 && mmio_read(REG_COMPLETED_JOBS) == completed + 3,
+                    "Descriptor ring: HEAD reaches TAIL, one completion per descriptor");
+        verify_test(ring_match, "Descriptor ring: outputs equal the single-row datapath output");
+        verify_test(record[0] == ((JOB_CYCLES << RING_CPL_CYCLES_LSB) | DONE_RECORD) &&
+                    record[8] == ((JOB_CYCLES << RING_CPL_CYCLES_LSB) | DONE_RECORD),
+                    "Descriptor ring: DONE records with the pin-level job cycle count (2 * beats + 18)");
+        verify_test((record[4] & 0xFFFFFFFF) == ((1u << RING_CPL_COMPLETE_BIT) | (1u << STAT_ERROR_BIT) |
+                    ((uint32_t)softmax::status::ERR_DATA_LENGTH_INVALID << STAT_ERROR_CODE_LSB)),
+                    "Descriptor ring: zero length recorded as ERR_DATA_LENGTH_INVALID");
+        verify_test(mem->memory[RING_WORD + 2] == (uint64_t)ROW_LENGTH && mem->memory[RING_WORD + 6] == 0,
+                    "Descriptor ring: completion write-back leaves words 0 - 2 unchanged");
+        verify_test(exec_ns == 3 + 2 * (long long)(JOB_CYCLES + 8) + 10 + 1,
+                    "Descriptor ring: fetch / write-back timing of the pin-level Descriptor_Ring");
+        mmio_write(REG_COMPLETED_JOBS, completed + 3);
+        wait_interrupt_clear();
+        mmio_write(REG_CONTROL, 0x0);
+        wait(1, SC_NS);
+        verify_test(mmio_read(REG_RING_HEAD) == 0, "Descriptor ring: clearing CTRL_RING_BIT resets HEAD");
+        mmio_write(REG_IRQ_COUNT_THRESHOLD, 0);
+
+        test_log << "\n[TEST SUMMARY] " << test_passed << "/" << test_total << " passed\n";
+        test_log << "\n============ END OF SOLE LT TEST LOG ============\n";
+        test_log.close();
+
+        cout << "[TEST SUMMARY] " << test_passed << "/" << test_total << " passed" << endl;
+        sc_stop();
+    }
+};
+
+// ===== Main Entry Point =====
+int sc_main(int argc, char* argv[]) {
+    SOLE_LT_TestBench testbench("SOLE_LT_TestBench");
+    sc_start();
+    return testbench.test_failed ? 1 : 0;
+}
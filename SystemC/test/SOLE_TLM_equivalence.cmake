@@ -0,0 +1,92 @@
+# SOLE TLM-model equivalence check
+#
+# For each input size in SIZES, generates a SOLE_test_Data.txt, runs REF_BIN
+# (pin-level model, SOLE_test) and DUT_BIN (a TLM-2.0 model testbench writing
+# ../test/<DUT_LOG>) on it and requires:
+#   - identical output memory dumps ("[5] Output Stored Back" section)
+#   - identical "[EXECUTION TIME]" lines
+# REF_ARGS (optional) are passed to REF_BIN, e.g. --rvalid-delay=2.
+# DUT_ENV (optional, NAME=VALUE list) is set in the environment of DUT_BIN.
+#
+# Usage:
+#   cmake -DNAME=<tag> -DREF_BIN=<SOLE_test> -DDUT_BIN=<SOLE_LT_test> -DDUT_LOG=SOLE_LT_test_Result.log
+#         -DWORK_DIR=<dir> [-DREF_ARGS=--opt=1] [-DDUT_ENV=VAR=1] [-DSIZES=1;7;96] -P SOLE_TLM_equivalence.cmake
+
+foreach(var NAME REF_BIN DUT_BIN DUT_LOG WORK_DIR)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} is not set")
+    endif()
+endforeach()
+if(NOT DEFINED SIZES)
+    set(SIZES 1 7 96 1024 4096)
+endif()
+
+# Both testbenches write their logs to ../test relative to the working directory
+set(RUN_DIR "${WORK_DIR}/${NAME}/run")
+set(LOG_DIR "${WORK_DIR}/${NAME}/test")
+file(MAKE_DIRECTORY "${RUN_DIR}" "${LOG_DIR}")
+
+# Extract the output memory dump and the execution time line from a result log
+function(extract_result log out_var)
+    file(READ "${log}" content)
+    string(FIND "${content}" "[5] Output Stored Back" begin)
+    string(FIND "${content}" "[4] Softmax Compute Results" end)
+    if(begin EQUAL -1 OR end EQUAL -1 OR end LESS begin)
+        message(FATAL_ERROR "${log} has no output memory dump")
+    endif()
+    math(EXPR len "${end} - ${begin}")
+    string(SUBSTRING "${content}" ${begin} ${len} dump)
+    string(REGEX MATCH "SOLE Execution Time: [0-9]+ ns" exec "${content}")
+    if(exec STREQUAL "")
+        message(FATAL_ERROR "${log} has no execution time")
+    endif()
+    set(${out_var} "${dump}${exec}" PARENT_SCOPE)
+endfunction()
+
+foreach(n ${SIZES})
+    # Deterministic inputs in [-4.000, 3.999]
+    set(data "")
+    set(seed 12345)
+    foreach(i RANGE 1 ${n})
+        math(EXPR seed "(${seed} * 1103515245 + 12345) % 2147483648")
+        math(EXPR milli "(${seed} / 65536) % 8000 - 4000")
+        if(milli LESS 0)
+            math(EXPR abs "0 - ${milli}")
+            set(sign "-")
+        else()
+            set(abs ${milli})
+            set(sign "")
+        endif()
+        math(EXPR int_part "${abs} / 1000")
+        math(EXPR frac_part "${abs} % 1000 + 1000")
+        string(SUBSTRING "${frac_part}" 1 3 frac_part)
+        string(APPEND data "${sign}${int_part}.${frac_part}\n")
+    endforeach()
+    file(WRITE "${RUN_DIR}/SOLE_test_Data.txt" "${data}")
+
+    set(REF_CMD ${REF_BIN} ${REF_ARGS})
+    set(DUT_CMD ${CMAKE_COMMAND} -E env ${DUT_ENV} ${DUT_BIN})
+    foreach(run REF DUT)
+        execute_process(
+            COMMAND ${${run}_CMD}
+            WORKING_DIRECTORY "${RUN_DIR}"
+            RESULT_VARIABLE rc
+            OUTPUT_VARIABLE out
+            ERROR_VARIABLE  err)
+        if(NOT rc EQUAL 0)
+            message(FATAL_ERROR "${${run}_BIN} (n=${n}) exited with ${rc}\n${out}\n${err}")
+        endif()
+        if(err MATCHES "\\[TIMEOUT\\]")
+            message(FATAL_ERROR "${${run}_BIN} (n=${n}) hit the watchdog\n${err}")
+        endif()
+    endforeach()
+
+    extract_result("${LOG_DIR}/SOLE_test_Result.log" ref_result)
+    extract_result("${LOG_DIR}/${DUT_LOG}" dut_result)
+    if(NOT ref_result STREQUAL dut_result)
+        message(FATAL_ERROR "n=${n}: ${DUT_BIN} differs from pin-level model\n"
+                            "--- pin-level ---\n${ref_result}\n--- TLM ---\n${dut_result}")
+    endif()
+    string(REGEX MATCH "[0-9]+ ns" exec "${dut_result}")
+    message(STATUS "n=${n}: outputs and execution time (${exec}) identical")
+endforeach()
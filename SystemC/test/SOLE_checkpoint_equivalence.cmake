@@ -0,0 +1,74 @@
+# SOLE_test checkpoint check
+#
+# 1. Runs BATCH with and without --fast-setup 1 and requires identical
+#    summary CSVs (execution time and cosine similarity of every case).
+# 2. Runs one case with --checkpoint, replays it with --restore and requires
+#    identical execution time lines and output memory dumps.
+#
+# Usage:
+#   cmake -DTEST_BIN=<SOLE_test> -DBATCH=<cases.txt> -DINPUT=<SOLE_test_Data.txt> -DWORK_DIR=<dir>
+#         -P SOLE_checkpoint_equivalence.cmake
+
+foreach(var TEST_BIN BATCH INPUT WORK_DIR)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} is not set")
+    endif()
+endforeach()
+
+# SOLE_test writes its default logs to ../test relative to the working directory
+set(RUN_DIR "${WORK_DIR}/SOLE_checkpoint/run")
+set(LOG_DIR "${WORK_DIR}/SOLE_checkpoint/test")
+file(MAKE_DIRECTORY "${RUN_DIR}" "${LOG_DIR}")
+
+function(run_sole_test)
+    execute_process(
+        COMMAND ${TEST_BIN} ${ARGN}
+        WORKING_DIRECTORY "${RUN_DIR}"
+        RESULT_VARIABLE rc
+        OUTPUT_VARIABLE out
+        ERROR_VARIABLE  err)
+    if(NOT rc EQUAL 0)
+        message(FATAL_ERROR "SOLE_test ${ARGN} exited with ${rc}\n${out}\n${err}")
+    endif()
+endfunction()
+
+# 1. Batch with and without fast setup
+run_sole_test(--batch ${BATCH} --input ${INPUT} --csv ${LOG_DIR}/full_setup.csv)
+run_sole_test(--batch ${BATCH} --input ${INPUT} --csv ${LOG_DIR}/fast_setup.csv --fast-setup 1)
+file(READ "${LOG_DIR}/full_setup.csv" full_csv)
+file(READ "${LOG_DIR}/fast_setup.csv" fast_csv)
+if(NOT full_csv STREQUAL fast_csv)
+    message(FATAL_ERROR "--fast-setup changes the batch results\n"
+                        "--- full setup ---\n${full_csv}\n--- fast setup ---\n${fast_csv}")
+endif()
+message(STATUS "batch: --fast-setup 1 results identical")
+
+# 2. Checkpoint and replay
+function(extract_result log out_var)
+    file(READ "${log}" content)
+    string(FIND "${content}" "[5] Output Stored Back" begin)
+    string(FIND "${content}" "[4] Softmax Compute Results" end)
+    if(begin EQUAL -1 OR end EQUAL -1 OR end LESS begin)
+        message(FATAL_ERROR "${log} has no output memory dump")
+    endif()
+    math(EXPR len "${end} - ${begin}")
+    string(SUBSTRING "${content}" ${begin} ${len} dump)
+    string(REGEX MATCH "SOLE Execution Time: [0-9]+ ns" exec "${content}")
+    if(exec STREQUAL "")
+        message(FATAL_ERROR "${log} has no execution time")
+    endif()
+    set(${out_var} "${dump}${exec}" PARENT_SCOPE)
+endfunction()
+
+set(CKPT "${LOG_DIR}/n64_mixed.ckpt")
+run_sole_test(--input ${INPUT} --length 64 --arready-delay 1 --rvalid-delay 3 --wready-delay 1
+              --checkpoint ${CKPT} --log ${LOG_DIR}/captured.log)
+run_sole_test(--restore ${CKPT} --log ${LOG_DIR}/replayed.log)
+extract_result("${LOG_DIR}/captured.log" captured)
+extract_result("${LOG_DIR}/replayed.log" replayed)
+if(NOT captured STREQUAL replayed)
+    message(FATAL_ERROR "replay of ${CKPT} differs from the captured run\n"
+                        "--- captured ---\n${captured}\n--- replayed ---\n${replayed}")
+endif()
+string(REGEX MATCH "[0-9]+ ns" exec "${replayed}")
+message(STATUS "checkpoint replay: outputs and execution time (${exec}) identical")
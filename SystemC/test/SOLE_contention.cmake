@@ -0,0 +1,73 @@
+# SOLE throughput under shared-memory contention
+#
+# Runs BIN (SOLE_contention_test) without background traffic and then with
+# ARGS traffic (e.g. --traffic-load=45) under each arbitration policy:
+#   rr          round-robin
+#   fixed_high  fixed priority, SOLE above the background masters
+#   fixed_low   fixed priority, SOLE below the background masters
+#   weighted    weighted round-robin, SOLE weight 4
+# Every run has to pass its Softmax_Datapath check. Requires the traffic to
+# slow SOLE down under round-robin, fixed_high and weighted to win at least 5%
+# of the round-robin cycles back, and fixed_low to be no faster than
+# round-robin (2% tolerance). The summary rows go to
+# WORK_DIR/SOLE_contention.csv.
+#
+# Usage:
+#   cmake -DBIN=<SOLE_contention_test> -DWORK_DIR=<dir> [-DARGS=--opt=1]
+#         -P SOLE_contention.cmake
+
+foreach(var BIN WORK_DIR)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} is not set")
+    endif()
+endforeach()
+
+set(CSV "${WORK_DIR}/SOLE_contention.csv")
+file(REMOVE "${CSV}")
+
+# Run BIN with extra arguments and return the SOLE cycles of the ring
+function(run_contention tag out_var)
+    execute_process(
+        COMMAND ${BIN} ${ARGS} ${ARGN} --csv ${CSV}
+        WORKING_DIRECTORY "${WORK_DIR}"
+        RESULT_VARIABLE rc
+        OUTPUT_VARIABLE out
+        ERROR_VARIABLE  err)
+    if(NOT rc EQUAL 0)
+        message(FATAL_ERROR "${BIN} ${ARGN} (${tag}) exited with ${rc}\n${out}\n${err}")
+    endif()
+    if(NOT out MATCHES "\\[CONTENTION\\] [^\n]* cycles=([0-9]+) elements_per_cycle=([0-9.]+)")
+        message(FATAL_ERROR "${BIN} ${ARGN} (${tag}) printed no [CONTENTION] summary\n${out}")
+    endif()
+    message(STATUS "${tag}: ${CMAKE_MATCH_1} cycles, ${CMAKE_MATCH_2} elements/cycle")
+    set(${out_var} ${CMAKE_MATCH_1} PARENT_SCOPE)
+endfunction()
+
+run_contention("no traffic" base --traffic-load=0)
+run_contention("rr" rr --arbitration=rr)
+run_contention("fixed_high" fixed_high --arbitration=fixed --sole-weight=2)
+run_contention("fixed_low" fixed_low --arbitration=fixed --traffic-weight=2)
+run_contention("weighted" weighted --arbitration=weighted --sole-weight=4)
+
+if(NOT rr GREATER base)
+    message(FATAL_ERROR "background traffic does not slow SOLE down (${base} -> ${rr} cycles)")
+endif()
+foreach(policy fixed_high weighted)
+    math(EXPR lhs "100 * ${${policy}}")
+    math(EXPR rhs "95 * ${rr}")
+    if(lhs GREATER rhs)
+        message(FATAL_ERROR "${policy} does not favour SOLE over round-robin (${${policy}} vs ${rr} cycles)")
+    endif()
+endforeach()
+math(EXPR lhs "100 * ${fixed_low}")
+math(EXPR rhs "98 * ${rr}")
+if(lhs LESS rhs)
+    message(FATAL_ERROR "fixed_low is faster than round-robin (${fixed_low} vs ${rr} cycles)")
+endif()
+
+foreach(policy rr fixed_high fixed_low weighted)
+    math(EXPR loss "(${${policy}} - ${base}) * 1000 / ${${policy}}")
+    math(EXPR loss_int "${loss} / 10")
+    math(EXPR loss_frac "${loss} % 10")
+    message(STATUS "${policy}: SOLE throughput ${loss_int}.${loss_frac}% below the no-traffic run")
+endforeach()
@@ -0,0 +1,615 @@
+#include <systemc>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <cstring>
+#include <cstdlib>
+#include <cerrno>
+#include <cmath>
+#include <vector>
+#include <string>
+#include "../include/SOLE.h"
+#include "../include/Axi_Arbiter.h"
+#include "../include/SOLE_MMIO.hpp"
+#include "../include/Softmax_Datapath.h"
+#include "../include/Profile.hpp"
+#include "test_utils.h"
+#include "AxiSlaveMemory.h"
+#include "AxiTrafficGen.h"
+
+using namespace sc_core;
+using namespace sc_dt;
+using namespace std;
+using namespace sole::mmio;
+
+// ===== Shared-Memory Contention Benchmark =====
+//
+// One SOLE (port 0 of an Axi_Arbiter) runs a descriptor ring of --jobs rows
+// while --traffic AxiTrafficGen masters (ports 1..N) load the same
+// AxiSlaveMemory, standing in for the other masters of the SoC (matrix
+// engine, CPU). Reports cycles from the doorbell until the ring is drained,
+// SOLE elements per cycle, and per-port bandwidth and latency from the
+// arbiter; comparing against a run with --traffic-load 0 gives the
+// throughput lost to contention under the chosen --arbitration. Every output
+// row is checked against Softmax_Datapath.
+
+struct ContentionConfig {
+    unsigned jobs = 16;                 ///< Descriptors on the SOLE ring
+    unsigned length = 256;              ///< FP16 elements per row (multiple of SOLE_LANES)
+    unsigned burst_len = 15;            ///< Descriptor flags BURST_LEN
+    unsigned traffic = 2;               ///< Background masters
+    unsigned traffic_load = 30;         ///< Per master, beats per 100 cycles
+    unsigned traffic_read = 50;         ///< Per master, % of bursts that are reads
+    unsigned traffic_burst_len = 15;
+    unsigned traffic_outstanding = 4;
+    unsigned traffic_ready = 100;       ///< Per master, % of cycles with RREADY / BREADY high
+    std::string arbitration = "rr";     ///< rr, fixed or weighted
+    unsigned sole_weight = 1;           ///< Arbiter weight of the SOLE port
+    unsigned traffic_weight = 1;        ///< Arbiter weight of every traffic port
+    unsigned issue_limit = 2;           ///< Arbiter bursts in flight per direction, all ports (0 = no limit)
+    int arready_delay = AXI_READ_ARREADY_DELAY;
+    int rvalid_delay = AXI_READ_RVALID_DELAY;
+    int wready_delay = AXI_WRITE_WREADY_DELAY;
+    int read_latency = AXI_READ_LATENCY;
+    uint32_t seed = 1;
+    uint64_t timeout_cycles = 2000000;
+    std::string csv;                    ///< Append one summary row
+};
+
+static void print_usage(const char* prog) {
+    cout << "Usage: " << prog << " [--key value ...]\n"
+         << "  --jobs N                 SOLE descriptors (default 16)\n"
+         << "  --length N               elements per row, multiple of " << SOLE_LANES << " (default 256)\n"
+         << "  --burst-len N            SOLE max AXI burst length - 1 (default 15)\n"
+         << "  --traffic N              background masters (default 2)\n"
+         << "  --traffic-load N         per master, requested beats per 100 cycles (default 30)\n"
+         << "  --traffic-read N         per master, % of bursts that are reads (default 50)\n"
+         << "  --traffic-burst-len N    background burst length - 1 (default 15)\n"
+         << "  --traffic-outstanding N  background bursts in flight per direction (default 4)\n"
+         << "  --traffic-ready N        per master, % of cycles with RREADY / BREADY high (default 100)\n"
+         << "  --arbitration P          rr | fixed | weighted (default rr)\n"
+         << "  --sole-weight N          arbiter weight / priority of SOLE (default 1)\n"
+         << "  --traffic-weight N       arbiter weight / priority of each background master (default 1)\n"
+         << "  --issue-limit N          bursts in flight at the memory per direction, 0 = no limit (default 2)\n"
+         << "  --arready-delay N        AR wait states (default " << AXI_READ_ARREADY_DELAY << ")\n"
+         << "  --rvalid-delay N         R wait states per burst (default " << AXI_READ_RVALID_DELAY << ")\n"
+         << "  --wready-delay N         W wait states per burst (default " << AXI_WRITE_WREADY_DELAY << ")\n"
+         << "  --read-latency N         pipelined AR-to-R latency (default " << AXI_READ_LATENCY << ")\n"
+         << "  --seed N                 input data / traffic seed (default 1)\n"
+         << "  --timeout-cycles N       watchdog (default 2000000)\n"
+         << "  --csv FILE               append a summary row to FILE\n";
+}
+
+/**
+ * @brief Build the configuration from argv
+ * @return 0 to run, 1 on error, 2 if only the usage was requested
+ */
+static int parse_contention_config(int argc, char* argv[], ContentionConfig& config) {
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "-h" || arg == "--help") {
+            print_usage(argv[0]);
+            return 2;
+        }
+        if (arg.compare(0, 2, "--") != 0) {
+            cerr << "[ERROR] Unexpected argument '" << arg << "'" << endl;
+            return 1;
+        }
+        string key = arg.substr(2);
+        string value;
+        size_t eq = key.find('=');
+        if (eq != string::npos) {
+            value = key.substr(eq + 1);
+            key = key.substr(0, eq);
+        } else if (i + 1 < argc) {
+            value = argv[++i];
+        } else {
+            cerr << "[ERROR] Option --" << key << " needs a value" << endl;
+            return 1;
+        }
+        if (key == "csv") {
+            config.csv = value;
+            continue;
+        }
+        if (key == "arbitration") {
+            if (value != "rr" && value != "fixed" && value != "weighted") {
+                cerr << "[ERROR] Option --arbitration: expected rr, fixed or weighted" << endl;
+                return 1;
+            }
+            config.arbitration = value;
+            continue;
+        }
+        char* end = nullptr;
+        errno = 0;
+        long long v = strtoll(value.c_str(), &end, 0);
+        if (value.empty() || *end != '\0' || errno != 0 || v < 0) {
+            cerr << "[ERROR] Option --" << key << ": bad value '" << value << "'" << endl;
+            return 1;
+        }
+        if (key == "jobs") config.jobs = (unsigned)v;
+        else if (key == "length") config.length = (unsigned)v;
+        else if (key == "burst-len") config.burst_len = (unsigned)v;
+        else if (key == "traffic") config.traffic = (unsigned)v;
+        else if (key == "traffic-load") config.traffic_load = (unsigned)v;
+        else if (key == "traffic-read") config.traffic_read = (unsigned)v;
+        else if (key == "traffic-burst-len") config.traffic_burst_len = (unsigned)v;
+        else if (key == "traffic-outstanding") config.traffic_outstanding = (unsigned)v;
+        else if (key == "traffic-ready") config.traffic_ready = (unsigned)v;
+        else if (key == "sole-weight") config.sole_weight = (unsigned)v;
+        else if (key == "traffic-weight") config.traffic_weight = (unsigned)v;
+        else if (key == "issue-limit") config.issue_limit = (unsigned)v;
+        else if (key == "arready-delay") config.arready_delay = (int)v;
+        else if (key == "rvalid-delay") config.rvalid_delay = (int)v;
+        else if (key == "wready-delay") config.wready_delay = (int)v;
+        else if (key == "read-latency") config.read_latency = (int)v;
+        else if (key == "seed") config.seed = (uint32_t)v;
+        else if (key == "timeout-cycles") config.timeout_cycles = (uint64_t)v;
+        else {
+            cerr << "[ERROR] Unknown option --" << key << endl;
+            return 1;
+        }
+    }
+    if (config.jobs == 0 || config.length == 0 || config.length % SOLE_LANES != 0 ||
+        config.length > DATA_LENGTH_MAX || config.burst_len > 255 || config.traffic > 63 ||
+        config.traffic_load > 100 || config.traffic_read > 100 || config.traffic_burst_len > 255 ||
+        config.traffic_outstanding == 0 || config.traffic_ready == 0 || config.traffic_ready > 100) {
+        cerr << "[ERROR] Need jobs > 0, 0 < length <= " << DATA_LENGTH_MAX << " and a multiple of " << SOLE_LANES
+             << ", burst lengths <= 255, traffic <= 63, load / read <= 100, traffic-outstanding > 0,"
+             << " 0 < traffic-ready <= 100" << endl;
+        return 1;
+    }
+    return 0;
+}
+
+SC_MODULE(SOLE_Contention_TestBench) {
+    sc_clock                                  clk;          ///< 1 ns period, first posedge at 0.5 ns
+    sc_signal<bool>                           rst;
+
+    sc_signal<sc_uint<32>>                    proc_addr;
+    sc_signal<sc_uint<32>>                    proc_wdata;
+    sc_signal<bool>                           proc_we;
+    sc_signal<sc_uint<32>>                    proc_rdata;
+    sc_signal<bool>                           interrupt;
+
+    // Arbiter <-> memory
+    sc_signal<sc_uint<32>>                    M_AXI_AWADDR;
+    sc_signal<sc_uint<8>>                     M_AXI_AWLEN;
+    sc_signal<sc_uint<3>>                     M_AXI_AWSIZE;
+    sc_signal<sc_uint<2>>                     M_AXI_AWBURST;
+    sc_signal<bool>                           M_AXI_AWVALID;
+    sc_signal<bool>                           M_AXI_AWREADY;
+    sc_signal<axi_data_t>                     M_AXI_WDATA;
+    sc_signal<sc_uint<AXI_STRB_WIDTH>>        M_AXI_WSTRB;
+    sc_signal<bool>                           M_AXI_WLAST;
+    sc_signal<bool>                           M_AXI_WVALID;
+    sc_signal<bool>                           M_AXI_WREADY;
+    sc_signal<sc_uint<2>>                     M_AXI_BRESP;
+    sc_signal<bool>                           M_AXI_BVALID;
+    sc_signal<bool>                           M_AXI_BREADY;
+    sc_signal<sc_uint<AXI_ID_WIDTH>>          M_AXI_ARID;
+    sc_signal<sc_uint<32>>                    M_AXI_ARADDR;
+    sc_signal<sc_uint<8>>                     M_AXI_ARLEN;
+    sc_signal<sc_uint<3>>                     M_AXI_ARSIZE;
+    sc_signal<sc_uint<2>>                     M_AXI_ARBURST;
+    sc_signal<bool>                           M_AXI_ARVALID;
+    sc_signal<bool>                           M_AXI_ARREADY;
+    sc_signal<sc_uint<AXI_ID_WIDTH>>          M_AXI_RID;
+    sc_signal<axi_data_t>                     M_AXI_RDATA;
+    sc_signal<sc_uint<2>>                     M_AXI_RRESP;
+    sc_signal<bool>                           M_AXI_RVALID;
+    sc_signal<bool>                           M_AXI_RREADY;
+
+    // Masters <-> arbiter, one entry per port (0 = SOLE)
+    sc_vector<sc_signal<sc_uint<AXI_ADDR_WIDTH>>>     awaddr;
+    sc_vector<sc_signal<sc_uint<8>>>                  awlen;
+    sc_vector<sc_signal<sc_uint<3>>>                  awsize;
+    sc_vector<sc_signal<sc_uint<2>>>                  awburst;
+    sc_vector<sc_signal<bool>>                        awvalid;
+    sc_vector<sc_signal<bool>>                        awready;
+    sc_vector<sc_signal<axi_data_t>>                  wdata;
+    sc_vector<sc_signal<sc_uint<AXI_STRB_WIDTH>>>     wstrb;
+    sc_vector<sc_signal<bool>>                        wlast;
+    sc_vector<sc_signal<bool>>                        wvalid;
+    sc_vector<sc_signal<bool>>                        wready;
+    sc_vector<sc_signal<sc_uint<2>>>                  bresp;
+    sc_vector<sc_signal<bool>>                        bvalid;
+    sc_vector<sc_signal<bool>>                        bready;
+    sc_vector<sc_signal<sc_uint<AXI_ID_WIDTH>>>       arid;
+    sc_vector<sc_signal<sc_uint<AXI_ADDR_WIDTH>>>     araddr;
+    sc_vector<sc_signal<sc_uint<8>>>                  arlen;
+    sc_vector<sc_signal<sc_uint<3>>>                  arsize;
+    sc_vector<sc_signal<sc_uint<2>>>                  arburst;
+    sc_vector<sc_signal<bool>>                        arvalid;
+    sc_vector<sc_signal<bool>>                        arready;
+    sc_vector<sc_signal<sc_uint<AXI_ID_WIDTH>>>       rid;
+    sc_vector<sc_signal<axi_data_t>>                  rdata;
+    sc_vector<sc_signal<sc_uint<2>>>                  rresp;
+    sc_vector<sc_signal<bool>>                        rvalid;
+    sc_vector<sc_signal<bool>>                        rready;
+
+    SOLE                      *dut;
+    std::vector<AxiTrafficGen*> traffic;
+    Axi_Arbiter               *arbiter;
+    AxiSlaveMemory            *axi_slave;
+    ContentionConfig          config;
+    bool                      passed = false;
+
+    // Memory layout: SOLE ring, source rows, destination rows, then one traffic region per master
+    static constexpr uint64_t TRAFFIC_REGION_BYTES = 64 * 1024;
+    uint64_t                  row_bytes;
+    uint64_t                  ring_bytes;
+    uint64_t                  sole_bytes;
+    std::vector<std::vector<uint64_t>> inputs;   ///< Packed input words per job
+
+    SC_HAS_PROCESS(SOLE_Contention_TestBench);
+
+    SOLE_Contention_TestBench(sc_module_name name, const ContentionConfig& test_config)
+        : sc_module(name), clk("clk", sc_time(1, SC_NS), 0.5, sc_time(0.5, SC_NS), true),
+          awaddr("awaddr", test_config.traffic + 1), awlen("awlen", test_config.traffic + 1),
+          awsize("awsize", test_config.traffic + 1), awburst("awburst", test_config.traffic + 1),
+          awvalid("awvalid", test_config.traffic + 1), awready("awready", test_config.traffic + 1),
+          wdata("wdata", test_config.traffic + 1), wstrb("wstrb", test_config.traffic + 1),
+          wlast("wlast", test_config.traffic + 1), wvalid("wvalid", test_config.traffic + 1),
+          wready("wready", test_config.traffic + 1),
+          bresp("bresp", test_config.traffic + 1), bvalid("bvalid", test_config.traffic + 1),
+          bready("bready", test_config.traffic + 1),
+          arid("arid", test_config.traffic + 1), araddr("araddr", test_config.traffic + 1),
+          arlen("arlen", test_config.traffic + 1), arsize("arsize", test_config.traffic + 1),
+          arburst("arburst", test_config.traffic + 1), arvalid("arvalid", test_config.traffic + 1),
+          arready("arready", test_config.traffic + 1),
+          rid("rid", test_config.traffic + 1), rdata("rdata", test_config.traffic + 1),
+          rresp("rresp", test_config.traffic + 1), rvalid("rvalid", test_config.traffic + 1),
+          rready("rready", test_config.traffic + 1),
+          config(test_config) {
+        row_bytes = ((uint64_t)config.length * 2 + 63) / 64 * 64;
+        ring_bytes = ((uint64_t)(config.jobs + 1) * RING_DESC_BYTES + 63) / 64 * 64;
+        sole_bytes = (ring_bytes + 2 * config.jobs * row_bytes + 4095) / 4096 * 4096;
+        unsigned ports = config.traffic + 1;
+
+        arbiter = new Axi_Arbiter("ARBITER", ports);
+        std::vector<unsigned> weights(ports, config.traffic_weight);
+        weights[0] = config.sole_weight;
+        arbiter->set_arbitration(config.arbitration == "fixed"    ? Axi_Arbiter::Arbitration_Policy::FIXED_PRIORITY :
+                                 config.arbitration == "weighted" ? Axi_Arbiter::Arbitration_Policy::WEIGHTED :
+                                                                    Axi_Arbiter::Arbitration_Policy::ROUND_ROBIN,
+                                 weights);
+        arbiter->set_issue_limit(config.issue_limit, config.issue_limit);
+        arbiter->clk(clk);
+        arbiter->rst(rst);
+        arbiter->M_AXI_AWADDR(M_AXI_AWADDR);
+        arbiter->M_AXI_AWLEN(M_AXI_AWLEN);
+        arbiter->M_AXI_AWSIZE(M_AXI_AWSIZE);
+        arbiter->M_AXI_AWBURST(M_AXI_AWBURST);
+        arbiter->M_AXI_AWVALID(M_AXI_AWVALID);
+        arbiter->M_AXI_AWREADY(M_AXI_AWREADY);
+        arbiter->M_AXI_WDATA(M_AXI_WDATA);
+        arbiter->M_AXI_WSTRB(M_AXI_WSTRB);
+        arbiter->M_AXI_WLAST(M_AXI_WLAST);
+        arbiter->M_AXI_WVALID(M_AXI_WVALID);
+        arbiter->M_AXI_WREADY(M_AXI_WREADY);
+        arbiter->M_AXI_BRESP(M_AXI_BRESP);
+        arbiter->M_AXI_BVALID(M_AXI_BVALID);
+        arbiter->M_AXI_BREADY(M_AXI_BREADY);
+        arbiter->M_AXI_ARID(M_AXI_ARID);
+        arbiter->M_AXI_ARADDR(M_AXI_ARADDR);
+        arbiter->M_AXI_ARLEN(M_AXI_ARLEN);
+        arbiter->M_AXI_ARSIZE(M_AXI_ARSIZE);
+        arbiter->M_AXI_ARBURST(M_AXI_ARBURST);
+        arbiter->M_AXI_ARVALID(M_AXI_ARVALID);
+        arbiter->M_AXI_ARREADY(M_AXI_ARREADY);
+        arbiter->M_AXI_RID(M_AXI_RID);
+        arbiter->M_AXI_RDATA(M_AXI_RDATA);
+        arbiter->M_AXI_RRESP(M_AXI_RRESP);
+        arbiter->M_AXI_RVALID(M_AXI_RVALID);
+        arbiter->M_AXI_RREADY(M_AXI_RREADY);
+
+        dut = new SOLE("SOLE_DUT");
+        dut->clk(clk);
+        dut->rst(rst);
+        dut->proc_addr(proc_addr);
+        dut->proc_wdata(proc_wdata);
+        dut->proc_we(proc_we);
+        dut->proc_rdata(proc_rdata);
+        dut->interrupt(interrupt);
+        bind_master(*dut, 0);
+        dut->set_bus_share(config.traffic + config.issue_limit);
+
+        for (unsigned t = 0; t < config.traffic; t++) {
+            AxiTrafficGen::Config traffic_config;
+            traffic_config.load_percent = config.traffic_load;
+            traffic_config.read_percent = config.traffic_read;
+            traffic_config.burst_len = config.traffic_burst_len;
+            traffic_config.outstanding = config.traffic_outstanding;
+            traffic_config.ready_percent = config.traffic_ready;
+            traffic_config.base = sole_bytes + (uint64_t)t * TRAFFIC_REGION_BYTES;
+            traffic_config.size = TRAFFIC_REGION_BYTES;
+            traffic_config.seed = config.seed * 7919u + t + 1;
+            AxiTrafficGen* gen = new AxiTrafficGen(("TRAFFIC_" + std::to_string(t)).c_str(), traffic_config);
+            gen->clk(clk);
+            gen->rst(rst);
+            bind_master(*gen, t + 1);
+            traffic.push_back(gen);
+        }
+
+        axi_slave = new AxiSlaveMemory("AXI_SLAVE", (sole_bytes + config.traffic * TRAFFIC_REGION_BYTES) / 8);
+        axi_slave->clk(clk);
+        axi_slave->rst(rst);
+        axi_slave->set_wait_states(config.arready_delay, config.rvalid_delay, config.wready_delay);
+        axi_slave->set_read_model(config.read_latency, 0);
+        axi_slave->S_AXI_AWADDR(M_AXI_AWADDR);
+        axi_slave->S_AXI_AWLEN(M_AXI_AWLEN);
+        axi_slave->S_AXI_AWVALID(M_AXI_AWVALID);
+        axi_slave->S_AXI_AWREADY(M_AXI_AWREADY);
+        axi_slave->S_AXI_WDATA(M_AXI_WDATA);
+        axi_slave->S_AXI_WSTRB(M_AXI_WSTRB);
+        axi_slave->S_AXI_WLAST(M_AXI_WLAST);
+        axi_slave->S_AXI_WVALID(M_AXI_WVALID);
+        axi_slave->S_AXI_WREADY(M_AXI_WREADY);
+        axi_slave->S_AXI_BRESP(M_AXI_BRESP);
+        axi_slave->S_AXI_BVALID(M_AXI_BVALID);
+        axi_slave->S_AXI_BREADY(M_AXI_BREADY);
+        axi_slave->S_AXI_ARID(M_AXI_ARID);
+        axi_slave->S_AXI_ARADDR(M_AXI_ARADDR);
+        axi_slave->S_AXI_ARLEN(M_AXI_ARLEN);
+        axi_slave->S_AXI_ARVALID(M_AXI_ARVALID);
+        axi_slave->S_AXI_ARREADY(M_AXI_ARREADY);
+        axi_slave->S_AXI_RID(M_AXI_RID);
+        axi_slave->S_AXI_RDATA(M_AXI_RDATA);
+        axi_slave->S_AXI_RRESP(M_AXI_RRESP);
+        axi_slave->S_AXI_RVALID(M_AXI_RVALID);
+        axi_slave->S_AXI_RREADY(M_AXI_RREADY);
+
+        SC_THREAD(test_stimulus);
+    }
+
+    ~SOLE_Contention_TestBench() {
+        delete dut;
+        for (AxiTrafficGen* gen : traffic) {
+            delete gen;
+        }
+        delete arbiter;
+        delete axi_slave;
+    }
+
+    /// Connect a master's AXI4 port (SOLE or AxiTrafficGen) to arbiter port p
+    template <typename Master>
+    void bind_master(Master& master, unsigned p) {
+        master.M_AXI_AWADDR(awaddr[p]);     arbiter->S_AXI_AWADDR[p](awaddr[p]);
+        master.M_AXI_AWLEN(awlen[p]);       arbiter->S_AXI_AWLEN[p](awlen[p]);
+        master.M_AXI_AWSIZE(awsize[p]);     arbiter->S_AXI_AWSIZE[p](awsize[p]);
+        master.M_AXI_AWBURST(awburst[p]);   arbiter->S_AXI_AWBURST[p](awburst[p]);
+        master.M_AXI_AWVALID(awvalid[p]);   arbiter->S_AXI_AWVALID[p](awvalid[p]);
+        master.M_AXI_AWREADY(awready[p]);   arbiter->S_AXI_AWREADY[p](awready[p]);
+        master.M_AXI_WDATA(wdata[p]);       arbiter->S_AXI_WDATA[p](wdata[p]);
+        master.M_AXI_WSTRB(wstrb[p]);       arbiter->S_AXI_WSTRB[p](wstrb[p]);
+        master.M_AXI_WLAST(wlast[p]);       arbiter->S_AXI_WLAST[p](wlast[p]);
+        master.M_AXI_WVALID(wvalid[p]);     arbiter->S_AXI_WVALID[p](wvalid[p]);
+        master.M_AXI_WREADY(wready[p]);     arbiter->S_AXI_WREADY[p](wready[p]);
+        master.M_AXI_BRESP(bresp[p]);       arbiter->S_AXI_BRESP[p](bresp[p]);
+        master.M_AXI_BVALID(bvalid[p]);     arbiter->S_AXI_BVALID[p](bvalid[p]);
+        master.M_AXI_BREADY(bready[p]);     arbiter->S_AXI_BREADY[p](bready[p]);
+        master.M_AXI_ARID(arid[p]);         arbiter->S_AXI_ARID[p](arid[p]);
+        master.M_AXI_ARADDR(araddr[p]);     arbiter->S_AXI_ARADDR[p](araddr[p]);
+        master.M_AXI_ARLEN(arlen[p]);       arbiter->S_AXI_ARLEN[p](arlen[p]);
+        master.M_AXI_ARSIZE(arsize[p]);     arbiter->S_AXI_ARSIZE[p](arsize[p]);
+        master.M_AXI_ARBURST(arburst[p]);   arbiter->S_AXI_ARBURST[p](arburst[p]);
+        master.M_AXI_ARVALID(arvalid[p]);   arbiter->S_AXI_ARVALID[p](arvalid[p]);
+        master.M_AXI_ARREADY(arready[p]);   arbiter->S_AXI_ARREADY[p](arready[p]);
+        master.M_AXI_RID(rid[p]);           arbiter->S_AXI_RID[p](rid[p]);
+        master.M_AXI_RDATA(rdata[p]);       arbiter->S_AXI_RDATA[p](rdata[p]);
+        master.M_AXI_RRESP(rresp[p]);       arbiter->S_AXI_RRESP[p](rresp[p]);
+        master.M_AXI_RVALID(rvalid[p]);     arbiter->S_AXI_RVALID[p](rvalid[p]);
+        master.M_AXI_RREADY(rready[p]);     arbiter->S_AXI_RREADY[p](rready[p]);
+    }
+
+    uint64_t src_addr(unsigned job) const { return ring_bytes + job * row_bytes; }
+    uint64_t dst_addr(unsigned job) const { return ring_bytes + ((uint64_t)config.jobs + job) * row_bytes; }
+
+    void mmio_write(uint32_t offset, uint32_t data) {
+        wait(clk.posedge_event());
+        proc_addr.write(offset);
+        proc_wdata.write(data);
+        proc_we.write(true);
+        wait(clk.posedge_event());
+        proc_we.write(false);
+        wait(clk.posedge_event());
+    }
+
+    uint32_t mmio_read(uint32_t offset) {
+        wait(clk.posedge_event());
+        proc_addr.write(offset);
+        proc_we.write(false);
+        wait(clk.posedge_event());
+        return proc_rdata.read().to_uint();
+    }
+
+    /// Rows and descriptors, loaded through the backdoor (ring at address 0)
+    void load_jobs() {
+        uint32_t lcg = config.seed;
+        uint32_t flags = config.burst_len << CTRL_BURST_LEN_LSB;
+        inputs.assign(config.jobs, std::vector<uint64_t>(config.length / 4, 0));
+        for (unsigned job = 0; job < config.jobs; job++) {
+            std::vector<uint64_t>& words = inputs[job];
+            for (unsigned i = 0; i < config.length; i++) {
+                lcg = lcg * 1103515245u + 12345u;
+                float value = (float)((lcg >> 16) % 8000) / 1000.0f - 4.0f;   // [-4.000, 3.999]
+                words[i / 4] |= (uint64_t)float_to_fp16(value) << (16 * (i % 4));
+            }
+            axi_slave->load(src_addr(job), words.data(), words.size() * 8);
+            uint64_t desc[RING_DESC_BYTES / 8] = {src_addr(job), dst_addr(job),
+                                                  ((uint64_t)flags << 32) | config.length, 0};
+            axi_slave->load((uint64_t)job * RING_DESC_BYTES, desc, sizeof(desc));
+        }
+    }
+
+    /// Outputs against Softmax_Datapath (one reset per job) and completion records; returns mismatching rows
+    unsigned verify_jobs() {
+        unsigned bad_rows = 0;
+        Softmax_Datapath datapath;
+        for (unsigned job = 0; job < config.jobs; job++) {
+            const std::vector<uint64_t>& words = inputs[job];
+            datapath.reset();
+            datapath.begin_job();
+            for (uint64_t word : words) {
+                datapath.process1_beat(word);
+            }
+            datapath.process2();
+            std::vector<uint64_t> output(words.size());
+            axi_slave->dump(dst_addr(job), output.data(), output.size() * 8);
+            size_t first_diff = output.size();
+            for (size_t beat = 0; beat < output.size() && first_diff == output.size(); beat++) {
+                if (output[beat] != datapath.process3_beat(beat)) {
+                    first_diff = beat;
+                }
+            }
+            uint64_t record = 0;
+            axi_slave->dump((uint64_t)job * RING_DESC_BYTES + RING_DESC_COMPLETION_WORD * 8, &record, sizeof(record));
+            bool done = ((record >> RING_CPL_COMPLETE_BIT) & 0x1) != 0 &&
+                        ((uint32_t)record & 0xFF) == (1u << STAT_DONE_BIT);
+            if (first_diff != output.size() || !done) {
+                bad_rows++;
+                cout << "[FAIL] job " << job;
+                if (!done) {
+                    cout << ": completion record 0x" << hex << record << dec;
+                } else {
+                    cout << ": beat " << first_diff << " is 0x" << hex << output[first_diff]
+                         << ", expected 0x" << datapath.process3_beat(first_diff) << dec;
+                }
+                cout << endl;
+            }
+        }
+        return bad_rows;
+    }
+
+    void test_stimulus() {
+        load_jobs();
+
+        rst.write(true);
+        proc_we.write(false);
+        for (int i = 0; i < 10; i++) {
+            wait(clk.posedge_event());
+        }
+        rst.write(false);
+        wait(clk.posedge_event());
+
+        // Background traffic runs from reset, through the ring setup as well
+        mmio_write(REG_RING_BASE_L, 0);
+        mmio_write(REG_RING_BASE_H, 0);
+        mmio_write(REG_RING_SIZE, config.jobs + 1);
+        mmio_write(REG_CONTROL, 1u << CTRL_RING_BIT);
+
+        uint64_t start_cycle = cycle();
+        mmio_write(REG_RING_TAIL, config.jobs);
+        bool drained = false;
+        while (!drained && cycle() - start_cycle < config.timeout_cycles) {
+            wait(clk.posedge_event());
+            drained = dut->ring_head.read().to_uint() == config.jobs;
+        }
+        uint64_t cycles = cycle() - start_cycle;
+
+        bool completed_ok = mmio_read(REG_COMPLETED_JOBS) == config.jobs;
+        unsigned bad_rows = drained ? verify_jobs() : config.jobs;
+        uint64_t traffic_errors = 0;
+        unsigned count_mismatches = 0;
+        for (unsigned t = 0; t < traffic.size(); t++) {
+            const AxiTrafficGen* gen = traffic[t];
+            traffic_errors += gen->error_responses;
+            // The arbiter must retire R and B on the same handshakes the master sees
+            const Axi_Arbiter::Port_Stats& s = arbiter->stats[t + 1];
+            if (s.r_beats != gen->r_beats || s.write_bursts_done != gen->b_responses) {
+                cout << "[FAIL] port " << t + 1 << ": arbiter counted " << s.r_beats << " R beats / "
+                     << s.write_bursts_done << " B, master " << gen->r_beats << " / " << gen->b_responses << "\n";
+                count_mismatches++;
+            }
+        }
+        passed = drained && bad_rows == 0 && completed_ok && traffic_errors == 0 && count_mismatches == 0;
+        report(cycles, drained, bad_rows, completed_ok, traffic_errors);
+        sc_stop();
+    }
+
+    uint64_t cycle() const { return (uint64_t)(sc_time_stamp() / clk.period()); }
+
+    void report(uint64_t cycles, bool drained, unsigned bad_rows, bool completed_ok, uint64_t traffic_errors) {
+        const uint64_t bus_cycles = arbiter->cycles;
+        auto per_cycle = [bus_cycles](uint64_t beats) { return bus_cycles ? (double)beats / bus_cycles : 0.0; };
+        auto average = [](uint64_t total, uint64_t count) { return count ? (double)total / count : 0.0; };
+
+        uint64_t r_beats = 0, w_beats = 0;
+        cout << fixed << setprecision(2);
+        cout << "\n===== SOLE Contention Benchmark =====\n"
+             << "arbitration=" << config.arbitration << " sole_weight=" << config.sole_weight
+             << " traffic=" << config.traffic << " traffic_load=" << config.traffic_load
+             << " traffic_read=" << config.traffic_read << " traffic_ready=" << config.traffic_ready
+             << " traffic_weight=" << config.traffic_weight
+             << " issue_limit=" << config.issue_limit
+             << " jobs=" << config.jobs << " length=" << config.length << " rvalid_delay=" << config.rvalid_delay << "\n"
+             << "Port | Master  | AR bursts | R beats | AW bursts | W beats | AR wait | AW wait | R lat avg/max | W lat avg/max"
+                " | R beats/cyc | W beats/cyc\n";
+        for (unsigned p = 0; p < arbiter->masters; p++) {
+            const Axi_Arbiter::Port_Stats& s = arbiter->stats[p];
+            r_beats += s.r_beats;
+            w_beats += s.w_beats;
+            cout << setw(4) << p << " | " << setw(7) << (p == 0 ? "SOLE" : "traffic") << " | "
+                 << setw(9) << s.ar_bursts << " | " << setw(7) << s.r_beats << " | "
+                 << setw(9) << s.aw_bursts << " | " << setw(7) << s.w_beats << " | "
+                 << setw(7) << s.ar_wait_cycles << " | " << setw(7) << s.aw_wait_cycles << " | "
+                 << setw(7) << average(s.read_latency_total, s.read_bursts_done) << "/" << setw(5) << s.read_latency_max
+                 << " | " << setw(7) << average(s.write_latency_total, s.write_bursts_done) << "/" << setw(5)
+                 << s.write_latency_max << " | " << setw(11) << per_cycle(s.r_beats) << " | " << setw(11)
+                 << per_cycle(s.w_beats) << "\n";
+        }
+
+        const Axi_Arbiter::Port_Stats& sole = arbiter->stats[0];
+        double elements_per_cycle = cycles ? (double)config.jobs * config.length / cycles : 0.0;
+        double sole_read_latency = average(sole.read_latency_total, sole.read_bursts_done);
+        cout << setprecision(4);
+        cout << "[CONTENTION] arbitration=" << config.arbitration << " traffic=" << config.traffic
+             << " traffic_load=" << config.traffic_load << " cycles=" << cycles
+             << " elements_per_cycle=" << elements_per_cycle << " sole_read_latency=" << sole_read_latency
+             << " bus_read_beats_per_cycle=" << per_cycle(r_beats)
+             << " bus_write_beats_per_cycle=" << per_cycle(w_beats) << "\n";
+        if (!drained) {
+            cout << "[TIMEOUT] ring not drained after " << config.timeout_cycles << " cycles\n";
+        }
+        if (!completed_ok) {
+            cout << "[FAIL] REG_COMPLETED_JOBS != " << config.jobs << "\n";
+        }
+        if (traffic_errors != 0) {
+            cout << "[FAIL] " << traffic_errors << " error responses to background traffic\n";
+        }
+        cout << (passed ? "[PASS]" : "[FAIL]") << " " << (config.jobs - bad_rows) << "/" << config.jobs
+             << " rows match Softmax_Datapath" << endl;
+
+        if (!config.csv.empty()) {
+            bool new_file = !std::ifstream(config.csv).good();
+            std::ofstream csv(config.csv, std::ios::app);
+            if (new_file) {
+                csv << "arbitration,sole_weight,traffic,traffic_load,traffic_read,traffic_weight,jobs,length,"
+                       "rvalid_delay,cycles,elements_per_cycle,sole_read_latency,sole_read_latency_max,"
+                       "bus_read_beats_per_cycle,bus_write_beats_per_cycle,pass\n";
+            }
+            csv << fixed << setprecision(4) << config.arbitration << "," << config.sole_weight << ","
+                << config.traffic << "," << config.traffic_load << "," << config.traffic_read << ","
+                << config.traffic_weight << "," << config.jobs << "," << config.length << ","
+                << config.rvalid_delay << "," << cycles << "," << elements_per_cycle << "," << sole_read_latency
+                << "," << sole.read_latency_max << "," << per_cycle(r_beats) << "," << per_cycle(w_beats) << ","
+                << (passed ? 1 : 0) << "\n";
+        }
+    }
+};
+
+int sc_main(int argc, char* argv[]) {
+    ContentionConfig config;
+    int rc = parse_contention_config(argc, argv, config);
+    if (rc != 0) {
+        return (rc == 2) ? 0 : 1;
+    }
+
+    SOLE_Contention_TestBench testbench("SOLE_Contention_TestBench", config);
+    sc_start();
+
+    cout << "\n[SIMULATION COMPLETE]" << endl;
+    SOLE_PROFILE_REPORT();
+
+    return testbench.passed ? 0 : 1;
+}
@@ -0,0 +1,65 @@
+# SOLE_test fast-forward check
+#
+# Runs BATCH twice, per-edge and with --fast-forward 1, and requires identical
+# summary CSVs, AXI pin logs, result logs and status monitor logs. With
+# REQUIRE_STOP the fast-forward run must also have stopped the clock.
+#
+# Usage:
+#   cmake -DTEST_BIN=<SOLE_test> -DBATCH=<cases.txt> -DINPUT=<SOLE_test_Data.txt> -DWORK_DIR=<dir>
+#         [-DNAME=<work subdirectory, default SOLE_fast_forward>] [-DREQUIRE_STOP=1]
+#         -P SOLE_fast_forward_equivalence.cmake
+
+foreach(var TEST_BIN BATCH INPUT WORK_DIR)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} is not set")
+    endif()
+endforeach()
+if(NOT DEFINED NAME)
+    set(NAME SOLE_fast_forward)
+endif()
+
+# SOLE_test writes its default logs to ../test relative to the working directory,
+# so each mode gets its own run/test pair
+function(run_mode mode fast_forward)
+    set(run_dir "${WORK_DIR}/${NAME}/${mode}/run")
+    set(log_dir "${WORK_DIR}/${NAME}/${mode}/test")
+    file(REMOVE_RECURSE "${WORK_DIR}/${NAME}/${mode}")
+    file(MAKE_DIRECTORY "${run_dir}" "${log_dir}")
+    execute_process(
+        COMMAND ${TEST_BIN} --batch ${BATCH} --input ${INPUT} --csv ${log_dir}/summary.csv
+                --axi-log ${log_dir}/axi_pins.log --fast-forward ${fast_forward}
+        WORKING_DIRECTORY "${run_dir}"
+        RESULT_VARIABLE rc
+        OUTPUT_VARIABLE out
+        ERROR_VARIABLE  err)
+    if(NOT rc EQUAL 0)
+        message(FATAL_ERROR "SOLE_test --fast-forward ${fast_forward} exited with ${rc}\n${out}\n${err}")
+    endif()
+    set(run_output "${out}" PARENT_SCOPE)
+endfunction()
+
+run_mode(per_edge 0)
+run_mode(fast_forward 1)
+string(REGEX MATCH "clock stopped for [0-9]+ of [0-9]+ cycles" stopped "${run_output}")
+if(REQUIRE_STOP AND (stopped STREQUAL "" OR stopped MATCHES "for 0 of"))
+    message(FATAL_ERROR "--fast-forward 1 did not stop the clock\n${run_output}")
+endif()
+
+file(GLOB logs RELATIVE "${WORK_DIR}/${NAME}/per_edge/test" "${WORK_DIR}/${NAME}/per_edge/test/*")
+list(LENGTH logs count)
+if(count LESS 3)
+    message(FATAL_ERROR "per-edge run wrote only ${count} files")
+endif()
+foreach(log ${logs})
+    set(ref "${WORK_DIR}/${NAME}/per_edge/test/${log}")
+    set(dut "${WORK_DIR}/${NAME}/fast_forward/test/${log}")
+    if(NOT EXISTS "${dut}")
+        message(FATAL_ERROR "--fast-forward 1 did not write ${log}")
+    endif()
+    file(READ "${ref}" ref_content)
+    file(READ "${dut}" dut_content)
+    if(NOT ref_content STREQUAL dut_content)
+        message(FATAL_ERROR "--fast-forward 1 changes ${log}\n  per-edge:     ${ref}\n  fast-forward: ${dut}")
+    endif()
+endforeach()
+message(STATUS "fast-forward: ${count} files identical to the per-edge run (${stopped})")
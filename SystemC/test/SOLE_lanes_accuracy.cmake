@@ -0,0 +1,87 @@
+# SOLE long-row accuracy check for the lane builds
+#
+# Runs BIN (SOLE_test, SOLE_test_l8 or SOLE_test_l16) on rows of 100, 1024
+# and 4096 elements drawn uniformly from [-8, 8) by a fixed LCG, and requires
+# the cosine similarity against Csim SOLE_softmax() of every row to be at
+# least MIN_COSINE. The 8 / 16 lane builds stay below the 0.99 PASS threshold
+# of SOLE_test on long rows (per-beat local max, see SOLE_LANES in
+# include/DataTypes.hpp), so MIN_COSINE pins the measured value instead. The
+# summary rows go to WORK_DIR/<NAME>.csv.
+#
+# Usage:
+#   cmake -DNAME=<test name> -DBIN=<SOLE_test_lN> -DWORK_DIR=<dir>
+#         -DMIN_COSINE=0.97 -P SOLE_lanes_accuracy.cmake
+
+foreach(var NAME BIN WORK_DIR MIN_COSINE)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} is not set")
+    endif()
+endforeach()
+
+set(LENGTHS 100 1024 4096)
+set(INPUT "${WORK_DIR}/${NAME}_Data.txt")
+set(BATCH "${WORK_DIR}/${NAME}_Batch.txt")
+set(CSV   "${WORK_DIR}/${NAME}.csv")
+file(REMOVE "${CSV}")
+
+# Input: 4096 values in [-8, 8) with two decimals
+set(lcg 1)
+set(values "")
+foreach(i RANGE 1 4096)
+    math(EXPR lcg "(${lcg} * 1103515245 + 12345) % 2147483648")
+    math(EXPR v "(${lcg} / 256) % 1600 - 800")
+    if(v LESS 0)
+        math(EXPR mag "-${v}")
+        set(sign "-")
+    else()
+        set(mag ${v})
+        set(sign "")
+    endif()
+    math(EXPR int_part "${mag} / 100")
+    math(EXPR frac "${mag} % 100")
+    if(frac LESS 10)
+        set(frac "0${frac}")
+    endif()
+    string(APPEND values "${sign}${int_part}.${frac}\n")
+endforeach()
+file(WRITE "${INPUT}" "${values}")
+set(cases "")
+foreach(n ${LENGTHS})
+    string(APPEND cases "name=n${n} length=${n}\n")
+endforeach()
+file(WRITE "${BATCH}" "${cases}")
+
+execute_process(
+    COMMAND ${BIN} --batch ${BATCH} --input ${INPUT} --mem-words 16384
+            --log ${WORK_DIR}/${NAME}_Result.log
+            --monitor-log ${WORK_DIR}/${NAME}_Monitor.log
+            --csv ${CSV}
+    WORKING_DIRECTORY "${WORK_DIR}"
+    RESULT_VARIABLE rc
+    OUTPUT_QUIET
+    ERROR_VARIABLE err)
+if(NOT rc EQUAL 0)
+    message(FATAL_ERROR "${BIN} exited with ${rc}\n${err}")
+endif()
+
+# name,input_count,...,execution_time_ns,cosine_similarity,timeout_detected,passed
+file(STRINGS "${CSV}" rows)
+list(REMOVE_AT rows 0)
+list(LENGTH rows count)
+list(LENGTH LENGTHS expected)
+if(NOT count EQUAL expected)
+    message(FATAL_ERROR "${CSV} has ${count} rows, expected ${expected}")
+endif()
+foreach(row ${rows})
+    string(REPLACE "," ";" fields "${row}")
+    list(GET fields 0 name)
+    list(GET fields 10 cosine)
+    list(GET fields 11 timeout)
+    if(NOT timeout STREQUAL "no")
+        message(FATAL_ERROR "${name}: watchdog timeout")
+    endif()
+    if(cosine LESS MIN_COSINE)
+        message(FATAL_ERROR "${name}: cosine ${cosine} below ${MIN_COSINE}")
+    endif()
+    message(STATUS "${name}: cosine ${cosine} (>= ${MIN_COSINE})")
+endforeach()
@@ -0,0 +1,66 @@
+# SOLE_Multi throughput scaling check
+#
+# Runs BIN (SOLE_multi_test) with 1, 2, 4 and 8 engines on the same per-engine
+# workload and a bandwidth-limited memory (ARGS, e.g. --rvalid-delay=2), and
+# requires every run to pass its Softmax_Datapath check, throughput
+# (elements per cycle) not to drop by more than 5% when engines are added, and
+# two engines to reach at least 1.5x the single-engine throughput. The summary
+# rows go to WORK_DIR/SOLE_multi_scaling.csv.
+#
+# Usage:
+#   cmake -DBIN=<SOLE_multi_test> -DWORK_DIR=<dir> [-DARGS=--opt=1]
+#         -P SOLE_multi_scaling.cmake
+
+foreach(var BIN WORK_DIR)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} is not set")
+    endif()
+endforeach()
+
+set(CSV "${WORK_DIR}/SOLE_multi_scaling.csv")
+file(REMOVE "${CSV}")
+
+set(ENGINE_COUNTS 1 2 4 8)
+set(cycles_list "")
+foreach(n ${ENGINE_COUNTS})
+    execute_process(
+        COMMAND ${BIN} ${ARGS} --engines ${n} --csv ${CSV}
+        WORKING_DIRECTORY "${WORK_DIR}"
+        RESULT_VARIABLE rc
+        OUTPUT_VARIABLE out
+        ERROR_VARIABLE  err)
+    if(NOT rc EQUAL 0)
+        message(FATAL_ERROR "${BIN} --engines ${n} exited with ${rc}\n${out}\n${err}")
+    endif()
+    if(NOT out MATCHES "\\[MULTI\\] engines=${n} cycles=([0-9]+) elements_per_cycle=([0-9.]+)")
+        message(FATAL_ERROR "${BIN} --engines ${n} printed no [MULTI] summary\n${out}")
+    endif()
+    list(APPEND cycles_list ${CMAKE_MATCH_1})
+    message(STATUS "engines=${n}: ${CMAKE_MATCH_1} cycles, ${CMAKE_MATCH_2} elements/cycle")
+endforeach()
+
+# Every engine runs the same jobs, so throughput is proportional to n / cycles:
+# n2 / c2 >= 0.95 * n1 / c1  <=>  100 * n2 * c1 >= 95 * n1 * c2
+list(LENGTH ENGINE_COUNTS runs)
+math(EXPR last "${runs} - 1")
+foreach(i RANGE 1 ${last})
+    math(EXPR prev "${i} - 1")
+    list(GET ENGINE_COUNTS ${prev} n1)
+    list(GET ENGINE_COUNTS ${i} n2)
+    list(GET cycles_list ${prev} c1)
+    list(GET cycles_list ${i} c2)
+    math(EXPR lhs "100 * ${n2} * ${c1}")
+    math(EXPR rhs "95 * ${n1} * ${c2}")
+    if(lhs LESS rhs)
+        message(FATAL_ERROR "throughput drops from ${n1} to ${n2} engines (${c1} -> ${c2} cycles)")
+    endif()
+endforeach()
+
+list(GET cycles_list 0 c1)
+list(GET cycles_list 1 c2)
+math(EXPR lhs "2 * ${c1} * 10")
+math(EXPR rhs "15 * ${c2}")
+if(lhs LESS rhs)
+    message(FATAL_ERROR "two engines do not reach 1.5x one engine (${c1} -> ${c2} cycles)")
+endif()
+message(STATUS "throughput scales with engines up to the memory limit (${CSV})")
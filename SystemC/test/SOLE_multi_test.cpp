@@ -0,0 +1,464 @@
+#include <systemc>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <cstring>
+#include <cstdlib>
+#include <cerrno>
+#include <cmath>
+#include <vector>
+#include <string>
+#include "../include/SOLE_Multi.h"
+#include "../include/SOLE_MMIO.hpp"
+#include "../include/Softmax_Datapath.h"
+#include "../include/Profile.hpp"
+#include "test_utils.h"
+#include "AxiSlaveMemory.h"
+
+using namespace sc_core;
+using namespace sc_dt;
+using namespace std;
+using namespace sole::mmio;
+
+// ===== Multi-Engine Throughput Benchmark =====
+//
+// Every engine of a SOLE_Multi runs its own descriptor ring of --jobs rows
+// (--length elements each) at the same time, all through the one AXI port of
+// the shared AxiSlaveMemory. The memory answers one read burst at a time at
+// one beat per cycle plus its wait states, so it is the bandwidth limit the
+// engines contend for. Reports cycles from the first doorbell until every
+// ring is drained, elements per cycle and the R / W beats per cycle, and
+// checks every output row against Softmax_Datapath and every completion
+// record for DONE.
+
+struct MultiConfig {
+    unsigned engines = 4;
+    unsigned jobs = 8;              ///< Descriptors per engine
+    unsigned length = 256;          ///< FP16 elements per row (multiple of SOLE_LANES)
+    unsigned burst_len = 15;        ///< Descriptor flags BURST_LEN (max burst length - 1)
+    unsigned read_outstanding = 0;  ///< Descriptor flags READ_OUTSTANDING (0 = 64)
+    unsigned outstanding_limit = 0; ///< Axi_Arbiter bursts in flight per engine (0 = ID space / engines)
+    unsigned issue_limit = 0;       ///< Axi_Arbiter bursts in flight per direction, all engines (0 = 2 * engines)
+    int arready_delay = AXI_READ_ARREADY_DELAY;
+    int rvalid_delay = AXI_READ_RVALID_DELAY;
+    int wready_delay = AXI_WRITE_WREADY_DELAY;
+    int read_latency = AXI_READ_LATENCY;
+    uint32_t seed = 1;
+    uint64_t timeout_cycles = 2000000;
+    std::string csv;                ///< Append one summary row
+};
+
+static void print_usage(const char* prog) {
+    cout << "Usage: " << prog << " [--key value ...]\n"
+         << "  --engines N            Softmax engines (default 4)\n"
+         << "  --jobs N               descriptors per engine (default 8)\n"
+         << "  --length N             elements per row, multiple of " << SOLE_LANES << " (default 256)\n"
+         << "  --burst-len N          max AXI burst length - 1 (default 15)\n"
+         << "  --read-outstanding N   max AR bursts in flight per engine, 0 = 64 (default 0)\n"
+         << "  --outstanding-limit N  arbiter bursts in flight per engine, 0 = 64 / engines (default 0)\n"
+         << "  --issue-limit N        bursts in flight at the memory per direction, 0 = 2 * engines (default 0)\n"
+         << "  --arready-delay N      AR wait states (default " << AXI_READ_ARREADY_DELAY << ")\n"
+         << "  --rvalid-delay N       R wait states per burst (default " << AXI_READ_RVALID_DELAY << ")\n"
+         << "  --wready-delay N       W wait states per burst (default " << AXI_WRITE_WREADY_DELAY << ")\n"
+         << "  --read-latency N       pipelined AR-to-R latency (default " << AXI_READ_LATENCY << ")\n"
+         << "  --seed N               input data seed (default 1)\n"
+         << "  --timeout-cycles N     watchdog (default 2000000)\n"
+         << "  --csv FILE             append a summary row to FILE\n";
+}
+
+/**
+ * @brief Build the configuration from argv
+ * @return 0 to run, 1 on error, 2 if only the usage was requested
+ */
+static int parse_multi_config(int argc, char* argv[], MultiConfig& config) {
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "-h" || arg == "--help") {
+            print_usage(argv[0]);
+            return 2;
+        }
+        if (arg.compare(0, 2, "--") != 0) {
+            cerr << "[ERROR] Unexpected argument '" << arg << "'" << endl;
+            return 1;
+        }
+        string key = arg.substr(2);
+        string value;
+        size_t eq = key.find('=');
+        if (eq != string::npos) {
+            value = key.substr(eq + 1);
+            key = key.substr(0, eq);
+        } else if (i + 1 < argc) {
+            value = argv[++i];
+        } else {
+            cerr << "[ERROR] Option --" << key << " needs a value" << endl;
+            return 1;
+        }
+        if (key == "csv") {
+            config.csv = value;
+            continue;
+        }
+        char* end = nullptr;
+        errno = 0;
+        long long v = strtoll(value.c_str(), &end, 0);
+        if (value.empty() || *end != '\0' || errno != 0 || v < 0) {
+            cerr << "[ERROR] Option --" << key << ": bad value '" << value << "'" << endl;
+            return 1;
+        }
+        if (key == "engines") config.engines = (unsigned)v;
+        else if (key == "jobs") config.jobs = (unsigned)v;
+        else if (key == "length") config.length = (unsigned)v;
+        else if (key == "burst-len") config.burst_len = (unsigned)v;
+        else if (key == "read-outstanding") config.read_outstanding = (unsigned)v;
+        else if (key == "outstanding-limit") config.outstanding_limit = (unsigned)v;
+        else if (key == "issue-limit") config.issue_limit = (unsigned)v;
+        else if (key == "arready-delay") config.arready_delay = (int)v;
+        else if (key == "rvalid-delay") config.rvalid_delay = (int)v;
+        else if (key == "wready-delay") config.wready_delay = (int)v;
+        else if (key == "read-latency") config.read_latency = (int)v;
+        else if (key == "seed") config.seed = (uint32_t)v;
+        else if (key == "timeout-cycles") config.timeout_cycles = (uint64_t)v;
+        else {
+            cerr << "[ERROR] Unknown option --" << key << endl;
+            return 1;
+        }
+    }
+    if (config.engines == 0 || config.engines > 256 || config.jobs == 0 || config.length == 0 ||
+        config.length % SOLE_LANES != 0 || config.length > DATA_LENGTH_MAX || config.burst_len > 255 ||
+        config.read_outstanding > 255) {
+        cerr << "[ERROR] Need 1..256 engines, jobs > 0, 0 < length <= " << DATA_LENGTH_MAX
+             << " and a multiple of " << SOLE_LANES << ", burst-len / read-outstanding <= 255" << endl;
+        return 1;
+    }
+    return 0;
+}
+
+SC_MODULE(SOLE_Multi_TestBench) {
+    sc_clock                                  clk;          ///< 1 ns period, first posedge at 0.5 ns
+    sc_signal<bool>                           rst;
+
+    sc_signal<sc_uint<32>>                    proc_addr;
+    sc_signal<sc_uint<32>>                    proc_wdata;
+    sc_signal<bool>                           proc_we;
+    sc_signal<sc_uint<32>>                    proc_rdata;
+    sc_signal<bool>                           interrupt;
+
+    sc_signal<sc_uint<32>>                    M_AXI_AWADDR;
+    sc_signal<sc_uint<8>>                     M_AXI_AWLEN;
+    sc_signal<sc_uint<3>>                     M_AXI_AWSIZE;
+    sc_signal<sc_uint<2>>                     M_AXI_AWBURST;
+    sc_signal<bool>                           M_AXI_AWVALID;
+    sc_signal<bool>                           M_AXI_AWREADY;
+    sc_signal<axi_data_t>                     M_AXI_WDATA;
+    sc_signal<sc_uint<AXI_STRB_WIDTH>>        M_AXI_WSTRB;
+    sc_signal<bool>                           M_AXI_WLAST;
+    sc_signal<bool>                           M_AXI_WVALID;
+    sc_signal<bool>                           M_AXI_WREADY;
+    sc_signal<sc_uint<2>>                     M_AXI_BRESP;
+    sc_signal<bool>                           M_AXI_BVALID;
+    sc_signal<bool>                           M_AXI_BREADY;
+    sc_signal<sc_uint<AXI_ID_WIDTH>>          M_AXI_ARID;
+    sc_signal<sc_uint<32>>                    M_AXI_ARADDR;
+    sc_signal<sc_uint<8>>                     M_AXI_ARLEN;
+    sc_signal<sc_uint<3>>                     M_AXI_ARSIZE;
+    sc_signal<sc_uint<2>>                     M_AXI_ARBURST;
+    sc_signal<bool>                           M_AXI_ARVALID;
+    sc_signal<bool>                           M_AXI_ARREADY;
+    sc_signal<sc_uint<AXI_ID_WIDTH>>          M_AXI_RID;
+    sc_signal<axi_data_t>                     M_AXI_RDATA;
+    sc_signal<sc_uint<2>>                     M_AXI_RRESP;
+    sc_signal<bool>                           M_AXI_RVALID;
+    sc_signal<bool>                           M_AXI_RREADY;
+
+    SOLE_Multi                *dut;
+    AxiSlaveMemory            *axi_slave;
+    MultiConfig               config;
+    bool                      passed = false;
+
+    // Memory layout: one region per engine, ring then source rows then destination rows
+    uint64_t                  row_bytes;
+    uint64_t                  ring_bytes;
+    uint64_t                  region_bytes;
+    std::vector<std::vector<uint64_t>> inputs;   ///< Packed input words per (engine * jobs + job)
+
+    SC_HAS_PROCESS(SOLE_Multi_TestBench);
+
+    SOLE_Multi_TestBench(sc_module_name name, const MultiConfig& test_config)
+        : sc_module(name), clk("clk", sc_time(1, SC_NS), 0.5, sc_time(0.5, SC_NS), true), config(test_config) {
+        row_bytes = ((uint64_t)config.length * 2 + 63) / 64 * 64;
+        ring_bytes = ((uint64_t)(config.jobs + 1) * RING_DESC_BYTES + 63) / 64 * 64;
+        region_bytes = (ring_bytes + 2 * config.jobs * row_bytes + 4095) / 4096 * 4096;
+
+        dut = new SOLE_Multi("SOLE_MULTI_DUT", config.engines, config.outstanding_limit);
+        if (config.issue_limit)
+            dut->arbiter->set_issue_limit(config.issue_limit, config.issue_limit);
+        dut->clk(clk);
+        dut->rst(rst);
+        dut->proc_addr(proc_addr);
+        dut->proc_wdata(proc_wdata);
+        dut->proc_we(proc_we);
+        dut->proc_rdata(proc_rdata);
+        dut->interrupt(interrupt);
+        dut->M_AXI_AWADDR(M_AXI_AWADDR);
+        dut->M_AXI_AWLEN(M_AXI_AWLEN);
+        dut->M_AXI_AWSIZE(M_AXI_AWSIZE);
+        dut->M_AXI_AWBURST(M_AXI_AWBURST);
+        dut->M_AXI_AWVALID(M_AXI_AWVALID);
+        dut->M_AXI_AWREADY(M_AXI_AWREADY);
+        dut->M_AXI_WDATA(M_AXI_WDATA);
+        dut->M_AXI_WSTRB(M_AXI_WSTRB);
+        dut->M_AXI_WLAST(M_AXI_WLAST);
+        dut->M_AXI_WVALID(M_AXI_WVALID);
+        dut->M_AXI_WREADY(M_AXI_WREADY);
+        dut->M_AXI_BRESP(M_AXI_BRESP);
+        dut->M_AXI_BVALID(M_AXI_BVALID);
+        dut->M_AXI_BREADY(M_AXI_BREADY);
+        dut->M_AXI_ARID(M_AXI_ARID);
+        dut->M_AXI_ARADDR(M_AXI_ARADDR);
+        dut->M_AXI_ARLEN(M_AXI_ARLEN);
+        dut->M_AXI_ARSIZE(M_AXI_ARSIZE);
+        dut->M_AXI_ARBURST(M_AXI_ARBURST);
+        dut->M_AXI_ARVALID(M_AXI_ARVALID);
+        dut->M_AXI_ARREADY(M_AXI_ARREADY);
+        dut->M_AXI_RID(M_AXI_RID);
+        dut->M_AXI_RDATA(M_AXI_RDATA);
+        dut->M_AXI_RRESP(M_AXI_RRESP);
+        dut->M_AXI_RVALID(M_AXI_RVALID);
+        dut->M_AXI_RREADY(M_AXI_RREADY);
+
+        axi_slave = new AxiSlaveMemory("AXI_SLAVE", region_bytes * config.engines / 8);
+        axi_slave->clk(clk);
+        axi_slave->rst(rst);
+        axi_slave->set_wait_states(config.arready_delay, config.rvalid_delay, config.wready_delay);
+        axi_slave->set_read_model(config.read_latency, 0);
+        axi_slave->S_AXI_AWADDR(M_AXI_AWADDR);
+        axi_slave->S_AXI_AWLEN(M_AXI_AWLEN);
+        axi_slave->S_AXI_AWVALID(M_AXI_AWVALID);
+        axi_slave->S_AXI_AWREADY(M_AXI_AWREADY);
+        axi_slave->S_AXI_WDATA(M_AXI_WDATA);
+        axi_slave->S_AXI_WSTRB(M_AXI_WSTRB);
+        axi_slave->S_AXI_WLAST(M_AXI_WLAST);
+        axi_slave->S_AXI_WVALID(M_AXI_WVALID);
+        axi_slave->S_AXI_WREADY(M_AXI_WREADY);
+        axi_slave->S_AXI_BRESP(M_AXI_BRESP);
+        axi_slave->S_AXI_BVALID(M_AXI_BVALID);
+        axi_slave->S_AXI_BREADY(M_AXI_BREADY);
+        axi_slave->S_AXI_ARID(M_AXI_ARID);
+        axi_slave->S_AXI_ARADDR(M_AXI_ARADDR);
+        axi_slave->S_AXI_ARLEN(M_AXI_ARLEN);
+        axi_slave->S_AXI_ARVALID(M_AXI_ARVALID);
+        axi_slave->S_AXI_ARREADY(M_AXI_ARREADY);
+        axi_slave->S_AXI_RID(M_AXI_RID);
+        axi_slave->S_AXI_RDATA(M_AXI_RDATA);
+        axi_slave->S_AXI_RRESP(M_AXI_RRESP);
+        axi_slave->S_AXI_RVALID(M_AXI_RVALID);
+        axi_slave->S_AXI_RREADY(M_AXI_RREADY);
+
+        SC_THREAD(test_stimulus);
+    }
+
+    ~SOLE_Multi_TestBench() {
+        delete dut;
+        delete axi_slave;
+    }
+
+    uint64_t region_base(unsigned e) const { return (uint64_t)e * region_bytes; }
+    uint64_t src_addr(unsigned e, unsigned job) const { return region_base(e) + ring_bytes + job * row_bytes; }
+    uint64_t dst_addr(unsigned e, unsigned job) const {
+        return region_base(e) + ring_bytes + ((uint64_t)config.jobs + job) * row_bytes;
+    }
+
+    /// Register write through the processor interface (engine e's window)
+    void mmio_write(unsigned e, uint32_t offset, uint32_t data) {
+        wait(clk.posedge_event());
+        proc_addr.write((e << ENGINE_WINDOW_SHIFT) | (offset & ADDR_OFFSET_MASK));
+        proc_wdata.write(data);
+        proc_we.write(true);
+        wait(clk.posedge_event());
+        proc_we.write(false);
+        wait(clk.posedge_event());
+    }
+
+    /// Register read through the processor interface (engine e's window)
+    uint32_t mmio_read(unsigned e, uint32_t offset) {
+        wait(clk.posedge_event());
+        proc_addr.write((e << ENGINE_WINDOW_SHIFT) | (offset & ADDR_OFFSET_MASK));
+        proc_we.write(false);
+        wait(clk.posedge_event());
+        return proc_rdata.read().to_uint();
+    }
+
+    /// Rows and descriptors of every engine, loaded through the backdoor
+    void load_jobs() {
+        uint32_t lcg = config.seed;
+        uint32_t flags = (config.burst_len << CTRL_BURST_LEN_LSB) | (config.read_outstanding << CTRL_READ_OUTSTANDING_LSB);
+        inputs.assign((size_t)config.engines * config.jobs, std::vector<uint64_t>(config.length / 4, 0));
+        for (unsigned e = 0; e < config.engines; e++) {
+            for (unsigned job = 0; job < config.jobs; job++) {
+                std::vector<uint64_t>& words = inputs[e * config.jobs + job];
+                for (unsigned i = 0; i < config.length; i++) {
+                    lcg = lcg * 1103515245u + 12345u;
+                    float value = (float)((lcg >> 16) % 8000) / 1000.0f - 4.0f;   // [-4.000, 3.999]
+                    words[i / 4] |= (uint64_t)float_to_fp16(value) << (16 * (i % 4));
+                }
+                axi_slave->load(src_addr(e, job), words.data(), words.size() * 8);
+                uint64_t desc[RING_DESC_BYTES / 8] = {src_addr(e, job), dst_addr(e, job),
+                                                      ((uint64_t)flags << 32) | config.length, 0};
+                axi_slave->load(region_base(e) + (uint64_t)job * RING_DESC_BYTES, desc, sizeof(desc));
+            }
+        }
+    }
+
+    /// Outputs against Softmax_Datapath (one reset per job) and completion records; returns mismatching rows
+    unsigned verify_jobs() {
+        unsigned bad_rows = 0;
+        Softmax_Datapath datapath;
+        for (unsigned e = 0; e < config.engines; e++) {
+            for (unsigned job = 0; job < config.jobs; job++) {
+                const std::vector<uint64_t>& words = inputs[e * config.jobs + job];
+                datapath.reset();
+                datapath.begin_job();
+                for (uint64_t word : words) {
+                    datapath.process1_beat(word);
+                }
+                datapath.process2();
+                std::vector<uint64_t> output(words.size());
+                axi_slave->dump(dst_addr(e, job), output.data(), output.size() * 8);
+                size_t first_diff = output.size();
+                for (size_t beat = 0; beat < output.size() && first_diff == output.size(); beat++) {
+                    if (output[beat] != datapath.process3_beat(beat)) {
+                        first_diff = beat;
+                    }
+                }
+                uint64_t record = 0;
+                axi_slave->dump(region_base(e) + (uint64_t)job * RING_DESC_BYTES + RING_DESC_COMPLETION_WORD * 8,
+                                &record, sizeof(record));
+                bool done = ((record >> RING_CPL_COMPLETE_BIT) & 0x1) != 0 &&
+                            ((uint32_t)record & 0xFF) == (1u << STAT_DONE_BIT);
+                if (first_diff != output.size() || !done) {
+                    bad_rows++;
+                    cout << "[FAIL] engine " << e << " job " << job;
+                    if (!done) {
+                        cout << ": completion record 0x" << hex << record << dec;
+                    } else {
+                        cout << ": beat " << first_diff << " is 0x" << hex << output[first_diff]
+                             << ", expected 0x" << datapath.process3_beat(first_diff) << dec;
+                    }
+                    cout << endl;
+                }
+            }
+        }
+        return bad_rows;
+    }
+
+    void test_stimulus() {
+        load_jobs();
+
+        rst.write(true);
+        proc_we.write(false);
+        for (int i = 0; i < 10; i++) {
+            wait(clk.posedge_event());
+        }
+        rst.write(false);
+        wait(clk.posedge_event());
+
+        // Every engine gets its own ring; jobs carry their burst flags in the descriptor
+        for (unsigned e = 0; e < config.engines; e++) {
+            mmio_write(e, REG_RING_BASE_L, (uint32_t)region_base(e));
+            mmio_write(e, REG_RING_BASE_H, (uint32_t)(region_base(e) >> 32));
+            mmio_write(e, REG_RING_SIZE, config.jobs + 1);
+            mmio_write(e, REG_CONTROL, 1u << CTRL_RING_BIT);
+        }
+
+        // Doorbells back to back; the run is timed from the first one
+        uint64_t start_cycle = cycle();
+        for (unsigned e = 0; e < config.engines; e++) {
+            mmio_write(e, REG_RING_TAIL, config.jobs);
+        }
+        bool drained = false;
+        while (!drained && cycle() - start_cycle < config.timeout_cycles) {
+            wait(clk.posedge_event());
+            drained = true;
+            for (unsigned e = 0; e < config.engines; e++) {
+                drained &= dut->engines[e].ring_head.read().to_uint() == config.jobs;
+            }
+        }
+        uint64_t cycles = cycle() - start_cycle;
+
+        unsigned completed_ok = 0;
+        for (unsigned e = 0; e < config.engines; e++) {
+            completed_ok += mmio_read(e, REG_COMPLETED_JOBS) == config.jobs;
+        }
+        unsigned bad_rows = drained ? verify_jobs() : config.engines * config.jobs;
+        passed = drained && bad_rows == 0 && completed_ok == config.engines;
+        report(cycles, drained, bad_rows, completed_ok);
+        sc_stop();
+    }
+
+    uint64_t cycle() const { return (uint64_t)(sc_time_stamp() / clk.period()); }
+
+    void report(uint64_t cycles, bool drained, unsigned bad_rows, unsigned completed_ok) {
+        uint64_t r_beats = 0, w_beats = 0;
+        for (const Axi_Arbiter::Port_Stats& s : dut->arbiter->stats) {
+            r_beats += s.r_beats;
+            w_beats += s.w_beats;
+        }
+        double elements = (double)config.engines * config.jobs * config.length;
+        double elements_per_cycle = cycles ? elements / cycles : 0.0;
+        double r_util = cycles ? (double)r_beats / cycles : 0.0;
+        double w_util = cycles ? (double)w_beats / cycles : 0.0;
+
+        cout << fixed << setprecision(4);
+        cout << "\n===== SOLE_Multi Benchmark =====\n"
+             << "engines=" << config.engines << " jobs=" << config.jobs << " length=" << config.length
+             << " burst_len=" << config.burst_len << " rvalid_delay=" << config.rvalid_delay
+             << " outstanding_limit=" << dut->arbiter->outstanding_limit << "\n"
+             << "Engine | AR bursts | R beats | AW bursts | W beats | AR wait | AW wait\n";
+        for (unsigned e = 0; e < config.engines; e++) {
+            const Axi_Arbiter::Port_Stats& s = dut->arbiter->stats[e];
+            cout << setw(6) << e << " | " << setw(9) << s.ar_bursts << " | " << setw(7) << s.r_beats << " | "
+                 << setw(9) << s.aw_bursts << " | " << setw(7) << s.w_beats << " | " << setw(7) << s.ar_wait_cycles
+                 << " | " << setw(7) << s.aw_wait_cycles << "\n";
+        }
+        cout << "[MULTI] engines=" << config.engines << " cycles=" << cycles
+             << " elements_per_cycle=" << elements_per_cycle
+             << " read_beats_per_cycle=" << r_util << " write_beats_per_cycle=" << w_util << "\n";
+        if (!drained) {
+            cout << "[TIMEOUT] rings not drained after " << config.timeout_cycles << " cycles\n";
+        }
+        if (completed_ok != config.engines) {
+            cout << "[FAIL] REG_COMPLETED_JOBS != " << config.jobs << " on " << (config.engines - completed_ok)
+                 << " engines\n";
+        }
+        cout << (passed ? "[PASS]" : "[FAIL]") << " " << (config.engines * config.jobs - bad_rows) << "/"
+             << config.engines * config.jobs << " rows match Softmax_Datapath" << endl;
+
+        if (!config.csv.empty()) {
+            bool new_file = !std::ifstream(config.csv).good();
+            std::ofstream csv(config.csv, std::ios::app);
+            if (new_file) {
+                csv << "engines,jobs,length,burst_len,rvalid_delay,outstanding_limit,cycles,"
+                       "elements_per_cycle,read_beats_per_cycle,write_beats_per_cycle,pass\n";
+            }
+            csv << fixed << setprecision(4) << config.engines << "," << config.jobs << "," << config.length << ","
+                << config.burst_len << "," << config.rvalid_delay << "," << dut->arbiter->outstanding_limit << ","
+                << cycles << "," << elements_per_cycle << "," << r_util << "," << w_util << ","
+                << (passed ? 1 : 0) << "\n";
+        }
+    }
+};
+
+int sc_main(int argc, char* argv[]) {
+    MultiConfig config;
+    int rc = parse_multi_config(argc, argv, config);
+    if (rc != 0) {
+        return (rc == 2) ? 0 : 1;
+    }
+
+    SOLE_Multi_TestBench testbench("SOLE_Multi_TestBench", config);
+    sc_start();
+
+    cout << "\n[SIMULATION COMPLETE]" << endl;
+    SOLE_PROFILE_REPORT();
+
+    return testbench.passed ? 0 : 1;
+}
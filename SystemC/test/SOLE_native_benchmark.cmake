@@ -0,0 +1,142 @@
+# SOLE wall-clock benchmark: sc_uint vs native-integer datapath vs Softmax_Cycle
+#
+# Runs SOLE_test (Softmax_lib, sc_uint datapath) and SOLE_test_native
+# (Softmax_lib_native, native-integer datapath) on CASES rows of LENGTH
+# generated elements, RUNS times each, interleaved. Requires the batch CSVs to
+# be identical and prints the best wall time of each build. With CYCLE_BIN set,
+# softmax_cycle_sim (no SystemC kernel) runs the same row CASES times
+# (--repeat) and is reported against SOLE_test as well.
+# There is no speed threshold: the numbers depend on the SystemC kernel and
+# the datatypes library the tree is built against.
+#
+# Usage:
+#   cmake -DREF_BIN=<SOLE_test> -DNATIVE_BIN=<SOLE_test_native> -DWORK_DIR=<dir>
+#         [-DCYCLE_BIN=<softmax_cycle_sim>] [-DCASES=10] [-DLENGTH=4096] [-DRUNS=3]
+#         -P SOLE_native_benchmark.cmake
+
+cmake_minimum_required(VERSION 3.23)   # string(TIMESTAMP "%f")
+
+foreach(var REF_BIN NATIVE_BIN WORK_DIR)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} is not set")
+    endif()
+endforeach()
+if(NOT DEFINED CASES)
+    set(CASES 10)
+endif()
+if(NOT DEFINED LENGTH)
+    set(LENGTH 4096)
+endif()
+if(NOT DEFINED RUNS)
+    set(RUNS 3)
+endif()
+
+# Input: LENGTH values in [-16, 16) with two decimals from a fixed LCG
+set(INPUT "${WORK_DIR}/SOLE_native_benchmark_Data.txt")
+set(BATCH "${WORK_DIR}/SOLE_native_benchmark_Batch.txt")
+set(lcg 12345)
+set(values "")
+foreach(i RANGE 1 ${LENGTH})
+    math(EXPR lcg "(${lcg} * 1103515245 + 12345) % 2147483648")
+    math(EXPR v "(${lcg} / 256) % 3200 - 1600")
+    if(v LESS 0)
+        math(EXPR mag "-${v}")
+        set(sign "-")
+    else()
+        set(mag ${v})
+        set(sign "")
+    endif()
+    math(EXPR int_part "${mag} / 100")
+    math(EXPR frac "${mag} % 100")
+    if(frac LESS 10)
+        set(frac "0${frac}")
+    endif()
+    string(APPEND values "${sign}${int_part}.${frac}\n")
+endforeach()
+file(WRITE "${INPUT}" "${values}")
+set(cases "")
+foreach(i RANGE 1 ${CASES})
+    string(APPEND cases "name=bench${i} length=${LENGTH}\n")
+endforeach()
+file(WRITE "${BATCH}" "${cases}")
+
+math(EXPR mem_words "${LENGTH} * 4")
+set(REF_BEST 0)
+set(NATIVE_BEST 0)
+set(CYCLE_BEST 0)
+foreach(run RANGE 1 ${RUNS})
+    foreach(build REF NATIVE)
+        set(csv "${WORK_DIR}/SOLE_native_benchmark_${build}.csv")
+        file(REMOVE "${csv}")
+        string(TIMESTAMP start "%s%f")
+        execute_process(
+            COMMAND ${${build}_BIN} --batch ${BATCH} --input ${INPUT}
+                    --mem-words ${mem_words} --timeout-cycles 1000000
+                    --log ${WORK_DIR}/SOLE_native_benchmark_Result.log
+                    --monitor-log ${WORK_DIR}/SOLE_native_benchmark_Monitor.log
+                    --csv ${csv}
+            WORKING_DIRECTORY "${WORK_DIR}"
+            RESULT_VARIABLE rc
+            OUTPUT_QUIET
+            ERROR_VARIABLE err)
+        string(TIMESTAMP stop "%s%f")
+        if(NOT rc EQUAL 0)
+            message(FATAL_ERROR "${${build}_BIN} exited with ${rc}\n${err}")
+        endif()
+        math(EXPR us "${stop} - ${start}")
+        if(${build}_BEST EQUAL 0 OR us LESS ${build}_BEST)
+            set(${build}_BEST ${us})
+        endif()
+    endforeach()
+    if(DEFINED CYCLE_BIN)
+        string(TIMESTAMP start "%s%f")
+        execute_process(
+            COMMAND ${CYCLE_BIN} --input ${INPUT} --length ${LENGTH} --repeat ${CASES}
+                    --timeout-cycles 1000000
+            WORKING_DIRECTORY "${WORK_DIR}"
+            RESULT_VARIABLE rc
+            OUTPUT_VARIABLE out
+            ERROR_VARIABLE err)
+        string(TIMESTAMP stop "%s%f")
+        if(NOT rc EQUAL 0 OR NOT out MATCHES "failed=0 ")
+            message(FATAL_ERROR "${CYCLE_BIN} failed (${rc})\n${out}\n${err}")
+        endif()
+        math(EXPR us "${stop} - ${start}")
+        if(CYCLE_BEST EQUAL 0 OR us LESS CYCLE_BEST)
+            set(CYCLE_BEST ${us})
+        endif()
+    endif()
+endforeach()
+
+execute_process(
+    COMMAND ${CMAKE_COMMAND} -E compare_files "${WORK_DIR}/SOLE_native_benchmark_REF.csv"
+                                              "${WORK_DIR}/SOLE_native_benchmark_NATIVE.csv"
+    RESULT_VARIABLE diff_rc)
+if(NOT diff_rc EQUAL 0)
+    message(FATAL_ERROR "batch CSVs differ between SOLE_test and SOLE_test_native")
+endif()
+
+# Ratio REF_BEST / best as "N.NNx" in ${out_var}
+function(speedup_of best out_var)
+    math(EXPR ratio "${REF_BEST} * 100 / ${best}")
+    math(EXPR ratio_int "${ratio} / 100")
+    math(EXPR ratio_frac "${ratio} % 100")
+    if(ratio_frac LESS 10)
+        set(ratio_frac "0${ratio_frac}")
+    endif()
+    set(${out_var} "${ratio_int}.${ratio_frac}x" PARENT_SCOPE)
+endfunction()
+
+math(EXPR ref_ms "${REF_BEST} / 1000")
+math(EXPR native_ms "${NATIVE_BEST} / 1000")
+speedup_of(${NATIVE_BEST} native_speedup)
+message(STATUS "${CASES} x ${LENGTH} elements, best of ${RUNS}: "
+               "SOLE_test ${ref_ms} ms, SOLE_test_native ${native_ms} ms (${native_speedup})")
+if(DEFINED CYCLE_BIN)
+    if(CYCLE_BEST EQUAL 0)
+        set(CYCLE_BEST 1)
+    endif()
+    math(EXPR cycle_ms "${CYCLE_BEST} / 1000")
+    speedup_of(${CYCLE_BEST} cycle_speedup)
+    message(STATUS "softmax_cycle_sim ${cycle_ms} ms (${cycle_speedup})")
+endif()
@@ -0,0 +1,52 @@
+# SOLE native-type model equivalence check
+#
+# Runs SOLE_test (Softmax_lib, sc_uint datapath) and SOLE_test_native
+# (Softmax_lib_native, native-integer datapath) on the same SOLE_test_Data.txt
+# and requires the per-cycle AXI pin logs to be identical.
+#
+# Usage:
+#   cmake -DREF_BIN=<SOLE_test> -DNATIVE_BIN=<SOLE_test_native> -DWORK_DIR=<dir> -P SOLE_native_equivalence.cmake
+
+foreach(var REF_BIN NATIVE_BIN WORK_DIR)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} is not set")
+    endif()
+endforeach()
+
+set(REF_LOG  "${WORK_DIR}/SOLE_axi_ref.log")
+set(NATIVE_LOG "${WORK_DIR}/SOLE_axi_native.log")
+file(REMOVE "${REF_LOG}" "${NATIVE_LOG}")
+
+foreach(run REF NATIVE)
+    execute_process(
+        COMMAND ${CMAKE_COMMAND} -E env SOLE_AXI_LOG=${${run}_LOG} ${${run}_BIN}
+        WORKING_DIRECTORY "${WORK_DIR}"
+        RESULT_VARIABLE rc
+        OUTPUT_VARIABLE out
+        ERROR_VARIABLE  err)
+    if(NOT rc EQUAL 0)
+        message(FATAL_ERROR "${${run}_BIN} exited with ${rc}\n${out}\n${err}")
+    endif()
+    if(err MATCHES "\\[TIMEOUT\\]")
+        message(FATAL_ERROR "${${run}_BIN} hit the watchdog\n${err}")
+    endif()
+    if(EXISTS "${${run}_LOG}")
+        file(READ "${${run}_LOG}" head LIMIT 64)
+    else()
+        set(head "")
+    endif()
+    if(head STREQUAL "")
+        message(FATAL_ERROR "${${run}_LOG} is empty, no AXI activity recorded")
+    endif()
+endforeach()
+
+execute_process(
+    COMMAND ${CMAKE_COMMAND} -E compare_files "${REF_LOG}" "${NATIVE_LOG}"
+    RESULT_VARIABLE diff_rc)
+if(NOT diff_rc EQUAL 0)
+    message(FATAL_ERROR "AXI pin logs differ: ${REF_LOG} vs ${NATIVE_LOG}")
+endif()
+
+file(STRINGS "${REF_LOG}" lines)
+list(LENGTH lines cycles)
+message(STATUS "AXI pin logs identical (${cycles} active cycles)")
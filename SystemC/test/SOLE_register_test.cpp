@@ -0,0 +1,266 @@
+#include <systemc>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include "../include/SOLE.h"
+#include "../include/SOLE_MMIO.hpp"
+
+using namespace sc_core;
+using namespace sc_dt;
+using namespace std;
+using namespace sole::mmio;
+
+// ===== Register File Checkpoint Round Trip =====
+//
+// Loads a register file with a distinct value in every field through
+// SOLE::restore_registers(), then requires save_registers() to return the
+// same file and every MMIO-readable register to read back its value. A field
+// that save / restore leaves out, or a readable MMIO register without a
+// field, fails here. The ring is enabled with HEAD == TAIL and START stays
+// clear, so no AXI traffic is started and the AXI inputs can stay idle.
+//
+// A second part restores unacknowledged completions and requires the
+// coalesced interrupt to come back as it was: at once past the count
+// threshold, and after the remaining cycles of a partly elapsed timeout.
+
+/// One Register_File field: name, MMIO offset (read-back) and member
+struct Register_Field {
+    const char*                     name;
+    int                             offset;     ///< -1: not readable over MMIO
+    uint32_t SOLE::Register_File::* member;
+};
+
+static const Register_Field REGISTER_FIELDS[] = {
+    {"control",             (int)REG_CONTROL,             &SOLE::Register_File::control},
+    {"src_addr_base_l",     (int)REG_SRC_ADDR_BASE_L,     &SOLE::Register_File::src_addr_base_l},
+    {"src_addr_base_h",     (int)REG_SRC_ADDR_BASE_H,     &SOLE::Register_File::src_addr_base_h},
+    {"dst_addr_base_l",     (int)REG_DST_ADDR_BASE_L,     &SOLE::Register_File::dst_addr_base_l},
+    {"dst_addr_base_h",     (int)REG_DST_ADDR_BASE_H,     &SOLE::Register_File::dst_addr_base_h},
+    {"length_l",            (int)REG_LENGTH_L,            &SOLE::Register_File::length_l},
+    {"length_h",            (int)REG_LENGTH_H,            &SOLE::Register_File::length_h},
+    {"row_count",           (int)REG_ROW_COUNT,           &SOLE::Register_File::row_count},
+    {"src_row_stride",      (int)REG_SRC_ROW_STRIDE,      &SOLE::Register_File::src_row_stride},
+    {"dst_row_stride",      (int)REG_DST_ROW_STRIDE,      &SOLE::Register_File::dst_row_stride},
+    {"ring_base_l",         (int)REG_RING_BASE_L,         &SOLE::Register_File::ring_base_l},
+    {"ring_base_h",         (int)REG_RING_BASE_H,         &SOLE::Register_File::ring_base_h},
+    {"ring_size",           (int)REG_RING_SIZE,           &SOLE::Register_File::ring_size},
+    {"ring_tail",           (int)REG_RING_TAIL,           &SOLE::Register_File::ring_tail},
+    {"ring_head",           (int)REG_RING_HEAD,           &SOLE::Register_File::ring_head},
+    {"irq_count_threshold", (int)REG_IRQ_COUNT_THRESHOLD, &SOLE::Register_File::irq_count_threshold},
+    {"irq_timeout_cycles",  (int)REG_IRQ_TIMEOUT_CYCLES,  &SOLE::Register_File::irq_timeout_cycles},
+    {"completed_jobs",      (int)REG_COMPLETED_JOBS,      &SOLE::Register_File::completed_jobs},
+    {"completed_ack",       -1,                           &SOLE::Register_File::completed_ack},
+    {"irq_wait_cycles",     -1,                           &SOLE::Register_File::irq_wait_cycles},
+    {"last_error",          -1,                           &SOLE::Register_File::last_error},
+};
+
+SC_MODULE(SOLE_Register_TestBench) {
+    sc_clock                                    clk;
+    sc_signal<bool>                             rst;
+    sc_signal<sc_uint<32>>                      proc_addr;
+    sc_signal<sc_uint<32>>                      proc_wdata;
+    sc_signal<bool>                             proc_we;
+    sc_signal<sc_uint<32>>                      proc_rdata;
+    sc_signal<bool>                             interrupt;
+
+    sc_signal<sc_uint<AXI_ADDR_WIDTH>>          M_AXI_AWADDR;
+    sc_signal<sc_uint<8>>                       M_AXI_AWLEN;
+    sc_signal<sc_uint<3>>                       M_AXI_AWSIZE;
+    sc_signal<sc_uint<2>>                       M_AXI_AWBURST;
+    sc_signal<bool>                             M_AXI_AWVALID;
+    sc_signal<bool>                             M_AXI_AWREADY;
+    sc_signal<axi_data_t>                       M_AXI_WDATA;
+    sc_signal<sc_uint<AXI_STRB_WIDTH>>          M_AXI_WSTRB;
+    sc_signal<bool>                             M_AXI_WLAST;
+    sc_signal<bool>                             M_AXI_WVALID;
+    sc_signal<bool>                             M_AXI_WREADY;
+    sc_signal<sc_uint<2>>                       M_AXI_BRESP;
+    sc_signal<bool>                             M_AXI_BVALID;
+    sc_signal<bool>                             M_AXI_BREADY;
+    sc_signal<sc_uint<AXI_ID_WIDTH>>            M_AXI_ARID;
+    sc_signal<sc_uint<AXI_ADDR_WIDTH>>          M_AXI_ARADDR;
+    sc_signal<sc_uint<8>>                       M_AXI_ARLEN;
+    sc_signal<sc_uint<3>>                       M_AXI_ARSIZE;
+    sc_signal<sc_uint<2>>                       M_AXI_ARBURST;
+    sc_signal<bool>                             M_AXI_ARVALID;
+    sc_signal<bool>                             M_AXI_ARREADY;
+    sc_signal<sc_uint<AXI_ID_WIDTH>>            M_AXI_RID;
+    sc_signal<axi_data_t>                       M_AXI_RDATA;
+    sc_signal<sc_uint<2>>                       M_AXI_RRESP;
+    sc_signal<bool>                             M_AXI_RVALID;
+    sc_signal<bool>                             M_AXI_RREADY;
+
+    SOLE*                                       dut;
+    bool                                        passed = true;
+
+    SC_HAS_PROCESS(SOLE_Register_TestBench);
+    SOLE_Register_TestBench(sc_module_name name) : sc_module(name),
+        clk("clk", sc_time(1, SC_NS), 0.5, sc_time(0.5, SC_NS), true)
+    {
+        dut = new SOLE("SOLE_DUT");
+        dut->clk(clk);
+        dut->rst(rst);
+        dut->proc_addr(proc_addr);
+        dut->proc_wdata(proc_wdata);
+        dut->proc_we(proc_we);
+        dut->proc_rdata(proc_rdata);
+        dut->interrupt(interrupt);
+        dut->M_AXI_AWADDR(M_AXI_AWADDR);
+        dut->M_AXI_AWLEN(M_AXI_AWLEN);
+        dut->M_AXI_AWSIZE(M_AXI_AWSIZE);
+        dut->M_AXI_AWBURST(M_AXI_AWBURST);
+        dut->M_AXI_AWVALID(M_AXI_AWVALID);
+        dut->M_AXI_AWREADY(M_AXI_AWREADY);
+        dut->M_AXI_WDATA(M_AXI_WDATA);
+        dut->M_AXI_WSTRB(M_AXI_WSTRB);
+        dut->M_AXI_WLAST(M_AXI_WLAST);
+        dut->M_AXI_WVALID(M_AXI_WVALID);
+        dut->M_AXI_WREADY(M_AXI_WREADY);
+        dut->M_AXI_BRESP(M_AXI_BRESP);
+        dut->M_AXI_BVALID(M_AXI_BVALID);
+        dut->M_AXI_BREADY(M_AXI_BREADY);
+        dut->M_AXI_ARID(M_AXI_ARID);
+        dut->M_AXI_ARADDR(M_AXI_ARADDR);
+        dut->M_AXI_ARLEN(M_AXI_ARLEN);
+        dut->M_AXI_ARSIZE(M_AXI_ARSIZE);
+        dut->M_AXI_ARBURST(M_AXI_ARBURST);
+        dut->M_AXI_ARVALID(M_AXI_ARVALID);
+        dut->M_AXI_ARREADY(M_AXI_ARREADY);
+        dut->M_AXI_RID(M_AXI_RID);
+        dut->M_AXI_RDATA(M_AXI_RDATA);
+        dut->M_AXI_RRESP(M_AXI_RRESP);
+        dut->M_AXI_RVALID(M_AXI_RVALID);
+        dut->M_AXI_RREADY(M_AXI_RREADY);
+
+        SC_THREAD(test_stimulus);
+    }
+
+    void mmio_write(uint32_t address, uint32_t data) {
+        wait(clk.posedge_event());
+        proc_addr.write(address & 0xFF);
+        proc_wdata.write(data);
+        proc_we.write(true);
+        wait(clk.posedge_event());
+        proc_we.write(false);
+        wait(clk.posedge_event());
+    }
+
+    uint32_t mmio_read(uint32_t address) {
+        wait(clk.posedge_event());
+        proc_addr.write(address & 0xFF);
+        proc_we.write(false);
+        wait(clk.posedge_event());
+        return proc_rdata.read().to_uint();
+    }
+
+    void check(bool condition, const string& what) {
+        cout << (condition ? "[PASS] " : "[FAIL] ") << what << endl;
+        passed &= condition;
+    }
+
+    void test_stimulus() {
+        rst.write(true);
+        wait(clk.posedge_event());
+        wait(clk.posedge_event());
+        rst.write(false);
+        wait(clk.posedge_event());
+
+        // A distinct value per field; ring enabled and idle (HEAD == TAIL), START clear
+        SOLE::Register_File regs;
+        uint32_t value = 0x10203040;
+        for (const Register_Field& field : REGISTER_FIELDS) {
+            regs.*field.member = value;
+            value += 0x01010101;
+        }
+        regs.control = (1u << CTRL_RING_BIT) | (1u << CTRL_REREAD_BIT) |
+                       (7u << CTRL_BURST_LEN_LSB) | (4u << CTRL_READ_OUTSTANDING_LSB);
+        regs.ring_size = 8;
+        regs.ring_tail = 5;
+        regs.ring_head = 5;
+        // Nothing pending, so the coalescing state holds still: no wait cycles, no error
+        regs.completed_ack = regs.completed_jobs;
+        regs.irq_wait_cycles = 0;
+        regs.last_error = 0;
+
+        // Registers load at the next edge; HEAD one edge later, once the ring sees REG_CONTROL[25]
+        dut->restore_registers(regs);
+        wait(clk.posedge_event());
+        wait(clk.posedge_event());
+        wait(clk.posedge_event());
+
+        // Every readable register except the engine-owned status has a field
+        for (uint32_t offset = 0; offset <= REG_IRQ_TIMEOUT_CYCLES; offset += 4) {
+            if (offset == REG_STATUS || offset == REG_RESERVED) continue;
+            bool covered = false;
+            for (const Register_Field& field : REGISTER_FIELDS) {
+                covered |= field.offset == (int)offset;
+            }
+            std::ostringstream what;
+            what << "MMIO 0x" << hex << setw(2) << setfill('0') << offset << " is in Register_File";
+            check(covered, what.str());
+        }
+
+        SOLE::Register_File saved = dut->save_registers();
+        for (const Register_Field& field : REGISTER_FIELDS) {
+            bool saved_ok = saved.*field.member == regs.*field.member;
+            bool mmio_ok = true;
+            uint32_t read = 0;
+            if (field.offset >= 0) {
+                read = mmio_read((uint32_t)field.offset);
+                mmio_ok = read == regs.*field.member;
+            }
+            std::ostringstream what;
+            what << field.name << ": restored 0x" << hex << regs.*field.member
+                 << ", saved 0x" << saved.*field.member;
+            if (field.offset >= 0) {
+                what << ", MMIO 0x" << setw(2) << setfill('0') << field.offset << " reads 0x" << read;
+            }
+            check(saved_ok && mmio_ok, what.str());
+        }
+
+        check_coalescing_restore();
+
+        cout << (passed ? "[PASS]" : "[FAIL]") << " Register file round trip" << endl;
+        sc_stop();
+    }
+
+    /// Pending completions and the coalesced interrupt survive a restore
+    void check_coalescing_restore() {
+        // 3 unacknowledged completions, threshold 3: the interrupt is due at once
+        SOLE::Register_File regs;
+        regs.completed_jobs = 7;
+        regs.completed_ack = 4;
+        regs.irq_count_threshold = 3;
+        dut->restore_registers(regs);
+        wait(clk.posedge_event());
+        wait(clk.posedge_event());
+        SOLE::Register_File saved = dut->save_registers();
+        check(interrupt.read() && saved.completed_jobs == 7 && saved.completed_ack == 4,
+              "Restored count over the threshold raises the coalesced interrupt");
+        mmio_write(REG_COMPLETED_JOBS, 7);
+        check(!interrupt.read(), "Acknowledging the restored completions drops the interrupt");
+
+        // Below the threshold with 45 of 50 timeout cycles gone: loaded at the first
+        // edge (46), the timeout is reached at the fifth and the interrupt seen at the sixth
+        regs.irq_count_threshold = 10;
+        regs.irq_timeout_cycles = 50;
+        regs.irq_wait_cycles = 45;
+        dut->restore_registers(regs);
+        int edges = 0;
+        while (!interrupt.read() && edges < 50) {
+            wait(clk.posedge_event());
+            edges++;
+        }
+        check(edges == 6,
+              "Restored timeout progress raises the interrupt after " + to_string(edges) + " edges (expected 6)");
+    }
+};
+
+int sc_main(int argc, char* argv[]) {
+    (void)argc;
+    (void)argv;
+    SOLE_Register_TestBench testbench("SOLE_Register_TestBench");
+    sc_start();
+    return testbench.passed ? 0 : 1;
+}
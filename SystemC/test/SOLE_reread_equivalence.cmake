@@ -0,0 +1,123 @@
+# SOLE re-read mode equivalence check
+#
+# For each input size in SIZES (all <= DATA_LENGTH_MAX), runs BIN in FIFO mode
+# and with the re-read pass forced (--reread 1) and requires identical output
+# data ("[5] Output Stored Back" section, word addresses ignored: the testbench
+# moves the output area behind the input in re-read mode).
+#
+# For LONG_SIZE (> DATA_LENGTH_MAX, re-read mode is the only way to run it) the
+# input is the same block of LONG_SIZE/2 values twice: max and sum are global,
+# so both halves of the output must be identical.
+# ARGS (optional) are passed to every run, e.g. --rvalid-delay=2.
+#
+# Usage:
+#   cmake -DNAME=<tag> -DBIN=<SOLE_test> -DWORK_DIR=<dir> [-DARGS=--opt=1]
+#         [-DSIZES=1;7;96] [-DLONG_SIZE=8192] -P SOLE_reread_equivalence.cmake
+
+foreach(var NAME BIN WORK_DIR)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} is not set")
+    endif()
+endforeach()
+if(NOT DEFINED SIZES)
+    set(SIZES 1 7 96 1024 4096)
+endif()
+if(NOT DEFINED LONG_SIZE)
+    set(LONG_SIZE 8192)
+endif()
+
+# SOLE_test writes its logs to ../test relative to the working directory
+set(RUN_DIR "${WORK_DIR}/${NAME}/run")
+set(LOG_DIR "${WORK_DIR}/${NAME}/test")
+file(MAKE_DIRECTORY "${RUN_DIR}" "${LOG_DIR}")
+
+# Deterministic inputs in [-4.000, 3.999], one per line
+function(make_data n out_var)
+    set(data "")
+    set(seed 12345)
+    foreach(i RANGE 1 ${n})
+        math(EXPR seed "(${seed} * 1103515245 + 12345) % 2147483648")
+        math(EXPR milli "(${seed} / 65536) % 8000 - 4000")
+        if(milli LESS 0)
+            math(EXPR abs "0 - ${milli}")
+            set(sign "-")
+        else()
+            set(abs ${milli})
+            set(sign "")
+        endif()
+        math(EXPR int_part "${abs} / 1000")
+        math(EXPR frac_part "${abs} % 1000 + 1000")
+        string(SUBSTRING "${frac_part}" 1 3 frac_part)
+        string(APPEND data "${sign}${int_part}.${frac_part}\n")
+    endforeach()
+    set(${out_var} "${data}" PARENT_SCOPE)
+endfunction()
+
+# Run BIN with extra arguments; fails on a non-zero exit or a watchdog timeout
+function(run_sole n)
+    execute_process(
+        COMMAND ${BIN} ${ARGS} ${ARGN}
+        WORKING_DIRECTORY "${RUN_DIR}"
+        RESULT_VARIABLE rc
+        OUTPUT_VARIABLE out
+        ERROR_VARIABLE  err)
+    if(NOT rc EQUAL 0)
+        message(FATAL_ERROR "${BIN} ${ARGN} (n=${n}) exited with ${rc}\n${out}\n${err}")
+    endif()
+    if("${out}${err}" MATCHES "\\[(TIMEOUT|ERROR)\\]")
+        message(FATAL_ERROR "${BIN} ${ARGN} (n=${n}) did not complete\n${out}\n${err}")
+    endif()
+endfunction()
+
+# Output data words of the last run, one line per AXI beat, without addresses
+function(extract_output out_var)
+    file(READ "${LOG_DIR}/SOLE_test_Result.log" content)
+    string(FIND "${content}" "[5] Output Stored Back" begin)
+    string(FIND "${content}" "[4] Softmax Compute Results" end)
+    if(begin EQUAL -1 OR end EQUAL -1 OR end LESS begin)
+        message(FATAL_ERROR "SOLE_test_Result.log has no output memory dump")
+    endif()
+    math(EXPR len "${end} - ${begin}")
+    string(SUBSTRING "${content}" ${begin} ${len} dump)
+    string(REGEX MATCHALL "0x [0-9a-f ]+" words "${dump}")
+    set(${out_var} "${words}" PARENT_SCOPE)
+endfunction()
+
+# SOLE_test has SOLE_LANES = 4: one 64-bit word (and dump line) per four elements.
+# Re-read runs place the output behind the input: input + output + the base offsets.
+foreach(n ${SIZES})
+    make_data(${n} data)
+    file(WRITE "${RUN_DIR}/SOLE_test_Data.txt" "${data}")
+    math(EXPR mem_words "${n} / 2 + 512")
+
+    run_sole(${n} --mem-words ${mem_words})
+    extract_output(fifo_result)
+    run_sole(${n} --mem-words ${mem_words} --reread 1)
+    extract_output(reread_result)
+    if(NOT fifo_result STREQUAL reread_result)
+        message(FATAL_ERROR "n=${n}: re-read output differs from FIFO mode\n"
+                            "--- FIFO ---\n${fifo_result}\n--- re-read ---\n${reread_result}")
+    endif()
+    list(LENGTH fifo_result beats)
+    message(STATUS "n=${n}: re-read output identical to FIFO mode (${beats} beats)")
+endforeach()
+
+# Long row: the same block twice
+math(EXPR half "${LONG_SIZE} / 2")
+make_data(${half} data)
+file(WRITE "${RUN_DIR}/SOLE_test_Data.txt" "${data}${data}")
+math(EXPR mem_words "${LONG_SIZE} / 2 + 512")
+run_sole(${LONG_SIZE} --mem-words ${mem_words})
+extract_output(long_result)
+list(LENGTH long_result beats)
+math(EXPR half_beats "${beats} / 2")
+math(EXPR expected_beats "(${LONG_SIZE} + 3) / 4")
+if(NOT beats EQUAL expected_beats)
+    message(FATAL_ERROR "n=${LONG_SIZE}: ${beats} output beats, expected ${expected_beats}")
+endif()
+list(SUBLIST long_result 0 ${half_beats} first_half)
+list(SUBLIST long_result ${half_beats} ${half_beats} second_half)
+if(NOT first_half STREQUAL second_half)
+    message(FATAL_ERROR "n=${LONG_SIZE}: output halves of a repeated input differ")
+endif()
+message(STATUS "n=${LONG_SIZE}: re-read mode wrote ${beats} beats, both halves identical")
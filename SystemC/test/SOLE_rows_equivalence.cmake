@@ -0,0 +1,139 @@
+# SOLE batched-row equivalence check
+#
+# Runs BIN once as a batched job (ROWS rows of LENGTH elements, REG_ROW_COUNT)
+# and once per row as a single-row job on that row's data, and requires every
+# row of the batched output to match its single-row run. Only the first LENGTH
+# lanes of a row are compared: the padding lanes of the last beat are don't-care.
+# STRIDE (optional) is the source/destination row stride in bytes (0 = packed).
+# ARGS (optional) are passed to every run, e.g. --rvalid-delay=2; with --ring=1
+# every row is its own descriptor of the ring.
+#
+# Usage:
+#   cmake -DNAME=<tag> -DBIN=<SOLE_test> -DWORK_DIR=<dir> [-DARGS=--opt=1]
+#         [-DROWS=6] [-DLENGTH=16] [-DSTRIDE=0] -P SOLE_rows_equivalence.cmake
+
+foreach(var NAME BIN WORK_DIR)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} is not set")
+    endif()
+endforeach()
+if(NOT DEFINED ROWS)
+    set(ROWS 6)
+endif()
+if(NOT DEFINED LENGTH)
+    set(LENGTH 16)
+endif()
+if(NOT DEFINED STRIDE)
+    set(STRIDE 0)
+endif()
+
+# SOLE_test writes its logs to ../test relative to the working directory
+set(RUN_DIR "${WORK_DIR}/${NAME}/run")
+set(LOG_DIR "${WORK_DIR}/${NAME}/test")
+file(MAKE_DIRECTORY "${RUN_DIR}" "${LOG_DIR}")
+
+# Deterministic inputs in [-4.000, 3.999], one list entry per value
+function(make_data n out_var)
+    set(data "")
+    set(seed 12345)
+    foreach(i RANGE 1 ${n})
+        math(EXPR seed "(${seed} * 1103515245 + 12345) % 2147483648")
+        math(EXPR milli "(${seed} / 65536) % 8000 - 4000")
+        if(milli LESS 0)
+            math(EXPR abs "0 - ${milli}")
+            set(sign "-")
+        else()
+            set(abs ${milli})
+            set(sign "")
+        endif()
+        math(EXPR int_part "${abs} / 1000")
+        math(EXPR frac_part "${abs} % 1000 + 1000")
+        string(SUBSTRING "${frac_part}" 1 3 frac_part)
+        list(APPEND data "${sign}${int_part}.${frac_part}")
+    endforeach()
+    set(${out_var} "${data}" PARENT_SCOPE)
+endfunction()
+
+# Run BIN with extra arguments; fails on a non-zero exit or a watchdog timeout
+function(run_sole tag)
+    execute_process(
+        COMMAND ${BIN} ${ARGS} ${ARGN}
+        WORKING_DIRECTORY "${RUN_DIR}"
+        RESULT_VARIABLE rc
+        OUTPUT_VARIABLE out
+        ERROR_VARIABLE  err)
+    if(NOT rc EQUAL 0)
+        message(FATAL_ERROR "${BIN} ${ARGN} (${tag}) exited with ${rc}\n${out}\n${err}")
+    endif()
+    if("${out}${err}" MATCHES "\\[(TIMEOUT|ERROR)\\]")
+        message(FATAL_ERROR "${BIN} ${ARGN} (${tag}) did not complete\n${out}\n${err}")
+    endif()
+endfunction()
+
+# Output data words of the last run, one list entry per AXI beat, without addresses
+function(extract_output out_var)
+    file(READ "${LOG_DIR}/SOLE_test_Result.log" content)
+    string(FIND "${content}" "[5] Output Stored Back" begin)
+    string(FIND "${content}" "[4] Softmax Compute Results" end)
+    if(begin EQUAL -1 OR end EQUAL -1 OR end LESS begin)
+        message(FATAL_ERROR "SOLE_test_Result.log has no output memory dump")
+    endif()
+    math(EXPR len "${end} - ${begin}")
+    string(SUBSTRING "${content}" ${begin} ${len} dump)
+    string(REGEX MATCHALL "0x [0-9a-f ]+" words "${dump}")
+    set(${out_var} "${words}" PARENT_SCOPE)
+endfunction()
+
+# Drops the padding lanes of the last beat. The dump prints lane 3 first, so the
+# valid lanes of a partial beat are the last (LENGTH % 4) hex groups.
+function(mask_row words_var)
+    set(words ${${words_var}})
+    math(EXPR tail "${LENGTH} % 4")
+    if(NOT tail EQUAL 0)
+        list(POP_BACK words last)
+        string(STRIP "${last}" last)
+        string(REPLACE " " ";" lanes "${last}")
+        list(REMOVE_AT lanes 0)
+        math(EXPR drop "4 - ${tail}")
+        list(SUBLIST lanes ${drop} -1 lanes)
+        list(JOIN lanes " " last)
+        list(APPEND words "0x ${last}")
+    endif()
+    set(${words_var} "${words}" PARENT_SCOPE)
+endfunction()
+
+# SOLE_test has SOLE_LANES = 4: one 64-bit word (and dump line) per four elements
+math(EXPR total "${ROWS} * ${LENGTH}")
+math(EXPR row_beats "(${LENGTH} + 3) / 4")
+math(EXPR mem_words "${total} / 2 + ${ROWS} * ${STRIDE} / 4 + 1024")
+make_data(${total} data)
+
+list(JOIN data "\n" text)
+file(WRITE "${RUN_DIR}/SOLE_test_Data.txt" "${text}\n")
+run_sole("batched" --mem-words ${mem_words} --length ${LENGTH} --rows ${ROWS} --row-stride ${STRIDE})
+extract_output(batched)
+list(LENGTH batched beats)
+math(EXPR expected_beats "${ROWS} * ${row_beats}")
+if(NOT beats EQUAL expected_beats)
+    message(FATAL_ERROR "${beats} output beats, expected ${expected_beats}")
+endif()
+
+math(EXPR last_row "${ROWS} - 1")
+foreach(r RANGE 0 ${last_row})
+    math(EXPR first "${r} * ${LENGTH}")
+    list(SUBLIST data ${first} ${LENGTH} row_data)
+    list(JOIN row_data "\n" text)
+    file(WRITE "${RUN_DIR}/SOLE_test_Data.txt" "${text}\n")
+    run_sole("row ${r}" --mem-words ${mem_words} --length ${LENGTH})
+    extract_output(single)
+
+    math(EXPR first "${r} * ${row_beats}")
+    list(SUBLIST batched ${first} ${row_beats} row_result)
+    mask_row(row_result)
+    mask_row(single)
+    if(NOT row_result STREQUAL single)
+        message(FATAL_ERROR "row ${r}: batched output differs from a single-row run\n"
+                            "--- single ---\n${single}\n--- batched ---\n${row_result}")
+    endif()
+endforeach()
+message(STATUS "${ROWS} rows x ${LENGTH}: batched output identical to single-row runs (${beats} beats)")
@@ -0,0 +1,47 @@
+# SOLE parallel sweep check
+#
+# Runs the cases of BATCH once with SOLE_test --batch (one process) and once
+# with sole_sweep over JOBS worker processes, both from WORK_DIR, and requires
+# identical summary CSVs.
+#
+# Usage:
+#   cmake -DREF_BIN=<SOLE_test> -DSWEEP_BIN=<sole_sweep> -DBATCH=<cases.txt> -DWORK_DIR=<dir>
+#         [-DJOBS=3] -P SOLE_sweep_equivalence.cmake
+
+foreach(var REF_BIN SWEEP_BIN BATCH WORK_DIR)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} is not set")
+    endif()
+endforeach()
+if(NOT DEFINED JOBS)
+    set(JOBS 3)
+endif()
+
+set(REF_CSV   "${WORK_DIR}/SOLE_sweep_ref.csv")
+set(SWEEP_CSV "${WORK_DIR}/SOLE_sweep_par.csv")
+file(REMOVE "${REF_CSV}" "${SWEEP_CSV}")
+
+set(REF_CMD   ${REF_BIN} --batch ${BATCH} --csv ${REF_CSV})
+set(SWEEP_CMD ${SWEEP_BIN} -b ${REF_BIN} -i ${BATCH} -o ${SWEEP_CSV} -j ${JOBS})
+foreach(run REF SWEEP)
+    execute_process(
+        COMMAND ${${run}_CMD}
+        WORKING_DIRECTORY "${WORK_DIR}"
+        RESULT_VARIABLE rc
+        OUTPUT_VARIABLE out
+        ERROR_VARIABLE  err)
+    if(NOT rc EQUAL 0)
+        message(FATAL_ERROR "${${run}_BIN} exited with ${rc}\n${out}\n${err}")
+    endif()
+endforeach()
+
+file(READ "${REF_CSV}" ref_csv)
+file(READ "${SWEEP_CSV}" sweep_csv)
+if(NOT ref_csv STREQUAL sweep_csv)
+    message(FATAL_ERROR "sole_sweep (-j ${JOBS}) differs from a single SOLE_test --batch run\n"
+                        "--- SOLE_test ---\n${ref_csv}\n--- sole_sweep ---\n${sweep_csv}")
+endif()
+string(REGEX MATCHALL "\n" lines "${ref_csv}")
+list(LENGTH lines rows)
+math(EXPR rows "${rows} - 1")
+message(STATUS "${rows} cases on ${JOBS} workers: summary identical")
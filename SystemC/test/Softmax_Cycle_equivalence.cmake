@@ -0,0 +1,95 @@
+# Cycle-accurate C++ model check
+#
+# Runs each case on SOLE_test (SystemC) and on softmax_cycle_sim with --axi-log
+# and requires the same per-cycle AXI pin logs. Times are made relative to the
+# first logged cycle, since the two testbenches start the engine at different
+# times; every line after that (pin values and cycle distance) must match.
+#
+# Usage:
+#   cmake -DREF_BIN=<SOLE_test> -DDUT_BIN=<softmax_cycle_sim> -DINPUT=<SOLE_test_Data.txt>
+#         -DWORK_DIR=<dir> -P Softmax_Cycle_equivalence.cmake
+
+foreach(var REF_BIN DUT_BIN INPUT WORK_DIR)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} is not set")
+    endif()
+endforeach()
+
+# Same option names on both sides (SOLE_test --help)
+set(cases
+    "--length 1"
+    "--length 7"
+    "--length 100"
+    "--length 100 --arready-delay 2"
+    "--length 100 --rvalid-delay 2"
+    "--length 100 --wready-delay 3"
+    "--length 64 --arready-delay 1 --rvalid-delay 3 --wready-delay 1"
+    # INCR bursts: AxLEN, WLAST and one B per burst; the output (word 500..524)
+    # crosses the 4 KB boundary at word 512
+    "--length 100 --burst-len 15"
+    "--length 100 --burst-len 3 --rvalid-delay 2 --wready-delay 1"
+    "--length 100 --burst-len 255 --arready-delay 1 --rvalid-delay 3"
+    # Outstanding reads: ARID / RID, out-of-order R bursts through the reorder buffer
+    "--length 100 --read-outstanding 4 --read-latency 8"
+    "--length 100 --read-reorder 3 --read-latency 4 --burst-len 3"
+    "--length 100 --read-reorder 3 --rvalid-delay 1"
+    "--length 100 --read-outstanding 1 --rvalid-delay 2 --arready-delay 1"
+    # Write timeout: both models must raise the error on the same cycle
+    "--length 40 --wready-delay 150 --timeout-cycles 3000")
+
+set(dir "${WORK_DIR}/Softmax_Cycle")
+file(REMOVE_RECURSE "${dir}")
+# SOLE_test writes its default logs to ../test relative to the working directory
+file(MAKE_DIRECTORY "${dir}/run" "${dir}/test")
+
+# Pin log with the time column relative to the first line
+function(normalize log out_var)
+    file(STRINGS "${log}" lines)
+    set(result "")
+    set(t0 "")
+    foreach(line IN LISTS lines)
+        string(REGEX MATCH "^[0-9]+" t "${line}")
+        string(REGEX REPLACE "^[0-9]+" "" rest "${line}")
+        if(t0 STREQUAL "")
+            set(t0 ${t})
+        endif()
+        math(EXPR dt "${t} - ${t0}")
+        string(APPEND result "${dt}${rest}\n")
+    endforeach()
+    set(${out_var} "${result}" PARENT_SCOPE)
+endfunction()
+
+set(index 0)
+foreach(case IN LISTS cases)
+    math(EXPR index "${index} + 1")
+    separate_arguments(args UNIX_COMMAND "${case}")
+
+    execute_process(
+        COMMAND ${REF_BIN} --input ${INPUT} ${args} --axi-log ${dir}/ref_${index}.log
+        WORKING_DIRECTORY "${dir}/run"
+        RESULT_VARIABLE rc
+        OUTPUT_QUIET ERROR_QUIET)
+    if(NOT rc EQUAL 0)
+        message(FATAL_ERROR "SOLE_test ${case} exited with ${rc}")
+    endif()
+    # softmax_cycle_sim exits with 1 when the run ends in an error (timeout case)
+    execute_process(
+        COMMAND ${DUT_BIN} --input ${INPUT} ${args} --axi-log ${dir}/dut_${index}.log
+        WORKING_DIRECTORY "${dir}/run"
+        RESULT_VARIABLE rc
+        OUTPUT_VARIABLE out
+        ERROR_VARIABLE  err)
+    if(NOT rc EQUAL 0 AND NOT rc EQUAL 1)
+        message(FATAL_ERROR "softmax_cycle_sim ${case} exited with ${rc}\n${out}\n${err}")
+    endif()
+
+    normalize("${dir}/ref_${index}.log" ref)
+    normalize("${dir}/dut_${index}.log" dut)
+    if(ref STREQUAL "")
+        message(FATAL_ERROR "SOLE_test ${case} wrote an empty AXI pin log")
+    endif()
+    if(NOT ref STREQUAL dut)
+        message(FATAL_ERROR "AXI pin logs differ for ${case}\n  SystemC: ${dir}/ref_${index}.log\n  cycle:   ${dir}/dut_${index}.log")
+    endif()
+endforeach()
+message(STATUS "cycle model: ${index} cases with identical AXI pin logs")
@@ -0,0 +1,302 @@
+/**
+ * @file softmax_cycle_sim.cpp
+ * @brief Runs one SOLE_test case on the cycle-accurate C++ model (include/Softmax_Cycle.h)
+ *
+ * Same memory layout and wait states as SOLE_test: the FP16 input is loaded at
+ * word 100, the output is written from word 500 of a 2048-word memory, and the
+ * AXI slave is the Axi_Slave_Cycle copy of AxiSlaveMemory. Each run asserts rst
+ * for 10 cycles, holds START until the engine leaves IDLE and stops at the
+ * DONE pulse, an error or the timeout.
+ *
+ * Usage:
+ *   softmax_cycle_sim [--input FILE] [--length N] [--arready-delay N] [--rvalid-delay N]
+ *                     [--wready-delay N] [--burst-len N] [--read-outstanding N]
+ *                     [--read-latency N] [--read-reorder N] [--timeout-cycles N]
+ *                     [--axi-log FILE] [--output FILE] [--repeat N]
+ *
+ *   --burst-len Max AXI burst length - 1 (REG_CONTROL[15:8], 0 = single beat)
+ *   --read-outstanding Max read bursts in flight (REG_CONTROL[23:16], 0 = 64)
+ *   --read-latency / --read-reorder  Slave read latency and reorder window - 1
+ *               (Axi_Slave_Cycle::set_read_model(), same as SOLE_test)
+ *   --axi-log   Per-cycle AXI pin log in the SOLE_test --axi-log format; the time
+ *               column counts clock cycles from the first reset cycle
+ *   --output    One line per element: index, FP16 result (hex), value
+ *   --repeat    Run the case N times back to back (rst between runs) and report
+ *               the simulation speed
+ *
+ * The exit status is 0 if every run ended with the DONE pulse.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../include/Softmax_Cycle.h"
+#include "../test/test_utils.h"
+
+static const int INPUT_START_WORD = 100;
+static const int OUTPUT_START_WORD = 500;
+static const size_t MEM_WORDS = 2048;
+static const int RESET_CYCLES = 10;
+
+/// Flat 64-bit word memory; out-of-range accesses answer SLVERR
+class Word_Memory : public Softmax_Cycle_Memory {
+public:
+    explicit Word_Memory(size_t words) : words(words, 0) {}
+
+    uint8_t read(uint32_t addr, uint64_t& data) override {
+        size_t idx = addr >> 3;
+        if (idx >= words.size()) {
+            data = 0;
+            return 2;
+        }
+        data = words[idx];
+        return 0;
+    }
+
+    uint8_t write(uint32_t addr, uint64_t data, uint8_t strb) override {
+        size_t idx = addr >> 3;
+        if (idx >= words.size()) {
+            return 2;
+        }
+        uint64_t mask = 0;
+        for (int b = 0; b < 8; b++) {
+            if ((strb >> b) & 1) mask |= 0xFFull << (b * 8);
+        }
+        words[idx] = (words[idx] & ~mask) | (data & mask);
+        return 0;
+    }
+
+    std::vector<uint64_t> words;
+};
+
+struct Options {
+    std::string input = "SOLE_test_Data.txt";
+    bool        input_given = false;
+    long        length = 0;
+    int         arready_delay = 0;
+    int         rvalid_delay = 0;
+    int         wready_delay = 0;
+    int         burst_len = 0;
+    int         read_outstanding = 0;
+    int         read_latency = 0;
+    int         read_reorder = 0;
+    long        timeout_cycles = 10000;
+    std::string axi_log;
+    std::string output;
+    long        repeat = 1;
+};
+
+static void usage(const char* prog) {
+    std::fprintf(stderr,
+                 "Usage: %s [--input FILE] [--length N] [--arready-delay N] [--rvalid-delay N]\n"
+                 "          [--wready-delay N] [--burst-len N] [--read-outstanding N]\n"
+                 "          [--read-latency N] [--read-reorder N] [--timeout-cycles N] [--axi-log FILE]\n"
+                 "          [--output FILE] [--repeat N]\n",
+                 prog);
+}
+
+static bool parse_options(int argc, char* argv[], Options& opt) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-h" || arg == "--help") {
+            return false;
+        }
+        if (i + 1 >= argc) {
+            std::fprintf(stderr, "[ERROR] %s needs a value\n", arg.c_str());
+            return false;
+        }
+        const char* value = argv[++i];
+        if (arg == "--input") {
+            opt.input = value;
+            opt.input_given = true;
+        } else if (arg == "--length") {
+            opt.length = std::atol(value);
+        } else if (arg == "--arready-delay") {
+            opt.arready_delay = std::atoi(value);
+        } else if (arg == "--rvalid-delay") {
+            opt.rvalid_delay = std::atoi(value);
+        } else if (arg == "--wready-delay") {
+            opt.wready_delay = std::atoi(value);
+        } else if (arg == "--burst-len") {
+            opt.burst_len = std::atoi(value);
+        } else if (arg == "--read-outstanding") {
+            opt.read_outstanding = std::atoi(value);
+        } else if (arg == "--read-latency") {
+            opt.read_latency = std::atoi(value);
+        } else if (arg == "--read-reorder") {
+            opt.read_reorder = std::atoi(value);
+        } else if (arg == "--timeout-cycles") {
+            opt.timeout_cycles = std::atol(value);
+        } else if (arg == "--axi-log") {
+            opt.axi_log = value;
+        } else if (arg == "--output") {
+            opt.output = value;
+        } else if (arg == "--repeat") {
+            opt.repeat = std::atol(value);
+        } else {
+            std::fprintf(stderr, "[ERROR] Unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+    return opt.repeat > 0 && opt.burst_len >= 0 && opt.burst_len <= 0xFF &&
+           opt.read_outstanding >= 0 && opt.read_outstanding <= 0xFF;
+}
+
+/// One value per line, lines without a number are skipped (as SOLE_test does)
+static bool read_input(Options& opt, std::vector<float>& values) {
+    std::ifstream file(opt.input);
+    if (!file.is_open() && !opt.input_given) {
+        opt.input = "../test/SOLE_test_Data.txt";
+        file.open(opt.input);
+    }
+    if (!file.is_open()) {
+        std::fprintf(stderr, "[ERROR] Failed to open %s\n", opt.input.c_str());
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        std::stringstream ss(line);
+        float v;
+        if (ss >> v) values.push_back(v);
+    }
+    if (opt.length > 0) {
+        if ((size_t)opt.length > values.size()) {
+            std::fprintf(stderr, "[ERROR] %s has %zu values, length=%ld requested\n",
+                         opt.input.c_str(), values.size(), opt.length);
+            return false;
+        }
+        values.resize(opt.length);
+    }
+    if (values.empty()) {
+        std::fprintf(stderr, "[ERROR] No input data found in %s\n", opt.input.c_str());
+        return false;
+    }
+    return true;
+}
+
+static void log_pins(std::FILE* log, long long cycle, const Softmax_Cycle::Axi_Pins& p) {
+    if (!(p.awvalid || p.wvalid || p.bvalid || p.arvalid || p.rvalid)) {
+        return;
+    }
+    std::fprintf(log, "%lld AW %d%d %x %x W %d%d %llx %x %d B %d%d %x AR %d%d %x %x %x R %d%d %llx %x %x\n",
+                 cycle, p.awvalid, p.awready, p.awaddr, p.awlen,
+                 p.wvalid, p.wready, (unsigned long long)p.wdata, p.wstrb, p.wlast,
+                 p.bvalid, p.bready, p.bresp,
+                 p.arvalid, p.arready, p.araddr, p.arlen, p.arid,
+                 p.rvalid, p.rready, (unsigned long long)p.rdata, p.rresp, p.rid);
+}
+
+int main(int argc, char* argv[]) {
+    Options opt;
+    if (!parse_options(argc, argv, opt)) {
+        usage(argv[0]);
+        return 1;
+    }
+    std::vector<float> values;
+    if (!read_input(opt, values)) {
+        return 1;
+    }
+    const size_t num_data = values.size();
+    const size_t num_words = (num_data + 3) / 4;
+    if (OUTPUT_START_WORD + num_words > MEM_WORDS) {
+        std::fprintf(stderr, "[ERROR] %zu elements do not fit into %zu memory words\n", num_data, MEM_WORDS);
+        return 1;
+    }
+
+    std::FILE* axi_log = nullptr;
+    if (!opt.axi_log.empty()) {
+        axi_log = std::fopen(opt.axi_log.c_str(), "w");
+        if (!axi_log) {
+            std::fprintf(stderr, "[ERROR] Failed to create AXI pin log %s\n", opt.axi_log.c_str());
+            return 1;
+        }
+    }
+
+    Word_Memory memory(MEM_WORDS);
+    Axi_Slave_Cycle slave(memory);
+    Softmax_Cycle dut;
+
+    long long cycle = 0;
+    long long total_cycles = 0;
+    long long exec_cycles = 0;
+    long failed = 0;
+    auto clock_edge = [&]() {
+        if (axi_log) log_pins(axi_log, cycle, dut.axi);
+        dut.step(slave);
+        cycle++;
+    };
+
+    auto wall_start = std::chrono::steady_clock::now();
+    for (long run = 0; run < opt.repeat; run++) {
+        // Reset; memory contents and wait states are replaced while in reset
+        dut.rst = true;
+        std::fill(memory.words.begin(), memory.words.end(), 0);
+        std::vector<uint16_t> fp16_input(num_words * 4, 0);
+        for (size_t i = 0; i < num_data; i++) {
+            fp16_input[i] = float_to_fp16(values[i]);
+        }
+        std::memcpy(&memory.words[INPUT_START_WORD], fp16_input.data(), fp16_input.size() * sizeof(uint16_t));
+        slave.set_wait_states(opt.arready_delay, opt.rvalid_delay, opt.wready_delay);
+        slave.set_read_model(opt.read_latency, opt.read_reorder);
+        for (int i = 0; i < RESET_CYCLES; i++) clock_edge();
+        dut.rst = false;
+        clock_edge();
+
+        dut.src_addr_base = INPUT_START_WORD * 8;
+        dut.dst_addr_base = OUTPUT_START_WORD * 8;
+        dut.data_length = num_data;
+        dut.burst_len = (uint8_t)opt.burst_len;
+        dut.read_outstanding = (uint8_t)opt.read_outstanding;
+        dut.start = true;
+
+        long long run_start = cycle;
+        bool done = false;
+        while (cycle - run_start < opt.timeout_cycles) {
+            clock_edge();
+            if (dut.state() != 0) dut.start = false;
+            if (dut.done()) {
+                done = true;
+                break;
+            }
+            if (dut.error()) break;
+        }
+        dut.start = false;
+        exec_cycles = cycle - run_start;
+        if (!done) {
+            failed++;
+            std::fprintf(stderr, "[ERROR] run %ld: %s after %lld cycles, status=0x%x\n", run,
+                         dut.error() ? "error" : "timeout", exec_cycles, dut.status());
+        }
+        // Let the last responses drain before the next reset
+        for (int i = 0; i < 2; i++) clock_edge();
+    }
+    auto wall_end = std::chrono::steady_clock::now();
+    total_cycles = cycle;
+    double seconds = std::chrono::duration<double>(wall_end - wall_start).count();
+
+    if (axi_log) std::fclose(axi_log);
+
+    if (!opt.output.empty()) {
+        std::FILE* out = std::fopen(opt.output.c_str(), "w");
+        if (!out) {
+            std::fprintf(stderr, "[ERROR] Failed to create %s\n", opt.output.c_str());
+            return 1;
+        }
+        const uint16_t* fp16_output = reinterpret_cast<const uint16_t*>(&memory.words[OUTPUT_START_WORD]);
+        for (size_t i = 0; i < num_data; i++) {
+            std::fprintf(out, "%zu,0x%04x,%.9f\n", i, fp16_output[i], fp16_to_float(fp16_output[i]));
+        }
+        std::fclose(out);
+    }
+
+    std::printf("elements=%zu runs=%ld failed=%ld exec_cycles=%lld total_cycles=%lld wall_s=%.6f cycles_per_s=%.0f\n",
+                num_data, opt.repeat, failed, exec_cycles, total_cycles, seconds,
+                seconds > 0 ? total_cycles / seconds : 0.0);
+    return failed ? 1 : 0;
+}
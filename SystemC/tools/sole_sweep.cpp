@@ -0,0 +1,347 @@
+/**
+ * @file sole_sweep.cpp
+ * @brief Parallel driver for SOLE_test batch runs
+ *
+ * Splits the cases of a SOLE_test batch file (one case per line, see
+ * SOLE_test --help) over N worker processes. Every worker runs
+ * "SOLE_test --batch <shard> --csv <shard.csv>" in its own directory, so the
+ * default result/monitor logs ("../test/...") of different workers never
+ * collide. The shard CSVs are merged back in the order of the batch file.
+ *
+ * Usage:
+ *   sole_sweep -b SOLE_test -i cases.txt -o summary.csv [-j jobs] [-w work_dir] [-k] [-- SOLE_test options]
+ *
+ *   -b  SOLE_test executable
+ *   -i  Batch file (the case matrix)
+ *   -o  Merged per-case CSV (same columns as SOLE_test --csv)
+ *   -j  Worker processes (default: number of CPUs)
+ *   -w  Work directory for shard files and worker logs (kept; default: a new
+ *       directory under $TMPDIR, removed unless a worker crashed or -k is given)
+ *   -k  Keep the temporary work directory
+ *
+ * The exit status follows SOLE_test: 0 if every case ran to completion,
+ * 1 if a case timed out or could not run.
+ *
+ * Cases are assigned longest-first to the least loaded worker; the cost of a
+ * case is its element count (length=, else the number of lines of input=,
+ * else the 100 values of SOLE_test_Data.txt). Cases without name= are named
+ * case<k> after their line in the batch file, as SOLE_test does.
+ *
+ * Workers run in their own directory, so input files are resolved here: a
+ * relative input= is made absolute, and cases without one get the
+ * SOLE_test_Data.txt (or ../test/SOLE_test_Data.txt) seen from the current
+ * directory. Paths in the SOLE_test options after "--" must be absolute.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+struct SweepCase {
+    std::string name;
+    std::string line;    ///< Batch line with an explicit name=
+    size_t      cost = 0;
+};
+
+struct Worker {
+    std::vector<size_t> cases;   ///< Indices into the case list
+    size_t   cost = 0;
+    fs::path dir;
+    pid_t    pid = -1;
+    int      status = 0;
+};
+
+static void usage(const char* prog) {
+    std::fprintf(stderr, "Usage: %s -b SOLE_test -i cases.txt -o summary.csv [-j jobs] [-w work_dir] [-k] [-- SOLE_test options]\n", prog);
+}
+
+/// Value of key=... in a batch line ("" if absent); values may be double-quoted
+static std::string case_value(const std::string& line, const std::string& key) {
+    size_t pos = 0;
+    while (pos < line.size()) {
+        pos = line.find_first_not_of(" \t", pos);
+        if (pos == std::string::npos) break;
+        size_t eq = line.find('=', pos);
+        if (eq == std::string::npos) break;
+        std::string k = line.substr(pos, eq - pos);
+        std::string value;
+        pos = eq + 1;
+        if (pos < line.size() && line[pos] == '"') {
+            size_t close = line.find('"', pos + 1);
+            if (close == std::string::npos) break;
+            value = line.substr(pos + 1, close - pos - 1);
+            pos = close + 1;
+        } else {
+            size_t end = line.find_first_of(" \t", pos);
+            value = line.substr(pos, end == std::string::npos ? std::string::npos : end - pos);
+            pos = (end == std::string::npos) ? line.size() : end;
+        }
+        if (k == key) return value;
+    }
+    return "";
+}
+
+static size_t case_cost(const std::string& line, const std::string& input) {
+    std::string length = case_value(line, "length");
+    if (!length.empty() && std::atol(length.c_str()) > 0) {
+        return (size_t)std::atol(length.c_str());
+    }
+    if (input.empty()) {
+        return 100;
+    }
+    std::ifstream file(input);
+    size_t lines = 0;
+    std::string s;
+    while (std::getline(file, s)) lines++;
+    return std::max<size_t>(lines, 1);
+}
+
+/// Absolute input file of a case; default_input unless the line has input=
+static std::string case_input(const std::string& line, const std::string& default_input) {
+    std::string input = case_value(line, "input");
+    if (input.empty()) {
+        return default_input;
+    }
+    return fs::absolute(input).lexically_normal().string();
+}
+
+static bool load_cases(const char* path, const std::string& default_input, std::vector<SweepCase>& cases) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        std::fprintf(stderr, "[ERROR] Cannot open batch file %s\n", path);
+        return false;
+    }
+    std::map<std::string, int> seen;
+    std::string line;
+    while (std::getline(file, line)) {
+        line = line.substr(0, line.find('#'));
+        if (line.find_first_not_of(" \t\r\n") == std::string::npos) continue;
+        line.erase(line.find_last_not_of(" \t\r\n") + 1);
+
+        SweepCase c;
+        c.name = case_value(line, "name");
+        c.line = line;
+        if (c.name.empty()) {
+            c.name = "case" + std::to_string(cases.size() + 1);
+            c.line = "name=" + c.name + " " + line;
+        }
+        if (seen[c.name]++) {
+            std::fprintf(stderr, "[ERROR] Duplicate case name '%s' in %s\n", c.name.c_str(), path);
+            return false;
+        }
+        // A later key overrides an earlier one in SOLE_test batch lines
+        std::string input = case_input(line, default_input);
+        if (!input.empty()) {
+            c.line += " input=\"" + input + "\"";
+        }
+        c.cost = case_cost(line, input);
+        cases.push_back(c);
+    }
+    if (cases.empty()) {
+        std::fprintf(stderr, "[ERROR] Batch file %s has no cases\n", path);
+        return false;
+    }
+    return true;
+}
+
+/// fork + exec SOLE_test in the worker directory, stdout/stderr to worker.log
+static pid_t start_worker(const Worker& w, const std::string& bin, const std::vector<std::string>& extra) {
+    std::vector<std::string> args = {bin, "--batch", (w.dir / "batch.txt").string(), "--csv", (w.dir / "result.csv").string()};
+    args.insert(args.end(), extra.begin(), extra.end());
+
+    pid_t pid = fork();
+    if (pid != 0) {
+        return pid;
+    }
+    int fd = open((w.dir / "worker.log").c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd >= 0) {
+        dup2(fd, STDOUT_FILENO);
+        dup2(fd, STDERR_FILENO);
+        close(fd);
+    }
+    if (chdir((w.dir / "run").c_str()) != 0) {
+        std::perror("chdir");
+        _exit(127);
+    }
+    std::vector<char*> argv;
+    for (std::string& a : args) argv.push_back(const_cast<char*>(a.c_str()));
+    argv.push_back(nullptr);
+    execv(argv[0], argv.data());
+    std::perror("execv");
+    _exit(127);
+}
+
+int main(int argc, char** argv) {
+    const char* bin = nullptr;
+    const char* batch = nullptr;
+    const char* output = nullptr;
+    const char* work = nullptr;
+    unsigned jobs = std::max(1u, std::thread::hardware_concurrency());
+    bool keep = false;
+    std::vector<std::string> extra;
+
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--") == 0) {
+            extra.assign(argv + i + 1, argv + argc);
+            break;
+        } else if (std::strcmp(argv[i], "-k") == 0) {
+            keep = true;
+        } else if (i + 1 < argc && std::strcmp(argv[i], "-b") == 0) {
+            bin = argv[++i];
+        } else if (i + 1 < argc && std::strcmp(argv[i], "-i") == 0) {
+            batch = argv[++i];
+        } else if (i + 1 < argc && std::strcmp(argv[i], "-o") == 0) {
+            output = argv[++i];
+        } else if (i + 1 < argc && std::strcmp(argv[i], "-w") == 0) {
+            work = argv[++i];
+        } else if (i + 1 < argc && std::strcmp(argv[i], "-j") == 0) {
+            jobs = (unsigned)std::atoi(argv[++i]);
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (!bin || !batch || !output || jobs == 0) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    // Default input as SOLE_test would find it from here, unless the options set one
+    std::string default_input;
+    bool input_option = std::any_of(extra.begin(), extra.end(),
+                                    [](const std::string& a) { return a.compare(0, 7, "--input") == 0; });
+    if (!input_option) {
+        for (const char* candidate : {"SOLE_test_Data.txt", "../test/SOLE_test_Data.txt"}) {
+            if (fs::exists(candidate)) {
+                default_input = fs::absolute(candidate).lexically_normal().string();
+                break;
+            }
+        }
+    }
+
+    std::vector<SweepCase> cases;
+    if (!load_cases(batch, default_input, cases)) {
+        return 1;
+    }
+    std::string bin_path = fs::absolute(bin).string();
+
+    fs::path work_dir;
+    std::error_code ec;
+    if (work) {
+        work_dir = fs::absolute(work);
+        fs::create_directories(work_dir, ec);
+    } else {
+        std::string tmpl = (fs::temp_directory_path() / "sole_sweep.XXXXXX").string();
+        if (mkdtemp(&tmpl[0]) == nullptr) {
+            std::perror("mkdtemp");
+            return 1;
+        }
+        work_dir = tmpl;
+    }
+
+    // Longest case first, each to the least loaded worker
+    std::vector<Worker> workers(std::min<size_t>(jobs, cases.size()));
+    std::vector<size_t> order(cases.size());
+    for (size_t i = 0; i < order.size(); i++) order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return cases[a].cost > cases[b].cost; });
+    for (size_t idx : order) {
+        Worker& w = *std::min_element(workers.begin(), workers.end(),
+                                      [](const Worker& a, const Worker& b) { return a.cost < b.cost; });
+        w.cases.push_back(idx);
+        w.cost += cases[idx].cost;
+    }
+
+    for (size_t k = 0; k < workers.size(); k++) {
+        Worker& w = workers[k];
+        std::sort(w.cases.begin(), w.cases.end());
+        w.dir = work_dir / ("worker" + std::to_string(k));
+        fs::create_directories(w.dir / "run", ec);
+        fs::create_directories(w.dir / "test", ec);
+        std::ofstream shard(w.dir / "batch.txt");
+        for (size_t idx : w.cases) {
+            shard << cases[idx].line << "\n";
+        }
+        shard.close();
+        w.pid = start_worker(w, bin_path, extra);
+        if (w.pid < 0) {
+            std::perror("fork");
+            return 1;
+        }
+    }
+    std::printf("[SWEEP] %zu cases on %zu workers, work dir %s\n", cases.size(), workers.size(), work_dir.c_str());
+    std::fflush(stdout);
+
+    // SOLE_test exits with 1 when a case timed out; anything else is a crash
+    bool workers_ok = true;
+    bool crashed = false;
+    for (Worker& w : workers) {
+        waitpid(w.pid, &w.status, 0);
+        int code = WIFEXITED(w.status) ? WEXITSTATUS(w.status) : -1;
+        if (code != 0) {
+            workers_ok = false;
+        }
+        if (code != 0 && code != 1) {
+            crashed = true;
+            std::fprintf(stderr, "[WARN] %s exited with status %d, see %s\n", w.dir.filename().c_str(),
+                         code, (w.dir / "worker.log").c_str());
+        }
+    }
+
+    // Merge in batch-file order; a case missing from its shard CSV is reported as not run
+    std::string header;
+    std::map<std::string, std::string> rows;
+    for (const Worker& w : workers) {
+        std::ifstream csv(w.dir / "result.csv");
+        std::string line;
+        if (std::getline(csv, line)) header = line;
+        while (std::getline(csv, line)) {
+            rows[line.substr(0, line.find(','))] = line;
+        }
+    }
+    if (header.empty()) {
+        std::fprintf(stderr, "[ERROR] No worker produced a summary, work dir kept: %s\n", work_dir.c_str());
+        return 1;
+    }
+
+    std::ofstream out(output);
+    if (!out.is_open()) {
+        std::fprintf(stderr, "[ERROR] Cannot create %s\n", output);
+        return 1;
+    }
+    size_t columns = std::count(header.begin(), header.end(), ',');
+    size_t missing = 0;
+    out << header << "\n";
+    for (const SweepCase& c : cases) {
+        auto it = rows.find(c.name);
+        if (it != rows.end()) {
+            out << it->second << "\n";
+            continue;
+        }
+        missing++;
+        out << c.name;
+        for (size_t i = 0; i < columns; i++) out << ",NA";
+        out << "\n";
+    }
+    out.close();
+
+    if (missing) {
+        std::fprintf(stderr, "[ERROR] %zu cases did not run\n", missing);
+    }
+    if (!work && !keep && !crashed && !missing) {
+        fs::remove_all(work_dir, ec);
+    }
+    std::printf("[SWEEP] %zu/%zu cases merged into %s\n", cases.size() - missing, cases.size(), output);
+    return (workers_ok && !missing) ? 0 : 1;
+}
@@ -0,0 +1,153 @@
+/**
+ * @file trace_decode.cpp
+ * @brief Offline decoder for SOLE binary trace files (see include/Trace.hpp)
+ *
+ * Usage:
+ *   trace_decode [-c AXI,FIFO,STATE,PIPELINE] [-l level] [-e EVENT_NAME] [-s] <trace.bin>
+ *
+ *   -c  Only show the listed categories (default: all)
+ *   -l  Only show events at or below this level (1=INFO, 2=DEBUG, 3=VERBOSE)
+ *   -e  Only show events whose name contains EVENT_NAME
+ *   -s  Print per-event record counts instead of the records
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "../include/Trace.hpp"
+
+using namespace sole::trace;
+
+static const char* category_name(uint8_t category) {
+    switch (category) {
+        case CAT_AXI:      return "AXI";
+        case CAT_FIFO:     return "FIFO";
+        case CAT_STATE:    return "STATE";
+        case CAT_PIPELINE: return "PIPELINE";
+        default:           return "?";
+    }
+}
+
+static uint8_t parse_categories(const char* list) {
+    uint8_t mask = 0;
+    std::string s(list);
+    size_t pos = 0;
+    while (pos <= s.size()) {
+        size_t end = s.find(',', pos);
+        if (end == std::string::npos) end = s.size();
+        std::string item = s.substr(pos, end - pos);
+        if (item == "AXI")           mask |= CAT_AXI;
+        else if (item == "FIFO")     mask |= CAT_FIFO;
+        else if (item == "STATE")    mask |= CAT_STATE;
+        else if (item == "PIPELINE") mask |= CAT_PIPELINE;
+        else if (!item.empty()) {
+            std::fprintf(stderr, "[ERROR] Unknown category '%s'\n", item.c_str());
+            std::exit(2);
+        }
+        pos = end + 1;
+    }
+    return mask;
+}
+
+static void usage(const char* prog) {
+    std::fprintf(stderr, "Usage: %s [-c AXI,FIFO,STATE,PIPELINE] [-l level] [-e EVENT_NAME] [-s] <trace.bin>\n", prog);
+}
+
+int main(int argc, char** argv) {
+    uint8_t category_mask = 0xFF;
+    int max_level = LVL_VERBOSE;
+    const char* event_filter = nullptr;
+    bool summary = false;
+    const char* path = nullptr;
+
+    for (int i = 1; i < argc; i++) {
+        if (!std::strcmp(argv[i], "-c") && i + 1 < argc) {
+            category_mask = parse_categories(argv[++i]);
+        } else if (!std::strcmp(argv[i], "-l") && i + 1 < argc) {
+            max_level = std::atoi(argv[++i]);
+        } else if (!std::strcmp(argv[i], "-e") && i + 1 < argc) {
+            event_filter = argv[++i];
+        } else if (!std::strcmp(argv[i], "-s")) {
+            summary = true;
+        } else if (argv[i][0] != '-' && !path) {
+            path = argv[i];
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (!path) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    std::FILE* f = std::fopen(path, "rb");
+    if (!f) {
+        std::fprintf(stderr, "[ERROR] Failed to open %s\n", path);
+        return 1;
+    }
+
+    FileHeader header{};
+    if (std::fread(&header, sizeof(header), 1, f) != 1 ||
+        std::memcmp(header.magic, kFileMagic, sizeof(kFileMagic)) != 0) {
+        std::fprintf(stderr, "[ERROR] %s is not a SOLE trace file\n", path);
+        std::fclose(f);
+        return 1;
+    }
+    if (header.version != kFileVersion || header.record_size != sizeof(Record)) {
+        std::fprintf(stderr, "[ERROR] Unsupported trace version %u (record size %u)\n",
+                     header.version, header.record_size);
+        std::fclose(f);
+        return 1;
+    }
+
+    std::vector<uint64_t> counts(EV_COUNT, 0);
+    uint64_t total = 0;
+    uint32_t expected_seq = 0;
+    uint64_t seq_gaps = 0;
+    Record r;
+    while (std::fread(&r, sizeof(r), 1, f) == 1) {
+        if (r.seq != expected_seq) seq_gaps++;
+        expected_seq = r.seq + 1;
+        total++;
+
+        if (r.event >= EV_COUNT) {
+            std::fprintf(stderr, "[WARN] Unknown event id %u at record %llu\n",
+                         r.event, (unsigned long long)(total - 1));
+            continue;
+        }
+        const EventInfo& info = kEvents[r.event];
+        if (!(r.category & category_mask) || r.level > max_level) continue;
+        if (event_filter && !std::strstr(info.name, event_filter)) continue;
+
+        counts[r.event]++;
+        if (summary) continue;
+
+        char text[256];
+        std::snprintf(text, sizeof(text), info.format,
+                      (unsigned long long)r.arg[0], (unsigned long long)r.arg[1],
+                      (unsigned long long)r.arg[2], (unsigned long long)r.arg[3]);
+        std::printf("%12.3f ns [%-8s] %-18s %s\n", r.time / 1000.0,
+                    category_name(r.category), info.name, text);
+    }
+    std::fclose(f);
+
+    if (summary) {
+        for (int ev = 0; ev < EV_COUNT; ev++) {
+            if (counts[ev]) {
+                std::printf("%-18s [%-8s] %llu\n", kEvents[ev].name,
+                            category_name(kEvents[ev].category), (unsigned long long)counts[ev]);
+            }
+        }
+    }
+    if (header.record_count != 0 && header.record_count != total) {
+        std::fprintf(stderr, "[WARN] Header records %llu, file holds %llu\n",
+                     (unsigned long long)header.record_count, (unsigned long long)total);
+    }
+    if (seq_gaps) {
+        std::fprintf(stderr, "[WARN] %llu sequence gaps detected\n", (unsigned long long)seq_gaps);
+    }
+    return 0;
+}